@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+// Coroutine Façade Resumption Benchmark
+//------------------------------------------------------------------------------
+//
+// This benchmark measures the per-message cost of delivering data-plane
+// messages through coro::Scheduler (one co_await per message) compared with
+// the raw DataPlane::drain<T>() loop it replaces.
+//
+// Methodology:
+//
+//   • Single thread, consumer-only timing: each round pushes BATCH trade
+//     messages round-robin over S symbols into the data plane (untimed), then
+//     delivers them (timed)
+//   • raw  : drain<trade::Response>(fn), fn reads the trade id
+//   • coro : S tasks, one per symbol, looping on next<trade::Response>(symbol)
+//            and reading the trade id; delivered by Scheduler::poll()
+//   • The session is a stub (no transport, no parsing): only the delivery
+//     path is measured
+//
+// Interpretation guideline:
+//
+//   • The difference is the resumption overhead: waiter lookup by symbol,
+//     message hand-off into the awaiter and one resume/suspend pair
+//   • Waiter lookup is a linear scan, so the overhead grows with the number
+//     of tasks awaiting the same message type
+//
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "wirekrak/core/protocol/coro/scheduler.hpp"
+#include "wirekrak/core/protocol/data/data_plane.hpp"
+#include "wirekrak/core/protocol/subscription/controller.hpp"
+#include "wirekrak/core/protocol/kraken/subscriptions/model.hpp"
+#include "wirekrak/core/protocol/kraken/schema/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/conflation.hpp"
+#include "wirekrak/core/policy/protocol/progress.hpp"
+#include "lcr/system/thread_affinity.hpp"
+
+using namespace std::chrono;
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol;
+
+using TradeResponse = kraken::schema::trade::Response;
+
+constexpr size_t   BATCH       = 512;
+constexpr uint64_t TOTAL_MSGS  = 1ull << 22;
+constexpr size_t   MAX_SYMBOLS = 16;
+
+// ------------------------------------------------------------
+// Stub session (delivery path only)
+// ------------------------------------------------------------
+struct BenchSession {
+    using MessageList = meta::type_list<TradeResponse>;
+
+    data::DataPlane<MessageList, meta::type_list<>> plane;
+    subscription::Controller<policy::protocol::DefaultProgress, kraken::SubscriptionModel::types> controller;
+
+    inline std::uint64_t poll() noexcept {
+        return 0;
+    }
+
+    inline auto& data_plane() noexcept {
+        return plane;
+    }
+
+    inline const auto& subscription_controller() const noexcept {
+        return controller;
+    }
+};
+
+using Sched = coro::Scheduler<BenchSession, MAX_SYMBOLS, 512>;
+
+static std::vector<Symbol> make_symbols(size_t n) {
+    std::vector<Symbol> symbols;
+    for (size_t i = 0; i < n; ++i) {
+        symbols.emplace_back(("SYM" + std::to_string(i) + "/USD").c_str());
+    }
+    return symbols;
+}
+
+static void fill(BenchSession& s, const std::vector<Symbol>& symbols, uint64_t& next_id) {
+    for (size_t i = 0; i < BATCH; ++i) {
+        TradeResponse msg;
+        kraken::schema::trade::Trade t{};
+        t.trade_id = next_id++;
+        t.symbol = symbols[i % symbols.size()];
+        msg.trades.push_back(t);
+        (void)s.plane.push(std::move(msg));
+    }
+}
+
+// ------------------------------------------------------------
+// Raw drain
+// ------------------------------------------------------------
+static double run_raw(size_t n_symbols) {
+    auto session = std::make_unique<BenchSession>();
+    const auto symbols = make_symbols(n_symbols);
+
+    uint64_t next_id = 0, checksum = 0, delivered = 0;
+    nanoseconds elapsed{0};
+
+    while (delivered < TOTAL_MSGS) {
+        fill(*session, symbols, next_id);
+        auto t0 = steady_clock::now();
+        delivered += session->plane.drain<TradeResponse>([&](const TradeResponse& msg) {
+            checksum += msg.trades.front().trade_id;
+        });
+        elapsed += duration_cast<nanoseconds>(steady_clock::now() - t0);
+    }
+
+    if (checksum == 0) std::cout << "";     // keep the work observable
+    return static_cast<double>(elapsed.count()) / static_cast<double>(delivered);
+}
+
+// ------------------------------------------------------------
+// Coroutine delivery
+// ------------------------------------------------------------
+WK_CORO_TASKS_BEGIN
+static coro::Task consume(Sched& sched, Symbol symbol, uint64_t& checksum, uint64_t& delivered) {
+    for (;;) {
+        const auto msg = co_await sched.next<TradeResponse>(symbol);
+        checksum += msg.trades.front().trade_id;
+        ++delivered;
+    }
+}
+WK_CORO_TASKS_END
+
+static double run_coro(size_t n_symbols) {
+    auto session = std::make_unique<BenchSession>();
+    auto sched = std::make_unique<Sched>(*session);
+    const auto symbols = make_symbols(n_symbols);
+
+    uint64_t next_id = 0, checksum = 0, delivered = 0;
+    for (const auto& symbol : symbols) {
+        if (!sched->spawn(consume(*sched, symbol, checksum, delivered))) {
+            std::cerr << "spawn failed\n";
+            return 0.0;
+        }
+    }
+
+    nanoseconds elapsed{0};
+    while (delivered < TOTAL_MSGS) {
+        fill(*session, symbols, next_id);
+        auto t0 = steady_clock::now();
+        (void)sched->poll();
+        elapsed += duration_cast<nanoseconds>(steady_clock::now() - t0);
+    }
+
+    if (checksum == 0) std::cout << "";
+    return static_cast<double>(elapsed.count()) / static_cast<double>(delivered);
+}
+
+// ------------------------------------------------------------
+// Main
+// ------------------------------------------------------------
+int main() {
+    lcr::system::pin_thread(0);
+
+    std::cout << "Running coroutine resumption benchmark ("
+              << TOTAL_MSGS << " messages per run, batch " << BATCH << ")...\n\n";
+
+    std::cout << "Symbols |  raw drain (ns/msg) | co_await (ns/msg) | overhead (ns/msg)\n";
+    std::cout << "--------+---------------------+-------------------+------------------\n";
+
+    for (size_t n = 1; n <= MAX_SYMBOLS; n *= 2) {
+        const double raw = run_raw(n);
+        const double co  = run_coro(n);
+
+        std::cout << std::setw(7) << n << " | "
+                  << std::setw(19) << std::fixed << std::setprecision(2) << raw << " | "
+                  << std::setw(17) << co << " | "
+                  << std::setw(16) << (co - raw) << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,180 @@
+//------------------------------------------------------------------------------
+// Kraken Book Analytics Benchmark (per-update strategy cost)
+//------------------------------------------------------------------------------
+//
+// This benchmark measures the cost of keeping book-derived metrics current
+// after every book update (microprice, top-10 imbalance, cumulative depth
+// within 10 / 50 / 100 bps of the best price) on depth-1000 books:
+//
+//   • Apply only    : BookStore without analytics, no metrics (baseline)
+//   • Recompute     : BookStore without analytics, the strategy recomputes
+//                     every metric from the full ladders after each update
+//   • Incremental   : BookStore with DefaultBookAnalytics, the strategy reads
+//                     the maintained metrics in O(1)
+//
+// Methodology:
+//
+//   • Single thread, no parsing: one snapshot per symbol, then a fixed
+//     random sequence of single-level updates (mostly below the top, as on
+//     deep books, some at the best), generated once (untimed)
+//   • Each update is applied to the store and followed by the metric reads
+//
+// Interpretation guideline:
+//
+//   • Recompute − Apply only is the strategy's O(depth) work per update
+//   • Incremental − Apply only is the bookkeeping moved into the store
+//
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "wirekrak/core/feed/book_store.hpp"
+#include "lcr/system/thread_affinity.hpp"
+
+using namespace std::chrono;
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol::kraken;
+
+constexpr std::size_t DEPTH   = 1000;
+constexpr std::size_t SYMBOLS = 16;
+constexpr std::size_t UPDATES = 400'000;
+
+using Level = schema::book::Level;
+
+// ------------------------------------------------------------
+// Messages
+// ------------------------------------------------------------
+static std::string symbol_name(std::size_t i) {
+    char name[16];
+    std::snprintf(name, sizeof(name), "A%03zu/USD", i);
+    return name;
+}
+
+static schema::book::Response snapshot(std::size_t symbol) {
+    schema::book::Response r{};
+    r.type = PayloadType::Snapshot;
+    r.book.symbol = Symbol{symbol_name(symbol)};
+    const double mid = 1000.0 + static_cast<double>(symbol);
+    for (std::size_t i = 0; i < DEPTH; ++i) {
+        r.book.bids.push_back({ mid - 0.05 - 0.05 * static_cast<double>(i), 0.25 * static_cast<double>(1 + i % 5) });
+        r.book.asks.push_back({ mid + 0.05 + 0.05 * static_cast<double>(i), 0.25 * static_cast<double>(1 + i % 7) });
+    }
+    return r;
+}
+
+static std::vector<schema::book::Response> updates() {
+    std::vector<schema::book::Response> out;
+    std::uint64_t state = 42;
+    auto next = [&state] {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    };
+    for (std::size_t u = 0; u < UPDATES; ++u) {
+        const std::size_t symbol = next() % SYMBOLS;
+        const double mid = 1000.0 + static_cast<double>(symbol);
+        // 1 in 16 at the best, the rest spread over the first 200 levels
+        const std::size_t level = (next() % 16 == 0) ? 0 : 1 + next() % 200;
+        const double qty = (next() % 4 == 0) ? 0.0 : 0.25 * static_cast<double>(1 + next() % 8);
+        const Level lvl{ (next() % 2 ? mid - 0.05 : mid + 0.05) + (next() % 2 ? -1.0 : 1.0) * 0.05 * static_cast<double>(level), qty };
+
+        schema::book::Response r{};
+        r.type = PayloadType::Update;
+        r.book.symbol = Symbol{symbol_name(symbol)};
+        if (lvl.price < mid) {
+            r.book.bids.push_back(lvl);
+        }
+        else {
+            r.book.asks.push_back(lvl);
+        }
+        out.push_back(std::move(r));
+    }
+    return out;
+}
+
+// ------------------------------------------------------------
+// Strategy-side recompute (what consumers do without analytics)
+// ------------------------------------------------------------
+template<class Ladder>
+static double recompute_side(const Ladder& ladder, double& top, double (&bands)[3]) {
+    static constexpr double BPS[3] = { 10.0, 50.0, 100.0 };
+    top = 0.0;
+    bands[0] = bands[1] = bands[2] = 0.0;
+    if (ladder.empty()) {
+        return 0.0;
+    }
+    const double best = ladder.best().price;
+    for (std::size_t i = 0; i < ladder.size(); ++i) {
+        const auto& l = ladder[i];
+        if (i < 10) {
+            top += l.qty;
+        }
+        const double distance = std::abs(l.price - best);
+        for (int b = 0; b < 3; ++b) {
+            if (distance <= best * BPS[b] * 1e-4) {
+                bands[b] += l.qty;
+            }
+        }
+    }
+    return best;
+}
+
+// ------------------------------------------------------------
+// Timing
+// ------------------------------------------------------------
+enum class Mode { ApplyOnly, Recompute, Incremental };
+
+template<class Store, Mode M>
+static void run(const char* name, const std::vector<schema::book::Response>& messages) {
+    static Store store;
+    for (std::size_t i = 0; i < SYMBOLS; ++i) {
+        (void)store.apply(snapshot(i));
+    }
+
+    double sink = 0.0;
+    const auto t0 = steady_clock::now();
+    for (const auto& msg : messages) {
+        (void)store.apply(msg);
+        const auto* book = store.find(msg.book.symbol.view());
+        if constexpr (M == Mode::ApplyOnly) {
+            sink += book->bids.size();
+        }
+        else if constexpr (M == Mode::Recompute) {
+            double bid_top, ask_top, bid_bands[3], ask_bands[3];
+            (void)recompute_side(book->bids, bid_top, bid_bands);
+            (void)recompute_side(book->asks, ask_top, ask_bands);
+            sink += book->microprice() + (bid_top - ask_top) / (bid_top + ask_top)
+                  + bid_bands[0] + bid_bands[1] + bid_bands[2] + ask_bands[0] + ask_bands[1] + ask_bands[2];
+        }
+        else {
+            sink += book->microprice() + book->imbalance()
+                  + book->bid_depth(0) + book->bid_depth(1) + book->bid_depth(2)
+                  + book->ask_depth(0) + book->ask_depth(1) + book->ask_depth(2);
+        }
+    }
+    const auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - t0).count();
+    std::cout << "  " << std::left << std::setw(14) << name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << static_cast<double>(elapsed) / static_cast<double>(messages.size()) << " ns/update"
+              << "   (checksum " << std::setprecision(3) << sink << ")\n";
+}
+
+int main() {
+    lcr::system::pin_thread(0);
+
+    const auto messages = updates();
+
+    std::cout << "\n=== Book analytics (" << SYMBOLS << " symbols, depth " << DEPTH << ", "
+              << UPDATES << " updates) ===\n";
+    run<feed::BookStore<DEPTH, SYMBOLS, feed::NoBookAnalytics>, Mode::ApplyOnly>("apply only", messages);
+    run<feed::BookStore<DEPTH, SYMBOLS, feed::NoBookAnalytics>, Mode::Recompute>("recompute", messages);
+    run<feed::BookStore<DEPTH, SYMBOLS, feed::DefaultBookAnalytics>, Mode::Incremental>("incremental", messages);
+    std::cout << '\n';
+    return 0;
+}
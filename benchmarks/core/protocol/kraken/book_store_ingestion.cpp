@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+// Kraken Book Store Ingestion Benchmark (time to full book)
+//------------------------------------------------------------------------------
+//
+// This benchmark measures the time from a (re)subscribe to every book being
+// fully loaded, for depth-1000 snapshots, through two ingestion paths:
+//
+//   • Response path  : Router → schema::book::Response (level vectors) →
+//                      data plane → consumer → BookStore::apply()
+//   • Streaming path : Router with book_sink::Into<BookStore> → levels parsed
+//                      straight into the store staging buffer and bulk-loaded,
+//                      only a SnapshotApplied event reaches the data plane
+//
+// Methodology:
+//
+//   • Single thread, no transport: N symbols × one depth-1000 snapshot frame
+//     each, generated once (untimed)
+//   • Each round calls BookStore::begin_epoch() and expect_book() per symbol
+//     (as a reconnect followed by the subscription replay does), routes all
+//     snapshots, and reads BookStore::time_to_full_book_ns()
+//   • JSON tokenization (simdjson) is included: it is paid on both paths
+//
+// Interpretation guideline:
+//
+//   • The difference is the cost of materializing, moving and re-reading
+//     2×1000 levels per snapshot outside the store
+//   • Results are reported as median / worst round and per snapshot
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "wirekrak/core/feed/book_store.hpp"
+#include "wirekrak/core/protocol/kraken/parser/router.hpp"
+#include "lcr/system/thread_affinity.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol;
+using namespace wirekrak::core::protocol::kraken;
+
+constexpr std::size_t DEPTH   = 1000;
+constexpr std::size_t SYMBOLS = 64;
+constexpr std::size_t ROUNDS  = 50;
+
+using Store = feed::BookStore<DEPTH, SYMBOLS>;
+
+// ------------------------------------------------------------
+// Messages
+// ------------------------------------------------------------
+static std::string levels(std::size_t n, double base, double step) {
+    std::string json = "[";
+    for (std::size_t i = 0; i < n; ++i) {
+        char buf[96];
+        std::snprintf(buf, sizeof(buf), R"(%s{"price":%.1f,"qty":%.8f})", i ? "," : "",
+            base + step * static_cast<double>(i), 0.25 * static_cast<double>(1 + i % 5));
+        json += buf;
+    }
+    return json + "]";
+}
+
+static std::string symbol_name_of(std::size_t symbol) {
+    char name[16];
+    std::snprintf(name, sizeof(name), "S%03zu/USD", symbol);
+    return name;
+}
+
+static std::string snapshot_message(std::size_t symbol) {
+    const std::string name = symbol_name_of(symbol);
+    const double mid = 100.0 + static_cast<double>(symbol);
+    return std::string(R"({"channel":"book","type":"snapshot","data":[{"symbol":")") + name +
+           R"(","bids":)" + levels(DEPTH, mid - 0.1, -0.1) +
+           R"(,"asks":)" + levels(DEPTH, mid + 0.1, 0.1) +
+           R"(,"checksum":3310070434,"timestamp":"2025-01-02T03:04:05.123456Z"}]})";
+}
+
+// ------------------------------------------------------------
+// Contexts
+// ------------------------------------------------------------
+
+// Response path: the consumer applies each Response to its own store
+struct ResponseContext {
+    Store* store;
+    std::vector<schema::book::Response> plane;   // stands in for the data plane
+
+    bool push(schema::book::Response&& r) noexcept {
+        plane.push_back(std::move(r));
+        (void)store->apply(plane.back());
+        plane.pop_back();
+        return true;
+    }
+    bool push(schema::trade::Response&&) noexcept { return true; }
+    bool push(schema::rejection::Notice&&) noexcept { return true; }
+    void set(schema::system::Pong&&) noexcept {}
+    void set(schema::status::Update&&) noexcept {}
+    template<class Request> void on_subscribe_ack(ctrl::req_id_t, Symbol, bool) noexcept {}
+    template<class Request> void on_unsubscribe_ack(ctrl::req_id_t, Symbol, bool) noexcept {}
+    void on_rejection(ctrl::req_id_t, Symbol) noexcept {}
+    void on_request_rejected(ctrl::req_id_t) noexcept {}
+};
+
+// Streaming path: only SnapshotApplied events reach the consumer
+struct StreamingContext : ResponseContext {
+    std::uint64_t applied = 0;
+
+    using ResponseContext::push;
+    bool push(schema::book::SnapshotApplied&&) noexcept { ++applied; return true; }
+    bool push(schema::book::UpdateApplied&&) noexcept { return true; }
+};
+
+// ------------------------------------------------------------
+// Timing
+// ------------------------------------------------------------
+template<class RouterT, class Context>
+static void report(const char* name, RouterT& router, Context& ctx, Store& store,
+                   const std::vector<std::string>& frames, const std::vector<SymbolId>& ids) {
+    Method method{};
+    Channel channel{};
+    std::vector<std::uint64_t> rounds;
+
+    for (std::size_t r = 0; r < ROUNDS + 1; ++r) {
+        store.begin_epoch();
+        for (SymbolId id : ids) {
+            store.expect_book(id);
+        }
+        for (const auto& frame : frames) {
+            if (router.parse_and_route(ctx, frame, method, channel) != MessageResult::Delivered) {
+                std::cerr << "routing failed\n";
+                return;
+            }
+        }
+        if (store.pending_books() != 0) {
+            std::cerr << "incomplete epoch\n";
+            return;
+        }
+        if (r > 0) {   // first round warms the parser buffers and books
+            rounds.push_back(store.time_to_full_book_ns());
+        }
+    }
+
+    std::sort(rounds.begin(), rounds.end());
+    const double median = static_cast<double>(rounds[rounds.size() / 2]) / 1e3;
+    const double worst  = static_cast<double>(rounds.back()) / 1e3;
+    std::cout << std::left << std::setw(16) << name << std::right << " | "
+              << std::setw(12) << std::fixed << std::setprecision(1) << median << " | "
+              << std::setw(11) << worst << " | "
+              << std::setw(14) << (median / static_cast<double>(SYMBOLS)) << "\n";
+}
+
+// ------------------------------------------------------------
+// Main
+// ------------------------------------------------------------
+int main() {
+    lcr::system::pin_thread(0);
+
+    std::vector<std::string> frames;
+    std::vector<SymbolId> ids;
+    for (std::size_t i = 0; i < SYMBOLS; ++i) {
+        frames.push_back(snapshot_message(i));
+        ids.push_back(intern_symbol(symbol_name_of(i)));
+    }
+
+    std::cout << "Running book store ingestion benchmark (" << SYMBOLS << " symbols, depth "
+              << DEPTH << ", " << ROUNDS << " rounds)...\n\n";
+
+    std::cout << "Path             | Median (us)  | Worst (us)  | Per book (us)\n";
+    std::cout << "-----------------+--------------+-------------+---------------\n";
+
+    {
+        static Store store;
+        parser::Router<> router;
+        ResponseContext ctx{ &store, {} };
+        report("Response", router, ctx, store, frames, ids);
+    }
+    {
+        static Store store;
+        parser::Router<policy::protocol::DefaultValidation, NoChannelFilter, book_sink::Into<Store>> router;
+        router.attach_book_store(store);
+        StreamingContext ctx{};
+        ctx.store = &store;
+        report("Streaming", router, ctx, store, frames, ids);
+    }
+
+    return 0;
+}
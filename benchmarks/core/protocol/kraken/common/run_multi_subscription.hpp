@@ -6,6 +6,7 @@
 
 #include "wirekrak/core.hpp"
 #include "wirekrak/core/perf/report.hpp"
+#include "wirekrak/core/perf/alloc_trace_install.hpp"   // replaces operator new / delete when WIREKRAK_ENABLE_ALLOC_TRACE is set
 #include "lcr/memory/block_pool.hpp"
 #include "common/loop/helpers.hpp"
 #include "common/kraken_pairs.hpp"
@@ -104,14 +105,21 @@ int run_multi_subscription(int argc, char** argv, const char* title, lcr::memory
     // NOTE:
     // Under Strict policy, sustained transport backpressure will escalate after N
     // consecutive overloaded polls. This example intentionally stresses the system.
-    int idle_spins = 0;
-    bool did_work = false;
-    while (running.load(std::memory_order_relaxed) && session.is_active()) {
-        (void)session.poll();
-        did_work = loop::drain_messages(session);
-        // Yield to avoid busy-waiting when idle
-        loop::manage_idle_spins(did_work, idle_spins);
-    }
+    // The loop runs on this thread, pinned to core 4 (same runner as production).
+    protocol::SessionRunner<Session, policy::protocol::idle::BusySpin> runner(
+        session, protocol::RunnerPlacement{ .core = 4, .priority = lcr::system::thread_priority::high }
+    );
+    // Steady state: heap allocations on the hot-path threads after a 10 s warm-up
+    // fail the run (instrumentation builds only, see perf/alloc_trace.hpp)
+    perf::alloc_trace::SteadyStateGate alloc_gate{ 10'000'000'000ULL };
+    runner.run([&](Session& s) {
+        if (!running.load(std::memory_order_relaxed)) {
+            runner.stop();
+        }
+        alloc_gate.poll();
+        return loop::drain_messages(s);
+    });
+    alloc_gate.finish();
 
     // -------------------------------------------------------------------------
     // Explicit unsubscription
@@ -146,7 +154,7 @@ int run_multi_subscription(int argc, char** argv, const char* title, lcr::memory
         }
         // Poll and drain messages to make progress towards quiescence
         (void)session.poll();
-        did_work = loop::drain_messages(session);
+        const bool did_work = loop::drain_messages(session);
         if (!did_work) {
             std::this_thread::yield();
         }
@@ -160,6 +168,12 @@ int run_multi_subscription(int argc, char** argv, const char* title, lcr::memory
     std::cout << "\n[6] Performance Report >>\n";
     perf::Report report(session.telemetry());
     report.dump(std::cout);
+    std::cout << "Runner loop iterations: " << runner.telemetry().loop_iterations_total.load()
+              << " (idle ratio " << runner.telemetry().idle_ratio() << ")\n";
+    if (!alloc_gate.verdict(std::cout)) {
+        std::cout << "\n[FAILURE] Heap allocations on the hot path in steady state.\n";
+        return 2;
+    }
 
     std::cout << "\n[SUCCESS] Clean shutdown completed.\n";
     return 0;
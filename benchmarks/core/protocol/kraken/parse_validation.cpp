@@ -0,0 +1,149 @@
+//------------------------------------------------------------------------------
+// Kraken Data-Plane Parser Validation Levels Benchmark
+//------------------------------------------------------------------------------
+//
+// This benchmark measures the per-message cost of the trade and book response
+// parsers under each compile-time validation level (Strict, Structural,
+// Trusted).
+//
+// Methodology:
+//
+//   • Single thread, no transport: a fixed set of representative messages is
+//     parsed into a simdjson DOM once (untimed), then the schema parsers run
+//     over the DOM in a loop (timed)
+//   • Only the schema layer is measured: JSON tokenization (simdjson) is the
+//     same for every level and excluded
+//   • Messages: trade update (1 trade), trade snapshot (50 trades),
+//     book update (2 levels), book snapshot (depth 25)
+//
+// Interpretation guideline:
+//
+//   • Strict → Structural: keyed field lookups replaced by one pass over
+//     the fields, domain value checks removed
+//   • Structural → Trusted: scalar type checks and required-field tracking
+//     removed
+//   • Gains grow with the number of fields per object (trade objects > levels)
+//
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "simdjson.h"
+
+#include "wirekrak/core/protocol/kraken/parser/dom/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/parser/dom/book/response.hpp"
+#include "wirekrak/core/policy/protocol/validation.hpp"
+#include "lcr/system/thread_affinity.hpp"
+
+using namespace std::chrono;
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol;
+using namespace wirekrak::core::protocol::kraken;
+
+namespace validation = wirekrak::core::policy::protocol::validation;
+
+constexpr std::uint64_t ITERATIONS = 200'000;
+
+// ------------------------------------------------------------
+// Messages
+// ------------------------------------------------------------
+static std::string trade_object(std::uint64_t id) {
+    char buf[256];
+    std::snprintf(buf, sizeof(buf),
+        R"({"symbol":"BTC/USD","side":"%s","price":%.1f,"qty":%.8f,"ord_type":"limit","trade_id":%llu,"timestamp":"2025-01-02T03:04:05.%06lluZ"})",
+        (id & 1) ? "buy" : "sell", 50000.0 + static_cast<double>(id % 100), 0.001 * static_cast<double>(1 + id % 7),
+        static_cast<unsigned long long>(id), static_cast<unsigned long long>(id % 1000000));
+    return buf;
+}
+
+static std::string trade_message(const char* type, std::size_t trades) {
+    std::string json = std::string(R"({"channel":"trade","type":")") + type + R"(","data":[)";
+    for (std::size_t i = 0; i < trades; ++i) {
+        json += (i ? "," : "") + trade_object(1000 + i);
+    }
+    return json + "]}";
+}
+
+static std::string levels(std::size_t n, double base, double step) {
+    std::string json = "[";
+    for (std::size_t i = 0; i < n; ++i) {
+        char buf[96];
+        std::snprintf(buf, sizeof(buf), R"(%s{"price":%.1f,"qty":%.8f})", i ? "," : "",
+            base + step * static_cast<double>(i), 0.25 * static_cast<double>(1 + i % 5));
+        json += buf;
+    }
+    return json + "]";
+}
+
+static std::string book_message(const char* type, std::size_t depth) {
+    return std::string(R"({"channel":"book","type":")") + type +
+           R"(","data":[{"symbol":"BTC/USD","bids":)" + levels(depth, 49999.9, -0.1) +
+           R"(,"asks":)" + levels(depth, 50000.1, 0.1) +
+           R"(,"checksum":3310070434,"timestamp":"2025-01-02T03:04:05.123456Z"}]})";
+}
+
+// ------------------------------------------------------------
+// Timing
+// ------------------------------------------------------------
+template<class Validation, class Parser, class Out>
+static double run(const simdjson::dom::element& root) {
+    Out out{};
+    std::uint64_t sink = 0;
+    auto t0 = steady_clock::now();
+    for (std::uint64_t i = 0; i < ITERATIONS; ++i) {
+        if (Parser::template parse<Validation>(root, out) == MessageResult::Parsed) {
+            ++sink;
+        }
+    }
+    const auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - t0).count();
+    if (sink != ITERATIONS) {
+        std::cerr << "parse failed\n";
+    }
+    return static_cast<double>(elapsed) / static_cast<double>(ITERATIONS);
+}
+
+template<class Parser, class Out>
+static void report(const char* name, const std::string& json) {
+    simdjson::dom::parser parser;
+    simdjson::dom::element root;
+    if (parser.parse(json).get(root)) {
+        std::cerr << "invalid benchmark message: " << name << "\n";
+        return;
+    }
+
+    const double strict     = run<validation::Strict, Parser, Out>(root);
+    const double structural = run<validation::Structural, Parser, Out>(root);
+    const double trusted    = run<validation::Trusted, Parser, Out>(root);
+
+    std::cout << std::left << std::setw(22) << name << std::right << " | "
+              << std::setw(12) << std::fixed << std::setprecision(1) << strict << " | "
+              << std::setw(16) << structural << " | "
+              << std::setw(13) << trusted << " | "
+              << std::setw(6) << std::setprecision(2) << (strict / trusted) << "x\n";
+}
+
+// ------------------------------------------------------------
+// Main
+// ------------------------------------------------------------
+int main() {
+    lcr::system::pin_thread(0);
+
+    std::cout << "Running parser validation levels benchmark ("
+              << ITERATIONS << " parses per level)...\n\n";
+
+    std::cout << "Message                |  Strict (ns) |  Structural (ns) |  Trusted (ns) | Strict/Trusted\n";
+    std::cout << "-----------------------+--------------+------------------+---------------+---------------\n";
+
+    report<parser::dom::trade::response, schema::trade::Response>("trade update (1)", trade_message("update", 1));
+    report<parser::dom::trade::response, schema::trade::Response>("trade snapshot (50)", trade_message("snapshot", 50));
+    report<parser::dom::book::response, schema::book::Response>("book update (1+1)", book_message("update", 1));
+    report<parser::dom::book::response, schema::book::Response>("book snapshot (25)", book_message("snapshot", 25));
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+//------------------------------------------------------------------------------
+// Subscribe Request Serialization Benchmark
+//------------------------------------------------------------------------------
+//
+// This benchmark measures the cost of serializing subscribe requests into a
+// caller-provided buffer (the Session TX path: write_json()), per request and
+// per symbol.
+//
+// Methodology:
+//
+//   • Single thread, no transport
+//   • Requests are built once (untimed), then serialized in a loop (timed);
+//     output sizes are summed to keep the work observable
+//   • Three workloads:
+//       - trade burst  : 1 symbol per request (subscribe bursts, replay with
+//                        Immediate batching)
+//       - trade batch  : 50 symbols per request (Batch / Paced batching)
+//       - book batch   : 50 symbols per request, depth + snapshot options
+//
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "wirekrak/core/protocol/kraken/schema/trade/subscribe.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/subscribe.hpp"
+#include "lcr/system/thread_affinity.hpp"
+
+using namespace std::chrono;
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol::kraken;
+
+constexpr std::size_t REQUESTS = 256;
+constexpr std::size_t PASSES = 2000;
+
+// ------------------------------------------------------------
+// Requests
+// ------------------------------------------------------------
+static RequestSymbols make_symbols(std::size_t n, std::size_t seed) {
+    static const char* bases[] = {"BTC", "ETH", "SOL", "XRP", "ADA", "DOGE", "MATIC", "LINK", "AVAX", "DOT"};
+    static const char* quotes[] = {"USD", "EUR", "GBP", "USDT"};
+    RequestSymbols symbols;
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t k = seed * 131 + i * 7;
+        std::string s = std::string(bases[k % 10]) + "/" + quotes[(k / 10) % 4];
+        symbols.emplace_back(s.c_str());
+    }
+    return symbols;
+}
+
+template<class RequestT>
+static std::vector<RequestT> make_requests(std::size_t symbols_per_request) {
+    std::vector<RequestT> requests;
+    for (std::size_t i = 0; i < REQUESTS; ++i) {
+        RequestT req;
+        req.symbols = make_symbols(symbols_per_request, i);
+        req.req_id = 1'000'000 + i * 977;
+        if constexpr (requires { req.depth; }) {
+            req.depth = 25;
+            req.snapshot = (i % 2) == 0;
+        }
+        requests.push_back(req);
+    }
+    return requests;
+}
+
+// ------------------------------------------------------------
+// Timing
+// ------------------------------------------------------------
+template<class RequestT>
+static void run(const char* name, std::size_t symbols_per_request) {
+    const auto requests = make_requests<RequestT>(symbols_per_request);
+    static char buffer[1 << 16];
+    std::uint64_t bytes = 0;
+    auto t0 = steady_clock::now();
+    for (std::size_t pass = 0; pass < PASSES; ++pass) {
+        for (const auto& req : requests) {
+            bytes += req.write_json(buffer);
+        }
+    }
+    const auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - t0).count();
+    const double per_request = static_cast<double>(elapsed) / static_cast<double>(PASSES * REQUESTS);
+    std::cout << "  " << std::left << std::setw(14) << name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << per_request << " ns/request"
+              << std::setw(10) << std::setprecision(2) << per_request / static_cast<double>(symbols_per_request) << " ns/symbol"
+              << std::setw(10) << (bytes / (PASSES * REQUESTS)) << " B/request\n";
+}
+
+int main() {
+    lcr::system::pin_thread(0);
+
+    std::cout << "\n=== Subscribe request serialization ===\n";
+    run<schema::trade::Subscribe>("trade burst", 1);
+    run<schema::trade::Subscribe>("trade batch", 50);
+    run<schema::book::Subscribe>("book batch", 50);
+    std::cout << '\n';
+    return 0;
+}
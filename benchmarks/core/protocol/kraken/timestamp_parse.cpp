@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+// RFC3339 Timestamp Parser Benchmark
+//------------------------------------------------------------------------------
+//
+// This benchmark measures the per-timestamp cost of the generic RFC3339
+// parser (field split + strtol + std::chrono calendar) against the
+// fixed-layout SWAR parser used by parse_rfc3339().
+//
+// Methodology:
+//
+//   • Single thread, Kraken layout (YYYY-MM-DDTHH:MM:SS.ffffffZ)
+//   • A pool of distinct timestamps is generated once (untimed), then parsed
+//     in a loop (timed); results are summed to keep the work observable
+//   • Two workloads:
+//       - same day   : every timestamp on one date (live feed, date cache hit)
+//       - mixed days : every timestamp on a different date (replay / worst
+//                      case, date cache miss)
+//
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "wirekrak/core/timestamp.hpp"
+#include "lcr/system/thread_affinity.hpp"
+
+using namespace std::chrono;
+using namespace wirekrak::core;
+
+constexpr std::size_t POOL = 4096;
+constexpr std::size_t PASSES = 500;
+
+// ------------------------------------------------------------
+// Timestamps
+// ------------------------------------------------------------
+static std::vector<std::string> make_pool(bool same_day) {
+    std::vector<std::string> pool;
+    std::uint64_t state = 42;
+    for (std::size_t i = 0; i < POOL; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const auto r = static_cast<unsigned>(state >> 33);
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%04u-%02u-%02uT%02u:%02u:%02u.%06uZ",
+            same_day ? 2025u : 2000u + r % 30, same_day ? 3u : 1u + r % 12, same_day ? 14u : 1u + (r >> 4) % 28,
+            (r >> 8) % 24, (r >> 13) % 60, (r >> 19) % 60, r % 1000000);
+        pool.emplace_back(buf);
+    }
+    return pool;
+}
+
+// ------------------------------------------------------------
+// Timing
+// ------------------------------------------------------------
+template<class Parse>
+static double run(const std::vector<std::string>& pool, Parse parse) {
+    std::int64_t sum = 0;
+    auto t0 = steady_clock::now();
+    for (std::size_t pass = 0; pass < PASSES; ++pass) {
+        for (const auto& s : pool) {
+            Timestamp ts{};
+            if (parse(s, ts)) {
+                sum += ts.time_since_epoch().count();
+            }
+        }
+    }
+    const auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - t0).count();
+    if (sum == 0) {
+        std::cerr << "parse failed\n";
+    }
+    return static_cast<double>(elapsed) / static_cast<double>(PASSES * POOL);
+}
+
+static void report(const char* name, bool same_day) {
+    const auto pool = make_pool(same_day);
+    const double generic = run(pool, [](std::string_view sv, Timestamp& ts) { return parse_rfc3339_generic(sv, ts); });
+    const double fast    = run(pool, [](std::string_view sv, Timestamp& ts) { return parse_rfc3339(sv, ts); });
+
+    std::cout << std::left << std::setw(12) << name << std::right << " | "
+              << std::setw(12) << std::fixed << std::setprecision(1) << generic << " | "
+              << std::setw(9) << fast << " | "
+              << std::setw(6) << std::setprecision(2) << (generic / fast) << "x\n";
+}
+
+// ------------------------------------------------------------
+// Main
+// ------------------------------------------------------------
+int main() {
+    lcr::system::pin_thread(0);
+
+    std::cout << "Running RFC3339 timestamp parser benchmark ("
+              << PASSES * POOL << " parses per parser)...\n\n";
+
+    std::cout << "Workload     | Generic (ns) | SWAR (ns) | Speedup\n";
+    std::cout << "-------------+--------------+-----------+--------\n";
+
+    report("same day", true);
+    report("mixed days", false);
+
+    return 0;
+}
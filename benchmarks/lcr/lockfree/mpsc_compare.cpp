@@ -0,0 +1,238 @@
+//------------------------------------------------------------------------------
+// MPSC Ring vs N x SPSC Ring Fan-in Benchmark
+//------------------------------------------------------------------------------
+//
+// This benchmark measures the throughput of funnelling P producer threads
+// into ONE consumer thread using two strategies:
+//
+//   • N x spsc_ring → one SPSC ring per producer, consumer round-robin polls
+//   • mpsc_ring     → one shared ring, single consumer, sequenced slots
+//
+// Both implementations use the two-phase (zero-copy) API and are executed
+// under identical conditions:
+//   • Dedicated, pinned producer threads (cores 1..P) and consumer (core 0)
+//   • Fixed-duration steady-state measurement
+//   • Heap-allocated rings (P rings do not fit comfortably on the stack)
+//
+// Per-producer ordering is verified on the consumer side for both variants
+// (each message carries its producer id and a per-producer sequence).
+//
+// Interpretation guideline:
+//
+//   • Few producers, all busy:
+//       SPSC fan-in avoids the shared CAS and usually wins on raw throughput.
+//
+//   • Many producers, bursty or mostly idle:
+//       MPSC avoids scanning empty rings and keeps a single cache-hot
+//       consumer path; the consumer cost no longer grows with P.
+//
+//------------------------------------------------------------------------------
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "lcr/lockfree/mpsc_ring.hpp"
+#include "lcr/lockfree/spsc_ring.hpp"
+#include "lcr/system/thread_affinity.hpp"
+
+using namespace std::chrono;
+
+struct Msg {
+    uint32_t producer;
+    uint64_t seq;
+};
+
+constexpr size_t N = 1 << 16;
+constexpr size_t PRODUCERS = 3;
+constexpr int DURATION_SEC = 10;
+
+// ------------------------------------------------------------
+// Benchmark result
+// ------------------------------------------------------------
+struct Result {
+    double throughput_mps;
+    uint64_t ops;
+    bool ordered;
+};
+
+// ------------------------------------------------------------
+// N x SPSC benchmark (consumer round-robin)
+// ------------------------------------------------------------
+Result run_spsc_fan_in() {
+    using Ring = lcr::lockfree::spsc_ring<Msg, N>;
+    std::array<std::unique_ptr<Ring>, PRODUCERS> rings;
+    for (auto& r : rings) {
+        r = std::make_unique<Ring>();
+    }
+
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> consumed{0};
+    std::atomic<bool> ordered{true};
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p] {
+            lcr::system::pin_thread(static_cast<std::uint32_t>(p + 1));
+            while (!start.load(std::memory_order_acquire));
+
+            auto& ring = *rings[p];
+            uint64_t seq = 0;
+
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (auto* slot = ring.acquire_producer_slot()) {
+                    slot->producer = static_cast<uint32_t>(p);
+                    slot->seq = seq++;
+                    ring.commit_producer_slot();
+                }
+            }
+        });
+    }
+
+    std::thread consumer([&] {
+        lcr::system::pin_thread(0);
+        while (!start.load(std::memory_order_acquire));
+
+        std::array<uint64_t, PRODUCERS> expected{};
+        uint64_t local = 0;
+        bool in_order = true;
+
+        while (!stop.load(std::memory_order_relaxed)) {
+            for (size_t p = 0; p < PRODUCERS; ++p) {
+                if (auto* slot = rings[p]->peek_consumer_slot()) {
+                    in_order &= (slot->seq == expected[slot->producer]++);
+                    rings[p]->release_consumer_slot();
+                    local++;
+                }
+            }
+        }
+
+        consumed.store(local, std::memory_order_relaxed);
+        ordered.store(in_order, std::memory_order_relaxed);
+    });
+
+    std::this_thread::sleep_for(std::chrono::seconds(1)); // warmup
+
+    auto t0 = high_resolution_clock::now();
+    start.store(true, std::memory_order_release);
+
+    std::this_thread::sleep_for(std::chrono::seconds(DURATION_SEC));
+
+    stop.store(true, std::memory_order_release);
+
+    for (auto& t : producers) {
+        t.join();
+    }
+    consumer.join();
+
+    auto t1 = high_resolution_clock::now();
+
+    double seconds = duration<double>(t1 - t0).count();
+    uint64_t ops = consumed.load();
+
+    return { (ops / seconds) / 1e6, ops, ordered.load() };
+}
+
+// ------------------------------------------------------------
+// MPSC benchmark
+// ------------------------------------------------------------
+Result run_mpsc() {
+    using Ring = lcr::lockfree::mpsc_ring<Msg, N>;
+    auto ring = std::make_unique<Ring>();
+
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> consumed{0};
+    std::atomic<bool> ordered{true};
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p] {
+            lcr::system::pin_thread(static_cast<std::uint32_t>(p + 1));
+            while (!start.load(std::memory_order_acquire));
+
+            uint64_t seq = 0;
+            size_t ticket;
+
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (auto* slot = ring->acquire_producer_slot(ticket)) {
+                    slot->producer = static_cast<uint32_t>(p);
+                    slot->seq = seq++;
+                    ring->commit_producer_slot(ticket);
+                }
+            }
+        });
+    }
+
+    std::thread consumer([&] {
+        lcr::system::pin_thread(0);
+        while (!start.load(std::memory_order_acquire));
+
+        std::array<uint64_t, PRODUCERS> expected{};
+        uint64_t local = 0;
+        bool in_order = true;
+
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (auto* slot = ring->peek_consumer_slot()) {
+                in_order &= (slot->seq == expected[slot->producer]++);
+                ring->release_consumer_slot();
+                local++;
+            }
+        }
+
+        consumed.store(local, std::memory_order_relaxed);
+        ordered.store(in_order, std::memory_order_relaxed);
+    });
+
+    std::this_thread::sleep_for(std::chrono::seconds(1)); // warmup
+
+    auto t0 = high_resolution_clock::now();
+    start.store(true, std::memory_order_release);
+
+    std::this_thread::sleep_for(std::chrono::seconds(DURATION_SEC));
+
+    stop.store(true, std::memory_order_release);
+
+    for (auto& t : producers) {
+        t.join();
+    }
+    consumer.join();
+
+    auto t1 = high_resolution_clock::now();
+
+    double seconds = duration<double>(t1 - t0).count();
+    uint64_t ops = consumed.load();
+
+    return { (ops / seconds) / 1e6, ops, ordered.load() };
+}
+
+// ------------------------------------------------------------
+// Main
+// ------------------------------------------------------------
+int main() {
+    std::cout << "Running fan-in benchmarks (" << PRODUCERS << " producers, "
+              << DURATION_SEC << "s each)...\n\n";
+
+    auto spsc_res = run_spsc_fan_in();
+    auto mpsc_res = run_mpsc();
+
+    double diff = ((mpsc_res.throughput_mps - spsc_res.throughput_mps)
+                  / spsc_res.throughput_mps) * 100.0;
+
+    std::cout << "Results:\n";
+    std::cout << "---------------------------------\n";
+    std::cout << "N x SPSC throughput : " << spsc_res.throughput_mps << " M msg/s"
+              << (spsc_res.ordered ? "" : " (ORDER VIOLATION)") << "\n";
+    std::cout << "MPSC throughput     : " << mpsc_res.throughput_mps << " M msg/s"
+              << (mpsc_res.ordered ? "" : " (ORDER VIOLATION)") << "\n";
+    std::cout << "---------------------------------\n";
+    std::cout << "MPSC advantage      : " << diff << " %\n";
+
+    return (spsc_res.ordered && mpsc_res.ordered) ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+// SPMC Fan-out Ring Producer Scaling Benchmark
+//------------------------------------------------------------------------------
+//
+// This benchmark measures the producer push cost of spmc_fanout_ring as the
+// number of registered consumers grows (1 → 128), comparing:
+//
+//   • tail_tracking::scan    → rescans every consumer tail on each push
+//   • tail_tracking::cached  → rescans only when the cached bound is reached
+//
+// Methodology:
+//
+//   • Single thread, producer-only timing (deterministic, no scheduler noise)
+//   • Consumers are simulated: after every window of pushes, each consumer
+//     jumps to the live edge (resync) OUTSIDE the timed region
+//   • Window = Capacity / 2 → the cached variant refreshes its bound roughly
+//     once per window, which is the realistic steady state for consumers that
+//     keep up but lag by up to half a ring
+//
+// The consumer tails are still written between windows, so the producer scan
+// touches cache lines that were modified by "consumers" (as in production).
+//
+// Interpretation guideline:
+//
+//   • scan   : cost grows linearly with consumer count
+//   • cached : cost stays near-constant (one amortized scan per window)
+//
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include "lcr/lockfree/spmc_fanout_ring.hpp"
+#include "lcr/system/thread_affinity.hpp"
+
+using namespace std::chrono;
+
+struct Msg {
+    uint64_t value;
+};
+
+constexpr size_t N             = 1 << 12;
+constexpr size_t MAX_CONSUMERS = 128;
+constexpr size_t WINDOW        = N / 2;
+constexpr uint64_t TOTAL_PUSHES = 1ull << 24;
+
+// ------------------------------------------------------------
+// Benchmark result
+// ------------------------------------------------------------
+struct Result {
+    double ns_per_push;
+    uint64_t ops;
+};
+
+// ------------------------------------------------------------
+// Producer cost for a given tracking mode and consumer count
+// ------------------------------------------------------------
+template<lcr::lockfree::tail_tracking Tracking>
+Result run(size_t consumers) {
+    using Ring = lcr::lockfree::spmc_fanout_ring<Msg, N, MAX_CONSUMERS, Tracking>;
+    auto ring = std::make_unique<Ring>();
+
+    for (size_t i = 0; i < consumers; ++i) {
+        (void)ring->register_consumer();
+    }
+
+    uint64_t pushed = 0;
+    nanoseconds elapsed{0};
+
+    while (pushed < TOTAL_PUSHES) {
+        auto t0 = steady_clock::now();
+        for (size_t i = 0; i < WINDOW; ++i) {
+            if (ring->push(Msg{pushed})) {
+                ++pushed;
+            }
+        }
+        elapsed += duration_cast<nanoseconds>(steady_clock::now() - t0);
+
+        // Simulated consumers catch up (untimed)
+        for (size_t c = 0; c < consumers; ++c) {
+            (void)ring->resync(c);
+        }
+    }
+
+    return { static_cast<double>(elapsed.count()) / static_cast<double>(pushed), pushed };
+}
+
+// ------------------------------------------------------------
+// Main
+// ------------------------------------------------------------
+int main() {
+    lcr::system::pin_thread(0);
+
+    std::cout << "Running SPMC fan-out producer scaling benchmark ("
+              << TOTAL_PUSHES << " pushes per run, capacity " << N << ")...\n\n";
+
+    std::cout << "Consumers |  scan (ns/push) | cached (ns/push) | speedup\n";
+    std::cout << "----------+-----------------+------------------+---------\n";
+
+    for (size_t consumers = 1; consumers <= MAX_CONSUMERS; consumers *= 2) {
+        auto scan   = run<lcr::lockfree::tail_tracking::scan>(consumers);
+        auto cached = run<lcr::lockfree::tail_tracking::cached>(consumers);
+
+        std::cout << std::setw(9) << consumers << " | "
+                  << std::setw(15) << std::fixed << std::setprecision(2) << scan.ns_per_push << " | "
+                  << std::setw(16) << cached.ns_per_push << " | "
+                  << std::setw(6) << (scan.ns_per_push / cached.ns_per_push) << "x\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+// ============================================================================
+// Core Contracts Example - Adaptive Request Batching Policy
+// ============================================================================
+//
+// POLICY CONFIGURATION
+// --------------------
+// Request Batching Policy : Adaptive
+// Batch Size              : 10 symbols
+// Rate                    : 20 batches/s (burst 4)
+// Max In Flight           : 8 batches
+//
+// EXPECTED BEHAVIOR
+// -----------------
+// - Large subscription requests are split into smaller batches.
+// - Each batch contains at most 10 symbols.
+// - Emission is driven by time and by exchange feedback, not by poll():
+//
+//       batch #1          → sent immediately (1 batch in flight)
+//       batch #1 ACKed    → 2 batches sent
+//       both ACKed        → 4 batches sent
+//       ...               → up to 8 in flight, never more than 20/s
+//
+// A rejection (e.g. rate limit exceeded) halves the number of batches
+// allowed in flight and pauses emission until the token bucket refills.
+//
+// All generated requests:
+//
+//   * share the same req_id
+//   * preserve the logical subscription intent
+//   * are transmitted during poll() as soon as the pacer admits them
+//
+// OBSERVATION GUIDE
+// -----------------
+// During execution you should observe:
+//
+// - The first batch alone, then growing groups of batches as ACKs arrive
+// - Each batch containing at most 10 symbols
+// - With telemetry enabled (L1), the time-to-full-subscription and the
+//   batch round-trip times in the session report
+//
+// DESIGN PURPOSE
+// --------------
+// Compared to Paced batching, the subscription ramp:
+//
+//   - does not depend on how fast the application polls
+//   - speeds up while the exchange keeps up, backs off when it does not
+//   - still respects a hard request rate
+//
+// ============================================================================
+
+#include "wirekrak/core/protocol/session.hpp"
+#include "wirekrak/core/protocol/kraken_model.hpp"
+#include "wirekrak/core/preset/transport/websocket_default.hpp"
+#include "wirekrak/core/preset/control_ring_default.hpp"
+#include "wirekrak/core/preset/message_ring_default.hpp"
+
+#include "common/run_multi_subscription_example.hpp"
+#include "common/default_memory_pool.hpp"
+
+
+// -------------------------------------------------------------------------
+// Session setup
+// -------------------------------------------------------------------------
+
+using MySessionPolicies =
+    policy::protocol::session_bundle<
+        policy::protocol::DefaultBackpressure,
+        policy::protocol::DefaultLiveness,
+        policy::protocol::DefaultProgress,
+        policy::protocol::DefaultSymbolLimit,
+        policy::protocol::DefaultReplay,
+        policy::protocol::AdaptiveBatchingPolicy<
+            10,     // batch size
+            20,     // batches per second
+            4,      // burst
+            8       // max batches in flight
+        >
+    >;
+
+using MySession =
+    protocol::Session<
+        protocol::KrakenModel,
+        preset::transport::DefaultWebSocket,
+        preset::DefaultMessageRing,
+        MySessionPolicies
+    >;
+
+
+// -----------------------------------------------------------------------------
+// Main
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+
+    return run_multi_subscription_example<MySession, preset::DefaultMessageRing>(
+        argc,
+        argv,
+        "Wirekrak Core - Adaptive Request Batching Example\n"
+        "Demonstrates ACK-driven request emission (10 symbols per batch, up to 20 batches/s).\n",
+        wirekrak::examples::default_memory_pool
+    );
+}
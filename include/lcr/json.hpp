@@ -9,17 +9,40 @@
 namespace lcr {
 namespace json {
 
-// Fast integer → raw buffer formatter
+// Two-digit lookup table for integer formatting ("00".."99")
+inline constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Fast integer → raw buffer formatter (two digits per division)
 // Returns number of characters written
 inline std::size_t append(char* out, std::uint64_t value) noexcept
 {
     char buf[32];
     char* p = buf + sizeof(buf);
 
-    do {
-        *(--p) = static_cast<char>('0' + (value % 10));
-        value /= 10;
-    } while (value > 0);
+    while (value >= 100) {
+        const std::size_t i = static_cast<std::size_t>(value % 100) * 2;
+        value /= 100;
+        *(--p) = DIGIT_PAIRS[i + 1];
+        *(--p) = DIGIT_PAIRS[i];
+    }
+    if (value >= 10) {
+        const std::size_t i = static_cast<std::size_t>(value) * 2;
+        *(--p) = DIGIT_PAIRS[i + 1];
+        *(--p) = DIGIT_PAIRS[i];
+    }
+    else {
+        *(--p) = static_cast<char>('0' + value);
+    }
 
     const std::size_t len = buf + sizeof(buf) - p;
     std::memcpy(out, p, len);
@@ -59,8 +82,36 @@ static constexpr char HEX[] = "0123456789ABCDEF";
 // Does NOT validate UTF-8 (assumes valid input).
 // ----------------------------------------------------------------------------
 
+// Characters that need escaping in a JSON string: ", \\ and control chars
+inline constexpr auto NEEDS_ESCAPE = [] {
+    struct Table { bool v[256]{}; } t{};
+    for (int c = 0; c < 0x20; ++c) {
+        t.v[c] = true;
+    }
+    t.v[static_cast<unsigned char>('"')] = true;
+    t.v[static_cast<unsigned char>('\\')] = true;
+    return t;
+}();
+
+// True if the string can be written verbatim inside JSON quotes
+[[nodiscard]]
+inline bool is_plain(const char* input, std::size_t length) noexcept
+{
+    bool dirty = false;
+    for (std::size_t i = 0; i < length; ++i) {
+        dirty |= NEEDS_ESCAPE.v[static_cast<unsigned char>(input[i])];
+    }
+    return !dirty;
+}
+
 inline std::size_t escape(char* out, const char* input, std::size_t length) noexcept
 {
+    // Fast path: nothing to escape (exchange symbols, identifiers)
+    if (is_plain(input, length)) [[likely]] {
+        std::memcpy(out, input, length);
+        return length;
+    }
+
     std::size_t pos = 0;
 
     for (std::size_t i = 0; i < length; ++i)
@@ -0,0 +1,257 @@
+#pragma once
+
+/*
+===============================================================================
+MPSC Ring (Bounded, Sequenced Slots, Two-Phase API)
+===============================================================================
+
+This file defines a bounded Multi-Producer / Single-Consumer (MPSC) ring
+buffer based on per-slot sequence numbers (Vyukov-style bounded queue).
+
+Purpose:
+  - Funnel several producer threads (sessions, shards) into ONE consumer
+  - Replace consumer-side round-robin polling of N SPSC rings
+  - Keep zero-copy two-phase slots like spsc_ring
+
+Design principles:
+  - Zero dynamic allocation (fixed-size, compile-time capacity)
+  - Lock-free producers (one CAS on the shared head per claim)
+  - Wait-free consumer (no CAS, no shared writes besides slot sequence)
+  - Cache-friendly layout (producer head and consumer tail on separate lines)
+
+Slot protocol (seq = per-slot sequence number, pos = ticket):
+
+  seq == pos              → slot free for the producer claiming ticket pos
+  seq == pos + 1          → slot published for the consumer at ticket pos
+  seq == pos + Capacity   → slot released, free for ticket pos + Capacity
+
+API semantics (two-phase protocol):
+
+  Producer (any thread):
+    1) acquire_producer_slot(ticket) → claim writable slot
+    2) write data into slot
+    3) commit_producer_slot(ticket)  → publish to consumer
+
+    or:
+    - discard_producer_slot(ticket)  → publish a tombstone (skipped by consumer)
+
+  Consumer (single thread):
+    1) peek_consumer_slot()          → access readable slot
+    2) process data in-place
+    3) release_consumer_slot()       → free slot
+
+Ordering guarantees:
+  - Per-producer FIFO: tickets claimed by one thread are increasing, and the
+    consumer reads strictly in ticket order
+  - No global order across producers beyond claim order
+
+Progress caveat:
+  - A producer that claimed a slot but has not committed it yet blocks the
+    consumer at that slot (head-of-line). Keep the acquire → commit window
+    short and never abandon a claimed slot: discard it instead.
+
+Threading model:
+  - Any number of producer threads
+  - Exactly one consumer thread
+
+Constraints:
+  - Capacity must be a power of two
+  - Usable capacity is Capacity
+
+===============================================================================
+*/
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "lcr/memory/footprint.hpp"
+#include "lcr/trap.hpp"
+
+
+namespace lcr::lockfree {
+
+template <typename T, size_t Capacity>
+class alignas(64) mpsc_ring {
+    static_assert((Capacity >= 2) && ((Capacity & (Capacity - 1)) == 0), "Capacity must be power of two and >= 2");
+
+    static_assert(std::is_trivially_destructible_v<T> || std::is_nothrow_destructible_v<T>, "ring element must be safely destructible");
+
+public:
+    mpsc_ring() noexcept {
+        for (size_t i = 0; i < Capacity; ++i) {
+            buffer_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpsc_ring(const mpsc_ring&) = delete;
+    mpsc_ring& operator=(const mpsc_ring&) = delete;
+
+    // -------------------------------------------------------------------------
+    // Producer API (two-phase, any thread)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline T* acquire_producer_slot(size_t& ticket) noexcept {
+        size_t pos = head_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            Cell& cell = buffer_[pos & MASK];
+            const size_t seq = cell.seq.load(std::memory_order_acquire);
+            const std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+            if (diff == 0) {
+                // Slot free for this ticket → try to claim it
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ticket = pos;
+                    return &cell.data;
+                }
+                // pos reloaded by compare_exchange_weak
+            }
+            else if (diff < 0) [[unlikely]] {
+                return nullptr; // full (slot not yet released by the consumer)
+            }
+            else {
+                pos = head_.load(std::memory_order_relaxed); // another producer claimed it
+            }
+        }
+    }
+
+    inline void commit_producer_slot(size_t ticket) noexcept {
+        Cell& cell = buffer_[ticket & MASK];
+        LCR_ASSERT(cell.seq.load(std::memory_order_relaxed) == ticket);
+        cell.skip = false;
+        cell.seq.store(ticket + 1, std::memory_order_release);
+    }
+
+    inline void discard_producer_slot(size_t ticket) noexcept {
+        Cell& cell = buffer_[ticket & MASK];
+        LCR_ASSERT(cell.seq.load(std::memory_order_relaxed) == ticket);
+        cell.skip = true;
+        cell.seq.store(ticket + 1, std::memory_order_release);
+    }
+
+    // -------------------------------------------------------------------------
+    // Producer value API (any thread)
+    // -------------------------------------------------------------------------
+
+    template <typename U>
+    [[nodiscard]]
+    inline bool push(U&& item) noexcept {
+        size_t ticket;
+        T* slot = acquire_producer_slot(ticket);
+        if (!slot) [[unlikely]] {
+            return false;
+        }
+        *slot = std::forward<U>(item);
+        commit_producer_slot(ticket);
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Consumer API (two-phase, single thread)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline T* peek_consumer_slot() noexcept {
+        for (;;) {
+            Cell& cell = buffer_[tail_ & MASK];
+            if (cell.seq.load(std::memory_order_acquire) != tail_ + 1) {
+                return nullptr; // empty (or next ticket not committed yet)
+            }
+            if (cell.skip) [[unlikely]] {
+                // Discarded by its producer → free it and move on
+                cell.seq.store(tail_ + Capacity, std::memory_order_release);
+                ++tail_;
+                continue;
+            }
+
+#ifndef NDEBUG
+            LCR_ASSERT(!consumer_slot_acquired_);
+            consumer_slot_acquired_ = true;
+#endif
+
+            return &cell.data;
+        }
+    }
+
+    inline void release_consumer_slot() noexcept {
+#ifndef NDEBUG
+        LCR_ASSERT(consumer_slot_acquired_);
+        consumer_slot_acquired_ = false;
+#endif
+
+        buffer_[tail_ & MASK].seq.store(tail_ + Capacity, std::memory_order_release);
+        ++tail_;
+    }
+
+    // -------------------------------------------------------------------------
+    // Consumer value API (single thread)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline bool pop(T& out) noexcept {
+        T* slot = peek_consumer_slot();
+        if (!slot) {
+            return false;
+        }
+        out = std::move(*slot);
+        release_consumer_slot();
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Observers (approximate while producers are active)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    static constexpr size_t capacity() noexcept {
+        return Capacity;
+    }
+
+    // Consumer view: true if the next ticket is not published yet
+    [[nodiscard]]
+    inline bool empty() const noexcept {
+        return buffer_[tail_ & MASK].seq.load(std::memory_order_acquire) != tail_ + 1;
+    }
+
+    // Number of claimed tickets not yet released by the consumer (consumer thread)
+    [[nodiscard]]
+    inline size_t used() const noexcept {
+        return head_.load(std::memory_order_relaxed) - tail_;
+    }
+
+    [[nodiscard]]
+    inline memory::footprint memory_usage() const noexcept {
+        return memory::footprint{
+            .static_bytes = sizeof(mpsc_ring<T, Capacity>),
+            .dynamic_bytes = 0
+        };
+    }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    struct Cell {
+        std::atomic<size_t> seq{0};
+        bool skip{false};
+        T data{};
+    };
+
+    std::array<Cell, Capacity> buffer_;
+
+    // Shared by all producers
+    alignas(64) std::atomic<size_t> head_{0};
+
+    // Consumer-private read position
+    alignas(64) size_t tail_{0};
+
+#ifndef NDEBUG
+    bool consumer_slot_acquired_ = false;
+#endif
+};
+
+} // namespace lcr::lockfree
@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+===============================================================================
+Shared-memory ring header (versioned layout descriptor)
+===============================================================================
+
+Every shared-memory ring starts with this header. It allows a process that
+attaches to an existing segment to verify that the producer and the consumer
+agree on the exact binary layout before touching any slot.
+
+Validated on attach:
+  • magic        → segment really holds an lcr ring
+  • version      → header/protocol version (bumped on incompatible changes)
+  • kind         → ring flavor (SPSC / SPMC fan-out)
+  • capacity     → slot count
+  • slot_size    → sizeof(T)
+  • slot_align   → alignof(T)
+  • max_consumers→ consumer table size (SPMC only, 1 for SPSC)
+
+The `ready` flag is published LAST (release) by the creator, so an attacher
+never observes a partially initialized segment.
+
+Position independence:
+  • The header and everything after it only contain integers and atomics
+  • No pointers, no virtual tables: the segment can be mapped at any address
+
+===============================================================================
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace lcr::lockfree::shm {
+
+inline constexpr std::uint64_t MAGIC   = 0x474E49524B52434CULL; // "LCRKRING"
+inline constexpr std::uint32_t VERSION = 1;
+
+enum class ring_kind : std::uint32_t {
+    spsc        = 1,
+    spmc_fanout = 2
+};
+
+struct alignas(64) header {
+    std::uint64_t magic;
+    std::uint32_t version;
+    ring_kind     kind;
+    std::uint64_t capacity;
+    std::uint64_t slot_size;
+    std::uint64_t slot_align;
+    std::uint64_t max_consumers;
+    std::atomic<std::uint32_t> ready;
+
+    inline void init(ring_kind k, std::size_t cap, std::size_t size, std::size_t align, std::size_t consumers) noexcept {
+        ready.store(0, std::memory_order_relaxed);
+        magic         = MAGIC;
+        version       = VERSION;
+        kind          = k;
+        capacity      = cap;
+        slot_size     = size;
+        slot_align    = align;
+        max_consumers = consumers;
+        ready.store(1, std::memory_order_release);
+    }
+
+    [[nodiscard]]
+    inline bool matches(ring_kind k, std::size_t cap, std::size_t size, std::size_t align, std::size_t consumers) const noexcept {
+        return ready.load(std::memory_order_acquire) == 1 &&
+               magic         == MAGIC &&
+               version       == VERSION &&
+               kind          == k &&
+               capacity      == cap &&
+               slot_size     == size &&
+               slot_align    == align &&
+               max_consumers == consumers;
+    }
+};
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "shared-memory rings require address-free atomics");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "shared-memory rings require address-free atomics");
+
+} // namespace lcr::lockfree::shm
@@ -0,0 +1,279 @@
+#pragma once
+
+/*
+===============================================================================
+Shared-Memory SPMC Fan-out Ring (cross-process, dynamic consumers)
+===============================================================================
+
+Variant of lcr::lockfree::spmc_fanout_ring whose entire state lives inside a
+caller provided memory region, so that one producer process can publish to
+several consumer processes that attach and detach at runtime.
+
+Layout (position independent, no pointers):
+
+  [ header ][ head (+ cached min tail) ][ consumer table ][ slots... ]
+
+  - 64-bit free-running indices (stable ABI across 32/64-bit processes)
+  - One cache line per consumer entry (tail + state)
+
+Consumer lifecycle:
+
+  attach_consumer()  → claims a free entry and starts at the live edge
+  detach_consumer()  → releases the entry (producer stops waiting for it)
+
+  Entry state: 0 = free, 1 = claimed (initializing), 2 = active
+
+  Attaching never races with the producer: the consumer publishes its tail,
+  activates the entry, then re-reads head behind a full fence. Any slot the
+  producer may still overwrite without having observed the new consumer is
+  below that re-read head, and is never read by the new consumer.
+
+Producer:
+  - Keeps a cached lower bound of the slowest active tail and rescans the
+    consumer table only when that bound is reached (near O(1) push)
+  - Never blocks: acquire_producer_slot() returns nullptr when full
+
+Crash handling:
+  - A consumer process that dies while attached pins the producer.
+    force_detach_consumer() lets a supervisor release its entry (ONLY when
+    the owner is known to be dead).
+
+Constraints:
+  - T must be trivially copyable (bytes are shared, not objects)
+  - Capacity must be a power of two
+  - Exactly one producer; each consumer id is used by exactly one thread
+
+===============================================================================
+*/
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include "lcr/lockfree/shm/header.hpp"
+#include "lcr/trap.hpp"
+
+
+namespace lcr::lockfree::shm {
+
+template <typename T, std::size_t Capacity, std::size_t MaxConsumers>
+class alignas(64) spmc_fanout_ring {
+    static_assert((Capacity >= 2) && ((Capacity & (Capacity - 1)) == 0), "Capacity must be power of two and >= 2");
+    static_assert(MaxConsumers >= 1, "MaxConsumers must be >= 1");
+    static_assert(std::is_trivially_copyable_v<T>, "shared-memory slots must be trivially copyable");
+    static_assert(alignof(T) <= 64, "slot alignment larger than a cache line is not supported");
+
+public:
+    static constexpr std::size_t INVALID_CONSUMER = static_cast<std::size_t>(-1);
+
+    spmc_fanout_ring(const spmc_fanout_ring&) = delete;
+    spmc_fanout_ring& operator=(const spmc_fanout_ring&) = delete;
+
+    // -------------------------------------------------------------------------
+    // Lifecycle
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    static constexpr std::size_t required_bytes() noexcept {
+        return sizeof(spmc_fanout_ring);
+    }
+
+    // Initialize a fresh ring in the given region (producer side)
+    [[nodiscard]]
+    static spmc_fanout_ring* create(void* mem, std::size_t bytes) noexcept {
+        if (!fits_(mem, bytes)) {
+            return nullptr;
+        }
+        auto* ring = ::new (mem) spmc_fanout_ring();
+        ring->header_.init(ring_kind::spmc_fanout, Capacity, sizeof(T), alignof(T), MaxConsumers);
+        return ring;
+    }
+
+    // Attach to a ring created by another process (validates the header)
+    [[nodiscard]]
+    static spmc_fanout_ring* attach(void* mem, std::size_t bytes) noexcept {
+        if (!fits_(mem, bytes)) {
+            return nullptr;
+        }
+        auto* ring = std::launder(reinterpret_cast<spmc_fanout_ring*>(mem));
+        if (!ring->header_.matches(ring_kind::spmc_fanout, Capacity, sizeof(T), alignof(T), MaxConsumers)) {
+            return nullptr;
+        }
+        return ring;
+    }
+
+    // -------------------------------------------------------------------------
+    // Consumer registration (any process)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline std::size_t attach_consumer() noexcept {
+        for (std::size_t id = 0; id < MaxConsumers; ++id) {
+            auto& c = consumers_[id];
+            std::uint32_t expected = FREE;
+            if (!c.state.compare_exchange_strong(expected, CLAIMED, std::memory_order_acq_rel)) {
+                continue;
+            }
+            c.tail.store(head_.index.load(std::memory_order_acquire), std::memory_order_relaxed);
+            c.state.store(ACTIVE, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            c.tail.store(head_.index.load(std::memory_order_seq_cst), std::memory_order_release);
+            return id;
+        }
+        return INVALID_CONSUMER;
+    }
+
+    inline void detach_consumer(std::size_t id) noexcept {
+        LCR_ASSERT(id < MaxConsumers);
+        consumers_[id].state.store(FREE, std::memory_order_release);
+    }
+
+    // Supervisor-only: release the entry of a consumer known to be dead
+    inline void force_detach_consumer(std::size_t id) noexcept {
+        detach_consumer(id);
+    }
+
+    // -------------------------------------------------------------------------
+    // Producer API (two-phase)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline T* acquire_producer_slot() noexcept {
+        const std::uint64_t head = head_.index.load(std::memory_order_relaxed);
+        if (head - head_.cached_min_tail >= Capacity) {
+            // Cached bound reached → refresh from the consumer table
+            head_.cached_min_tail = min_active_tail_(head);
+            if (head - head_.cached_min_tail >= Capacity) [[unlikely]] {
+                return nullptr; // full
+            }
+        }
+        return &slots_[head & MASK];
+    }
+
+    inline void commit_producer_slot() noexcept {
+        const std::uint64_t head = head_.index.load(std::memory_order_relaxed);
+        head_.index.store(head + 1, std::memory_order_release);
+    }
+
+    inline void discard_producer_slot() noexcept {
+        // Nothing published
+    }
+
+    [[nodiscard]]
+    inline bool push(const T& item) noexcept {
+        T* slot = acquire_producer_slot();
+        if (!slot) [[unlikely]] {
+            return false;
+        }
+        *slot = item;
+        commit_producer_slot();
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Consumer API (two-phase, zero-copy)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline const T* peek(std::size_t id) const noexcept {
+        const auto& c = consumers_[id];
+        const std::uint64_t tail = c.tail.load(std::memory_order_relaxed);
+        if (tail == head_.index.load(std::memory_order_acquire)) {
+            return nullptr; // empty
+        }
+        return &slots_[tail & MASK];
+    }
+
+    inline void release(std::size_t id) noexcept {
+        auto& c = consumers_[id];
+        c.tail.store(c.tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    [[nodiscard]]
+    inline bool pop(std::size_t id, T& out) noexcept {
+        const T* slot = peek(id);
+        if (!slot) {
+            return false;
+        }
+        out = *slot;
+        release(id);
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Observers
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    static constexpr std::size_t capacity() noexcept {
+        return Capacity;
+    }
+
+    [[nodiscard]]
+    inline std::size_t lag(std::size_t id) const noexcept {
+        return static_cast<std::size_t>(
+            head_.index.load(std::memory_order_acquire) - consumers_[id].tail.load(std::memory_order_acquire)
+        );
+    }
+
+    [[nodiscard]]
+    inline std::size_t active_consumers() const noexcept {
+        std::size_t n = 0;
+        for (const auto& c : consumers_) {
+            n += (c.state.load(std::memory_order_acquire) == ACTIVE);
+        }
+        return n;
+    }
+
+private:
+    static constexpr std::uint64_t MASK = Capacity - 1;
+
+    static constexpr std::uint32_t FREE    = 0;
+    static constexpr std::uint32_t CLAIMED = 1;
+    static constexpr std::uint32_t ACTIVE  = 2;
+
+    struct alignas(64) Producer {
+        std::atomic<std::uint64_t> index{0};
+        // Producer-private lower bound of the slowest active tail
+        std::uint64_t cached_min_tail{0};
+    };
+
+    struct alignas(64) Consumer {
+        std::atomic<std::uint64_t> tail{0};
+        std::atomic<std::uint32_t> state{FREE};
+    };
+
+    spmc_fanout_ring() noexcept = default;
+
+    static bool fits_(void* mem, std::size_t bytes) noexcept {
+        return mem != nullptr &&
+               bytes >= sizeof(spmc_fanout_ring) &&
+               (reinterpret_cast<std::uintptr_t>(mem) % alignof(spmc_fanout_ring)) == 0;
+    }
+
+    inline std::uint64_t min_active_tail_(std::uint64_t head) const noexcept {
+        // Pairs with the fence in attach_consumer(): either this scan observes
+        // the new consumer, or the consumer observes a head >= this head.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::uint64_t min_tail = head;
+        for (const auto& c : consumers_) {
+            if (c.state.load(std::memory_order_acquire) == ACTIVE) {
+                const std::uint64_t t = c.tail.load(std::memory_order_acquire);
+                if (t < min_tail) {
+                    min_tail = t;
+                }
+            }
+        }
+        return min_tail;
+    }
+
+    header header_;
+    Producer head_;
+    std::array<Consumer, MaxConsumers> consumers_{};
+    alignas(64) T slots_[Capacity];
+};
+
+} // namespace lcr::lockfree::shm
@@ -0,0 +1,213 @@
+#pragma once
+
+/*
+===============================================================================
+Shared-Memory SPSC Ring (Zero-Copy Two-Phase API, cross-process)
+===============================================================================
+
+Variant of lcr::lockfree::spsc_ring whose entire state lives inside a caller
+provided memory region (typically a memfd / shm_open mapping from
+lcr::system::shared_memory), so that the producer and the consumer can be
+different processes.
+
+Layout (position independent, no pointers):
+
+  [ header ][ head (+ producer cache) ][ tail (+ consumer cache) ][ slots... ]
+
+  - 64-bit free-running indices (stable ABI across 32/64-bit processes)
+  - Every field on its own cache line, slots are contiguous T
+
+API semantics (same two-phase protocol as spsc_ring):
+
+  Producer:
+    acquire_producer_slot() → write in place → commit_producer_slot()
+    or discard_producer_slot()
+
+  Consumer:
+    peek_consumer_slot() → read in place → release_consumer_slot()
+
+Lifecycle:
+
+  // Producer process (creates and initializes the layout)
+  auto* ring = shm::spsc_ring<Event, 4096>::create(shm.data(), shm.size());
+
+  // Consumer process (validates the versioned header)
+  auto* ring = shm::spsc_ring<Event, 4096>::attach(shm.data(), shm.size());
+
+Constraints:
+  - T must be trivially copyable (bytes are shared, not objects)
+  - Capacity must be a power of two
+  - Usable capacity is Capacity (free-running indices)
+  - Exactly one producer process/thread, exactly one consumer process/thread
+
+===============================================================================
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include "lcr/lockfree/shm/header.hpp"
+#include "lcr/trap.hpp"
+
+
+namespace lcr::lockfree::shm {
+
+template <typename T, std::size_t Capacity>
+class alignas(64) spsc_ring {
+    static_assert((Capacity >= 2) && ((Capacity & (Capacity - 1)) == 0), "Capacity must be power of two and >= 2");
+    static_assert(std::is_trivially_copyable_v<T>, "shared-memory slots must be trivially copyable");
+    static_assert(alignof(T) <= 64, "slot alignment larger than a cache line is not supported");
+
+public:
+    spsc_ring(const spsc_ring&) = delete;
+    spsc_ring& operator=(const spsc_ring&) = delete;
+
+    // -------------------------------------------------------------------------
+    // Lifecycle
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    static constexpr std::size_t required_bytes() noexcept {
+        return sizeof(spsc_ring);
+    }
+
+    // Initialize a fresh ring in the given region (producer side)
+    [[nodiscard]]
+    static spsc_ring* create(void* mem, std::size_t bytes) noexcept {
+        if (!fits_(mem, bytes)) {
+            return nullptr;
+        }
+        auto* ring = ::new (mem) spsc_ring();
+        ring->header_.init(ring_kind::spsc, Capacity, sizeof(T), alignof(T), 1);
+        return ring;
+    }
+
+    // Attach to a ring created by another process (validates the header)
+    [[nodiscard]]
+    static spsc_ring* attach(void* mem, std::size_t bytes) noexcept {
+        if (!fits_(mem, bytes)) {
+            return nullptr;
+        }
+        auto* ring = std::launder(reinterpret_cast<spsc_ring*>(mem));
+        if (!ring->header_.matches(ring_kind::spsc, Capacity, sizeof(T), alignof(T), 1)) {
+            return nullptr;
+        }
+        return ring;
+    }
+
+    // -------------------------------------------------------------------------
+    // Producer API (two-phase)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline T* acquire_producer_slot() noexcept {
+        const std::uint64_t head = head_.index.load(std::memory_order_relaxed);
+        if (head - head_.cached_opposite >= Capacity) {
+            head_.cached_opposite = tail_.index.load(std::memory_order_acquire);
+            if (head - head_.cached_opposite >= Capacity) [[unlikely]] {
+                return nullptr; // full
+            }
+        }
+        return &slots_[head & MASK];
+    }
+
+    inline void commit_producer_slot() noexcept {
+        const std::uint64_t head = head_.index.load(std::memory_order_relaxed);
+        head_.index.store(head + 1, std::memory_order_release);
+    }
+
+    inline void discard_producer_slot() noexcept {
+        // Nothing published
+    }
+
+    [[nodiscard]]
+    inline bool push(const T& item) noexcept {
+        T* slot = acquire_producer_slot();
+        if (!slot) [[unlikely]] {
+            return false;
+        }
+        *slot = item;
+        commit_producer_slot();
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Consumer API (two-phase)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline const T* peek_consumer_slot() noexcept {
+        const std::uint64_t tail = tail_.index.load(std::memory_order_relaxed);
+        if (tail == tail_.cached_opposite) {
+            tail_.cached_opposite = head_.index.load(std::memory_order_acquire);
+            if (tail == tail_.cached_opposite) [[unlikely]] {
+                return nullptr; // empty
+            }
+        }
+        return &slots_[tail & MASK];
+    }
+
+    inline void release_consumer_slot() noexcept {
+        const std::uint64_t tail = tail_.index.load(std::memory_order_relaxed);
+        tail_.index.store(tail + 1, std::memory_order_release);
+    }
+
+    [[nodiscard]]
+    inline bool pop(T& out) noexcept {
+        const T* slot = peek_consumer_slot();
+        if (!slot) {
+            return false;
+        }
+        out = *slot;
+        release_consumer_slot();
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Observers (approximate while both sides are active)
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    static constexpr std::size_t capacity() noexcept {
+        return Capacity;
+    }
+
+    [[nodiscard]]
+    inline std::size_t used() const noexcept {
+        return static_cast<std::size_t>(
+            head_.index.load(std::memory_order_acquire) - tail_.index.load(std::memory_order_acquire)
+        );
+    }
+
+    [[nodiscard]]
+    inline bool empty() const noexcept {
+        return used() == 0;
+    }
+
+private:
+    static constexpr std::uint64_t MASK = Capacity - 1;
+
+    struct alignas(64) Index {
+        std::atomic<std::uint64_t> index{0};
+        // Side-private cache of the opposite index (only touched by the owner)
+        std::uint64_t cached_opposite{0};
+    };
+
+    spsc_ring() noexcept = default;
+
+    static bool fits_(void* mem, std::size_t bytes) noexcept {
+        return mem != nullptr &&
+               bytes >= sizeof(spsc_ring) &&
+               (reinterpret_cast<std::uintptr_t>(mem) % alignof(spsc_ring)) == 0;
+    }
+
+    header header_;
+    Index head_;
+    Index tail_;
+    alignas(64) T slots_[Capacity];
+};
+
+} // namespace lcr::lockfree::shm
@@ -0,0 +1,144 @@
+/*
+================================================================================
+ seqlock<T>
+================================================================================
+
+A single-writer / multi-reader sequence lock for small, trivially copyable
+records that are overwritten at high frequency (quotes, top-of-book, counters).
+
+Compared with `last_value_snapshot<T>`:
+
+  • One copy of T instead of two (the whole slot can fit one cache line)
+  • Writers never wait, readers retry only if they overlap a write
+  • Requires T to be trivially copyable
+
+--------------------------------------------------------------------------------
+ Concurrency model
+--------------------------------------------------------------------------------
+
+  • Single writer
+      - Exactly one thread may call `store()`
+
+  • Multiple readers
+      - `try_load()` is wait-free: one attempt, fails if a write overlapped
+      - `load()` retries until it obtains a consistent copy (lock-free:
+        it can only spin while the writer is making progress)
+
+--------------------------------------------------------------------------------
+ Memory ordering
+--------------------------------------------------------------------------------
+
+The payload is stored as an array of relaxed 64-bit atomic words so that
+concurrent reads and writes are never a data race (TSAN clean).
+
+Writer:
+    1) sequence → odd (relaxed), release fence
+    2) payload words (relaxed)
+    3) sequence → even (release)
+
+Reader:
+    1) sequence (acquire), reject if odd
+    2) payload words (relaxed), acquire fence
+    3) sequence (relaxed), accept only if unchanged
+
+The sequence value doubles as an update counter: `version() / 2` is the
+number of completed stores.
+
+================================================================================
+*/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace lcr::lockfree::slot {
+
+template <typename T>
+class seqlock {
+    static_assert(std::is_trivially_copyable_v<T>, "seqlock<T> requires T to be trivially copyable");
+
+    static constexpr std::size_t WORDS = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+public:
+    seqlock() noexcept = default;
+    ~seqlock() noexcept = default;
+
+    seqlock(const seqlock&) = delete;
+    seqlock& operator=(const seqlock&) = delete;
+
+    // ============================================================
+    // Writer API (single thread only)
+    // ============================================================
+
+    inline void store(const T& value) noexcept {
+        std::uint64_t buffer[WORDS] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        const std::uint64_t s = seq_.load(std::memory_order_relaxed);
+        seq_.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+
+        seq_.store(s + 2, std::memory_order_release);
+    }
+
+    // ============================================================
+    // Reader API (multi-thread safe)
+    // ============================================================
+
+    // Single attempt. Returns false if a write was in progress or overlapped.
+    [[nodiscard]]
+    inline bool try_load(T& out) const noexcept {
+        std::uint64_t version;
+        return try_load(out, version);
+    }
+
+    [[nodiscard]]
+    inline bool try_load(T& out, std::uint64_t& version) const noexcept {
+        const std::uint64_t s1 = seq_.load(std::memory_order_acquire);
+        if (s1 & 1u) {
+            return false;
+        }
+
+        std::uint64_t buffer[WORDS];
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq_.load(std::memory_order_relaxed) != s1) {
+            return false;
+        }
+
+        std::memcpy(&out, buffer, sizeof(T));
+        version = s1;
+        return true;
+    }
+
+    // Retries until a consistent copy is obtained.
+    inline std::uint64_t load(T& out) const noexcept {
+        std::uint64_t version;
+        while (!try_load(out, version)) {
+            // writer in progress
+        }
+        return version;
+    }
+
+    // Even value = stable, odd value = write in progress
+    [[nodiscard]]
+    inline std::uint64_t version() const noexcept {
+        return seq_.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<std::uint64_t> seq_{0};
+    std::atomic<std::uint64_t> words_[WORDS]{};
+};
+
+} // namespace lcr::lockfree::slot
@@ -9,9 +9,13 @@
 //     • Each consumer has its own read index (tail)
 //     • Consumers must register before producer starts pushing.
 //     • The producer tracks the slowest consumer to prevent overwrite
-//     • NOT constant-time for producer when many consumers
-//       - Push cost = O(number of active consumers). For small MaxConsumers (≤16) is fine but
-//       - for 64+ consumers, this becomes a scaling issue.
+//     • Near constant-time producer regardless of consumer count (default)
+//       - The producer keeps a private cached minimum tail and only rescans
+//         the consumer tails when it reaches the cached bound
+//       - Rescan cost = O(number of active consumers), amortized over up to
+//         Capacity pushes when consumers keep up
+//       - tail_tracking::scan restores the legacy behavior (rescan on every
+//         push, O(number of active consumers) per push)
 //
 // Example:
 //     spmc_fanout_ring<Event*, 1024, 8> queue;
@@ -21,6 +25,12 @@
 //     Event* ev;
 //     queue.pop(c1, ev); // Consumer 1
 //
+//     // Zero-copy consumption (item stays shared by all consumers)
+//     if (const Event* const* p = queue.peek(c2)) {
+//         handle(*p);
+//         queue.release(c2);
+//     }
+//
 // Design Highlights:
 //     • Lock-free and wait-free per operation (no mutexes, no spinning)
 //     • All atomics use relaxed/acquire/release ordering — never seq_cst
@@ -34,7 +44,7 @@
 // Performance Characteristics:
 //     • Push latency: ~2–6 ns typical (L1-resident)
 //     • Pop latency: ~3–8 ns typical per consumer
-//     • Scales up to 8–16 consumers with near-linear throughput
+//     • Producer cost stays flat up to 128+ consumers with cached tail tracking
 //     • Producer never waits unless all consumers are lagging
 //     • Predictable memory access pattern — perfect for ULL or RT systems
 //
@@ -42,6 +52,13 @@
 //     • Capacity must be a power of two (compile-time check)
 //     • Register consumers before use (fixed maximum count)
 //     • Each consumer reads independently; producer safety ensured
+//     • pop() copies the item: every consumer observes the same value
+//     • peek()/release() give in-place access without copying
+//     • lag() and resync() let the owner implement slow-consumer policies
+//     • claim()/reclaim() let the producer itself advance a stalled consumer:
+//       a consumer reading through claim() marks the slot it is reading, and
+//       reclaim() only moves tails that are not marked. A consumer using
+//       claim() must not use pop()/peek() (they do not mark the slot)
 //     • Not thread-safe for multiple producers (use MPMC variant if needed)
 //
 // -----------------------------------------------------------------------------
@@ -57,7 +74,13 @@
 
 namespace lcr::lockfree {
 
-template <typename T, size_t Capacity, size_t MaxConsumers>
+// How the producer computes the slowest consumer position
+enum class tail_tracking {
+    cached, // rescan consumer tails only when the cached bound is reached
+    scan    // rescan consumer tails on every push
+};
+
+template <typename T, size_t Capacity, size_t MaxConsumers, tail_tracking Tracking = tail_tracking::cached>
 class alignas(64) spmc_fanout_ring {
     static_assert((Capacity >= 2) && ((Capacity & (Capacity - 1)) == 0), "Capacity must be power of two and >= 2");
 
@@ -85,9 +108,7 @@ public:
     bool push(T&& item) noexcept {
         const size_t head = head_.load(std::memory_order_relaxed);
 
-        const size_t min_tail = min_consumer_tail();
-
-        if (head - min_tail >= Capacity)
+        if (!has_room_(head))
             return false; // full
 
         buffer_[head & MASK] = std::move(item);
@@ -99,9 +120,7 @@ public:
     bool push(const T& item) noexcept {
         const size_t head = head_.load(std::memory_order_relaxed);
 
-        const size_t min_tail = min_consumer_tail();
-
-        if (head - min_tail >= Capacity)
+        if (!has_room_(head))
             return false;
 
         buffer_[head & MASK] = item;
@@ -112,7 +131,7 @@ public:
 
     // Consumer pop
     bool pop(size_t consumer_id, T& out) noexcept {
-        if (consumer_id >= consumer_count_.load(std::memory_order_acquire))
+        if (consumer_id >= consumer_count())
             return false;
 
         auto& tail = consumer_tails_[consumer_id].value;
@@ -124,12 +143,137 @@ public:
         if (local_tail == head)
             return false; // empty
 
-        out = std::move(buffer_[local_tail & MASK]);
+        // Copy (never move): the slot is shared by every registered consumer
+        out = buffer_[local_tail & MASK];
 
         tail.store(local_tail + 1, std::memory_order_release);
         return true;
     }
 
+    // Consumer zero-copy access to the next item (nullptr if empty)
+    [[nodiscard]]
+    const T* peek(size_t consumer_id) const noexcept {
+        if (consumer_id >= consumer_count())
+            return nullptr;
+
+        const size_t local_tail = consumer_tails_[consumer_id].value.load(std::memory_order_relaxed);
+
+        if (local_tail == head_.load(std::memory_order_acquire))
+            return nullptr; // empty
+
+        return &buffer_[local_tail & MASK];
+    }
+
+    // Consumer releases the item obtained by peek() or claim()
+    void release(size_t consumer_id) noexcept {
+        auto& tail = consumer_tails_[consumer_id].value;
+        tail.store((tail.load(std::memory_order_relaxed) & ~CLAIMED) + 1, std::memory_order_release);
+    }
+
+    // Consumer zero-copy access to the next item (nullptr if empty).
+    // The slot stays claimed until release() or unclaim(): reclaim() cannot
+    // move this consumer while it is reading.
+    [[nodiscard]]
+    const T* claim(size_t consumer_id) noexcept {
+        if (consumer_id >= consumer_count())
+            return nullptr;
+
+        auto& tail = consumer_tails_[consumer_id].value;
+
+        size_t local_tail = tail.load(std::memory_order_relaxed);
+
+        for (;;) {
+            if (local_tail == head_.load(std::memory_order_acquire))
+                return nullptr; // empty
+
+            // Fails only if the producer reclaimed the backlog meanwhile
+            if (tail.compare_exchange_weak(local_tail, local_tail | CLAIMED,
+                                           std::memory_order_acquire, std::memory_order_relaxed))
+                return &buffer_[local_tail & MASK];
+        }
+    }
+
+    // Consumer gives back the item obtained by claim() without consuming it
+    void unclaim(size_t consumer_id) noexcept {
+        auto& tail = consumer_tails_[consumer_id].value;
+        tail.store(tail.load(std::memory_order_relaxed) & ~CLAIMED, std::memory_order_release);
+    }
+
+    // Producer moves an unclaimed consumer to the live edge.
+    // On success returns the number of skipped items and sets 'from' to the
+    // first one: items [from, from + n) stay readable by the producer until
+    // its next push. Returns 0 if the consumer is reading (claimed) or empty.
+    size_t reclaim(size_t consumer_id, size_t& from) noexcept {
+        if (consumer_id >= consumer_count())
+            return 0;
+
+        auto& tail = consumer_tails_[consumer_id].value;
+
+        size_t local_tail = tail.load(std::memory_order_acquire);
+        const size_t head = head_.load(std::memory_order_relaxed);
+
+        if ((local_tail & CLAIMED) || local_tail == head)
+            return 0;
+
+        if (!tail.compare_exchange_strong(local_tail, head,
+                                          std::memory_order_acq_rel, std::memory_order_relaxed))
+            return 0; // consumer moved meanwhile (it is making progress)
+
+        from = local_tail;
+        return head - local_tail;
+    }
+
+    // Producer access to an item it published (e.g. after reclaim())
+    [[nodiscard]]
+    const T& at(size_t index) const noexcept {
+        return buffer_[index & MASK];
+    }
+
+    // Consumer skips every pending item and jumps to the live edge.
+    // Returns the number of skipped items.
+    size_t resync(size_t consumer_id) noexcept {
+        if (consumer_id >= consumer_count())
+            return 0;
+
+        auto& tail = consumer_tails_[consumer_id].value;
+
+        const size_t local_tail = tail.load(std::memory_order_relaxed);
+        const size_t head = head_.load(std::memory_order_acquire);
+
+        tail.store(head, std::memory_order_release);
+        return head - local_tail;
+    }
+
+    // Number of items published but not yet consumed by the given consumer.
+    // Safe to call from any thread (approximate while both sides are active).
+    [[nodiscard]]
+    size_t lag(size_t consumer_id) const noexcept {
+        if (consumer_id >= consumer_count())
+            return 0;
+
+        const size_t tail = consumer_tails_[consumer_id].value.load(std::memory_order_acquire) & ~CLAIMED;
+        const size_t head = head_.load(std::memory_order_acquire);
+
+        return head - tail;
+    }
+
+    [[nodiscard]]
+    bool empty(size_t consumer_id) const noexcept {
+        return lag(consumer_id) == 0;
+    }
+
+    // Producer view: true if no slot can be written without overwriting
+    [[nodiscard]]
+    bool full() const noexcept {
+        return head_.load(std::memory_order_relaxed) - min_consumer_tail() >= Capacity;
+    }
+
+    [[nodiscard]]
+    size_t consumer_count() const noexcept {
+        const size_t count = consumer_count_.load(std::memory_order_acquire);
+        return (count < MaxConsumers) ? count : MaxConsumers;
+    }
+
     constexpr size_t capacity() const noexcept {
         return Capacity;
     }
@@ -137,10 +281,17 @@ public:
 private:
     static constexpr size_t MASK = Capacity - 1;
 
+    // Tail bit set while a consumer reads the slot it obtained by claim()
+    static constexpr size_t CLAIMED = size_t{1} << (std::numeric_limits<size_t>::digits - 1);
+
     alignas(64) std::array<T, Capacity> buffer_;
 
     alignas(64) std::atomic<size_t> head_{0};
 
+    // Producer-private lower bound of the slowest consumer tail.
+    // Tails only move forward, so a stale value is always conservative.
+    size_t cached_min_tail_{0};
+
     struct alignas(64) padded_atomic {
         std::atomic<size_t> value{0};
     };
@@ -149,13 +300,27 @@ private:
 
     alignas(64) std::atomic<size_t> consumer_count_{0};
 
+    // Producer-side capacity check
+    bool has_room_(size_t head) noexcept {
+        if constexpr (Tracking == tail_tracking::cached) {
+            if (head - cached_min_tail_ < Capacity) [[likely]]
+                return true;
+            // Cached bound reached → refresh from consumer tails
+            cached_min_tail_ = min_consumer_tail();
+            return head - cached_min_tail_ < Capacity;
+        }
+        else {
+            return head - min_consumer_tail() < Capacity;
+        }
+    }
+
     size_t min_consumer_tail() const noexcept {
-        const size_t count = consumer_count_.load(std::memory_order_acquire);
+        const size_t count = consumer_count();
 
         size_t min_tail = std::numeric_limits<size_t>::max();
 
         for (size_t i = 0; i < count; ++i) {
-            const size_t t = consumer_tails_[i].value.load(std::memory_order_acquire);
+            const size_t t = consumer_tails_[i].value.load(std::memory_order_acquire) & ~CLAIMED;
             if (t < min_tail)
                 min_tail = t;
         }
@@ -0,0 +1,184 @@
+#pragma once
+
+/*
+===============================================================================
+lcr::system::event_notifier
+===============================================================================
+
+Edge-triggered wake-up channel between a producer thread and a consumer that
+wants to sleep in epoll/poll instead of spinning.
+
+Backend (Linux): a non-blocking eventfd. The fd becomes readable when the
+producer signals and can be registered in any epoll set.
+
+Edge triggering:
+  • The consumer arms the notifier before going to sleep
+  • The producer writes to the eventfd only if the notifier is armed, and
+    disarms it in the same step
+
+So a burst of N commits costs one syscall (the empty → non-empty edge), and
+a consumer that keeps up never causes any.
+
+-------------------------------------------------------------------------------
+Usage:
+-------------------------------------------------------------------------------
+
+  // Producer (after publishing work)
+  notifier.notify();
+
+  // Consumer
+  notifier.arm();
+  if (work_pending()) { ... don't sleep, process ... }
+  else                { epoll_wait(...) / notifier.wait(timeout); }
+  notifier.consume();
+
+-------------------------------------------------------------------------------
+Notes:
+-------------------------------------------------------------------------------
+
+  • arm() and notify() are ordered by full fences: a producer that published
+    work before the consumer armed is always seen by the consumer's re-check
+    (no lost wake-up).
+  • No exceptions: open() reports failure with false.
+  • Not supported outside Linux (open() fails, notify() is a no-op).
+
+===============================================================================
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+
+namespace lcr::system {
+
+class event_notifier {
+public:
+    event_notifier() noexcept = default;
+
+    ~event_notifier() {
+        close();
+    }
+
+    event_notifier(const event_notifier&) = delete;
+    event_notifier& operator=(const event_notifier&) = delete;
+
+    // ------------------------------------------------------------
+    // Lifecycle
+    // ------------------------------------------------------------
+
+    [[nodiscard]]
+    inline bool open() noexcept {
+#ifdef __linux__
+        if (fd_ >= 0) {
+            return true;
+        }
+        fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        return fd_ >= 0;
+#else
+        return false;
+#endif
+    }
+
+    inline void close() noexcept {
+#ifdef __linux__
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+        armed_.store(false, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    inline bool is_open() const noexcept {
+        return fd_ >= 0;
+    }
+
+    // Pollable file descriptor (-1 if not open)
+    [[nodiscard]]
+    inline int fd() const noexcept {
+        return fd_;
+    }
+
+    // ------------------------------------------------------------
+    // Producer
+    // ------------------------------------------------------------
+
+    // Wakes the consumer if it is armed. Cheap when it is not (one fence
+    // and one relaxed load).
+    inline void notify() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!armed_.load(std::memory_order_relaxed)) [[likely]] {
+            return;
+        }
+        if (armed_.exchange(false, std::memory_order_acq_rel)) {
+            signal_();
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Consumer
+    // ------------------------------------------------------------
+
+    // Requests a wake-up on the next notify(). The caller MUST re-check
+    // for pending work after arming and before sleeping.
+    inline void arm() noexcept {
+        armed_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    inline void disarm() noexcept {
+        armed_.store(false, std::memory_order_relaxed);
+    }
+
+    // Resets the readable state of the fd (call after waking up)
+    inline void consume() noexcept {
+#ifdef __linux__
+        if (fd_ >= 0) {
+            std::uint64_t value;
+            [[maybe_unused]] auto n = ::read(fd_, &value, sizeof(value));
+        }
+#endif
+    }
+
+    // Blocks until notified or until the timeout expires.
+    // Returns true if notified.
+    [[nodiscard]]
+    inline bool wait(std::chrono::milliseconds timeout) noexcept {
+#ifdef __linux__
+        if (fd_ < 0) {
+            return false;
+        }
+        pollfd pfd{fd_, POLLIN, 0};
+        const int r = ::poll(&pfd, 1, static_cast<int>(timeout.count()));
+        if (r > 0) {
+            consume();
+            return true;
+        }
+        return false;
+#else
+        (void)timeout;
+        return false;
+#endif
+    }
+
+private:
+    int fd_{-1};
+    std::atomic<bool> armed_{false};
+
+    inline void signal_() noexcept {
+#ifdef __linux__
+        const std::uint64_t one = 1;
+        [[maybe_unused]] auto n = ::write(fd_, &one, sizeof(one));
+#endif
+    }
+};
+
+} // namespace lcr::system
@@ -0,0 +1,238 @@
+#pragma once
+
+/*
+===============================================================================
+lcr::system::shared_memory
+===============================================================================
+
+RAII owner of a shared memory mapping usable across processes.
+
+Backends (POSIX):
+  • memfd_create  → anonymous segment, shared by passing the fd
+                    (fork inheritance, SCM_RIGHTS, /proc/<pid>/fd/<fd>)
+  • shm_open      → named segment under /dev/shm, attachable by name
+
+Design goals:
+  • No exceptions (ULL-safe): every operation returns bool
+  • No allocations (names are copied into a fixed buffer for unlinking)
+  • Mapping is MAP_SHARED + read/write, optionally pre-faulted (MAP_POPULATE)
+  • The creator of a named segment unlinks it on destruction (configurable)
+
+-------------------------------------------------------------------------------
+Usage:
+-------------------------------------------------------------------------------
+
+  // Feed handler (creator)
+  lcr::system::shared_memory shm;
+  if (!shm.create("/wk.market", bytes)) { ... }
+
+  // Strategy process (attacher)
+  lcr::system::shared_memory shm;
+  if (!shm.open("/wk.market")) { ... }
+
+  void* base = shm.data();
+
+-------------------------------------------------------------------------------
+Notes:
+-------------------------------------------------------------------------------
+
+  • Data structures placed in the segment MUST be position independent
+    (indices only, no pointers): each process maps it at a different address.
+  • Not supported on Windows (all operations fail).
+
+===============================================================================
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace lcr::system {
+
+class shared_memory {
+public:
+    shared_memory() noexcept = default;
+
+    ~shared_memory() {
+        close();
+    }
+
+    shared_memory(const shared_memory&) = delete;
+    shared_memory& operator=(const shared_memory&) = delete;
+
+    shared_memory(shared_memory&& other) noexcept {
+        swap_(other);
+    }
+
+    shared_memory& operator=(shared_memory&& other) noexcept {
+        if (this != &other) {
+            close();
+            swap_(other);
+        }
+        return *this;
+    }
+
+    // -------------------------------------------------------------------------
+    // Create a named segment (shm_open). Fails if it already exists.
+    // -------------------------------------------------------------------------
+    [[nodiscard]]
+    inline bool create(const char* name, std::size_t size, bool unlink_on_close = true) noexcept {
+#ifndef _WIN32
+        close();
+        const int fd = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            return false;
+        }
+        if (!size_and_map_(fd, size)) {
+            ::shm_unlink(name);
+            return false;
+        }
+        if (unlink_on_close) {
+            const std::size_t n = std::strlen(name);
+            if (n < unlink_name_.size()) {
+                std::memcpy(unlink_name_.data(), name, n + 1);
+            }
+        }
+        return true;
+#else
+        (void)name; (void)size; (void)unlink_on_close;
+        return false;
+#endif
+    }
+
+    // -------------------------------------------------------------------------
+    // Create an anonymous segment (memfd_create). Share it through fd().
+    // -------------------------------------------------------------------------
+    [[nodiscard]]
+    inline bool create_anonymous(const char* debug_name, std::size_t size) noexcept {
+#if defined(__linux__)
+        close();
+        const int fd = ::memfd_create(debug_name, MFD_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+        return size_and_map_(fd, size);
+#else
+        (void)debug_name; (void)size;
+        return false;
+#endif
+    }
+
+    // -------------------------------------------------------------------------
+    // Attach to an existing named segment (size taken from the segment)
+    // -------------------------------------------------------------------------
+    [[nodiscard]]
+    inline bool open(const char* name) noexcept {
+#ifndef _WIN32
+        close();
+        const int fd = ::shm_open(name, O_RDWR, 0600);
+        if (fd < 0) {
+            return false;
+        }
+        return map_existing_(fd);
+#else
+        (void)name;
+        return false;
+#endif
+    }
+
+    // -------------------------------------------------------------------------
+    // Attach to an existing segment from a file descriptor (takes ownership)
+    // -------------------------------------------------------------------------
+    [[nodiscard]]
+    inline bool open_fd(int fd) noexcept {
+#ifndef _WIN32
+        close();
+        return map_existing_(fd);
+#else
+        (void)fd;
+        return false;
+#endif
+    }
+
+    inline void close() noexcept {
+#ifndef _WIN32
+        if (data_) {
+            ::munmap(data_, size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        if (unlink_name_[0] != '\0') {
+            ::shm_unlink(unlink_name_.data());
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        fd_ = -1;
+        unlink_name_[0] = '\0';
+    }
+
+    // -------------------------------------------------------------------------
+    // Accessors
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] inline void* data() const noexcept { return data_; }
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline int fd() const noexcept { return fd_; }
+    [[nodiscard]] inline bool valid() const noexcept { return data_ != nullptr; }
+
+private:
+    void* data_ = nullptr;
+    std::size_t size_ = 0;
+    int fd_ = -1;
+    std::array<char, 256> unlink_name_{}; // set only for created named segments
+
+#ifndef _WIN32
+    inline bool size_and_map_(int fd, std::size_t size) noexcept {
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            return false;
+        }
+        return map_(fd, size);
+    }
+
+    inline bool map_existing_(int fd) noexcept {
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        return map_(fd, static_cast<std::size_t>(st.st_size));
+    }
+
+    inline bool map_(int fd, std::size_t size) noexcept {
+        int flags = MAP_SHARED;
+#if defined(__linux__)
+        flags |= MAP_POPULATE; // pre-fault: no page faults on the hot path
+#endif
+        void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        data_ = p;
+        size_ = size;
+        fd_ = fd;
+        return true;
+    }
+#endif
+
+    inline void swap_(shared_memory& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(fd_, other.fd_);
+        std::swap(unlink_name_, other.unlink_name_);
+    }
+};
+
+} // namespace lcr::system
@@ -171,4 +171,6 @@ Wirekrak Core is built to evolve without breaking contracts.
 #include "wirekrak/core/transport/websocket/engine.hpp"
 #include "wirekrak/core/transport/connection.hpp"
 #include "wirekrak/core/protocol/session.hpp"
+#include "wirekrak/core/protocol/runner.hpp"
+#include "wirekrak/core/protocol/session_group.hpp"
 #include "wirekrak/core/protocol/kraken_model.hpp"
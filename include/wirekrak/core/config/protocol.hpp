@@ -56,6 +56,14 @@ inline constexpr static std::size_t TX_BATCH_QUEUE_CAPACITY =  1 << 8; // 256
 // -----------------------------------------------------------------------------
 inline constexpr static std::size_t TX_BATCH_BUFFER_CAPACITY =  1 << 10; // 1 KiB
 
+// -----------------------------------------------------------------------------
+// Conflation limits
+// -----------------------------------------------------------------------------
+// Trades kept by one conflated trade entry (per symbol). Past it, the oldest
+// trades of the entry are discarded: a consumer that stays behind its trade
+// ring for longer sees only the most recent prints.
+inline constexpr static std::size_t MAX_CONFLATED_TRADES     = 1 << 8; // 256
+
 // -----------------------------------------------------------------------------
 // Message batch processing limits
 // -----------------------------------------------------------------------------
@@ -0,0 +1,858 @@
+#pragma once
+
+/*
+===============================================================================
+feed::BookStore - Full-depth order books per symbol, loaded in place
+===============================================================================
+
+A SymbolId-indexed store of full-depth books (up to Depth levels per side),
+written by the session thread.
+
+Two ways to feed it:
+
+  • Streaming (no intermediate messages): the Kraken router parses book
+    messages straight into the store staging buffer and commits them, and
+    only a schema::book::SnapshotApplied event reaches the data plane
+    (see kraken/book_sink.hpp):
+
+        using Model = BasicKrakenModel<
+            policy::protocol::DefaultValidation,
+            kraken::NoChannelFilter,
+            kraken::book_sink::Into<feed::BookStore<1000>>
+        >;
+        feed::BookStore<1000> books;
+        session.message_handler().attach_book_store(books);
+
+  • From book messages drained from the data plane:
+
+        session.data_plane().drain<schema::book::Response>([&](const auto& r) {
+            books.apply(r);
+        });
+
+Layout:
+  • Each side is a sorted ladder stored worst → best, with free room at both
+    ends: updates near the top shift only the levels above them, truncating
+    the worst level is O(1), and a snapshot is one bulk copy (Kraken sends
+    levels already sorted, best first)
+  • Books are allocated on the first snapshot of a symbol (or by reserve()),
+    never afterwards
+
+Analytics (BookAnalyticsPolicy, DefaultBookAnalytics):
+  • Each side keeps the quantity of its top N levels and the cumulative
+    quantity within price bands around its best price (e.g. 10/50/100 bps),
+    updated incrementally as levels change: O(1) per level below the best,
+    a full recompute (contiguous multi-accumulator sums) only when the best
+    price of that side moves
+  • Book::microprice(), imbalance() and bid_depth() / ask_depth() read them
+    in O(1); NoBookAnalytics compiles the bookkeeping out
+
+Time to first full book:
+  • expect_book(id, ticket) marks one book as awaited (stale until its next
+    snapshot); the snapshot clears the mark, cancel_book(id, ticket) drops
+    it (rejected or unsubscribed) and restores the previous validity
+  • begin_epoch() marks every book stale and forgets every awaited book
+  • time_to_full_book_ns() reports the time from the first awaited book to
+    the last one cleared (0 while any is awaited)
+  • With book_sink::Into<BookStore>, the session drives all three: book
+    subscribes with snapshot (including replays and shedding resyncs) call
+    expect_book() with their req_id, rejections and unsubscribes call
+    cancel_book(), reconnects call begin_epoch()
+
+Symbols:
+  • Books are indexed by SymbolId; messages of symbols interned at or beyond
+    MaxSymbols are dropped and counted (dropped_symbols())
+
+Concurrency:
+  • Single writer and readers on the session thread (not thread-safe)
+
+===============================================================================
+*/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+
+#include "wirekrak/core/protocol/kraken/schema/book/response.hpp"
+#include "wirekrak/core/protocol/kraken/enums/payload_type.hpp"
+#include "wirekrak/core/symbol/intern.hpp"
+#include "wirekrak/core/timestamp.hpp"
+#include "lcr/system/monotonic_clock.hpp"
+#include "lcr/optional.hpp"
+#include "lcr/trap.hpp"
+
+
+namespace wirekrak::core::feed {
+
+using BookLevel = protocol::kraken::schema::book::Level;
+
+// ============================================================================
+// Analytics policy
+// ============================================================================
+//
+// top_levels : levels per side summed for imbalance() (capped at the depth)
+// band_bps   : ascending price bands, in basis points of the best price of
+//              each side, for cumulative depth
+//
+// ============================================================================
+
+template<std::size_t TopLevels, std::uint32_t... BandBps>
+struct BookAnalyticsPolicy {
+    static_assert(TopLevels > 0, "BookAnalyticsPolicy needs at least one top level");
+
+    static constexpr bool enabled = true;
+    static constexpr std::size_t top_levels = TopLevels;
+    static constexpr std::array<std::uint32_t, sizeof...(BandBps)> band_bps{ BandBps... };
+
+    static_assert(std::is_sorted(band_bps.begin(), band_bps.end()), "BookAnalyticsPolicy bands must be ascending");
+};
+
+struct NoBookAnalytics {
+    static constexpr bool enabled = false;
+    static constexpr std::size_t top_levels = 0;
+    static constexpr std::array<std::uint32_t, 0> band_bps{};
+};
+
+// Top 10 levels, 10 / 50 / 100 bps bands
+using DefaultBookAnalytics = BookAnalyticsPolicy<10, 10, 50, 100>;
+
+template<class P>
+concept BookAnalyticsConcept =
+requires {
+    { P::enabled } -> std::same_as<const bool&>;
+    { P::top_levels } -> std::convertible_to<std::size_t>;
+    { P::band_bps.size() } -> std::convertible_to<std::size_t>;
+};
+
+// ============================================================================
+// BookLadder - one side of a book
+// ============================================================================
+//
+// Better(a, b) is true when price a is better than price b
+// (std::greater for bids, std::less for asks).
+//
+// ============================================================================
+
+template<std::size_t Depth, class Better, BookAnalyticsConcept Analytics = NoBookAnalytics>
+class BookLadder {
+    static_assert(Depth > 0, "BookLadder depth must be positive");
+
+    static constexpr std::size_t CAPACITY = 2 * Depth;  // Depth levels + Depth free slots
+    static constexpr std::size_t TOP      = std::min(Analytics::top_levels, Depth);
+    static constexpr std::size_t BANDS    = Analytics::band_bps.size();
+
+public:
+    BookLadder()
+        : levels_(std::make_unique<BookLevel[]>(CAPACITY)) {}
+
+    // ------------------------------------------------------------
+    // Readers
+    // ------------------------------------------------------------
+
+    [[nodiscard]]
+    inline std::size_t size() const noexcept {
+        return end_ - begin_;
+    }
+
+    [[nodiscard]]
+    inline bool empty() const noexcept {
+        return end_ == begin_;
+    }
+
+    // i-th best level (0 = best)
+    [[nodiscard]]
+    inline const BookLevel& operator[](std::size_t i) const noexcept {
+        LCR_ASSERT_MSG(i < size(), "BookLadder index out of range");
+        return levels_[end_ - 1 - i];
+    }
+
+    [[nodiscard]]
+    inline const BookLevel& best() const noexcept {
+        return (*this)[0];
+    }
+
+    // All levels, worst → best
+    [[nodiscard]]
+    inline std::span<const BookLevel> worst_to_best() const noexcept {
+        return { levels_.get() + begin_, size() };
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t depth() noexcept {
+        return Depth;
+    }
+
+    // ------------------------------------------------------------
+    // Analytics (Analytics::enabled)
+    // ------------------------------------------------------------
+
+    // Quantity of the top min(top_levels, Depth) levels
+    [[nodiscard]]
+    inline double top_qty() const noexcept {
+        return top_qty_;
+    }
+
+    // Cumulative quantity within Analytics::band_bps[band] of the best price
+    [[nodiscard]]
+    inline double band_qty(std::size_t band) const noexcept {
+        LCR_ASSERT_MSG(band < BANDS, "BookLadder band out of range");
+        return band_qty_[band];
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t bands() noexcept {
+        return BANDS;
+    }
+
+    // ------------------------------------------------------------
+    // Writers
+    // ------------------------------------------------------------
+
+    inline void clear() noexcept {
+        begin_ = end_ = Depth;
+        if constexpr (Analytics::enabled) {
+            recompute_stats_();
+        }
+    }
+
+    // Bulk load from levels sorted best first (snapshot order).
+    // Returns false if the input was not sorted (the ladder is sorted anyway).
+    inline bool assign_best_first(const BookLevel* levels, std::size_t count) noexcept {
+        count = std::min(count, Depth);
+        begin_ = (CAPACITY - count) / 2;
+        end_   = begin_ + count;
+
+        bool sorted = true;
+        BookLevel* out = levels_.get() + end_;
+        for (std::size_t i = 0; i < count; ++i) {
+            *--out = levels[i];
+            sorted &= (i == 0) || Better{}(levels[i - 1].price, levels[i].price);
+        }
+        if (!sorted) [[unlikely]] {
+            std::sort(levels_.get() + begin_, levels_.get() + end_,
+                      [](const BookLevel& a, const BookLevel& b) { return Better{}(b.price, a.price); });
+        }
+        if constexpr (Analytics::enabled) {
+            recompute_stats_();
+        }
+        return sorted;
+    }
+
+    // Incremental update: qty > 0 inserts or replaces the level, qty == 0
+    // deletes it. The worst level is dropped beyond Depth.
+    inline void apply(const BookLevel& level) noexcept {
+        BookLevel* first = levels_.get() + begin_;
+        BookLevel* last  = levels_.get() + end_;
+        // First level not worse than the new price
+        BookLevel* it = std::lower_bound(first, last, level.price,
+            [](const BookLevel& l, double price) { return Better{}(price, l.price); });
+        const std::size_t pos = static_cast<std::size_t>(it - levels_.get());
+
+        if (it != last && it->price == level.price) {
+            if (level.qty > 0.0) {
+                if constexpr (Analytics::enabled) {
+                    on_replace_(end_ - 1 - pos, level.price, level.qty - it->qty);
+                }
+                it->qty = level.qty;
+            }
+            else {
+                [[maybe_unused]] const BookLevel removed = *it;
+                [[maybe_unused]] const std::size_t rank = end_ - 1 - pos;
+                erase_(pos);
+                if constexpr (Analytics::enabled) {
+                    on_erase_(rank, removed);
+                }
+            }
+            return;
+        }
+        if (level.qty > 0.0) {
+            [[maybe_unused]] const std::size_t rank = end_ - pos;   // levels better than the new one
+            insert_(pos, level);
+            if constexpr (Analytics::enabled) {
+                on_insert_(rank, level);
+            }
+            if (size() > Depth) {
+                if constexpr (Analytics::enabled) {
+                    on_drop_worst_(levels_[begin_]);
+                }
+                ++begin_;  // drop the worst level
+            }
+        }
+    }
+
+private:
+    std::unique_ptr<BookLevel[]> levels_;
+    std::size_t begin_ = Depth;
+    std::size_t end_   = Depth;
+
+    // Analytics
+    double top_qty_ = 0.0;
+    std::array<double, BANDS> band_qty_{};
+    std::array<double, BANDS> band_span_{};     // price distance from the best covered by each band
+
+    BookLevel* at_(std::size_t i) noexcept {
+        return levels_.get() + i;
+    }
+
+    // ------------------------------------------------------------
+    // Analytics bookkeeping
+    // ------------------------------------------------------------
+    //
+    // Ranks count from the best level (0). A level change below the best
+    // only moves the sums by its own quantity (plus the level crossing the
+    // top-N boundary); a new best moves every band, so both are recomputed.
+    //
+
+    [[nodiscard]]
+    inline bool in_band_(double price, std::size_t band) const noexcept {
+        return std::abs(price - levels_[end_ - 1].price) <= band_span_[band];
+    }
+
+    inline void add_to_bands_(double price, double qty) noexcept {
+        for (std::size_t b = 0; b < BANDS; ++b) {
+            if (in_band_(price, b)) {
+                band_qty_[b] += qty;
+            }
+        }
+    }
+
+    inline void on_replace_(std::size_t rank, double price, double delta) noexcept {
+        if (rank < TOP) {
+            top_qty_ += delta;
+        }
+        add_to_bands_(price, delta);
+    }
+
+    inline void on_erase_(std::size_t rank, const BookLevel& removed) noexcept {
+        if (rank == 0) {
+            recompute_stats_();         // new best
+            return;
+        }
+        if (rank < TOP) {
+            top_qty_ -= removed.qty;
+            if (size() >= TOP) {
+                top_qty_ += (*this)[TOP - 1].qty;   // moved up into the top
+            }
+        }
+        add_to_bands_(removed.price, -removed.qty);
+    }
+
+    inline void on_insert_(std::size_t rank, const BookLevel& level) noexcept {
+        if (rank == 0) {
+            recompute_stats_();         // new best
+            return;
+        }
+        if (rank < TOP) {
+            top_qty_ += level.qty;
+            if (size() > TOP) {
+                top_qty_ -= (*this)[TOP].qty;       // pushed out of the top
+            }
+        }
+        add_to_bands_(level.price, level.qty);
+    }
+
+    // Truncation only ever drops a level ranked at Depth >= TOP
+    inline void on_drop_worst_(const BookLevel& worst) noexcept {
+        add_to_bands_(worst.price, -worst.qty);
+    }
+
+    // Full recompute: bands are nested suffixes of the worst → best array
+    inline void recompute_stats_() noexcept {
+        const std::size_t n = size();
+        if (n == 0) {
+            top_qty_ = 0.0;
+            band_qty_.fill(0.0);
+            band_span_.fill(0.0);
+            return;
+        }
+        const BookLevel* first = levels_.get() + begin_;
+        const BookLevel* last  = levels_.get() + end_;
+        const double best = last[-1].price;
+
+        const std::size_t top = std::min(TOP, n);
+        top_qty_ = sum_qty_(last - top, top);
+
+        const BookLevel* inner = last;
+        double cumulative = 0.0;
+        for (std::size_t b = 0; b < BANDS; ++b) {
+            const double span = best * static_cast<double>(Analytics::band_bps[b]) * 1e-4;
+            band_span_[b] = span;
+            const BookLevel* outer = std::partition_point(first, inner,
+                [&](const BookLevel& l) { return std::abs(l.price - best) > span; });
+            cumulative += sum_qty_(outer, static_cast<std::size_t>(inner - outer));
+            band_qty_[b] = cumulative;
+            inner = outer;
+        }
+    }
+
+    // Independent accumulators: no loop-carried dependency on one add
+    // (lets the compiler keep several lanes in flight / vectorize)
+    [[nodiscard]]
+    static inline double sum_qty_(const BookLevel* levels, std::size_t count) noexcept {
+        double acc[4] = {0.0, 0.0, 0.0, 0.0};
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            acc[0] += levels[i + 0].qty;
+            acc[1] += levels[i + 1].qty;
+            acc[2] += levels[i + 2].qty;
+            acc[3] += levels[i + 3].qty;
+        }
+        for (; i < count; ++i) {
+            acc[0] += levels[i].qty;
+        }
+        return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    }
+
+    // Shifts whichever part of the ladder is shorter
+    inline void insert_(std::size_t pos, const BookLevel& level) noexcept {
+        bool up = (end_ - pos) <= (pos - begin_);
+        if (up ? end_ == CAPACITY : begin_ == 0) [[unlikely]] {
+            // Amortized: the window drifts by one slot per truncating insert
+            pos = recenter_(pos);
+            up = (begin_ == 0) || (end_ < CAPACITY && (end_ - pos) <= (pos - begin_));
+        }
+        if (up) {
+            std::memmove(at_(pos + 1), at_(pos), (end_ - pos) * sizeof(BookLevel));
+            ++end_;
+            *at_(pos) = level;
+        }
+        else {
+            std::memmove(at_(begin_ - 1), at_(begin_), (pos - begin_) * sizeof(BookLevel));
+            --begin_;
+            *at_(pos - 1) = level;
+        }
+    }
+
+    inline void erase_(std::size_t pos) noexcept {
+        if ((end_ - pos - 1) <= (pos - begin_)) {
+            std::memmove(at_(pos), at_(pos + 1), (end_ - pos - 1) * sizeof(BookLevel));
+            --end_;
+        }
+        else {
+            std::memmove(at_(begin_ + 1), at_(begin_), (pos - begin_) * sizeof(BookLevel));
+            ++begin_;
+        }
+    }
+
+    // Moves the levels to the middle of the buffer. Returns the moved position.
+    inline std::size_t recenter_(std::size_t pos) noexcept {
+        const std::size_t count = size();
+        const std::size_t begin = (CAPACITY - count) / 2;
+        std::memmove(at_(begin), at_(begin_), count * sizeof(BookLevel));
+        pos = pos - begin_ + begin;
+        begin_ = begin;
+        end_   = begin + count;
+        return pos;
+    }
+};
+
+
+// ============================================================================
+// BookStore
+// ============================================================================
+
+template<std::size_t Depth = 1000, std::size_t MaxSymbols = 4096, BookAnalyticsConcept Analytics = DefaultBookAnalytics>
+class BookStore {
+public:
+    struct Book {
+        BookLadder<Depth, std::greater<>, Analytics> bids;
+        BookLadder<Depth, std::less<>, Analytics>    asks;
+
+        std::uint32_t checksum{0};      // Checksum of the latest book message
+        std::int64_t  ts_ns{0};         // Exchange timestamp of the latest update (0 if absent)
+        std::uint64_t loaded_ns{0};     // Monotonic time of the latest snapshot
+        std::uint64_t snapshots{0};
+        std::uint64_t updates{0};
+        bool          valid{false};     // Snapshot applied, no newer one awaited
+
+        [[nodiscard]]
+        inline bool is_valid() const noexcept {
+            return valid;
+        }
+
+        // Size-weighted mid of the best levels (0 if a side is empty)
+        [[nodiscard]]
+        inline double microprice() const noexcept {
+            if (bids.empty() || asks.empty()) {
+                return 0.0;
+            }
+            const auto& bid = bids.best();
+            const auto& ask = asks.best();
+            return (bid.price * ask.qty + ask.price * bid.qty) / (bid.qty + ask.qty);
+        }
+
+        // (bid - ask) / (bid + ask) over the top levels, in [-1, 1] (0 if empty)
+        [[nodiscard]]
+        inline double imbalance() const noexcept requires (Analytics::enabled) {
+            const double b = bids.top_qty();
+            const double a = asks.top_qty();
+            return (a + b) > 0.0 ? (b - a) / (a + b) : 0.0;
+        }
+
+        // Cumulative quantity within Analytics::band_bps[band] of the best price
+        [[nodiscard]]
+        inline double bid_depth(std::size_t band) const noexcept requires (Analytics::enabled) {
+            return bids.band_qty(band);
+        }
+
+        [[nodiscard]]
+        inline double ask_depth(std::size_t band) const noexcept requires (Analytics::enabled) {
+            return asks.band_qty(band);
+        }
+    };
+
+    // ------------------------------------------------------------
+    // Staging buffer (streaming target of the book parsers)
+    // ------------------------------------------------------------
+    //
+    // Mirrors schema::book::Response, with bounded level buffers instead of
+    // vectors. Levels beyond Depth are counted and dropped.
+    //
+    class LevelBuffer {
+    public:
+        LevelBuffer()
+            : levels_(std::make_unique<BookLevel[]>(Depth)) {}
+
+        inline void push_back(const BookLevel& level) noexcept {
+            if (size_ < Depth) [[likely]] {
+                levels_[size_++] = level;
+            }
+            else {
+                ++overflow_;
+            }
+        }
+
+        inline void reserve(std::size_t) noexcept {}
+
+        inline void clear() noexcept {
+            size_ = 0;
+            overflow_ = 0;
+        }
+
+        [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] inline std::size_t overflow() const noexcept { return overflow_; }
+        [[nodiscard]] inline const BookLevel* begin() const noexcept { return levels_.get(); }
+        [[nodiscard]] inline const BookLevel* end() const noexcept { return levels_.get() + size_; }
+        [[nodiscard]] inline const BookLevel& operator[](std::size_t i) const noexcept { return levels_[i]; }
+
+    private:
+        std::unique_ptr<BookLevel[]> levels_;
+        std::size_t size_ = 0;
+        std::size_t overflow_ = 0;
+    };
+
+    struct Staging {
+        protocol::kraken::PayloadType type{};
+        struct {
+            Symbol symbol;
+            LevelBuffer asks;
+            LevelBuffer bids;
+            std::uint32_t checksum{0};
+            lcr::optional<Timestamp> timestamp;
+        } book;
+
+        inline void reset() noexcept {
+            type = {};
+            book.symbol = Symbol{};
+            book.asks.clear();
+            book.bids.clear();
+            book.checksum = 0;
+            book.timestamp.reset();
+        }
+    };
+
+    using staging_type = Staging;
+
+    BookStore()
+        : books_(std::make_unique<std::unique_ptr<Book>[]>(MaxSymbols))
+        , awaited_(std::make_unique<Await[]>(MaxSymbols)) {}
+
+    BookStore(const BookStore&) = delete;
+    BookStore& operator=(const BookStore&) = delete;
+
+    // ------------------------------------------------------------
+    // Streaming writer API (book_sink)
+    // ------------------------------------------------------------
+
+    // Cleared staging buffer, to be filled by a book parser
+    [[nodiscard]]
+    inline Staging& staging() noexcept {
+        staging_.reset();
+        return staging_;
+    }
+
+    // Applies a parsed staging buffer (snapshot: bulk load, update: level
+    // upserts). Returns false for an update of a book without snapshot.
+    inline bool commit(const Staging& msg) noexcept {
+        const SymbolId id = intern_symbol(msg.book.symbol.view());
+        if (!in_range_(id)) [[unlikely]] {
+            return false;
+        }
+        if (msg.type == protocol::kraken::PayloadType::Snapshot) {
+            load_snapshot_(id, msg.book.bids.begin(), msg.book.bids.size(),
+                               msg.book.asks.begin(), msg.book.asks.size(),
+                               msg.book.checksum, msg.book.timestamp);
+            return true;
+        }
+        return apply_update_(id, msg.book.bids, msg.book.asks, msg.book.checksum, msg.book.timestamp);
+    }
+
+    // ------------------------------------------------------------
+    // Message writer API
+    // ------------------------------------------------------------
+
+    inline bool apply(const protocol::kraken::schema::book::Response& msg) noexcept {
+        const SymbolId id = intern_symbol(msg.book.symbol.view());
+        if (!in_range_(id)) [[unlikely]] {
+            return false;
+        }
+        if (msg.type == protocol::kraken::PayloadType::Snapshot) {
+            load_snapshot_(id, msg.book.bids.data(), msg.book.bids.size(),
+                               msg.book.asks.data(), msg.book.asks.size(),
+                               msg.book.checksum, msg.book.timestamp);
+            return true;
+        }
+        return apply_update_(id, msg.book.bids, msg.book.asks, msg.book.checksum, msg.book.timestamp);
+    }
+
+    // Allocates the book of a symbol ahead of its first snapshot
+    inline void reserve(SymbolId id) {
+        if (in_range_(id)) [[likely]] {
+            (void)book_(id);
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Epochs (subscribe / reconnect)
+    // ------------------------------------------------------------
+
+    // Marks every book stale and forgets every awaited book
+    inline void begin_epoch() noexcept {
+        for (std::size_t i = 0; i < MaxSymbols; ++i) {
+            if (books_[i]) {
+                books_[i]->valid = false;
+            }
+            awaited_[i] = Await{};
+        }
+        epoch_start_ns_ = lcr::system::monotonic_clock::instance().now_ns();
+        last_loaded_ns_ = 0;
+        pending_books_ = 0;
+        time_to_full_book_ns_ = 0;
+    }
+
+    // Awaits the next snapshot of `id` (the book is stale until then).
+    // `ticket` (non-zero, e.g. the request id) identifies the wait for
+    // cancel_book(); awaiting again only replaces the ticket.
+    inline void expect_book(SymbolId id, std::uint64_t ticket = 1) noexcept {
+        if (!in_range_(id)) [[unlikely]] {
+            return;
+        }
+        Await& await = awaited_[id];
+        if (await.ticket == 0) {
+            if (pending_books_ == 0) {
+                epoch_start_ns_ = lcr::system::monotonic_clock::instance().now_ns();
+                last_loaded_ns_ = 0;
+                time_to_full_book_ns_ = 0;
+            }
+            ++pending_books_;
+            Book* book = books_[id].get();
+            await.was_valid = book && book->valid;
+            if (book) {
+                book->valid = false;
+            }
+        }
+        await.ticket = ticket != 0 ? ticket : 1;
+    }
+
+    // Stops awaiting `id` (subscription rejected or cancelled) if the wait
+    // carries `ticket` (0 matches any wait)
+    inline void cancel_book(SymbolId id, std::uint64_t ticket = 0) noexcept {
+        if (id >= MaxSymbols) [[unlikely]] {
+            return;
+        }
+        Await& await = awaited_[id];
+        if (await.ticket == 0 || (ticket != 0 && await.ticket != ticket)) {
+            return;
+        }
+        if (Book* book = books_[id].get()) {
+            book->valid = await.was_valid;
+        }
+        await = Await{};
+        on_book_cleared_(last_loaded_ns_);
+    }
+
+    // Awaits `id` (see expect_book())
+    [[nodiscard]]
+    inline bool awaiting(SymbolId id) const noexcept {
+        return id < MaxSymbols && awaited_[id].ticket != 0;
+    }
+
+    // Snapshots still awaited in the current epoch
+    [[nodiscard]]
+    inline std::size_t pending_books() const noexcept {
+        return pending_books_;
+    }
+
+    // Time from the first awaited book to the last one cleared (0 while
+    // pending or if no awaited snapshot arrived)
+    [[nodiscard]]
+    inline std::uint64_t time_to_full_book_ns() const noexcept {
+        return time_to_full_book_ns_;
+    }
+
+    // ------------------------------------------------------------
+    // Readers
+    // ------------------------------------------------------------
+
+    // nullptr until the first snapshot of the symbol
+    [[nodiscard]]
+    inline const Book* find(SymbolId id) const noexcept {
+        if (id >= MaxSymbols) [[unlikely]] {
+            return nullptr;
+        }
+        const Book* book = books_[id].get();
+        return (book && book->snapshots > 0) ? book : nullptr;
+    }
+
+    // Lookup only: unknown symbols are not interned
+    [[nodiscard]]
+    inline const Book* find(std::string_view symbol) const noexcept {
+        SymbolId id{};
+        return find_symbol(symbol, id) ? find(id) : nullptr;
+    }
+
+    // Updates received for books without snapshot
+    [[nodiscard]]
+    inline std::uint64_t orphan_updates() const noexcept {
+        return orphan_updates_;
+    }
+
+    // Messages dropped because their SymbolId is beyond MaxSymbols
+    [[nodiscard]]
+    inline std::uint64_t dropped_symbols() const noexcept {
+        return dropped_symbols_;
+    }
+
+    // Snapshots whose levels were not sorted best first (sorted on load)
+    [[nodiscard]]
+    inline std::uint64_t unsorted_snapshots() const noexcept {
+        return unsorted_snapshots_;
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t depth() noexcept {
+        return Depth;
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t capacity() noexcept {
+        return MaxSymbols;
+    }
+
+private:
+    std::unique_ptr<std::unique_ptr<Book>[]> books_;
+    Staging staging_;
+
+    // Awaited snapshot of one symbol (ticket 0: not awaited)
+    struct Await {
+        std::uint64_t ticket{0};
+        bool          was_valid{false};    // validity restored by cancel_book()
+    };
+    std::unique_ptr<Await[]> awaited_;
+
+    std::uint64_t epoch_start_ns_{0};
+    std::uint64_t last_loaded_ns_{0};      // latest awaited snapshot of the wait
+    std::size_t   pending_books_{0};
+    std::uint64_t time_to_full_book_ns_{0};
+
+    std::uint64_t orphan_updates_{0};
+    std::uint64_t unsorted_snapshots_{0};
+    std::uint64_t dropped_symbols_{0};
+
+    [[nodiscard]]
+    inline bool in_range_(SymbolId id) noexcept {
+        if constexpr (MaxSymbols < MAX_INTERNED_SYMBOLS) {
+            if (id >= MaxSymbols) [[unlikely]] {
+                ++dropped_symbols_;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]]
+    inline Book& book_(SymbolId id) {
+        LCR_ASSERT_MSG(id < MaxSymbols, "SymbolId out of BookStore range");
+        auto& book = books_[id];
+        if (!book) [[unlikely]] {
+            book = std::make_unique<Book>();
+        }
+        return *book;
+    }
+
+    static inline void stamp_(Book& book, std::uint32_t checksum, const lcr::optional<Timestamp>& ts) noexcept {
+        book.checksum = checksum;
+        if (ts.has()) {
+            book.ts_ns = ts.value().time_since_epoch().count();
+        }
+    }
+
+    inline void load_snapshot_(SymbolId id,
+                               const BookLevel* bids, std::size_t bid_count,
+                               const BookLevel* asks, std::size_t ask_count,
+                               std::uint32_t checksum, const lcr::optional<Timestamp>& ts) noexcept {
+        Book& book = book_(id);
+        bool sorted = book.bids.assign_best_first(bids, bid_count);
+        sorted &= book.asks.assign_best_first(asks, ask_count);
+        if (!sorted) [[unlikely]] {
+            ++unsorted_snapshots_;
+        }
+        stamp_(book, checksum, ts);
+        ++book.snapshots;
+        book.loaded_ns = lcr::system::monotonic_clock::instance().now_ns();
+
+        book.valid = true;
+        if (awaited_[id].ticket != 0) {
+            awaited_[id] = Await{};
+            last_loaded_ns_ = book.loaded_ns;
+            on_book_cleared_(book.loaded_ns);
+        }
+    }
+
+    inline void on_book_cleared_(std::uint64_t loaded_ns) noexcept {
+        LCR_ASSERT_MSG(pending_books_ > 0, "BookStore awaited book count underflow");
+        if (--pending_books_ == 0 && loaded_ns != 0) {
+            time_to_full_book_ns_ = std::max<std::uint64_t>(loaded_ns - epoch_start_ns_, 1);
+        }
+    }
+
+    template<class Levels>
+    inline bool apply_update_(SymbolId id, const Levels& bids, const Levels& asks,
+                              std::uint32_t checksum, const lcr::optional<Timestamp>& ts) noexcept {
+        LCR_ASSERT_MSG(id < MaxSymbols, "SymbolId out of BookStore range");
+        Book* book = books_[id].get();
+        if (!book || book->snapshots == 0) [[unlikely]] {
+            ++orphan_updates_;
+            return false;
+        }
+        for (const auto& level : bids) {
+            book->bids.apply(level);
+        }
+        for (const auto& level : asks) {
+            book->asks.apply(level);
+        }
+        stamp_(*book, checksum, ts);
+        ++book->updates;
+        return true;
+    }
+};
+
+} // namespace wirekrak::core::feed
@@ -0,0 +1,94 @@
+#pragma once
+
+/*
+===============================================================================
+MarketEvent - Normalized, position-independent market data record
+===============================================================================
+
+A MarketEvent is the unit exported by feed publishers to co-located processes
+(e.g. through a shared-memory ring). It is a fixed 64-byte, trivially
+copyable record: exactly one cache line, no pointers, no heap.
+
+Event kinds:
+
+  Trade      → one executed trade
+                 price, qty, side (Buy/Sell), aux = trade id
+  BookLevel  → one price level change
+                 price, qty (0 = level removed), side (Bid/Ask)
+                 aux = book checksum on the last level of a message
+
+Flags:
+
+  Snapshot       → level belongs to a full book snapshot (reset the book on
+                   the first level of a snapshot message)
+  FirstInMessage → first event produced from one exchange message
+  LastInMessage  → last event produced from one exchange message
+                   (book: the book is consistent, checksum is valid)
+
+Symbols are exported both as SymbolId (process-local interning, only valid
+for consumers sharing the publisher's intern table order) and as the fixed
+16-byte symbol text (always valid across processes).
+
+===============================================================================
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "wirekrak/core/symbol.hpp"
+
+
+namespace wirekrak::core::feed {
+
+enum class EventType : std::uint8_t {
+    Trade     = 1,
+    BookLevel = 2
+};
+
+enum class EventSide : std::uint8_t {
+    Buy = 0,    // trade aggressor buy / book bid
+    Sell = 1,   // trade aggressor sell / book ask
+    Unknown = 2
+};
+
+inline constexpr EventSide Bid = EventSide::Buy;
+inline constexpr EventSide Ask = EventSide::Sell;
+
+namespace event_flags {
+inline constexpr std::uint8_t Snapshot       = 1u << 0;
+inline constexpr std::uint8_t FirstInMessage = 1u << 1;
+inline constexpr std::uint8_t LastInMessage  = 1u << 2;
+} // namespace event_flags
+
+struct alignas(64) MarketEvent {
+    std::uint64_t seq;          // publisher sequence (gap detection)
+    std::int64_t  ts_ns;        // exchange timestamp, ns since epoch (0 if absent)
+    SymbolId      symbol_id;
+    EventType     type;
+    EventSide     side;
+    std::uint8_t  flags;
+    std::uint8_t  reserved;
+    double        price;
+    double        qty;
+    std::uint64_t aux;          // trade id / book checksum
+    char          symbol[MAX_SYMBOL_LENGTH]; // not NUL-terminated when full
+
+    inline void set_symbol(const Symbol& s) noexcept {
+        std::memset(symbol, 0, sizeof(symbol));
+        std::memcpy(symbol, s.data(), s.size());
+    }
+
+    [[nodiscard]]
+    inline std::string_view symbol_view() const noexcept {
+        const void* nul = std::memchr(symbol, '\0', sizeof(symbol));
+        return std::string_view(symbol, nul ? static_cast<const char*>(nul) - symbol : sizeof(symbol));
+    }
+};
+
+static_assert(sizeof(MarketEvent) == 64, "MarketEvent must fit exactly one cache line");
+static_assert(std::is_trivially_copyable_v<MarketEvent>, "MarketEvent must be trivially copyable");
+static_assert(std::is_standard_layout_v<MarketEvent>, "MarketEvent must be standard layout");
+
+} // namespace wirekrak::core::feed
@@ -0,0 +1,200 @@
+#pragma once
+
+/*
+===============================================================================
+feed::Publisher - Normalized market data export
+===============================================================================
+
+Converts parsed Kraken book and trade messages into fixed-size MarketEvent
+records and writes them, zero-copy, into a producer ring. Combined with the
+shared-memory rings this lets co-located processes consume the feed at
+memory speed while the feed handler pays connection and parse cost once.
+
+Typical wiring (feed handler process):
+
+    lcr::system::shared_memory shm;
+    (void)shm.create("/wk.market", Ring::required_bytes());
+    auto* ring = Ring::create(shm.data(), shm.size());
+
+    feed::Publisher<Ring> publisher(*ring);
+
+    session.data_plane().drain<schema::trade::Response>([&](const auto& r) {
+        publisher.publish(r);
+    });
+    session.data_plane().drain<schema::book::Response>([&](const auto& r) {
+        publisher.publish(r);
+    });
+
+Strategy process:
+
+    (void)shm.open("/wk.market");
+    auto* ring = Ring::attach(shm.data(), shm.size());
+    auto id = ring->attach_consumer();
+    while (const feed::MarketEvent* ev = ring->peek(id)) { ...; ring->release(id); }
+
+Guarantees:
+  • Never blocks the Session: a full ring drops events (counted)
+  • Every attempted event consumes a sequence number → consumers detect gaps
+  • No allocations on the publish path
+
+===============================================================================
+*/
+
+#include <concepts>
+#include <cstdint>
+
+#include "wirekrak/core/feed/market_event.hpp"
+#include "wirekrak/core/protocol/kraken/schema/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/response.hpp"
+#include "wirekrak/core/symbol/intern.hpp"
+#include "lcr/lockfree/shm/spsc_ring.hpp"
+#include "lcr/lockfree/shm/spmc_fanout_ring.hpp"
+
+
+namespace wirekrak::core::feed {
+
+// -----------------------------------------------------------------------------
+// Ring requirements (single producer, two-phase)
+// -----------------------------------------------------------------------------
+template<class R>
+concept FeedRingConcept =
+    requires(R& r) {
+        { r.acquire_producer_slot() } -> std::same_as<MarketEvent*>;
+        { r.commit_producer_slot() } noexcept;
+    };
+
+// Common shared-memory ring shapes
+template<std::size_t Capacity>
+using SharedSpscRing = lcr::lockfree::shm::spsc_ring<MarketEvent, Capacity>;
+
+template<std::size_t Capacity, std::size_t MaxConsumers>
+using SharedFanoutRing = lcr::lockfree::shm::spmc_fanout_ring<MarketEvent, Capacity, MaxConsumers>;
+
+
+template<FeedRingConcept Ring>
+class Publisher {
+public:
+    explicit Publisher(Ring& ring) noexcept
+        : ring_(ring) {}
+
+    // -------------------------------------------------------------------------
+    // Trades → one event per trade
+    // -------------------------------------------------------------------------
+    inline std::size_t publish(const protocol::kraken::schema::trade::Response& msg) noexcept {
+        std::size_t published = 0;
+        const std::size_t n = msg.trades.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto& t = msg.trades[i];
+            std::uint8_t flags = message_flags_(i, n);
+            if (msg.type == protocol::kraken::PayloadType::Snapshot) {
+                flags |= event_flags::Snapshot;
+            }
+            published += emit_(EventType::Trade, t.symbol, intern_symbol(t.symbol.view()),
+                               to_event_side_(t.side), flags, t.price, t.qty, t.trade_id,
+                               t.timestamp.time_since_epoch().count());
+        }
+        return published;
+    }
+
+    // -------------------------------------------------------------------------
+    // Book → one event per level (asks first, then bids)
+    // -------------------------------------------------------------------------
+    inline std::size_t publish(const protocol::kraken::schema::book::Response& msg) noexcept {
+        const auto& book = msg.book;
+        const SymbolId id = intern_symbol(book.symbol.view());
+        const std::int64_t ts = book.timestamp.has() ? book.timestamp.value().time_since_epoch().count() : 0;
+        const std::uint8_t snapshot = (msg.type == protocol::kraken::PayloadType::Snapshot) ? event_flags::Snapshot : 0;
+
+        const std::size_t n = book.asks.size() + book.bids.size();
+        std::size_t i = 0;
+        std::size_t published = 0;
+
+        for (const auto& lvl : book.asks) {
+            const std::uint8_t flags = snapshot | message_flags_(i, n);
+            published += emit_(EventType::BookLevel, book.symbol, id, Ask, flags, lvl.price, lvl.qty,
+                               (i + 1 == n) ? book.checksum : 0, ts);
+            ++i;
+        }
+        for (const auto& lvl : book.bids) {
+            const std::uint8_t flags = snapshot | message_flags_(i, n);
+            published += emit_(EventType::BookLevel, book.symbol, id, Bid, flags, lvl.price, lvl.qty,
+                               (i + 1 == n) ? book.checksum : 0, ts);
+            ++i;
+        }
+        return published;
+    }
+
+    // -------------------------------------------------------------------------
+    // Observability
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline std::uint64_t published() const noexcept {
+        return published_;
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t dropped() const noexcept {
+        return dropped_;
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t next_sequence() const noexcept {
+        return seq_;
+    }
+
+private:
+    Ring& ring_;
+
+    std::uint64_t seq_{0};
+    std::uint64_t published_{0};
+    std::uint64_t dropped_{0};
+
+    [[nodiscard]]
+    static constexpr std::uint8_t message_flags_(std::size_t i, std::size_t n) noexcept {
+        std::uint8_t flags = 0;
+        if (i == 0) {
+            flags |= event_flags::FirstInMessage;
+        }
+        if (i + 1 == n) {
+            flags |= event_flags::LastInMessage;
+        }
+        return flags;
+    }
+
+    [[nodiscard]]
+    static constexpr EventSide to_event_side_(protocol::kraken::Side s) noexcept {
+        switch (s) {
+            case protocol::kraken::Side::Buy:  return EventSide::Buy;
+            case protocol::kraken::Side::Sell: return EventSide::Sell;
+            default:                           return EventSide::Unknown;
+        }
+    }
+
+    inline std::size_t emit_(EventType type, const Symbol& symbol, SymbolId id, EventSide side,
+                             std::uint8_t flags, double price, double qty, std::uint64_t aux,
+                             std::int64_t ts_ns) noexcept {
+        const std::uint64_t seq = seq_++;
+        MarketEvent* ev = ring_.acquire_producer_slot();
+        if (!ev) [[unlikely]] {
+            ++dropped_;
+            return 0;
+        }
+        ev->seq       = seq;
+        ev->ts_ns     = ts_ns;
+        ev->symbol_id = id;
+        ev->type      = type;
+        ev->side      = side;
+        ev->flags     = flags;
+        ev->reserved  = 0;
+        ev->price     = price;
+        ev->qty       = qty;
+        ev->aux       = aux;
+        ev->set_symbol(symbol);
+        ring_.commit_producer_slot();
+        ++published_;
+        return 1;
+    }
+};
+
+} // namespace wirekrak::core::feed
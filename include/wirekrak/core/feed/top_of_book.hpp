@@ -0,0 +1,290 @@
+#pragma once
+
+/*
+===============================================================================
+feed::TopOfBookTable - Seqlock-published best bid/ask per symbol
+===============================================================================
+
+A SymbolId-indexed table holding, for every symbol, the latest best bid/ask,
+their sizes, the last trade and an update sequence. It is written by the
+session thread right after each book or trade message and can be read from
+any number of threads without draining queues:
+
+    // Session thread
+    session.data_plane().drain<schema::book::Response>([&](const auto& r) {
+        tob.on_book(r);
+    });
+    session.data_plane().drain<schema::trade::Response>([&](const auto& r) {
+        tob.on_trade(r);
+    });
+
+    // Risk / quoting thread
+    feed::TopOfBook q;
+    if (tob.try_load(btc_id, q)) { ... }
+
+Layout:
+  • One row per SymbolId, each row exactly one cache line
+    (8-byte sequence + 56-byte quote), so readers of different symbols
+    never share a line and a reader touches a single line per lookup
+  • Rows are allocated once at construction (no allocations afterwards)
+
+Book semantics:
+  • The writer keeps the best ShadowDepth levels of each side per symbol
+    (writer-private, outside the published rows), so deleting the best
+    level promotes the next one
+  • Snapshots seed the shadow ladders, updates insert / resize / delete
+    levels within them; levels worse than a truncated ladder are ignored
+    (the ladder always holds the true top levels of the book)
+  • A side is published empty only when every shadow level was deleted
+    before a replacement reached it (deeper than ShadowDepth deletions);
+    it recovers on the next snapshot
+  • Owners of a full book can publish with set_quote() instead
+
+Concurrency:
+  • Single writer (the session thread)
+  • try_load() is wait-free, load() retries only while a write overlaps
+
+===============================================================================
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "wirekrak/core/protocol/kraken/schema/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/response.hpp"
+#include "wirekrak/core/symbol/intern.hpp"
+#include "lcr/lockfree/slot/seqlock.hpp"
+#include "lcr/trap.hpp"
+
+
+namespace wirekrak::core::feed {
+
+struct TopOfBook {
+    double       bid_price{0.0};
+    double       bid_qty{0.0};
+    double       ask_price{0.0};
+    double       ask_qty{0.0};
+    double       last_price{0.0};
+    double       last_qty{0.0};
+    std::int64_t ts_ns{0};       // exchange timestamp of the latest update (0 if absent)
+
+    [[nodiscard]]
+    inline bool has_bid() const noexcept {
+        return bid_qty > 0.0;
+    }
+
+    [[nodiscard]]
+    inline bool has_ask() const noexcept {
+        return ask_qty > 0.0;
+    }
+
+    // Size-weighted mid (0 unless both sides are set)
+    [[nodiscard]]
+    inline double microprice() const noexcept {
+        if (!has_bid() || !has_ask()) {
+            return 0.0;
+        }
+        return (bid_price * ask_qty + ask_price * bid_qty) / (bid_qty + ask_qty);
+    }
+};
+
+static_assert(sizeof(TopOfBook) == 56, "TopOfBook must leave room for the seqlock sequence in one cache line");
+
+
+template<std::size_t MaxSymbols = 4096, std::size_t ShadowDepth = 16>
+class TopOfBookTable {
+    static_assert(ShadowDepth >= 1, "TopOfBookTable requires at least one shadow level per side");
+
+    struct alignas(64) Row {
+        lcr::lockfree::slot::seqlock<TopOfBook> slot;
+    };
+
+    static_assert(sizeof(Row) == 64, "TopOfBookTable row must be exactly one cache line");
+
+    using Level = protocol::kraken::schema::book::Level;
+
+    // Writer-private best levels of one side (best first)
+    struct ShadowSide {
+        Level         levels[ShadowDepth];
+        std::uint32_t size{0};
+        bool          complete{true};   // false once a level was truncated away
+    };
+
+    struct Shadow {
+        ShadowSide bids;
+        ShadowSide asks;
+    };
+
+public:
+    TopOfBookTable()
+        : rows_(std::make_unique<Row[]>(MaxSymbols))
+        , shadows_(std::make_unique<Shadow[]>(MaxSymbols)) {}
+
+    TopOfBookTable(const TopOfBookTable&) = delete;
+    TopOfBookTable& operator=(const TopOfBookTable&) = delete;
+
+    // -------------------------------------------------------------------------
+    // Writer API (session thread only)
+    // -------------------------------------------------------------------------
+
+    inline void on_book(const protocol::kraken::schema::book::Response& msg) noexcept {
+        const auto& book = msg.book;
+        const SymbolId id = intern_symbol(book.symbol.view());
+        auto& slot = row_(id).slot;
+        auto& shadow = shadows_[id];
+
+        if (msg.type == protocol::kraken::PayloadType::Snapshot) {
+            seed_(shadow.bids, book.bids);
+            seed_(shadow.asks, book.asks);
+        }
+        else {
+            for (const auto& lvl : book.bids) {
+                apply_level_(shadow.bids, lvl, [](double a, double b) { return a > b; });
+            }
+            for (const auto& lvl : book.asks) {
+                apply_level_(shadow.asks, lvl, [](double a, double b) { return a < b; });
+            }
+        }
+
+        TopOfBook q;
+        (void)slot.load(q);
+        q.bid_price = shadow.bids.size ? shadow.bids.levels[0].price : 0.0;
+        q.bid_qty   = shadow.bids.size ? shadow.bids.levels[0].qty   : 0.0;
+        q.ask_price = shadow.asks.size ? shadow.asks.levels[0].price : 0.0;
+        q.ask_qty   = shadow.asks.size ? shadow.asks.levels[0].qty   : 0.0;
+        if (book.timestamp.has()) {
+            q.ts_ns = book.timestamp.value().time_since_epoch().count();
+        }
+        slot.store(q);
+    }
+
+    inline void on_trade(const protocol::kraken::schema::trade::Response& msg) noexcept {
+        if (msg.trades.empty()) {
+            return;
+        }
+        // One store per symbol run (trades of one message are usually one symbol)
+        std::size_t i = 0;
+        const std::size_t n = msg.trades.size();
+        while (i < n) {
+            const SymbolId id = intern_symbol(msg.trades[i].symbol.view());
+            auto& slot = row_(id).slot;
+
+            TopOfBook q;
+            (void)slot.load(q);
+            do {
+                const auto& t = msg.trades[i];
+                q.last_price = t.price;
+                q.last_qty   = t.qty;
+                q.ts_ns      = t.timestamp.time_since_epoch().count();
+                ++i;
+            } while (i < n && msg.trades[i].symbol.view() == msg.trades[i - 1].symbol.view());
+            slot.store(q);
+        }
+    }
+
+    // Publish an externally maintained best bid/ask (e.g. from a full book)
+    inline void set_quote(SymbolId id, double bid_price, double bid_qty,
+                          double ask_price, double ask_qty, std::int64_t ts_ns) noexcept {
+        auto& slot = row_(id).slot;
+        TopOfBook q;
+        (void)slot.load(q);
+        q.bid_price = bid_price;
+        q.bid_qty   = bid_qty;
+        q.ask_price = ask_price;
+        q.ask_qty   = ask_qty;
+        q.ts_ns     = ts_ns;
+        slot.store(q);
+    }
+
+    // -------------------------------------------------------------------------
+    // Reader API (any thread)
+    // -------------------------------------------------------------------------
+
+    // Wait-free: fails only if the row is being written at this instant
+    [[nodiscard]]
+    inline bool try_load(SymbolId id, TopOfBook& out) const noexcept {
+        return row_(id).slot.try_load(out);
+    }
+
+    // Retries while a write overlaps. Returns the row sequence.
+    inline std::uint64_t load(SymbolId id, TopOfBook& out) const noexcept {
+        return row_(id).slot.load(out);
+    }
+
+    // Number of completed updates of a symbol (monotonic)
+    [[nodiscard]]
+    inline std::uint64_t update_sequence(SymbolId id) const noexcept {
+        return row_(id).slot.version() / 2;
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t capacity() noexcept {
+        return MaxSymbols;
+    }
+
+private:
+    std::unique_ptr<Row[]> rows_;
+    std::unique_ptr<Shadow[]> shadows_;   // writer-only
+
+    [[nodiscard]]
+    inline Row& row_(SymbolId id) noexcept {
+        LCR_ASSERT_MSG(id < MaxSymbols, "SymbolId out of TopOfBookTable range");
+        return rows_[id];
+    }
+
+    [[nodiscard]]
+    inline const Row& row_(SymbolId id) const noexcept {
+        LCR_ASSERT_MSG(id < MaxSymbols, "SymbolId out of TopOfBookTable range");
+        return rows_[id];
+    }
+
+    // Snapshot levels arrive best first
+    template<class Levels>
+    static inline void seed_(ShadowSide& side, const Levels& levels) noexcept {
+        const std::size_t n = std::min<std::size_t>(levels.size(), ShadowDepth);
+        for (std::size_t i = 0; i < n; ++i) {
+            side.levels[i] = levels[i];
+        }
+        side.size = static_cast<std::uint32_t>(n);
+        side.complete = (levels.size() <= ShadowDepth);
+    }
+
+    template<class Better>
+    static inline void apply_level_(ShadowSide& side, const Level& lvl, Better better) noexcept {
+        // First level not strictly better than the incoming price
+        std::uint32_t pos = 0;
+        while (pos < side.size && better(side.levels[pos].price, lvl.price)) {
+            ++pos;
+        }
+        const bool found = (pos < side.size && side.levels[pos].price == lvl.price);
+
+        if (lvl.qty <= 0.0) {
+            if (found) {
+                std::copy(side.levels + pos + 1, side.levels + side.size, side.levels + pos);
+                --side.size;
+            }
+            return;
+        }
+        if (found) {
+            side.levels[pos].qty = lvl.qty;
+            return;
+        }
+        if (pos == side.size && !side.complete) {
+            return; // deeper than the truncated ladder: its rank is unknown
+        }
+        if (side.size == ShadowDepth) {
+            side.complete = false;
+            if (pos == ShadowDepth) {
+                return;
+            }
+            --side.size; // worst level falls out of the ladder
+        }
+        std::copy_backward(side.levels + pos, side.levels + side.size, side.levels + side.size + 1);
+        side.levels[pos] = lvl;
+        ++side.size;
+    }
+};
+
+} // namespace wirekrak::core::feed
@@ -0,0 +1,419 @@
+#pragma once
+
+/*
+===============================================================================
+feed::TradeAggregator - Streaming OHLCV bars and VWAP per symbol
+===============================================================================
+
+Turns the trade stream into time-bucketed OHLCV bars (several intervals at
+once, e.g. 1s and 1m) and an EWMA VWAP, per SymbolId, incrementally as
+trades arrive. Bars are computed once, in the session, for all consumers:
+
+    using BarModel = BasicKrakenModel<
+        policy::protocol::DefaultValidation,
+        kraken::NoChannelFilter,
+        kraken::book_sink::None,
+        kraken::trade_sink::Into<feed::TradeAggregator<>>
+    >;
+
+    feed::TradeAggregator<> bars;
+    session.message_handler().attach_trade_aggregator(bars);
+
+    // Completed bars (data plane)
+    session.data_plane().drain<schema::trade::BarClose>([](const auto& bar) { ... });
+
+    // Bars in progress / VWAP (session thread)
+    feed::Bar bar;
+    if (bars.current(btc_id, 0, bar)) { ... }
+
+It can also be fed directly: on_trades(response, emit).
+
+Bars:
+  • Buckets are aligned on the exchange timestamp: a trade at ts belongs to
+    [ts - ts % interval, + interval)
+  • A bar closes when a later bucket of the same symbol receives a trade,
+    or through close_expired(now_ns) for symbols that went quiet
+  • Empty buckets produce no bar
+  • Trades of an already closed bucket are counted as late and skipped
+  • Trades with a trade_id not above the last one of their symbol are
+    counted as duplicates and skipped (trade snapshots replayed after a
+    reconnect are not aggregated twice)
+
+VWAP:
+  • Per bar: notional / volume of the bar
+  • EWMA: price * qty and qty decayed by 2^(-dt / half-life) between trades
+    (event time), so the weight of a trade halves every half-life
+
+Layout (structure of arrays):
+  • One column per field (start, open, high, low, close, volume, notional,
+    trades), interval-major: column[interval * max_symbols + SymbolId]
+  • Sweeps over many symbols (close_expired) read only the columns they
+    need; a symbol run of one message keeps hitting the same lines
+  • All columns are allocated once at construction (no allocations after)
+
+Symbols:
+  • Columns are indexed by SymbolId; trades of symbols interned at or beyond
+    Policy::max_symbols are skipped and counted (dropped_trades_total())
+
+Concurrency:
+  • Single writer, not thread-safe (session thread only)
+
+===============================================================================
+*/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "wirekrak/core/protocol/kraken/schema/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/schema/trade/bar_close.hpp"
+#include "wirekrak/core/symbol/intern.hpp"
+#include "wirekrak/core/symbol/set.hpp"
+#include "lcr/trap.hpp"
+
+
+namespace wirekrak::core::feed {
+
+// ============================================================================
+// Policy
+// ============================================================================
+
+template<class P>
+concept BarPolicyConcept =
+requires {
+    { P::max_symbols } -> std::convertible_to<std::size_t>;
+    { P::vwap_half_life_ns } -> std::convertible_to<std::uint64_t>;
+    { P::intervals_ns.size() } -> std::convertible_to<std::size_t>;
+    { P::intervals_ns[0] } -> std::convertible_to<std::uint64_t>;
+};
+
+// Bar intervals (nanoseconds, at least one) and EWMA VWAP half-life
+template<std::size_t MaxSymbols, std::uint64_t VwapHalfLifeNs, std::uint64_t... IntervalsNs>
+struct BarPolicy {
+    static_assert(sizeof...(IntervalsNs) > 0, "BarPolicy needs at least one interval");
+    static_assert(((IntervalsNs > 0) && ...), "BarPolicy intervals must be positive");
+    static_assert(VwapHalfLifeNs > 0, "BarPolicy VWAP half-life must be positive");
+    static_assert(MaxSymbols <= MAX_INTERNED_SYMBOLS, "BarPolicy symbols are bounded by the intern table");
+
+    static constexpr std::size_t max_symbols = MaxSymbols;
+    static constexpr std::uint64_t vwap_half_life_ns = VwapHalfLifeNs;
+    static constexpr std::array<std::uint64_t, sizeof...(IntervalsNs)> intervals_ns{ IntervalsNs... };
+};
+
+// 1s and 1m bars, 1m VWAP half-life
+using DefaultBarPolicy = BarPolicy<MAX_INTERNED_SYMBOLS, 60'000'000'000ULL, 1'000'000'000ULL, 60'000'000'000ULL>;
+
+static_assert(BarPolicyConcept<DefaultBarPolicy>);
+
+
+// ============================================================================
+// Bar (in progress)
+// ============================================================================
+
+struct Bar {
+    std::int64_t  start_ns{0};
+    double        open{0.0};
+    double        high{0.0};
+    double        low{0.0};
+    double        close{0.0};
+    double        volume{0.0};
+    double        notional{0.0};     // sum(price * qty)
+    std::uint32_t trades{0};
+
+    [[nodiscard]]
+    inline double vwap() const noexcept {
+        return volume > 0.0 ? notional / volume : close;
+    }
+};
+
+
+// ============================================================================
+// TradeAggregator
+// ============================================================================
+
+template<BarPolicyConcept Policy = DefaultBarPolicy>
+class TradeAggregator {
+    static constexpr std::size_t INTERVALS = Policy::intervals_ns.size();
+    static constexpr std::size_t SYMBOLS   = Policy::max_symbols;
+    static constexpr std::size_t CELLS     = INTERVALS * SYMBOLS;
+
+public:
+    TradeAggregator()
+        : start_(std::make_unique<std::int64_t[]>(CELLS))
+        , open_(std::make_unique<double[]>(CELLS))
+        , high_(std::make_unique<double[]>(CELLS))
+        , low_(std::make_unique<double[]>(CELLS))
+        , close_(std::make_unique<double[]>(CELLS))
+        , volume_(std::make_unique<double[]>(CELLS))
+        , notional_(std::make_unique<double[]>(CELLS))
+        , trades_(std::make_unique<std::uint32_t[]>(CELLS))
+        , ewma_pv_(std::make_unique<double[]>(SYMBOLS))
+        , ewma_v_(std::make_unique<double[]>(SYMBOLS))
+        , last_ts_(std::make_unique<std::int64_t[]>(SYMBOLS))
+        , last_trade_id_(std::make_unique<std::uint64_t[]>(SYMBOLS))
+        , seen_(std::make_unique<SymbolSet>())
+        , open_bars_(std::make_unique<SymbolSet>())
+    {}
+
+    TradeAggregator(const TradeAggregator&) = delete;
+    TradeAggregator& operator=(const TradeAggregator&) = delete;
+
+    // -------------------------------------------------------------------------
+    // Writer API (session thread only)
+    // -------------------------------------------------------------------------
+
+    // Folds a trade message in. emit(const schema::trade::BarClose&) is called
+    // for every bar completed by these trades, oldest first per symbol.
+    template<class Emit>
+    inline void on_trades(const protocol::kraken::schema::trade::Response& msg, Emit&& emit) noexcept {
+        std::size_t i = 0;
+        const std::size_t n = msg.trades.size();
+        while (i < n) {
+            // One intern lookup per symbol run
+            const auto& symbol = msg.trades[i].symbol;
+            const SymbolId sid = intern_symbol(symbol.view());
+            const bool in_range = (sid < SYMBOLS);
+            do {
+                const auto& t = msg.trades[i];
+                if (in_range) [[likely]] {
+                    on_trade_(sid, symbol, t.trade_id, t.price, t.qty,
+                              t.timestamp.time_since_epoch().count(), emit);
+                }
+                else {
+                    ++dropped_trades_total_;
+                }
+                ++i;
+            } while (i < n && msg.trades[i].symbol.view() == symbol.view());
+        }
+    }
+
+    // Closes every bar whose bucket ended at or before now_ns (exchange time),
+    // for symbols with no later trade to close them.
+    template<class Emit>
+    inline void close_expired(std::int64_t now_ns, Emit&& emit) noexcept {
+        open_bars_->for_each([&](SymbolId sid) noexcept {
+            bool still_open = false;
+            for (std::size_t k = 0; k < INTERVALS; ++k) {
+                const std::size_t c = cell_(k, sid);
+                if (trades_[c] == 0) {
+                    continue;
+                }
+                if (start_[c] + static_cast<std::int64_t>(Policy::intervals_ns[k]) <= now_ns) {
+                    emit_close_(k, c, Symbol{symbol_name(sid)}, emit);
+                }
+                else {
+                    still_open = true;
+                }
+            }
+            if (!still_open) {
+                (void)open_bars_->erase(sid);
+            }
+        });
+    }
+
+    // Forgets everything (bars in progress are dropped, not emitted)
+    inline void clear() noexcept {
+        std::fill_n(start_.get(), CELLS, 0);
+        std::fill_n(trades_.get(), CELLS, 0u);
+        std::fill_n(ewma_pv_.get(), SYMBOLS, 0.0);
+        std::fill_n(ewma_v_.get(), SYMBOLS, 0.0);
+        std::fill_n(last_trade_id_.get(), SYMBOLS, 0);
+        seen_->clear();
+        open_bars_->clear();
+    }
+
+    // -------------------------------------------------------------------------
+    // Reader API (session thread)
+    // -------------------------------------------------------------------------
+
+    // Bar in progress of `interval` (index into Policy::intervals_ns)
+    [[nodiscard]]
+    inline bool current(SymbolId sid, std::size_t interval, Bar& out) const noexcept {
+        LCR_ASSERT_MSG(interval < INTERVALS, "TradeAggregator::current() interval out of range");
+        if (sid >= SYMBOLS) [[unlikely]] {
+            return false;
+        }
+        const std::size_t c = cell_(interval, sid);
+        if (trades_[c] == 0) {
+            return false;
+        }
+        out.start_ns = start_[c];
+        out.open     = open_[c];
+        out.high     = high_[c];
+        out.low      = low_[c];
+        out.close    = close_[c];
+        out.volume   = volume_[c];
+        out.notional = notional_[c];
+        out.trades   = trades_[c];
+        return true;
+    }
+
+    // EWMA VWAP as of the latest trade of the symbol (0 if none)
+    [[nodiscard]]
+    inline double vwap(SymbolId sid) const noexcept {
+        if (sid >= SYMBOLS) [[unlikely]] {
+            return 0.0;
+        }
+        return ewma_v_[sid] > 0.0 ? ewma_pv_[sid] / ewma_v_[sid] : 0.0;
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t intervals() noexcept {
+        return INTERVALS;
+    }
+
+    [[nodiscard]]
+    static constexpr std::uint64_t interval_ns(std::size_t interval) noexcept {
+        return Policy::intervals_ns[interval];
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t capacity() noexcept {
+        return SYMBOLS;
+    }
+
+    // -------------------------------------------------------------------------
+    // Counters
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline std::uint64_t trades_total() const noexcept {
+        return trades_total_;
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t bars_closed_total() const noexcept {
+        return bars_closed_total_;
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t late_trades_total() const noexcept {
+        return late_trades_total_;
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t duplicate_trades_total() const noexcept {
+        return duplicate_trades_total_;
+    }
+
+    // Trades skipped because their SymbolId is beyond Policy::max_symbols
+    [[nodiscard]]
+    inline std::uint64_t dropped_trades_total() const noexcept {
+        return dropped_trades_total_;
+    }
+
+private:
+    // Bar columns (interval-major)
+    std::unique_ptr<std::int64_t[]>  start_;
+    std::unique_ptr<double[]>        open_;
+    std::unique_ptr<double[]>        high_;
+    std::unique_ptr<double[]>        low_;
+    std::unique_ptr<double[]>        close_;
+    std::unique_ptr<double[]>        volume_;
+    std::unique_ptr<double[]>        notional_;
+    std::unique_ptr<std::uint32_t[]> trades_;     // 0 = no bar in progress
+
+    // Per-symbol columns
+    std::unique_ptr<double[]>        ewma_pv_;
+    std::unique_ptr<double[]>        ewma_v_;
+    std::unique_ptr<std::int64_t[]>  last_ts_;
+    std::unique_ptr<std::uint64_t[]> last_trade_id_;
+    std::unique_ptr<SymbolSet>       seen_;        // symbols with at least one trade
+    std::unique_ptr<SymbolSet>       open_bars_;   // symbols with a bar in progress
+
+    std::uint64_t trades_total_ = 0;
+    std::uint64_t bars_closed_total_ = 0;
+    std::uint64_t late_trades_total_ = 0;
+    std::uint64_t duplicate_trades_total_ = 0;
+    std::uint64_t dropped_trades_total_ = 0;
+
+private:
+    [[nodiscard]]
+    static constexpr std::size_t cell_(std::size_t interval, SymbolId sid) noexcept {
+        return interval * SYMBOLS + sid;
+    }
+
+    template<class Emit>
+    inline void on_trade_(SymbolId sid, const Symbol& symbol, std::uint64_t trade_id,
+                          double price, double qty, std::int64_t ts, Emit& emit) noexcept {
+        const bool first = seen_->insert(sid);
+        if (!first && trade_id <= last_trade_id_[sid]) [[unlikely]] {
+            ++duplicate_trades_total_;
+            return;
+        }
+        last_trade_id_[sid] = trade_id;
+        ++trades_total_;
+
+        // EWMA VWAP (event time)
+        if (first) {
+            ewma_pv_[sid] = price * qty;
+            ewma_v_[sid] = qty;
+        }
+        else {
+            double decay = 1.0;
+            if (ts > last_ts_[sid]) {
+                decay = std::exp2(-static_cast<double>(ts - last_ts_[sid]) / static_cast<double>(Policy::vwap_half_life_ns));
+            }
+            ewma_pv_[sid] = ewma_pv_[sid] * decay + price * qty;
+            ewma_v_[sid] = ewma_v_[sid] * decay + qty;
+        }
+        last_ts_[sid] = std::max(last_ts_[sid], ts);
+
+        // Bars
+        bool late = false;
+        for (std::size_t k = 0; k < INTERVALS; ++k) {
+            const std::size_t c = cell_(k, sid);
+            const std::int64_t width = static_cast<std::int64_t>(Policy::intervals_ns[k]);
+            const std::int64_t start = ts - ts % width;
+
+            if (trades_[c] != 0 && start == start_[c]) [[likely]] {
+                high_[c] = std::max(high_[c], price);
+                low_[c] = std::min(low_[c], price);
+            }
+            else if (start < start_[c]) [[unlikely]] {
+                late = true;    // bucket already closed
+                continue;
+            }
+            else {
+                if (trades_[c] != 0) {
+                    emit_close_(k, c, symbol, emit);
+                }
+                start_[c] = start;
+                open_[c] = high_[c] = low_[c] = price;
+                volume_[c] = notional_[c] = 0.0;
+            }
+            close_[c] = price;
+            volume_[c] += qty;
+            notional_[c] += price * qty;
+            ++trades_[c];
+        }
+        late_trades_total_ += late;
+        (void)open_bars_->insert(sid);
+    }
+
+    template<class Emit>
+    inline void emit_close_(std::size_t interval, std::size_t c, const Symbol& symbol, Emit& emit) noexcept {
+        const protocol::kraken::schema::trade::BarClose bar{
+            .symbol      = symbol,
+            .interval_ns = Policy::intervals_ns[interval],
+            .open_time   = Timestamp{std::chrono::nanoseconds{start_[c]}},
+            .open        = open_[c],
+            .high        = high_[c],
+            .low         = low_[c],
+            .close       = close_[c],
+            .volume      = volume_[c],
+            .vwap        = volume_[c] > 0.0 ? notional_[c] / volume_[c] : close_[c],
+            .trades      = trades_[c]
+        };
+        trades_[c] = 0;     // start_ is kept: later trades of this bucket are late
+        ++bars_closed_total_;
+        emit(bar);
+    }
+};
+
+} // namespace wirekrak::core::feed
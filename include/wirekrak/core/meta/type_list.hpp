@@ -167,6 +167,37 @@ struct type_list_for_each<type_list<Ts...>> {
     }
 };
 
+// ============================================================================
+// type_list_concat
+// ============================================================================
+//
+// Concatenates type_lists, preserving order.
+//
+// Example:
+//   using L = type_list_concat_t<type_list<int>, type_list<double, float>>;
+//   // type_list<int, double, float>
+//
+// ============================================================================
+template<typename... Lists>
+struct type_list_concat;
+
+template<>
+struct type_list_concat<> {
+    using type = type_list<>;
+};
+
+template<typename... Ts>
+struct type_list_concat<type_list<Ts...>> {
+    using type = type_list<Ts...>;
+};
+
+template<typename... Ts, typename... Us, typename... Rest>
+struct type_list_concat<type_list<Ts...>, type_list<Us...>, Rest...>
+    : type_list_concat<type_list<Ts..., Us...>, Rest...> {};
+
+template<typename... Lists>
+using type_list_concat_t = typename type_list_concat<Lists...>::type;
+
 // ============================================================================
 // type_list_assert_unique
 // ============================================================================
@@ -0,0 +1,419 @@
+#pragma once
+
+/*
+===============================================================================
+Wirekrak Heap Allocation Tracer
+===============================================================================
+
+Opt-in instrumentation that counts heap allocations per thread role and per
+pipeline stage, to check the "no allocations in hot paths" claim instead of
+assuming it.
+
+Enabling
+--------
+
+1. Build with WIREKRAK_ENABLE_ALLOC_TRACE (CMake option of the same name)
+2. Include "wirekrak/core/perf/alloc_trace_install.hpp" in exactly ONE
+   translation unit of the executable (it replaces global operator new /
+   delete; it is empty when the flag is off)
+
+Without the flag every hook below compiles to nothing.
+
+Attribution
+-----------
+
+    Thread (role)   tagged once by the thread itself (WK_ALLOC_THREAD)
+        Receive     transport receive loop (websocket::Engine)
+        Session     thread calling Session::poll()
+        Wal         WAL recorder worker
+        Untagged    anything else
+
+    Stage           scoped by the pipeline (WK_ALLOC_STAGE)
+        Ingress     transport receive → message ring
+        Transport   connection poll, transport signals
+        Parse       parse, route, data-plane delivery
+        Requests    outbound request emission
+        Wal         WAL writes
+        None        outside any stage (e.g. user code between polls)
+
+Counters are relaxed atomics in a fixed table (no allocation, no locks);
+dumps print raw integers so reporting does not allocate either.
+
+Trapping
+--------
+
+set_trap(Thread::Session, true) makes any later allocation on a Session
+thread abort with a diagnostic (debug a steady-state allocation at the
+faulting call stack).
+
+Steady-state gate
+-----------------
+
+SteadyStateGate takes a baseline after a warm-up period and reports whether
+the hot path allocated since: the pipeline stages (Ingress, Transport, Parse,
+Requests) of the hot-path threads (Receive, Session). Allocations of these
+threads outside any stage (user code between polls) are reported separately
+and do not fail the gate. Benchmarks return a non-zero exit code when it
+fails.
+
+Reporting
+---------
+
+perf::Report prints the per-thread / per-stage table in its MEMORY section.
+
+===============================================================================
+*/
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <ostream>
+
+#include "lcr/system/monotonic_clock.hpp"
+#include "lcr/trap.hpp"
+
+
+// -----------------------------------------------------------------------------
+// Instrumentation hooks
+// -----------------------------------------------------------------------------
+// WK_ALLOC_STAGE opens a stage until the end of the enclosing scope; several
+// stages in one scope nest (the latest wins) and unwind in reverse order.
+#if defined(WIREKRAK_ENABLE_ALLOC_TRACE)
+    #define WK_ALLOC_CONCAT_(a, b) a##b
+    #define WK_ALLOC_SCOPE_NAME_(line) WK_ALLOC_CONCAT_(wk_alloc_stage_scope_, line)
+    #define WK_ALLOC_THREAD(role) ::wirekrak::core::perf::alloc_trace::tag_thread(::wirekrak::core::perf::alloc_trace::Thread::role)
+    #define WK_ALLOC_STAGE(stage) ::wirekrak::core::perf::alloc_trace::StageScope WK_ALLOC_SCOPE_NAME_(__LINE__){::wirekrak::core::perf::alloc_trace::Stage::stage}
+#else
+    #define WK_ALLOC_THREAD(role) ((void)0)
+    #define WK_ALLOC_STAGE(stage) ((void)0)
+#endif
+
+
+namespace wirekrak::core::perf::alloc_trace {
+
+// ============================================================================
+// Attribution keys
+// ============================================================================
+
+enum class Thread : std::uint8_t {
+    Untagged = 0,
+    Receive,
+    Session,
+    Wal,
+    COUNT
+};
+
+enum class Stage : std::uint8_t {
+    None = 0,
+    Ingress,
+    Transport,
+    Parse,
+    Requests,
+    Wal,
+    COUNT
+};
+
+inline constexpr std::size_t THREAD_COUNT = static_cast<std::size_t>(Thread::COUNT);
+inline constexpr std::size_t STAGE_COUNT  = static_cast<std::size_t>(Stage::COUNT);
+
+[[nodiscard]]
+inline constexpr const char* to_string(Thread t) noexcept {
+    switch (t) {
+        case Thread::Untagged: return "Untagged";
+        case Thread::Receive:  return "Receive";
+        case Thread::Session:  return "Session";
+        case Thread::Wal:      return "Wal";
+        default:               return "?";
+    }
+}
+
+[[nodiscard]]
+inline constexpr const char* to_string(Stage s) noexcept {
+    switch (s) {
+        case Stage::None:      return "None";
+        case Stage::Ingress:   return "Ingress";
+        case Stage::Transport: return "Transport";
+        case Stage::Parse:     return "Parse";
+        case Stage::Requests:  return "Requests";
+        case Stage::Wal:       return "Wal";
+        default:               return "?";
+    }
+}
+
+
+// ============================================================================
+// State (constant-initialized: safe to touch from operator new at any time)
+// ============================================================================
+namespace detail {
+
+struct Cell {
+    std::atomic<std::uint64_t> allocations{0};
+    std::atomic<std::uint64_t> deallocations{0};
+    std::atomic<std::uint64_t> bytes{0};
+};
+
+struct ThreadState {
+    Thread thread = Thread::Untagged;
+    Stage  stage  = Stage::None;
+};
+
+inline constinit Cell table[THREAD_COUNT][STAGE_COUNT]{};
+inline constinit std::atomic<bool> trapped[THREAD_COUNT]{};
+inline constinit std::atomic<bool> installed{false};
+inline constinit thread_local ThreadState current{};
+
+[[nodiscard]]
+inline Cell& cell_() noexcept {
+    return table[static_cast<std::size_t>(current.thread)][static_cast<std::size_t>(current.stage)];
+}
+
+} // namespace detail
+
+
+// ============================================================================
+// Thread / stage tagging
+// ============================================================================
+
+inline void tag_thread(Thread t) noexcept {
+    detail::current.thread = t;
+}
+
+[[nodiscard]]
+inline Thread current_thread() noexcept {
+    return detail::current.thread;
+}
+
+// Sets the current stage for the lifetime of the scope (nests)
+class StageScope {
+public:
+    explicit StageScope(Stage s) noexcept
+        : previous_(detail::current.stage) {
+        detail::current.stage = s;
+    }
+
+    ~StageScope() noexcept {
+        detail::current.stage = previous_;
+    }
+
+    StageScope(const StageScope&) = delete;
+    StageScope& operator=(const StageScope&) = delete;
+
+private:
+    Stage previous_;
+};
+
+// Any allocation on a thread with this role aborts (with a diagnostic)
+inline void set_trap(Thread t, bool on) noexcept {
+    detail::trapped[static_cast<std::size_t>(t)].store(on, std::memory_order_relaxed);
+}
+
+// True once the operator new / delete hooks are linked in
+[[nodiscard]]
+inline bool installed() noexcept {
+    return detail::installed.load(std::memory_order_relaxed);
+}
+
+
+// ============================================================================
+// Hooks (called by alloc_trace_install.hpp)
+// ============================================================================
+
+inline void on_allocate(std::size_t size) noexcept {
+    auto& c = detail::cell_();
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+    c.bytes.fetch_add(size, std::memory_order_relaxed);
+    if (detail::trapped[static_cast<std::size_t>(detail::current.thread)].load(std::memory_order_relaxed)) [[unlikely]] {
+        // No allocation past this point: plain stdio on a fixed message
+        std::fputs("[ALLOC TRACE] heap allocation on trapped thread: ", stderr);
+        std::fputs(to_string(detail::current.thread), stderr);
+        std::fputs(" / stage ", stderr);
+        std::fputs(to_string(detail::current.stage), stderr);
+        std::fputs("\n", stderr);
+        std::fflush(stderr);
+        lcr::trap("heap allocation on trapped thread");
+    }
+}
+
+inline void on_deallocate() noexcept {
+    detail::cell_().deallocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+// ============================================================================
+// Snapshot (point-in-time copy, subtractable)
+// ============================================================================
+
+struct Snapshot {
+    struct Entry {
+        std::uint64_t allocations = 0;
+        std::uint64_t deallocations = 0;
+        std::uint64_t bytes = 0;
+    };
+
+    std::array<std::array<Entry, STAGE_COUNT>, THREAD_COUNT> entries{};
+
+    [[nodiscard]]
+    inline const Entry& at(Thread t, Stage s) const noexcept {
+        return entries[static_cast<std::size_t>(t)][static_cast<std::size_t>(s)];
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t allocations(Thread t) const noexcept {
+        std::uint64_t n = 0;
+        for (const auto& e : entries[static_cast<std::size_t>(t)]) {
+            n += e.allocations;
+        }
+        return n;
+    }
+
+    // Allocations in the pipeline stages of the hot-path threads
+    // (transport receive + Session::poll())
+    [[nodiscard]]
+    inline std::uint64_t hot_path_allocations() const noexcept {
+        std::uint64_t n = 0;
+        for (Thread t : { Thread::Receive, Thread::Session }) {
+            for (Stage s : { Stage::Ingress, Stage::Transport, Stage::Parse, Stage::Requests }) {
+                n += at(t, s).allocations;
+            }
+        }
+        return n;
+    }
+
+    // Allocations of the hot-path threads outside any stage (user code)
+    [[nodiscard]]
+    inline std::uint64_t outside_stage_allocations() const noexcept {
+        return at(Thread::Receive, Stage::None).allocations + at(Thread::Session, Stage::None).allocations;
+    }
+
+    [[nodiscard]]
+    inline Snapshot operator-(const Snapshot& base) const noexcept {
+        Snapshot d;
+        for (std::size_t t = 0; t < THREAD_COUNT; ++t) {
+            for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+                d.entries[t][s].allocations   = entries[t][s].allocations   - base.entries[t][s].allocations;
+                d.entries[t][s].deallocations = entries[t][s].deallocations - base.entries[t][s].deallocations;
+                d.entries[t][s].bytes         = entries[t][s].bytes         - base.entries[t][s].bytes;
+            }
+        }
+        return d;
+    }
+
+    // Non-empty rows only
+    inline void dump(std::ostream& os) const {
+        if (!installed()) {
+            os << "  Not traced (build with WIREKRAK_ENABLE_ALLOC_TRACE and include alloc_trace_install.hpp)\n";
+            return;
+        }
+        bool any = false;
+        for (std::size_t t = 0; t < THREAD_COUNT; ++t) {
+            for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+                const auto& e = entries[t][s];
+                if (e.allocations == 0 && e.deallocations == 0) {
+                    continue;
+                }
+                any = true;
+                os << "  " << to_string(static_cast<Thread>(t)) << " / " << to_string(static_cast<Stage>(s))
+                   << " : " << e.allocations << " allocs, "
+                   << e.deallocations << " frees, "
+                   << e.bytes << " bytes\n";
+            }
+        }
+        if (!any) {
+            os << "  No heap allocations\n";
+        }
+    }
+};
+
+[[nodiscard]]
+inline Snapshot snapshot() noexcept {
+    Snapshot snap;
+    for (std::size_t t = 0; t < THREAD_COUNT; ++t) {
+        for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+            const auto& c = detail::table[t][s];
+            snap.entries[t][s].allocations   = c.allocations.load(std::memory_order_relaxed);
+            snap.entries[t][s].deallocations = c.deallocations.load(std::memory_order_relaxed);
+            snap.entries[t][s].bytes         = c.bytes.load(std::memory_order_relaxed);
+        }
+    }
+    return snap;
+}
+
+
+// ============================================================================
+// Steady-state gate
+// ============================================================================
+//
+// Usage (benchmark loop):
+//
+//     perf::alloc_trace::SteadyStateGate gate{ 10'000'000'000 };  // 10 s warm-up
+//     while (running) { ...; gate.poll(); }
+//     gate.finish();                                              // end of steady state
+//     ...                                                         // shutdown (not counted)
+//     if (!gate.verdict(std::cout)) return 2;
+//
+// Always passes when the tracer is not installed.
+//
+class SteadyStateGate {
+public:
+    explicit SteadyStateGate(std::uint64_t warmup_ns) noexcept
+        : warmup_ns_(warmup_ns)
+        , start_ns_(lcr::system::monotonic_clock::instance().now_ns()) {
+    }
+
+    // Takes the baseline once the warm-up period is over
+    inline void poll() noexcept {
+        if (armed_) [[likely]] {
+            return;
+        }
+        if (lcr::system::monotonic_clock::instance().now_ns() - start_ns_ >= warmup_ns_) {
+            baseline_ = snapshot();
+            armed_ = true;
+        }
+    }
+
+    // Ends the measured window (later allocations, e.g. shutdown, are not counted)
+    inline void finish() noexcept {
+        if (armed_ && !finished_) {
+            end_ = snapshot();
+            finished_ = true;
+        }
+    }
+
+    [[nodiscard]]
+    inline bool armed() const noexcept {
+        return armed_;
+    }
+
+    // Prints the steady-state allocations; false if the hot path allocated
+    [[nodiscard]]
+    inline bool verdict(std::ostream& os) const {
+        os << "\nSteady-state heap allocations\n";
+        if (!installed()) {
+            os << "  Not traced\n";
+            return true;
+        }
+        if (!armed_) {
+            os << "  Warm-up not completed (no steady state measured)\n";
+            return true;
+        }
+        const Snapshot delta = (finished_ ? end_ : snapshot()) - baseline_;
+        delta.dump(os);
+        const std::uint64_t hot = delta.hot_path_allocations();
+        os << "  Outside stages    : " << delta.outside_stage_allocations() << " (not gated)\n";
+        os << "  Hot path          : " << hot << (hot == 0 ? " (PASS)\n" : " (FAIL)\n");
+        return hot == 0;
+    }
+
+private:
+    std::uint64_t warmup_ns_;
+    std::uint64_t start_ns_;
+    bool armed_ = false;
+    bool finished_ = false;
+    Snapshot baseline_{};
+    Snapshot end_{};
+};
+
+} // namespace wirekrak::core::perf::alloc_trace
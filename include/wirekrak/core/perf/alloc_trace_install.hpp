@@ -0,0 +1,125 @@
+#pragma once
+
+/*
+===============================================================================
+Wirekrak Heap Allocation Tracer - global operator new / delete
+===============================================================================
+
+Include in exactly ONE translation unit of an executable built with
+WIREKRAK_ENABLE_ALLOC_TRACE (see alloc_trace.hpp). Replacement allocation
+functions cannot be inline, so they are defined here rather than in the
+header-only library; including this file twice in one program is an ODR
+violation (duplicate symbols at link time).
+
+Without WIREKRAK_ENABLE_ALLOC_TRACE this header is empty.
+
+Every replaceable form is covered (plain, array, nothrow, sized, aligned),
+all forwarding to malloc / free after counting.
+
+===============================================================================
+*/
+
+#if defined(WIREKRAK_ENABLE_ALLOC_TRACE)
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#if defined(_MSC_VER)
+#  include <malloc.h>
+#endif
+
+#include "wirekrak/core/perf/alloc_trace.hpp"
+
+
+namespace wirekrak::core::perf::alloc_trace::detail {
+
+[[nodiscard]]
+inline void* malloc_(std::size_t size) noexcept {
+    on_allocate(size);
+    return std::malloc(size ? size : 1);
+}
+
+[[nodiscard]]
+inline void* aligned_malloc_(std::size_t size, std::align_val_t al) noexcept {
+    on_allocate(size);
+    const std::size_t align = static_cast<std::size_t>(al);
+#if defined(_MSC_VER)
+    return ::_aligned_malloc(size ? size : 1, align);
+#else
+    const std::size_t rounded = ((size ? size : 1) + align - 1) & ~(align - 1);
+    return std::aligned_alloc(align, rounded);
+#endif
+}
+
+inline void free_(void* p) noexcept {
+    if (p) {
+        on_deallocate();
+        std::free(p);
+    }
+}
+
+inline void aligned_free_(void* p) noexcept {
+    if (p) {
+        on_deallocate();
+#if defined(_MSC_VER)
+        ::_aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+inline const bool installed_at_startup_ = (installed.store(true, std::memory_order_relaxed), true);
+
+} // namespace wirekrak::core::perf::alloc_trace::detail
+
+
+namespace wk_alloc_trace_ = wirekrak::core::perf::alloc_trace::detail;
+
+// ---- plain / array ----
+void* operator new(std::size_t size) {
+    if (void* p = wk_alloc_trace_::malloc_(size)) return p;
+    throw std::bad_alloc{};
+}
+void* operator new[](std::size_t size) {
+    if (void* p = wk_alloc_trace_::malloc_(size)) return p;
+    throw std::bad_alloc{};
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return wk_alloc_trace_::malloc_(size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return wk_alloc_trace_::malloc_(size);
+}
+
+void operator delete(void* p) noexcept                                   { wk_alloc_trace_::free_(p); }
+void operator delete[](void* p) noexcept                                 { wk_alloc_trace_::free_(p); }
+void operator delete(void* p, std::size_t) noexcept                      { wk_alloc_trace_::free_(p); }
+void operator delete[](void* p, std::size_t) noexcept                    { wk_alloc_trace_::free_(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept            { wk_alloc_trace_::free_(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept          { wk_alloc_trace_::free_(p); }
+
+// ---- aligned ----
+void* operator new(std::size_t size, std::align_val_t al) {
+    if (void* p = wk_alloc_trace_::aligned_malloc_(size, al)) return p;
+    throw std::bad_alloc{};
+}
+void* operator new[](std::size_t size, std::align_val_t al) {
+    if (void* p = wk_alloc_trace_::aligned_malloc_(size, al)) return p;
+    throw std::bad_alloc{};
+}
+void* operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return wk_alloc_trace_::aligned_malloc_(size, al);
+}
+void* operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return wk_alloc_trace_::aligned_malloc_(size, al);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept                          { wk_alloc_trace_::aligned_free_(p); }
+void operator delete[](void* p, std::align_val_t) noexcept                        { wk_alloc_trace_::aligned_free_(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept             { wk_alloc_trace_::aligned_free_(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept           { wk_alloc_trace_::aligned_free_(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept   { wk_alloc_trace_::aligned_free_(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { wk_alloc_trace_::aligned_free_(p); }
+
+#endif // WIREKRAK_ENABLE_ALLOC_TRACE
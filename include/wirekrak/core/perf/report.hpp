@@ -4,6 +4,7 @@
 #include <iomanip>
 
 #include "wirekrak/core/protocol/telemetry/session.hpp"
+#include "wirekrak/core/perf/alloc_trace.hpp"
 #include "lcr/format.hpp"
 
 namespace wirekrak::core::perf {
@@ -29,6 +30,7 @@ public:
         , end_to_end_latency_ ( t.end_to_end_latency.compute_percentiles() )
         , process_latency_    ( t.process_latency.compute_percentiles() )
         , handoff_latency_    ( t.handoff_latency.compute_percentiles() )
+        , poll_latency_       ( t.poll_latency.compute_percentiles() )
         , ingress_latency_    ( t.connection.websocket.ingress_latency.compute_percentiles() )
         , healthy_ns_         ( t.healthy_time_ns.load() )
         , backpressure_ns_    ( t.backpressure_time_ns.load() )
@@ -65,6 +67,7 @@ private:
     const lcr::metrics::latency_percentiles end_to_end_latency_;
     const lcr::metrics::latency_percentiles process_latency_;
     const lcr::metrics::latency_percentiles handoff_latency_;
+    const lcr::metrics::latency_percentiles poll_latency_;
     const lcr::metrics::latency_percentiles ingress_latency_;
 
     const std::uint64_t healthy_ns_;
@@ -158,6 +161,8 @@ private:
 
         print_latency_block_(os, "Latency (ingress)", ingress_latency_);
 
+        print_latency_block_(os, "Poll duration", poll_latency_);
+
         os << "\nBurst profiling (Ingress)\n";
         os << "  Ingress burst    : "; t_.connection.websocket.ingress_burst.dump(os); os << '\n';
 
@@ -209,6 +214,8 @@ private:
         os << "  Ignored          : " << lcr::format_number_exact(t_.parse_ignored_total.load()) << '\n';
         os << "  Failures         : " << lcr::format_number_exact(t_.parse_failure_total.load()) << '\n';
         os << "  Backpressure     : " << lcr::format_number_exact(t_.parse_backpressure_total.load()) << '\n';
+        os << "  Conflated        : " << lcr::format_number_exact(t_.conflated_messages_total.load()) << '\n';
+        os << "  Shed (stale)     : " << lcr::format_number_exact(t_.shed_dropped_messages_total.load()) << '\n';
     }
 
     // =============================================================================
@@ -286,6 +293,9 @@ private:
         os << "\nMemory Behavior\n";
         os << "  Slot promotions   : " << lcr::format_number_exact(ws.slot_promotions_total.load()) << '\n';
         os << "  Pool depth        : "; ws.memory_pool_depth.dump(os); os << '\n';
+
+        os << "\nHeap allocations (since start, per thread / stage)\n";
+        alloc_trace::snapshot().dump(os);
     }
 
     // =============================================================================
@@ -320,9 +330,23 @@ private:
         os << "  Subscriptions     : " << lcr::format_number_exact(t_.subscriptions_requested_total.load()) << '\n';
         os << "  Unsubscriptions   : " << lcr::format_number_exact(t_.unsubscriptions_requested_total.load()) << '\n';
 
+        os << "\nSubscription ramp\n";
+        os << "  Completed ramps   : " << lcr::format_number_exact(t_.subscription_ramp_duration.samples()) << '\n';
+        os << "  Avg time to full  : " << lcr::format_duration(t_.subscription_ramp_duration.avg_ns()) << '\n';
+        os << "  Max time to full  : " << lcr::format_duration(t_.subscription_ramp_duration.max_ns()) << '\n';
+        if (t_.request_batch_rtt.samples() > 0) {
+            os << "  Batch RTT (avg)   : " << lcr::format_duration(t_.request_batch_rtt.avg_ns()) << '\n';
+            os << "  Batch RTT (max)   : " << lcr::format_duration(t_.request_batch_rtt.max_ns()) << '\n';
+        }
+
         os << "\nReplay\n";
         os << "  Replay requests   : " << lcr::format_number_exact(t_.replay_requests_total.load()) << '\n';
         os << "  Replay symbols    : " << lcr::format_number_exact(t_.replay_symbols_total.load()) << '\n';
+        os << "  Snapshot-less     : " << lcr::format_number_exact(t_.replay_snapshotless_symbols_total.load()) << '\n';
+        if (t_.replay_resync_duration.samples() > 0) {
+            os << "  Resync (avg)      : " << lcr::format_duration(t_.replay_resync_duration.avg_ns()) << '\n';
+            os << "  Resync (max)      : " << lcr::format_duration(t_.replay_resync_duration.max_ns()) << '\n';
+        }
     
         const auto& c = t_.connection;
 
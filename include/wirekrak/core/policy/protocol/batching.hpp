@@ -33,6 +33,14 @@
 //   - Large subscriptions are split into batches
 //   - One batch is emitted every N poll() calls
 //
+// Adaptive
+//   - Large subscriptions are split into batches
+//   - Emission is time-based (token bucket: rate + burst) and bounded by
+//     the number of batches awaiting their ACKs (window grown from ACK
+//     feedback, halved on failures / rejections)
+//   - Independent of the poll() rate; reaches full subscription as fast as
+//     the exchange acknowledges
+//
 // EXAMPLE
 // -------
 //
@@ -54,6 +62,13 @@
 //       poll 3 → subscribe(book, 20)
 //       poll 5 → subscribe(book, 20)
 //
+//   Adaptive mode (batch_size = 10, rate = 20/s, burst = 4, max_in_flight = 8):
+//
+//       t=0      → subscribe(book, 10)             window 1
+//       ACK      → subscribe(book, 10) x2          window 2
+//       ACKs     → subscribe(book, 10) x4          window 4 (bounded by rate)
+//       ...
+//
 // USE CASES
 // ---------
 // • Large initial market data bootstraps
@@ -76,7 +91,8 @@ namespace wirekrak::core::policy::protocol {
 enum class BatchingMode {
     Immediate,
     Batch,
-    Paced
+    Paced,
+    Adaptive
 };
 
 
@@ -94,6 +110,15 @@ concept HasBatchingMembers =
     };
 
 
+template<class T>
+concept HasAdaptivePacingMembers =
+    requires {
+        { T::rate_per_sec } -> std::same_as<const std::size_t&>;
+        { T::burst } -> std::same_as<const std::size_t&>;
+        { T::max_in_flight } -> std::same_as<const std::size_t&>;
+    };
+
+
 // ------------------------------------------------------------
 // Batching Concept
 // ------------------------------------------------------------
@@ -127,9 +152,26 @@ concept BatchingConcept =
             T::batch_size > 0 &&
             T::emit_interval > 0
         )
+        ||
+        // Adaptive
+        (
+            T::mode == BatchingMode::Adaptive &&
+            T::batch_size > 0 &&
+            T::emit_interval == 0 &&
+            HasAdaptivePacingMembers<T> &&
+            T::rate_per_sec > 0 &&
+            T::burst > 0 &&
+            T::max_in_flight > 0
+        )
     );
 
 
+// True if batches are queued and emitted by the Session over several polls
+template<class T>
+inline constexpr bool is_scheduled_batching_v =
+    T::mode == BatchingMode::Paced || T::mode == BatchingMode::Adaptive;
+
+
 // ------------------------------------------------------------
 // Batching Policy
 // ------------------------------------------------------------
@@ -160,6 +202,7 @@ struct BatchingPolicy {
             case BatchingMode::Immediate: return "Immediate";
             case BatchingMode::Batch:     return "Batch";
             case BatchingMode::Paced:     return "Paced";
+            case BatchingMode::Adaptive:  return "Adaptive";
         }
         return "Unknown";
     }
@@ -184,6 +227,52 @@ struct BatchingPolicy {
 };
 
 
+// ------------------------------------------------------------
+// Adaptive Batching Policy
+// ------------------------------------------------------------
+
+template<
+    std::size_t BatchSizeV,
+    std::size_t RatePerSecV,    // batches per second (token refill rate)
+    std::size_t BurstV,         // token bucket depth (batches)
+    std::size_t MaxInFlightV    // upper bound of the ACK-driven window (batches)
+>
+struct AdaptiveBatchingPolicy {
+
+    static constexpr BatchingMode mode = BatchingMode::Adaptive;
+
+    static constexpr std::size_t batch_size = BatchSizeV;
+
+    // Not used (emission is time-based)
+    static constexpr std::size_t emit_interval = 0;
+
+    static constexpr std::size_t rate_per_sec = RatePerSecV;
+
+    static constexpr std::size_t burst = BurstV;
+
+    static constexpr std::size_t max_in_flight = MaxInFlightV;
+
+    static constexpr bool enabled = true;
+
+    static constexpr const char* mode_name() noexcept {
+        return "Adaptive";
+    }
+
+    static void dump(std::ostream& os) {
+
+        os << "[Protocol Batching Policy]\n";
+
+        os << "- Mode          : " << mode_name() << "\n";
+        os << "- Enabled       : yes\n";
+        os << "- Batch size    : " << batch_size << "\n";
+        os << "- Rate          : " << rate_per_sec << " batch(es)/s (burst " << burst << ")\n";
+        os << "- Max in flight : " << max_in_flight << " batch(es)\n";
+
+        os << "\n";
+    }
+};
+
+
 // ------------------------------------------------------------
 // Predefined Policies
 // ------------------------------------------------------------
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <concepts>
+#include <ostream>
+
+#include "wirekrak/core/meta/type_list.hpp"
+
+namespace wirekrak::core::policy::protocol {
+
+// ------------------------------------------------------------
+// Concept Helpers
+// ------------------------------------------------------------
+
+template<class T>
+concept HasConflationMembers =
+    requires {
+        { T::enabled } -> std::same_as<const bool&>;
+        { T::max_symbols } -> std::same_as<const std::size_t&>;
+        typename T::messages;
+    };
+
+
+// ------------------------------------------------------------
+// Conflation Concept
+// ------------------------------------------------------------
+
+template<class T>
+concept ConflationConcept =
+    HasConflationMembers<T>
+    &&
+    (
+        // Disabled → no pending table
+        (!T::enabled && T::max_symbols == 0)
+        ||
+        // Enabled → at least one symbol slot
+        (T::enabled && T::max_symbols >= 1)
+    );
+
+
+// ------------------------------------------------------------
+// Conflation Policy
+// ------------------------------------------------------------
+//
+// When the data-plane ring of a listed message type is full, updates are
+// merged into one pending entry per SymbolId instead of being rejected.
+// Pending entries are delivered after the queued messages of that type.
+//
+// Merge semantics are defined per message type by
+// protocol::data::conflation_traits<T>.
+//
+// ------------------------------------------------------------
+
+template<
+    std::size_t MaxSymbolsV,
+    class... Messages
+>
+struct ConflationPolicy {
+
+    static constexpr bool enabled = true;
+
+    static constexpr std::size_t max_symbols = MaxSymbolsV;
+
+    using messages = meta::type_list<Messages...>;
+
+    static_assert(sizeof...(Messages) > 0, "ConflationPolicy requires at least one message type");
+
+    // ------------------------------------------------------------
+    // Introspection Helpers
+    // ------------------------------------------------------------
+
+    static constexpr const char* mode_name() noexcept {
+        return "LatestPerSymbol";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Protocol Conflation Policy]\n";
+        os << "- Enabled       : yes\n";
+        os << "- Mode          : " << mode_name() << "\n";
+        os << "- Message types : " << sizeof...(Messages) << "\n";
+        os << "- Max symbols   : " << max_symbols << "\n\n";
+    }
+};
+
+
+// ------------------------------------------------------------
+// Conflation disabled
+// ------------------------------------------------------------
+
+struct NoConflation {
+
+    static constexpr bool enabled = false;
+
+    static constexpr std::size_t max_symbols = 0;
+
+    using messages = meta::type_list<>;
+
+    // ------------------------------------------------------------
+    // Introspection Helpers
+    // ------------------------------------------------------------
+
+    static constexpr const char* mode_name() noexcept {
+        return "Disabled";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Protocol Conflation Policy]\n";
+        os << "- Enabled       : no (every update is queued)\n\n";
+    }
+};
+
+static_assert(ConflationConcept<NoConflation>, "NoConflation does not satisfy ConflationConcept");
+
+
+// ------------------------------------------------------------
+// Default
+// ------------------------------------------------------------
+
+using DefaultConflation = NoConflation;
+
+static_assert(ConflationConcept<DefaultConflation>, "DefaultConflation does not satisfy ConflationConcept");
+
+} // namespace wirekrak::core::policy::protocol
@@ -0,0 +1,181 @@
+#pragma once
+
+// ============================================================================
+// Protocol Fan-out Policy
+// ============================================================================
+//
+// Controls how many consumer threads can read the Session data-plane.
+//
+// By default the data-plane is single-consumer: every message type is backed
+// by an SPSC queue and the thread calling poll() (or a single dedicated
+// consumer) drains it. With fan-out enabled, every message type is backed by
+// an SPMC fan-out ring: messages are parsed ONCE and each registered consumer
+// reads the same stream at its own pace.
+//
+// DESIGN GOALS
+// ------------
+// • Compile-time configurable
+// • Zero runtime overhead when disabled (plain SPSC data-plane)
+// • Bounded memory (fixed consumer count, fixed ring capacity)
+// • Deterministic slow-consumer handling
+//
+// SLOW CONSUMER MODES
+// -------------------
+//
+// Block
+//   - The producer refuses to publish while the slowest consumer lags by a
+//     full ring
+//   - Surfaces as protocol backpressure (same semantics as single consumer)
+//
+// Drop
+//   - The producer never waits: the message being published is dropped for
+//     ALL consumers while the ring is full
+//   - Lagging consumers keep their backlog
+//
+// Evict
+//   - The producer never waits: consumers lagging by a full ring are evicted
+//     (moved to the live edge by the producer) and the message is published
+//     to everyone, so a stalled consumer costs the others nothing
+//   - The evicted backlog is skipped; message types listed in the session
+//     ConflationPolicy are first collapsed into one entry per symbol, which
+//     the evicted consumer reads before the live stream
+//
+// EXAMPLE
+// -------
+//
+//   using Fanout = FanoutPolicy<SlowConsumerMode::Evict, 4>;
+//
+//   using Bundle = session_bundle<
+//       DefaultBackpressure, DefaultLiveness, DefaultProgress,
+//       DefaultSymbolLimit, DefaultReplay, DefaultBatching,
+//       Fanout
+//   >;
+//
+//   auto pricing = session.data_plane().register_consumer();
+//   auto risk    = session.data_plane().register_consumer();
+//
+// ============================================================================
+
+#include <cstddef>
+#include <concepts>
+#include <ostream>
+
+namespace wirekrak::core::policy::protocol {
+
+// ------------------------------------------------------------
+// Slow Consumer Mode
+// ------------------------------------------------------------
+
+enum class SlowConsumerMode {
+    Block,
+    Drop,
+    Evict
+};
+
+
+// ------------------------------------------------------------
+// Concept Helpers
+// ------------------------------------------------------------
+
+template<class T>
+concept HasFanoutMembers =
+    requires {
+        { T::enabled } -> std::same_as<const bool&>;
+        { T::max_consumers } -> std::same_as<const std::size_t&>;
+        { T::slow_consumer } -> std::same_as<const SlowConsumerMode&>;
+    };
+
+
+// ------------------------------------------------------------
+// Fan-out Concept
+// ------------------------------------------------------------
+
+template<class T>
+concept FanoutConcept =
+    HasFanoutMembers<T>
+    &&
+    (
+        // Disabled → single consumer
+        (!T::enabled && T::max_consumers == 1)
+        ||
+        // Enabled → at least one consumer
+        (T::enabled && T::max_consumers >= 1)
+    );
+
+
+// ------------------------------------------------------------
+// Fan-out Policy
+// ------------------------------------------------------------
+
+template<
+    SlowConsumerMode SlowConsumerV,
+    std::size_t MaxConsumersV
+>
+struct FanoutPolicy {
+
+    static constexpr bool enabled = true;
+
+    static constexpr std::size_t max_consumers = MaxConsumersV;
+
+    static constexpr SlowConsumerMode slow_consumer = SlowConsumerV;
+
+    // ------------------------------------------------------------
+    // Introspection Helpers
+    // ------------------------------------------------------------
+
+    static constexpr const char* mode_name() noexcept {
+        switch (slow_consumer) {
+            case SlowConsumerMode::Block: return "Block";
+            case SlowConsumerMode::Drop:  return "Drop";
+            case SlowConsumerMode::Evict: return "Evict";
+        }
+        return "Unknown";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Protocol Fan-out Policy]\n";
+        os << "- Enabled       : yes\n";
+        os << "- Max consumers : " << max_consumers << "\n";
+        os << "- Slow consumer : " << mode_name() << "\n\n";
+    }
+};
+
+
+// ------------------------------------------------------------
+// Single consumer (fan-out disabled)
+// ------------------------------------------------------------
+
+struct NoFanout {
+
+    static constexpr bool enabled = false;
+
+    static constexpr std::size_t max_consumers = 1;
+
+    static constexpr SlowConsumerMode slow_consumer = SlowConsumerMode::Block;
+
+    // ------------------------------------------------------------
+    // Introspection Helpers
+    // ------------------------------------------------------------
+
+    static constexpr const char* mode_name() noexcept {
+        return "Disabled";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Protocol Fan-out Policy]\n";
+        os << "- Enabled       : no (single consumer)\n\n";
+    }
+};
+
+static_assert(FanoutConcept<NoFanout>, "NoFanout does not satisfy FanoutConcept");
+
+
+// ------------------------------------------------------------
+// Default
+// ------------------------------------------------------------
+
+using DefaultFanout = NoFanout;
+
+static_assert(FanoutConcept<DefaultFanout>, "DefaultFanout does not satisfy FanoutConcept");
+
+} // namespace wirekrak::core::policy::protocol
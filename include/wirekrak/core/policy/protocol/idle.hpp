@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <concepts>
+#include <ostream>
+
+namespace wirekrak::core::policy::protocol {
+
+// ------------------------------------------------------------
+// Idle Mode
+// ------------------------------------------------------------
+//
+// What a SessionRunner does after a loop iteration that did no work
+// (no message received, nothing drained by the handler).
+//
+// ------------------------------------------------------------
+
+enum class IdleMode {
+    BusySpin,   // cpu_relax() and poll again (lowest latency, burns the core)
+    Backoff,    // Spin, then yield, then sleep as the idle streak grows
+    Block       // Sleep on the session notification fd (see Session::wait)
+};
+
+
+// ------------------------------------------------------------
+// Concept Helpers
+// ------------------------------------------------------------
+
+template<class T>
+concept HasIdleMembers =
+    requires {
+        { T::mode } -> std::same_as<const IdleMode&>;
+        { T::spin_polls } -> std::same_as<const std::uint32_t&>;
+        { T::yield_polls } -> std::same_as<const std::uint32_t&>;
+        { T::sleep_ns } -> std::same_as<const std::uint64_t&>;
+    };
+
+
+// ------------------------------------------------------------
+// Idle Concept
+// ------------------------------------------------------------
+
+template<class T>
+concept IdleConcept =
+    HasIdleMembers<T>
+    &&
+    (
+        // BusySpin → no thresholds
+        (T::mode == IdleMode::BusySpin && T::spin_polls == 0 && T::yield_polls == 0 && T::sleep_ns == 0)
+        ||
+        // Backoff → spin stage first, then yield stage, then sleep
+        (T::mode == IdleMode::Backoff && T::yield_polls >= T::spin_polls && T::sleep_ns > 0)
+        ||
+        // Block → bounded wait (liveness, retry and pacing need regular polls)
+        (T::mode == IdleMode::Block && T::sleep_ns > 0)
+    );
+
+
+namespace idle {
+
+// ------------------------------------------------------------
+// BusySpin
+// ------------------------------------------------------------
+
+struct BusySpin {
+
+    static constexpr IdleMode mode = IdleMode::BusySpin;
+
+    static constexpr std::uint32_t spin_polls = 0;
+
+    static constexpr std::uint32_t yield_polls = 0;
+
+    static constexpr std::uint64_t sleep_ns = 0;
+
+    static constexpr const char* mode_name() noexcept {
+        return "BusySpin";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Runner Idle Policy]\n";
+        os << "- Mode        : " << mode_name() << " (never releases the core)\n\n";
+    }
+};
+
+// ------------------------------------------------------------
+// Backoff
+// ------------------------------------------------------------
+//
+// Consecutive idle iterations:
+//   [0, SpinPolls)          → cpu_relax()
+//   [SpinPolls, YieldPolls) → std::this_thread::yield()
+//   [YieldPolls, ...)       → sleep for SleepNs
+//
+// Any iteration with work resets the streak.
+//
+// ------------------------------------------------------------
+
+template<
+    std::uint32_t SpinPollsV = 1024,
+    std::uint32_t YieldPollsV = 4096,
+    std::uint64_t SleepNsV = 50'000
+>
+struct Backoff {
+
+    static constexpr IdleMode mode = IdleMode::Backoff;
+
+    static constexpr std::uint32_t spin_polls = SpinPollsV;
+
+    static constexpr std::uint32_t yield_polls = YieldPollsV;
+
+    static constexpr std::uint64_t sleep_ns = SleepNsV;
+
+    static constexpr const char* mode_name() noexcept {
+        return "Backoff";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Runner Idle Policy]\n";
+        os << "- Mode        : " << mode_name() << "\n";
+        os << "- Spin        : " << spin_polls << " idle polls\n";
+        os << "- Yield       : until " << yield_polls << " idle polls\n";
+        os << "- Sleep       : " << sleep_ns << " ns\n\n";
+    }
+};
+
+// ------------------------------------------------------------
+// Block
+// ------------------------------------------------------------
+//
+// After SpinPolls idle iterations, sleeps on the session notification fd
+// for at most SleepNs (rounded up to whole milliseconds). Requires a
+// transport with notification::EventFd; otherwise the runner yields.
+//
+// ------------------------------------------------------------
+
+template<
+    std::uint32_t SpinPollsV = 1024,
+    std::uint64_t SleepNsV = 1'000'000
+>
+struct Block {
+
+    static constexpr IdleMode mode = IdleMode::Block;
+
+    static constexpr std::uint32_t spin_polls = SpinPollsV;
+
+    static constexpr std::uint32_t yield_polls = SpinPollsV;
+
+    static constexpr std::uint64_t sleep_ns = SleepNsV;
+
+    static constexpr const char* mode_name() noexcept {
+        return "Block";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Runner Idle Policy]\n";
+        os << "- Mode        : " << mode_name() << "\n";
+        os << "- Spin        : " << spin_polls << " idle polls\n";
+        os << "- Max wait    : " << sleep_ns << " ns\n\n";
+    }
+};
+
+} // namespace idle
+
+static_assert(IdleConcept<idle::BusySpin>, "idle::BusySpin does not satisfy IdleConcept");
+static_assert(IdleConcept<idle::Backoff<>>, "idle::Backoff does not satisfy IdleConcept");
+static_assert(IdleConcept<idle::Block<>>, "idle::Block does not satisfy IdleConcept");
+
+
+// ------------------------------------------------------------
+// Default
+// ------------------------------------------------------------
+
+using DefaultIdle = idle::Backoff<>;
+
+static_assert(IdleConcept<DefaultIdle>, "DefaultIdle does not satisfy IdleConcept");
+
+} // namespace wirekrak::core::policy::protocol
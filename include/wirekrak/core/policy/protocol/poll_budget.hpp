@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <ostream>
+
+#include "wirekrak/core/meta/type_list.hpp"
+#include "wirekrak/core/config/protocol.hpp"
+
+namespace wirekrak::core::policy::protocol {
+
+// ------------------------------------------------------------
+// Poll Budget Mode
+// ------------------------------------------------------------
+
+enum class PollBudgetMode {
+    Count,     // At most max_messages per poll()
+    Deadline   // At most max_messages per poll() AND stop once budget_ns elapsed
+};
+
+
+// ------------------------------------------------------------
+// Per-message-type quota
+// ------------------------------------------------------------
+//
+// Stops the current poll() once `Limit` messages of type `Msg` have been
+// delivered, so that bursts of expensive messages (e.g. depth-1000 book
+// snapshots) cannot monopolize a poll cycle.
+//
+// ------------------------------------------------------------
+
+template<class Msg, std::size_t Limit>
+struct message_quota {
+    static_assert(Limit > 0, "message_quota limit must be > 0");
+
+    using message = Msg;
+    static constexpr std::size_t limit = Limit;
+};
+
+
+// ------------------------------------------------------------
+// Concept Helpers
+// ------------------------------------------------------------
+
+template<class T>
+concept HasPollBudgetMembers =
+    requires {
+        { T::mode } -> std::same_as<const PollBudgetMode&>;
+        { T::max_messages } -> std::same_as<const std::size_t&>;
+        { T::budget_ns } -> std::same_as<const std::uint64_t&>;
+        typename T::quotas;
+    };
+
+
+// ------------------------------------------------------------
+// Poll Budget Concept
+// ------------------------------------------------------------
+
+template<class T>
+concept PollBudgetConcept =
+    HasPollBudgetMembers<T>
+    &&
+    (T::max_messages > 0)
+    &&
+    (
+        // Count → no time budget
+        (T::mode == PollBudgetMode::Count && T::budget_ns == 0)
+        ||
+        // Deadline → non-zero time budget
+        (T::mode == PollBudgetMode::Deadline && T::budget_ns > 0)
+    );
+
+
+// ------------------------------------------------------------
+// Poll Budget Policy
+// ------------------------------------------------------------
+//
+// NOTE:
+// The deadline is checked after each message, so one poll() may overrun
+// the budget by at most the cost of a single message.
+//
+// ------------------------------------------------------------
+
+template<
+    PollBudgetMode ModeV,
+    std::size_t MaxMessagesV,
+    std::uint64_t BudgetNsV = 0,
+    class... Quotas
+>
+struct PollBudgetPolicy {
+
+    static constexpr PollBudgetMode mode = ModeV;
+
+    static constexpr std::size_t max_messages = MaxMessagesV;
+
+    // Used only for Deadline mode
+    static constexpr std::uint64_t budget_ns = BudgetNsV;
+
+    using quotas = meta::type_list<Quotas...>;
+
+    static constexpr bool has_quotas = sizeof...(Quotas) > 0;
+
+    // ------------------------------------------------------------
+    // Introspection Helpers
+    // ------------------------------------------------------------
+
+    static constexpr const char* mode_name() noexcept {
+        switch (mode) {
+            case PollBudgetMode::Count:    return "Count";
+            case PollBudgetMode::Deadline: return "Deadline";
+        }
+        return "Unknown";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Protocol Poll Budget Policy]\n";
+        os << "- Mode         : " << mode_name() << "\n";
+        os << "- Max messages : " << max_messages << " per poll\n";
+        if constexpr (ModeV == PollBudgetMode::Deadline) {
+            os << "- Time budget  : " << budget_ns << " ns per poll\n";
+        }
+        os << "- Quotas       : " << sizeof...(Quotas) << " message type(s)\n\n";
+    }
+};
+
+
+// ------------------------------------------------------------
+// Predefined Policies
+// ------------------------------------------------------------
+
+template<std::size_t MaxMessagesV = config::protocol::MAX_MESSAGES_PER_POLL, class... Quotas>
+using CountBudget =
+    PollBudgetPolicy<
+        PollBudgetMode::Count,
+        MaxMessagesV,
+        0,
+        Quotas...
+    >;
+
+template<std::uint64_t BudgetNsV, std::size_t MaxMessagesV = config::protocol::MAX_MESSAGES_PER_POLL, class... Quotas>
+using DeadlineBudget =
+    PollBudgetPolicy<
+        PollBudgetMode::Deadline,
+        MaxMessagesV,
+        BudgetNsV,
+        Quotas...
+    >;
+
+static_assert(PollBudgetConcept<CountBudget<>>, "CountBudget does not satisfy PollBudgetConcept");
+static_assert(PollBudgetConcept<DeadlineBudget<50'000>>, "DeadlineBudget does not satisfy PollBudgetConcept");
+
+
+// ------------------------------------------------------------
+// Default (legacy fixed message count)
+// ------------------------------------------------------------
+
+using DefaultPollBudget = CountBudget<>;
+
+static_assert(PollBudgetConcept<DefaultPollBudget>, "DefaultPollBudget does not satisfy PollBudgetConcept");
+
+} // namespace wirekrak::core::policy::protocol
@@ -44,6 +44,15 @@ namespace replay {
 //   - Session replays previously acknowledged subscriptions
 //   - Replay database drives deterministic re-subscription
 //
+// Replay emission:
+//   - Follows the session BatchingPolicy: with Paced or Adaptive batching
+//     the replayed requests are split into batches and paced, not flushed
+//     in the reconnect poll
+//   - Symbols marked with Session::resume_without_snapshot() are replayed
+//     first, with snapshot=false; the rest keep their snapshot
+//   - Per-symbol time-to-resync (replay emission to subscribe ACK) is
+//     recorded in the session telemetry
+//
 // NOTE:
 // The policy only exposes configuration. The replay algorithm remains fully
 // implemented inside Session.
@@ -35,6 +35,8 @@ A valid SessionBundleConcept must define:
     using liveness;
     using symbol_limit;
     using replay;
+    using batching;
+    using fanout;
 
 And each must satisfy the corresponding policy concept:
 
@@ -42,6 +44,8 @@ And each must satisfy the corresponding policy concept:
     liveness      -> LivenessConcept
     symbol_limit  -> SymbolLimitConcept
     replay        -> ReplayConcept
+    batching      -> BatchingConcept
+    fanout        -> FanoutConcept
 
 -------------------------------------------------------------------------------
  Example
@@ -78,6 +82,10 @@ static_assert(SessionBundleConcept<MyBundle>);
 #include "wirekrak/core/policy/protocol/symbol_limit.hpp"
 #include "wirekrak/core/policy/protocol/replay.hpp"
 #include "wirekrak/core/policy/protocol/batching.hpp"
+#include "wirekrak/core/policy/protocol/fanout.hpp"
+#include "wirekrak/core/policy/protocol/conflation.hpp"
+#include "wirekrak/core/policy/protocol/poll_budget.hpp"
+#include "wirekrak/core/policy/protocol/shedding.hpp"
 
 
 namespace wirekrak::core::policy::protocol {
@@ -95,6 +103,10 @@ concept HasSessionBundleMembers =
         typename T::symbol_limit;
         typename T::replay;
         typename T::batching;
+        typename T::fanout;
+        typename T::conflation;
+        typename T::poll_budget;
+        typename T::shedding;
     };
 
 
@@ -110,7 +122,11 @@ concept SessionBundleConcept =
     ProgressConcept<typename T::progress> &&
     SymbolLimitConcept<typename T::symbol_limit> &&
     ReplayConcept<typename T::replay> &&
-    BatchingConcept<typename T::batching>;
+    BatchingConcept<typename T::batching> &&
+    FanoutConcept<typename T::fanout> &&
+    ConflationConcept<typename T::conflation> &&
+    PollBudgetConcept<typename T::poll_budget> &&
+    SheddingConcept<typename T::shedding>;
 
 
 
@@ -129,7 +145,11 @@ template<
     ProgressConcept ProgressT         = DefaultProgress,
     SymbolLimitConcept SymbolLimitT   = DefaultSymbolLimit,
     ReplayConcept ReplayT             = DefaultReplay,
-    BatchingConcept BatchingT         = DefaultBatching
+    BatchingConcept BatchingT         = DefaultBatching,
+    FanoutConcept FanoutT             = DefaultFanout,
+    ConflationConcept ConflationT     = DefaultConflation,
+    PollBudgetConcept PollBudgetT     = DefaultPollBudget,
+    SheddingConcept SheddingT         = DefaultShedding
 >
 struct session_bundle {
 
@@ -139,6 +159,10 @@ struct session_bundle {
     using symbol_limit = SymbolLimitT;
     using replay       = ReplayT;
     using batching     = BatchingT;
+    using fanout       = FanoutT;
+    using conflation   = ConflationT;
+    using poll_budget  = PollBudgetT;
+    using shedding     = SheddingT;
 
     // Future policy additions go here
 
@@ -155,6 +179,10 @@ struct session_bundle {
         symbol_limit::dump(os);
         replay::dump(os);
         batching::dump(os);
+        fanout::dump(os);
+        conflation::dump(os);
+        poll_budget::dump(os);
+        shedding::dump(os);
     }
 };
 
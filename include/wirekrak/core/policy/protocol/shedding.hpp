@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <ostream>
+
+namespace wirekrak::core::policy::protocol {
+
+// ------------------------------------------------------------
+// Shed Order
+// ------------------------------------------------------------
+
+enum class ShedOrder {
+    Priority,   // Lowest user-supplied priority is shed first
+    Activity    // Least active symbol (messages seen) is shed first
+};
+
+
+// ------------------------------------------------------------
+// Concept Helpers
+// ------------------------------------------------------------
+
+template<class T>
+concept HasSheddingMembers =
+    requires {
+        { T::enabled } -> std::same_as<const bool&>;
+        { T::order } -> std::same_as<const ShedOrder&>;
+        { T::trigger_polls } -> std::same_as<const std::uint32_t&>;
+        { T::batch_size } -> std::same_as<const std::size_t&>;
+        { T::recovery_polls } -> std::same_as<const std::uint32_t&>;
+        { T::max_symbols } -> std::same_as<const std::size_t&>;
+    };
+
+
+// ------------------------------------------------------------
+// Shedding Concept
+// ------------------------------------------------------------
+
+template<class T>
+concept SheddingConcept =
+    HasSheddingMembers<T>
+    &&
+    (
+        // Disabled → no symbol table
+        (!T::enabled && T::max_symbols == 0)
+        ||
+        // Enabled → non-zero thresholds and at least one symbol slot
+        (T::enabled && T::trigger_polls > 0 && T::batch_size > 0 &&
+         T::recovery_polls > 0 && T::max_symbols > 0)
+    );
+
+
+// ------------------------------------------------------------
+// Load Shedding Policy
+// ------------------------------------------------------------
+//
+// Under sustained transport backpressure, sheds the lowest ranked symbols
+// instead of letting the whole connection escalate to a forced close.
+//
+//   • After `TriggerPolls` consecutive overloaded polls, `BatchSize`
+//     symbols are unsubscribed and marked stale (their in-flight data is
+//     dropped). Every further `TriggerPolls` overloaded polls shed another
+//     batch.
+//   • Once backpressure has been clear for `RecoveryPolls` consecutive
+//     polls, shed symbols are resubscribed (fresh snapshot) and reported
+//     to the user as resynced.
+//
+// Only the shed symbols are affected; the other symbols keep their feed.
+//
+// NOTE:
+// TriggerPolls must be lower than the backpressure escalation threshold,
+// otherwise the connection is closed before any symbol is shed.
+//
+// ------------------------------------------------------------
+
+template<
+    ShedOrder OrderV,
+    std::uint32_t TriggerPollsV,
+    std::size_t BatchSizeV = 1,
+    std::uint32_t RecoveryPollsV = TriggerPollsV,
+    std::size_t MaxSymbolsV = 4096
+>
+struct LoadShedding {
+
+    static constexpr bool enabled = true;
+
+    static constexpr ShedOrder order = OrderV;
+
+    static constexpr std::uint32_t trigger_polls = TriggerPollsV;
+
+    static constexpr std::size_t batch_size = BatchSizeV;
+
+    static constexpr std::uint32_t recovery_polls = RecoveryPollsV;
+
+    // SymbolId range tracked for priority/activity (higher ids are never shed)
+    static constexpr std::size_t max_symbols = MaxSymbolsV;
+
+    // ------------------------------------------------------------
+    // Introspection Helpers
+    // ------------------------------------------------------------
+
+    static constexpr const char* mode_name() noexcept {
+        switch (order) {
+            case ShedOrder::Priority: return "ShedByPriority";
+            case ShedOrder::Activity: return "ShedByActivity";
+        }
+        return "Unknown";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Protocol Load Shedding Policy]\n";
+        os << "- Enabled        : yes\n";
+        os << "- Mode           : " << mode_name() << "\n";
+        os << "- Trigger        : " << trigger_polls << " overloaded polls\n";
+        os << "- Batch size     : " << batch_size << " symbol(s)\n";
+        os << "- Recovery       : " << recovery_polls << " clear polls\n";
+        os << "- Max symbols    : " << max_symbols << "\n\n";
+    }
+};
+
+
+// ------------------------------------------------------------
+// Load shedding disabled
+// ------------------------------------------------------------
+
+struct NoShedding {
+
+    static constexpr bool enabled = false;
+
+    static constexpr ShedOrder order = ShedOrder::Priority;
+
+    static constexpr std::uint32_t trigger_polls = 0;
+
+    static constexpr std::size_t batch_size = 0;
+
+    static constexpr std::uint32_t recovery_polls = 0;
+
+    static constexpr std::size_t max_symbols = 0;
+
+    // ------------------------------------------------------------
+    // Introspection Helpers
+    // ------------------------------------------------------------
+
+    static constexpr const char* mode_name() noexcept {
+        return "Disabled";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Protocol Load Shedding Policy]\n";
+        os << "- Enabled        : no (sustained backpressure escalates on the whole connection)\n\n";
+    }
+};
+
+static_assert(SheddingConcept<NoShedding>, "NoShedding does not satisfy SheddingConcept");
+static_assert(SheddingConcept<LoadShedding<ShedOrder::Priority, 64>>, "LoadShedding does not satisfy SheddingConcept");
+
+
+// ------------------------------------------------------------
+// Default
+// ------------------------------------------------------------
+
+using DefaultShedding = NoShedding;
+
+static_assert(SheddingConcept<DefaultShedding>, "DefaultShedding does not satisfy SheddingConcept");
+
+} // namespace wirekrak::core::policy::protocol
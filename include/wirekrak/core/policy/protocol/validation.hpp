@@ -0,0 +1,118 @@
+#pragma once
+
+#include <concepts>
+#include <ostream>
+
+namespace wirekrak::core::policy::protocol {
+
+// ------------------------------------------------------------
+// Validation Mode
+// ------------------------------------------------------------
+//
+// How much of the exchange schema the data-plane parsers (trade and book
+// responses) verify on every message.
+//
+// On valid traffic the three modes produce identical messages; they differ
+// only in what they detect on invalid traffic.
+//
+// Control messages (ACKs, rejections, pong, status) are rare and always
+// parsed with Strict validation.
+//
+// ------------------------------------------------------------
+
+enum class ValidationMode {
+    Strict,      // Keyed field lookups, types, required fields, domain values (non-empty, known enums)
+    Structural,  // Single pass over fields, types and required fields only
+    Trusted      // Single pass over fields, schema assumed (no type or presence checks)
+};
+
+
+// ------------------------------------------------------------
+// Concept Helpers
+// ------------------------------------------------------------
+
+template<class T>
+concept HasValidationMembers =
+    requires {
+        { T::mode } -> std::same_as<const ValidationMode&>;
+        { T::check_types } -> std::same_as<const bool&>;
+        { T::check_values } -> std::same_as<const bool&>;
+    };
+
+
+// ------------------------------------------------------------
+// Validation Concept
+// ------------------------------------------------------------
+
+template<class T>
+concept ValidationConcept =
+    HasValidationMembers<T>
+    &&
+    (
+        (T::mode == ValidationMode::Strict && T::check_types && T::check_values)
+        ||
+        (T::mode == ValidationMode::Structural && T::check_types && !T::check_values)
+        ||
+        (T::mode == ValidationMode::Trusted && !T::check_types && !T::check_values)
+    );
+
+
+// ------------------------------------------------------------
+// Validation Policy
+// ------------------------------------------------------------
+
+template<ValidationMode ModeV>
+struct ValidationPolicy {
+
+    static constexpr ValidationMode mode = ModeV;
+
+    // JSON types and required-field presence are verified
+    static constexpr bool check_types = (ModeV != ValidationMode::Trusted);
+
+    // Domain values are verified (non-empty strings, known enum values)
+    static constexpr bool check_values = (ModeV == ValidationMode::Strict);
+
+    // ------------------------------------------------------------
+    // Introspection Helpers
+    // ------------------------------------------------------------
+
+    static constexpr const char* mode_name() noexcept {
+        switch (mode) {
+            case ValidationMode::Strict:     return "Strict";
+            case ValidationMode::Structural: return "Structural";
+            case ValidationMode::Trusted:    return "Trusted";
+        }
+        return "Unknown";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Protocol Validation Policy]\n";
+        os << "- Mode         : " << mode_name() << "\n";
+        os << "- Types        : " << (check_types ? "checked" : "assumed") << "\n";
+        os << "- Values       : " << (check_values ? "checked" : "assumed") << "\n\n";
+    }
+};
+
+
+namespace validation {
+
+using Strict     = ValidationPolicy<ValidationMode::Strict>;
+using Structural = ValidationPolicy<ValidationMode::Structural>;
+using Trusted    = ValidationPolicy<ValidationMode::Trusted>;
+
+} // namespace validation
+
+static_assert(ValidationConcept<validation::Strict>, "validation::Strict does not satisfy ValidationConcept");
+static_assert(ValidationConcept<validation::Structural>, "validation::Structural does not satisfy ValidationConcept");
+static_assert(ValidationConcept<validation::Trusted>, "validation::Trusted does not satisfy ValidationConcept");
+
+
+// ------------------------------------------------------------
+// Default
+// ------------------------------------------------------------
+
+using DefaultValidation = validation::Strict;
+
+static_assert(ValidationConcept<DefaultValidation>, "DefaultValidation does not satisfy ValidationConcept");
+
+} // namespace wirekrak::core::policy::protocol
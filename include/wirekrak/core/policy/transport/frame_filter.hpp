@@ -0,0 +1,88 @@
+#pragma once
+
+/*
+===============================================================================
+ Transport Frame Filter Policy
+===============================================================================
+
+This policy decides, on the WebSocket receive thread, whether a fully
+assembled message is published to the message ring or dropped in place.
+
+  • Disabled        → every message is published (default)
+  • Custom filter   → protocol-provided (e.g. kraken::ChannelFilter), drops
+                      configured-uninteresting frames before they reach the
+                      ring, so they cost neither a ring slot nor a JSON parse
+
+A filter is a stateless type exposing:
+
+    static constexpr bool enabled;
+    static bool drop(std::string_view frame) noexcept;
+
+drop() runs once per message on the receive thread: it must be a few
+byte-level comparisons, never a parse, and must never block or allocate.
+
+Dropped frames still count as inbound traffic for liveness purposes.
+
+The policy is:
+
+- Compile-time defined
+- Zero cost when disabled (no branch on the receive path)
+
+===============================================================================
+*/
+
+#include <concepts>
+#include <ostream>
+#include <string_view>
+
+
+namespace wirekrak::core::policy::transport {
+
+// ============================================================================
+// Frame Filter Policy Concept
+// ============================================================================
+
+template<typename P>
+concept FrameFilterConcept =
+requires(std::string_view frame) {
+    { P::enabled } -> std::same_as<const bool&>;
+    { P::drop(frame) } noexcept -> std::same_as<bool>;
+};
+
+
+namespace frame_filter {
+
+// ------------------------------------------------------------
+// Disabled (every message is published)
+// ------------------------------------------------------------
+
+struct Disabled {
+
+    static constexpr bool enabled = false;
+
+    static constexpr bool drop(std::string_view) noexcept {
+        return false;
+    }
+
+    static constexpr const char* mode_name() noexcept {
+        return "Disabled";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Transport Frame Filter Policy]\n";
+        os << "- Mode        : " << mode_name() << " (every message is published)\n\n";
+    }
+};
+
+} // namespace frame_filter
+
+
+// ============================================================================
+// Default
+// ============================================================================
+
+using DefaultFrameFilter = frame_filter::Disabled;
+
+static_assert(FrameFilterConcept<frame_filter::Disabled>);
+
+} // namespace wirekrak::core::policy::transport
@@ -0,0 +1,92 @@
+#pragma once
+
+/*
+===============================================================================
+ Transport Notification Policy
+===============================================================================
+
+This policy defines whether the WebSocket receive thread wakes up the
+consumer when it publishes work (message slot commit or control event).
+
+  • Disabled        → the consumer drives poll() in a busy loop (default)
+  • EventFd         → the engine signals an eventfd on the empty → non-empty
+                      edge, so a process can epoll on many sessions, timers
+                      and its own sockets, and sleep when idle
+
+The policy is:
+
+- Compile-time defined
+- Zero cost when disabled (no fence, no syscall on the receive path)
+- Edge-triggered when enabled (one write() per wake-up, not per message)
+
+===============================================================================
+*/
+
+#include <concepts>
+#include <ostream>
+
+
+namespace wirekrak::core::policy::transport {
+
+// ============================================================================
+// Notification Policy Concept
+// ============================================================================
+
+template<typename P>
+concept NotificationConcept =
+requires {
+    { P::enabled } -> std::same_as<const bool&>;
+};
+
+
+namespace notification {
+
+// ------------------------------------------------------------
+// Disabled (busy polling)
+// ------------------------------------------------------------
+
+struct Disabled {
+
+    static constexpr bool enabled = false;
+
+    static constexpr const char* mode_name() noexcept {
+        return "Disabled";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Transport Notification Policy]\n";
+        os << "- Mode        : " << mode_name() << " (consumer busy-polls)\n\n";
+    }
+};
+
+// ------------------------------------------------------------
+// EventFd (edge-triggered wake-up)
+// ------------------------------------------------------------
+
+struct EventFd {
+
+    static constexpr bool enabled = true;
+
+    static constexpr const char* mode_name() noexcept {
+        return "EventFd";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Transport Notification Policy]\n";
+        os << "- Mode        : " << mode_name() << " (empty -> non-empty edge wakes the consumer)\n\n";
+    }
+};
+
+} // namespace notification
+
+
+// ============================================================================
+// Default
+// ============================================================================
+
+using DefaultNotification = notification::Disabled;
+
+static_assert(NotificationConcept<notification::Disabled>);
+static_assert(NotificationConcept<notification::EventFd>);
+
+} // namespace wirekrak::core::policy::transport
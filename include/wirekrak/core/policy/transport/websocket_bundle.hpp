@@ -12,6 +12,7 @@ The WebSocket transport owns:
   • Low-level send/receive mechanics
   • Fragment assembly
   • Backpressure detection
+  • Receive-side frame filtering
   • Transport-level error signaling
 
 To prevent template parameter explosion and preserve API clarity, all
@@ -35,10 +36,14 @@ Instead of validating nested members via ad-hoc requires clauses, this concept:
 A valid WebSocketBundleConcept must define:
 
     using backpressure;
+    using notification;
+    using frame_filter;
 
-And that type must satisfy:
+And those types must satisfy:
 
-    BackpressureConcept
+    backpressure  -> BackpressureConcept
+    notification  -> NotificationConcept
+    frame_filter  -> FrameFilterConcept
 
 -------------------------------------------------------------------------------
  Design Guarantees
@@ -57,6 +62,8 @@ And that type must satisfy:
 #include <ostream>
 
 #include "wirekrak/core/policy/transport/backpressure.hpp"
+#include "wirekrak/core/policy/transport/notification.hpp"
+#include "wirekrak/core/policy/transport/frame_filter.hpp"
 
 
 namespace wirekrak::core::policy::transport {
@@ -69,6 +76,8 @@ template<typename T>
 concept HasWebSocketMembers =
 requires {
     typename T::backpressure;
+    typename T::notification;
+    typename T::frame_filter;
 };
 
 // -----------------------------------------------------------------------------
@@ -78,7 +87,9 @@ requires {
 template<typename T>
 concept WebSocketBundleConcept =
     HasWebSocketMembers<T> &&
-    BackpressureConcept<typename T::backpressure>;
+    BackpressureConcept<typename T::backpressure> &&
+    NotificationConcept<typename T::notification> &&
+    FrameFilterConcept<typename T::frame_filter>;
 
 
 // ============================================================================
@@ -96,11 +107,15 @@ concept WebSocketBundleConcept =
 // ============================================================================
 
 template<
-    BackpressureConcept BackpressureT = DefaultBackpressure
+    BackpressureConcept BackpressureT = DefaultBackpressure,
+    NotificationConcept NotificationT = DefaultNotification,
+    FrameFilterConcept FrameFilterT = DefaultFrameFilter
 >
 struct websocket_bundle {
 
     using backpressure = BackpressureT;
+    using notification = NotificationT;
+    using frame_filter = FrameFilterT;
 
     // Future WebSocket-level policies go here
 
@@ -112,6 +127,8 @@ struct websocket_bundle {
     static void dump(std::ostream& os) {
         os << "\n=== Transport WebSocket Policies ===\n";
         backpressure::dump(os);
+        notification::dump(os);
+        frame_filter::dump(os);
     }
 };
 
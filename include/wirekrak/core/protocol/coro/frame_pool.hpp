@@ -0,0 +1,142 @@
+#pragma once
+
+/*
+===============================================================================
+FramePool - Fixed pool of coroutine frames
+===============================================================================
+
+Backing store for coroutine frames spawned on a coro::Scheduler. All frames
+are allocated once at construction; spawning and finishing a task never
+touches the heap.
+
+  • Fixed frame size and frame count (runtime values, chosen by the owner)
+  • O(1) allocate / deallocate (intrusive free list of frame indices)
+  • Exhaustion is reported with nullptr (the task is then invalid)
+
+Each frame is prefixed by a small header holding the owning pool, so the
+promise's operator delete can return the frame without knowing the
+scheduler type.
+
+Single-threaded (session thread).
+
+===============================================================================
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#include "lcr/memory/footprint.hpp"
+
+
+namespace wirekrak::core::protocol::coro {
+
+class FramePool {
+    struct alignas(alignof(std::max_align_t)) Header {
+        FramePool* pool;
+        std::uint32_t index;
+    };
+
+public:
+    static constexpr std::size_t HEADER_SIZE = sizeof(Header);
+
+    FramePool(std::size_t frame_size, std::size_t frame_count)
+        : stride_(round_up_(frame_size + HEADER_SIZE))
+        , frame_count_(frame_count)
+        , storage_(new (std::align_val_t{alignof(std::max_align_t)}) std::byte[stride_ * frame_count])
+        , next_free_(std::make_unique<std::uint32_t[]>(frame_count))
+    {
+        for (std::size_t i = 0; i < frame_count_; ++i) {
+            next_free_[i] = static_cast<std::uint32_t>(i + 1);
+        }
+        free_head_ = frame_count_ == 0 ? NIL : 0;
+    }
+
+    ~FramePool() {
+        ::operator delete[](storage_, std::align_val_t{alignof(std::max_align_t)});
+    }
+
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    // ------------------------------------------------------------
+    // Allocation
+    // ------------------------------------------------------------
+
+    // Returns nullptr if the frame does not fit or the pool is exhausted
+    [[nodiscard]]
+    inline void* allocate(std::size_t size) noexcept {
+        if (size + HEADER_SIZE > stride_ || free_head_ == NIL) [[unlikely]] {
+            ++failures_;
+            return nullptr;
+        }
+        const std::uint32_t index = free_head_;
+        free_head_ = next_free_[index];
+        ++used_;
+        auto* header = ::new (storage_ + std::size_t{index} * stride_) Header{this, index};
+        return reinterpret_cast<std::byte*>(header) + HEADER_SIZE;
+    }
+
+    // Returns a frame to the pool it was allocated from
+    static inline void deallocate(void* frame) noexcept {
+        auto* header = reinterpret_cast<Header*>(static_cast<std::byte*>(frame) - HEADER_SIZE);
+        FramePool* pool = header->pool;
+        pool->next_free_[header->index] = pool->free_head_;
+        pool->free_head_ = header->index;
+        --pool->used_;
+    }
+
+    // ------------------------------------------------------------
+    // Introspection
+    // ------------------------------------------------------------
+
+    // Largest coroutine frame (as requested by the compiler) that fits
+    [[nodiscard]]
+    inline std::size_t frame_size() const noexcept {
+        return stride_ - HEADER_SIZE;
+    }
+
+    [[nodiscard]]
+    inline std::size_t capacity() const noexcept {
+        return frame_count_;
+    }
+
+    [[nodiscard]]
+    inline std::size_t used() const noexcept {
+        return used_;
+    }
+
+    // Allocations rejected (frame too large or pool exhausted)
+    [[nodiscard]]
+    inline std::uint64_t failures() const noexcept {
+        return failures_;
+    }
+
+    [[nodiscard]]
+    inline lcr::memory::footprint memory_usage() const noexcept {
+        lcr::memory::footprint fp;
+        fp.add_static(sizeof(*this));
+        fp.add_dynamic(stride_ * frame_count_);
+        fp.add_dynamic(frame_count_ * sizeof(std::uint32_t));
+        return fp;
+    }
+
+private:
+    static constexpr std::uint32_t NIL = UINT32_MAX;
+
+    std::size_t stride_;
+    std::size_t frame_count_;
+    std::byte* storage_;
+    std::unique_ptr<std::uint32_t[]> next_free_;
+    std::uint32_t free_head_{NIL};
+    std::size_t used_{0};
+    std::uint64_t failures_{0};
+
+    static constexpr std::size_t round_up_(std::size_t n) noexcept {
+        constexpr std::size_t A = alignof(std::max_align_t);
+        return (n + A - 1) / A * A;
+    }
+};
+
+} // namespace wirekrak::core::protocol::coro
@@ -0,0 +1,571 @@
+#pragma once
+
+/*
+===============================================================================
+coro::Scheduler - Coroutine façade over Session::poll()
+===============================================================================
+
+Lets strategy code await session events instead of hand-rolling a state
+machine around poll() + drain<T>():
+
+    WK_CORO_TASKS_BEGIN   // see coro/task.hpp
+    coro::Task run(Sched& sched, Symbol symbol) {
+        const auto req_id = sched.session().subscribe(book::Subscribe{{symbol}});
+        if (!co_await sched.subscribed(req_id)) {
+            co_return;                  // rejected (or connection lost)
+        }
+        for (;;) {
+            const auto book = co_await sched.template next<book::Response>(symbol);
+            ...
+        }
+    }
+    WK_CORO_TASKS_END
+
+    Sched sched{session};
+    sched.spawn(run(sched, Symbol{"BTC/USD"}));
+    while (sched.live_tasks() > 0) {
+        sched.poll();
+    }
+
+Scheduler::poll() calls Session::poll() and then resumes awaiting tasks:
+
+  1) subscribed(req_id) waiters whose request is no longer pending
+  2) next<T>(symbol) waiters, in arrival order, one message per resumption
+
+Delivery model:
+  • A message type is drained by the scheduler only while at least one task
+    awaits it. Types nobody awaits stay in the DataPlane for plain drain<T>().
+  • While a type is awaited, its messages for symbols no task is waiting
+    on are parked in a bounded per-type buffer (MaxUnclaimed messages,
+    counted by unclaimed_messages()). A later next<T>() takes its oldest
+    parked message first, so per-symbol order is kept. A full buffer drops
+    its oldest message (counted by dropped_messages()).
+  • Plain consumers of an awaited type read through Scheduler::drain<T>(),
+    which hands out parked messages before the DataPlane ones.
+  • Symbol matching uses protocol::symbol_traits<T>::key (book / trade).
+    Multi-symbol messages are partitioned into per-symbol parts first.
+
+Memory:
+  • Task frames come from a fixed FramePool (MaxTasks frames of FrameSize
+    bytes), awaiters live inside the frames. No allocation per await or per
+    resumption.
+  • Parking buffers (MaxUnclaimed messages per awaited type) are allocated
+    at construction.
+  • Size frames for what the coroutine keeps alive: a request built inside
+    the coroutine holds RequestSymbols (~40 KiB) and a subscribed() awaiter
+    holds RequestSymbolIds (~8 KiB). Strategies that only await next<T>()
+    fit in a few hundred bytes.
+
+Single consumer data plane only, single-threaded (session thread). Tasks must
+not call poll() themselves.
+
+===============================================================================
+*/
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "wirekrak/core/protocol/coro/frame_pool.hpp"
+#include "wirekrak/core/protocol/coro/task.hpp"
+#include "wirekrak/core/protocol/control/req_id.hpp"
+#include "wirekrak/core/protocol/symbol_traits.hpp"
+#include "wirekrak/core/meta/type_list.hpp"
+#include "wirekrak/core/symbol.hpp"
+#include "wirekrak/core/symbol/intern.hpp"
+#include "lcr/log/logger.hpp"
+
+
+namespace wirekrak::core::protocol::coro {
+
+template<
+    class SessionT,
+    std::size_t MaxTasks = 16,
+    std::size_t FrameSize = 64 * 1024,
+    std::size_t MaxUnclaimed = 64
+>
+class Scheduler {
+    static_assert(MaxTasks > 0, "Scheduler requires at least one task slot");
+    static_assert(MaxTasks < UINT32_MAX);
+    static_assert(MaxUnclaimed > 0, "Scheduler requires at least one parking slot per message type");
+
+    using MessageList = typename SessionT::MessageList;
+
+public:
+    // ------------------------------------------------------------
+    // Awaitable: next message of type Msg (optionally for one symbol)
+    // ------------------------------------------------------------
+    template<class Msg>
+    class MessageAwaiter {
+    public:
+        MessageAwaiter(Scheduler& sched, SymbolId symbol, bool any) noexcept
+            : sched_(sched), symbol_(symbol), any_(any) {}
+
+        // Ready at once if a matching message is parked
+        [[nodiscard]]
+        inline bool await_ready() noexcept {
+            return sched_.template parking_<Msg>().take(any_, symbol_, value_);
+        }
+
+        inline void await_suspend(Task::handle_type h) noexcept {
+            handle_ = h;
+            sched_.template wait_list_<Msg>().push_back(this);
+        }
+
+        [[nodiscard]]
+        inline Msg await_resume() noexcept {
+            return std::move(value_);
+        }
+
+    private:
+        friend class Scheduler;
+
+        Scheduler& sched_;
+        SymbolId symbol_;
+        bool any_;
+        Msg value_{};
+        Task::handle_type handle_{};
+        MessageAwaiter* next_{nullptr};
+    };
+
+    // ------------------------------------------------------------
+    // Awaitable: settlement of a subscribe request
+    // ------------------------------------------------------------
+    // Resolves once no symbol of the request awaits its ACK. Returns true if
+    // every symbol of the request is active, false if any was rejected or the
+    // connection was lost first. A request that is not pending when awaited
+    // (e.g. every symbol was already active) resolves immediately with
+    // req_id != INVALID_REQ_ID.
+    class SubscribedAwaiter {
+    public:
+        SubscribedAwaiter(Scheduler& sched, ctrl::req_id_t req_id) noexcept
+            : sched_(sched), req_id_(req_id) {}
+
+        [[nodiscard]]
+        inline bool await_ready() noexcept {
+            if (sched_.find_pending_subscription_(req_id_, domain_, symbols_)) {
+                return false;
+            }
+            result_ = (req_id_ != ctrl::INVALID_REQ_ID);
+            return true;
+        }
+
+        inline void await_suspend(Task::handle_type h) noexcept {
+            handle_ = h;
+            sched_.push_subscribed_(this);
+        }
+
+        [[nodiscard]]
+        inline bool await_resume() const noexcept {
+            return result_;
+        }
+
+    private:
+        friend class Scheduler;
+
+        Scheduler& sched_;
+        ctrl::req_id_t req_id_;
+        std::size_t domain_{0};
+        RequestSymbolIds symbols_{};
+        bool result_{false};
+        Task::handle_type handle_{};
+        SubscribedAwaiter* next_{nullptr};
+    };
+
+public:
+    explicit Scheduler(SessionT& session)
+        : session_(session)
+        , pool_(FrameSize, MaxTasks)
+    {
+        for (std::size_t i = 0; i < MaxTasks; ++i) {
+            free_slots_[i] = static_cast<std::uint32_t>(MaxTasks - 1 - i);
+        }
+    }
+
+    ~Scheduler() {
+        for (auto& h : tasks_) {
+            if (h) {
+                h.destroy();
+            }
+        }
+    }
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    // ------------------------------------------------------------
+    // Tasks
+    // ------------------------------------------------------------
+
+    // Takes ownership of the task and runs it up to its first co_await.
+    // Returns false if the frame could not be allocated or all task slots
+    // are in use.
+    inline bool spawn(Task task) noexcept {
+        if (!task.valid()) [[unlikely]] {
+            WK_WARN("[CORO] Task frame allocation failed (frame size " << pool_.frame_size() << " bytes, "
+                    << pool_.used() << "/" << pool_.capacity() << " frames in use)");
+            return false;
+        }
+        if (live_ == MaxTasks) [[unlikely]] {
+            WK_WARN("[CORO] Cannot spawn task - all " << MaxTasks << " task slots in use");
+            return false;
+        }
+        Task::handle_type h = task.release();
+        const std::uint32_t slot = free_slots_[--free_top_];
+        h.promise().slot = slot;
+        tasks_[slot] = h;
+        ++live_;
+        resume_(h);
+        return true;
+    }
+
+    // ------------------------------------------------------------
+    // Awaitables
+    // ------------------------------------------------------------
+
+    template<class Msg>
+    [[nodiscard]]
+    inline MessageAwaiter<Msg> next(const Symbol& symbol) noexcept {
+        static_assert(meta::type_list_contains_v<Msg, MessageList>, "Message type not produced by this session");
+        static_assert(symbol_traits<Msg>::enabled,
+            "next<Msg>(symbol) requires a symbol key (protocol::symbol_traits<Msg>)");
+        return MessageAwaiter<Msg>{*this, intern_symbol(symbol), false};
+    }
+
+    template<class Msg>
+    [[nodiscard]]
+    inline MessageAwaiter<Msg> next() noexcept {
+        static_assert(meta::type_list_contains_v<Msg, MessageList>, "Message type not produced by this session");
+        return MessageAwaiter<Msg>{*this, SymbolId{}, true};
+    }
+
+    [[nodiscard]]
+    inline SubscribedAwaiter subscribed(ctrl::req_id_t req_id) noexcept {
+        return SubscribedAwaiter{*this, req_id};
+    }
+
+    // ------------------------------------------------------------
+    // Event loop
+    // ------------------------------------------------------------
+
+    // Polls the session, then resumes every task whose awaited event is ready.
+    // Returns the transport epoch (as Session::poll()).
+    inline std::uint64_t poll() {
+        const std::uint64_t epoch = session_.poll();
+        dispatch_subscribed_();
+        dispatch_messages_(MessageList{});
+        return epoch;
+    }
+
+    // ------------------------------------------------------------
+    // Accessors
+    // ------------------------------------------------------------
+
+    [[nodiscard]]
+    inline SessionT& session() noexcept {
+        return session_;
+    }
+
+    [[nodiscard]]
+    inline FramePool& frame_pool() noexcept {
+        return pool_;
+    }
+
+    [[nodiscard]]
+    inline std::size_t live_tasks() const noexcept {
+        return live_;
+    }
+
+    // Messages drained for an awaited type that no task was waiting for
+    // (parked for a later next<T>() or drain<T>())
+    [[nodiscard]]
+    inline std::uint64_t unclaimed_messages() const noexcept {
+        return unclaimed_;
+    }
+
+    // Parked messages discarded because their buffer was full
+    [[nodiscard]]
+    inline std::uint64_t dropped_messages() const noexcept {
+        return dropped_;
+    }
+
+    // Plain consumption of a message type that tasks may also await:
+    // parked messages first, then the DataPlane
+    template<class Msg, class F>
+    inline std::size_t drain(F&& fn) {
+        static_assert(meta::type_list_contains_v<Msg, MessageList>, "Message type not produced by this session");
+        std::size_t count = parking_<Msg>().drain(fn);
+        count += session_.data_plane().template drain<Msg>(fn);
+        return count;
+    }
+
+private:
+    template<class Msg>
+    struct WaitList {
+        MessageAwaiter<Msg>* head = nullptr;
+        MessageAwaiter<Msg>* tail = nullptr;
+
+        [[nodiscard]]
+        inline bool empty() const noexcept {
+            return head == nullptr;
+        }
+
+        inline void push_back(MessageAwaiter<Msg>* w) noexcept {
+            w->next_ = nullptr;
+            if (tail) {
+                tail->next_ = w;
+            }
+            else {
+                head = w;
+            }
+            tail = w;
+        }
+
+        // Unlinks the oldest waiter matching the message symbol
+        [[nodiscard]]
+        inline MessageAwaiter<Msg>* take(bool keyed, SymbolId symbol) noexcept {
+            MessageAwaiter<Msg>* prev = nullptr;
+            for (auto* w = head; w; prev = w, w = w->next_) {
+                if (w->any_ || (keyed && w->symbol_ == symbol)) {
+                    (prev ? prev->next_ : head) = w->next_;
+                    if (tail == w) {
+                        tail = prev;
+                    }
+                    return w;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    // Bounded FIFO of messages no task was waiting for (oldest first)
+    template<class Msg>
+    struct Parking {
+        std::unique_ptr<Msg[]> messages = std::make_unique<Msg[]>(MaxUnclaimed);
+        std::array<SymbolId, MaxUnclaimed> symbols{};
+        std::array<bool, MaxUnclaimed> keyed{};
+        std::size_t size = 0;
+
+        // Returns false if the oldest message had to be dropped
+        [[nodiscard]]
+        inline bool push(Msg&& msg, bool is_keyed, SymbolId symbol) noexcept {
+            const bool full = (size == MaxUnclaimed);
+            if (full) [[unlikely]] {
+                erase_(0);
+            }
+            messages[size] = std::move(msg);
+            symbols[size] = symbol;
+            keyed[size] = is_keyed;
+            ++size;
+            return !full;
+        }
+
+        // Moves out the oldest message matching the waiter
+        [[nodiscard]]
+        inline bool take(bool any, SymbolId symbol, Msg& out) noexcept {
+            for (std::size_t i = 0; i < size; ++i) {
+                if (any || (keyed[i] && symbols[i] == symbol)) {
+                    out = std::move(messages[i]);
+                    erase_(i);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<class F>
+        inline std::size_t drain(F& fn) {
+            const std::size_t n = size;
+            for (std::size_t i = 0; i < n; ++i) {
+                fn(messages[i]);
+            }
+            size = 0;
+            return n;
+        }
+
+    private:
+        inline void erase_(std::size_t i) noexcept {
+            for (; i + 1 < size; ++i) {
+                messages[i] = std::move(messages[i + 1]);
+                symbols[i] = symbols[i + 1];
+                keyed[i] = keyed[i + 1];
+            }
+            --size;
+        }
+    };
+
+    template<class List>
+    struct wait_lists;
+
+    template<class... Msgs>
+    struct wait_lists<meta::type_list<Msgs...>> {
+        using type = std::tuple<WaitList<Msgs>...>;
+        using parking = std::tuple<Parking<Msgs>...>;
+    };
+
+    SessionT& session_;
+    FramePool pool_;
+
+    std::array<Task::handle_type, MaxTasks> tasks_{};
+    std::array<std::uint32_t, MaxTasks> free_slots_{};
+    std::size_t free_top_{MaxTasks};
+    std::size_t live_{0};
+
+    typename wait_lists<MessageList>::type message_waiters_;
+    typename wait_lists<MessageList>::parking parked_;
+    SubscribedAwaiter* subscribed_head_{nullptr};
+
+    std::uint64_t unclaimed_{0};
+    std::uint64_t dropped_{0};
+
+    // ------------------------------------------------------------
+    // Task lifecycle
+    // ------------------------------------------------------------
+
+    inline void resume_(Task::handle_type h) noexcept {
+        h.resume();
+        if (h.done()) {
+            const std::uint32_t slot = h.promise().slot;
+            tasks_[slot] = nullptr;
+            free_slots_[free_top_++] = slot;
+            --live_;
+            h.destroy();
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Message dispatch
+    // ------------------------------------------------------------
+
+    template<class Msg>
+    inline WaitList<Msg>& wait_list_() noexcept {
+        return std::get<WaitList<Msg>>(message_waiters_);
+    }
+
+    template<class... Msgs>
+    inline void dispatch_messages_(meta::type_list<Msgs...>) {
+        (dispatch_<Msgs>(), ...);
+    }
+
+    template<class Msg>
+    inline Parking<Msg>& parking_() noexcept {
+        return std::get<Parking<Msg>>(parked_);
+    }
+
+    template<class Msg>
+    inline void dispatch_() {
+        auto& waiters = wait_list_<Msg>();
+        if (waiters.empty()) [[likely]] {
+            return;
+        }
+        auto& data_plane = session_.data_plane();
+        Msg msg;
+        while (!waiters.empty() && data_plane.template try_pop<Msg>(msg)) {
+            SymbolId symbol{};
+            if (key_(msg, symbol)) [[likely]] {
+                deliver_(std::move(msg), true, symbol);
+            }
+            else if constexpr (MultiSymbolMessage<Msg>) {
+                symbol_traits<Msg>::partition(std::move(msg), [&](Msg&& part) noexcept {
+                    SymbolId sid{};
+                    const bool keyed = key_(part, sid);
+                    deliver_(std::move(part), keyed, sid);
+                });
+            }
+            else {
+                deliver_(std::move(msg), false, symbol);
+            }
+        }
+    }
+
+    template<class Msg>
+    inline void deliver_(Msg&& msg, bool keyed, SymbolId symbol) noexcept {
+        auto* w = wait_list_<Msg>().take(keyed, symbol);
+        if (!w) [[unlikely]] {
+            ++unclaimed_;
+            if (!parking_<Msg>().push(std::move(msg), keyed, symbol)) {
+                ++dropped_;
+            }
+            return;
+        }
+        w->value_ = std::move(msg);
+        // Resumed inline: a task looping on next<Msg>() re-registers
+        // before the following message is dispatched
+        resume_(w->handle_);
+    }
+
+    template<class Msg>
+    [[nodiscard]]
+    static inline bool key_(const Msg& msg, SymbolId& out) noexcept {
+        if constexpr (symbol_traits<Msg>::enabled) {
+            return symbol_traits<Msg>::key(msg, out);
+        }
+        else {
+            (void)msg;
+            (void)out;
+            return false;
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Subscription dispatch
+    // ------------------------------------------------------------
+
+    inline void push_subscribed_(SubscribedAwaiter* w) noexcept {
+        w->next_ = subscribed_head_;
+        subscribed_head_ = w;
+    }
+
+    inline void dispatch_subscribed_() {
+        // Detach the list first: resumed tasks may await new requests
+        SubscribedAwaiter* w = std::exchange(subscribed_head_, nullptr);
+        while (w) {
+            SubscribedAwaiter* next = w->next_;
+            if (settled_(*w)) {
+                resume_(w->handle_);
+            }
+            else {
+                push_subscribed_(w);
+            }
+            w = next;
+        }
+    }
+
+    [[nodiscard]]
+    inline bool find_pending_subscription_(ctrl::req_id_t req_id, std::size_t& domain, RequestSymbolIds& symbols) const noexcept {
+        bool found = false;
+        std::size_t index = 0;
+        session_.subscription_controller().for_each_manager([&]<class Domain>(const auto& manager) {
+            if (!found && manager.pending_subscription_symbols(req_id, symbols)) {
+                found = true;
+                domain = index;
+            }
+            ++index;
+        });
+        return found;
+    }
+
+    // Settled → stores the outcome in the awaiter
+    [[nodiscard]]
+    inline bool settled_(SubscribedAwaiter& w) const noexcept {
+        bool settled = false;
+        std::size_t index = 0;
+        session_.subscription_controller().for_each_manager([&]<class Domain>(const auto& manager) {
+            if (index++ != w.domain_ || manager.is_subscription_pending(w.req_id_)) {
+                return;
+            }
+            settled = true;
+            w.result_ = true;
+            for (SymbolId sid : w.symbols_) {
+                w.result_ = w.result_ && manager.is_active(sid);
+            }
+        });
+        return settled;
+    }
+};
+
+} // namespace wirekrak::core::protocol::coro
@@ -0,0 +1,180 @@
+#pragma once
+
+/*
+===============================================================================
+coro::Task - Coroutine type for strategies driven by a coro::Scheduler
+===============================================================================
+
+A Task is a lazily started coroutine that awaits session events (see
+coro::Scheduler::next / subscribed) and is resumed from Scheduler::poll().
+
+Frame allocation:
+  • Frames come from the FramePool of the scheduler passed as an argument of
+    the coroutine (any position, by reference). There is no heap fallback:
+    a coroutine without a scheduler argument does not compile.
+  • A frame that does not fit (or an exhausted pool) yields an invalid Task,
+    which Scheduler::spawn() rejects.
+
+    coro::Task strategy(Sched& sched, Symbol symbol) {
+        for (;;) {
+            auto book = co_await sched.template next<schema::book::Response>(symbol);
+            ...
+        }
+    }
+
+Tasks are flat: they await scheduler events only (no nested co_await on other
+Tasks). Exceptions are not supported (the library is built without them).
+
+GCC before 14 reports every coroutine using a templated promise operator new
+as -Wmismatched-new-delete (false positive, GCC PR 109224), at the coroutine
+definition rather than at the operators. Wrap Task coroutine definitions in
+WK_CORO_TASKS_BEGIN / WK_CORO_TASKS_END to keep -Wall builds clean:
+
+    WK_CORO_TASKS_BEGIN
+    coro::Task strategy(Sched& sched, Symbol symbol) { ... }
+    WK_CORO_TASKS_END
+
+===============================================================================
+*/
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include "wirekrak/core/protocol/coro/frame_pool.hpp"
+
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 14
+#define WK_CORO_TASKS_BEGIN \
+    _Pragma("GCC diagnostic push") \
+    _Pragma("GCC diagnostic ignored \"-Wmismatched-new-delete\"")
+#define WK_CORO_TASKS_END \
+    _Pragma("GCC diagnostic pop")
+#else
+#define WK_CORO_TASKS_BEGIN
+#define WK_CORO_TASKS_END
+#endif
+
+
+namespace wirekrak::core::protocol::coro {
+
+// Any object that owns a FramePool (the scheduler)
+template<class T>
+concept FrameSource =
+    requires(T& t) {
+        { t.frame_pool() } -> std::same_as<FramePool&>;
+    };
+
+
+namespace detail {
+
+template<class... Args>
+inline constexpr bool has_frame_source_v = (FrameSource<std::remove_cvref_t<Args>> || ...);
+
+template<class First, class... Rest>
+[[nodiscard]]
+inline FramePool& find_frame_pool(First& first, Rest&... rest) noexcept {
+    if constexpr (FrameSource<std::remove_cvref_t<First>>) {
+        return const_cast<std::remove_cvref_t<First>&>(first).frame_pool();
+    }
+    else {
+        return find_frame_pool(rest...);
+    }
+}
+
+} // namespace detail
+
+
+class Task {
+public:
+    struct promise_type {
+        // Slot of the task in its scheduler (set by spawn)
+        std::uint32_t slot = UINT32_MAX;
+
+        Task get_return_object() noexcept {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        static Task get_return_object_on_allocation_failure() noexcept {
+            return Task{};
+        }
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() const noexcept {
+            std::terminate();
+        }
+
+        // Frames come from the scheduler's FramePool (see WK_CORO_TASKS_BEGIN
+        // for the GCC diagnostic this pair triggers at coroutine definitions)
+        template<class... Args>
+        static void* operator new(std::size_t size, Args&... args) noexcept {
+            static_assert(detail::has_frame_source_v<Args...>,
+                "coro::Task coroutines must take the scheduler (frame pool owner) as an argument");
+            return detail::find_frame_pool(args...).allocate(size);
+        }
+
+        static void operator delete(void* frame) noexcept {
+            FramePool::deallocate(frame);
+        }
+
+        static void operator delete(void* frame, std::size_t) noexcept {
+            FramePool::deallocate(frame);
+        }
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    Task() noexcept = default;
+
+    Task(Task&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            reset_();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        reset_();
+    }
+
+    // False if the frame could not be allocated
+    [[nodiscard]]
+    inline bool valid() const noexcept {
+        return static_cast<bool>(handle_);
+    }
+
+    // Transfers frame ownership to the caller (the scheduler)
+    [[nodiscard]]
+    inline handle_type release() noexcept {
+        return std::exchange(handle_, nullptr);
+    }
+
+private:
+    explicit Task(handle_type h) noexcept
+        : handle_(h) {}
+
+    handle_type handle_{};
+
+    inline void reset_() noexcept {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+        }
+    }
+};
+
+} // namespace wirekrak::core::protocol::coro
@@ -0,0 +1,265 @@
+#pragma once
+
+/*
+===============================================================================
+ConflationTable - Latest-state pending entries keyed by SymbolId
+===============================================================================
+
+Backing store used by the DataPlane when conflation is enabled for a message
+type and its ring is full.
+
+Instead of rejecting an update (which surfaces as parser backpressure and
+eventually closes the connection), the update is merged into a single
+pending entry for its symbol:
+
+  • pending_ : one slot of T per SymbolId (allocated once at construction)
+  • dirty_   : bitset of symbols with a pending entry
+
+Draining walks the dirty bitset word by word and delivers each pending entry
+exactly once, as one coalesced batch.
+
+Merge semantics are provided per message type by conflation_traits<T>:
+
+    template<>
+    struct conflation_traits<MyMsg> {
+        static constexpr bool enabled = true;
+        static bool key(const MyMsg&, SymbolId& out) noexcept;     // false → not conflatable
+        static void merge(MyMsg& pending, MyMsg&& incoming);        // may allocate
+    };
+
+Messages that may span several symbols (key() returns false for them) can
+opt into per-symbol merging with an optional partition hook:
+
+        template<class F>
+        static void partition(MyMsg&& msg, F&& fn) noexcept;       // fn(MyMsg&&) per single-symbol part, in order
+
+Such a message is conservatively treated as pending whenever the table holds
+any entry, so per-symbol order is preserved for every symbol it carries.
+
+Merges that depend on how an entry started (e.g. the depth of a pending book
+snapshot) can keep per-entry state, one slot per SymbolId next to pending_:
+
+        using state_type = MyState;
+        static void stored(state_type&, const MyMsg& entry) noexcept;   // new pending entry
+        static void merge(MyMsg& pending, MyMsg&& incoming, state_type&);
+
+Threading:
+  • Not lock-free across threads: merging (session thread) and draining
+    must happen on the same thread, i.e. drain after poll() as usual.
+
+===============================================================================
+*/
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "wirekrak/core/symbol.hpp"
+
+namespace wirekrak::core::protocol::data {
+
+// ============================================================================
+// Conflation traits (customizable per message type)
+// ============================================================================
+template<class T>
+struct conflation_traits {
+    static constexpr bool enabled = false;
+};
+
+// Traits providing the optional multi-symbol partition hook
+template<class T>
+concept PartitionedConflation =
+    requires(T&& msg) {
+        conflation_traits<T>::partition(std::move(msg), [](T&&) noexcept {});
+    };
+
+// Traits keeping per-entry merge state
+template<class T>
+concept StatefulConflation =
+    requires(T& pending, T&& incoming, typename conflation_traits<T>::state_type& state) {
+        conflation_traits<T>::stored(state, std::as_const(pending));
+        conflation_traits<T>::merge(pending, std::move(incoming), state);
+    };
+
+namespace detail {
+
+struct NoConflationState {};
+
+template<class T>
+struct conflation_state {
+    using type = NoConflationState;
+};
+
+template<StatefulConflation T>
+struct conflation_state<T> {
+    using type = typename conflation_traits<T>::state_type;
+};
+
+} // namespace detail
+
+
+// ============================================================================
+// ConflationTable
+// ============================================================================
+template<class T, std::size_t MaxSymbols>
+class ConflationTable {
+    using traits = conflation_traits<T>;
+
+    static_assert(traits::enabled, "ConflationTable requires conflation_traits<T> to be specialized");
+    static_assert(MaxSymbols >= 1, "ConflationTable requires at least one symbol slot");
+
+    static constexpr std::size_t WORDS = (MaxSymbols + 63) / 64;
+
+    using state_type = typename detail::conflation_state<T>::type;
+
+public:
+    ConflationTable()
+        : pending_(std::make_unique<T[]>(MaxSymbols)) {
+        if constexpr (StatefulConflation<T>) {
+            state_ = std::make_unique<state_type[]>(MaxSymbols);
+        }
+    }
+
+    ConflationTable(const ConflationTable&) = delete;
+    ConflationTable& operator=(const ConflationTable&) = delete;
+
+    // -------------------------------------------------------------------------
+    // Producer side
+    // -------------------------------------------------------------------------
+
+    // True if the message belongs to a symbol that already has a pending entry.
+    // Such messages must be merged (not queued) to preserve per-symbol order.
+    [[nodiscard]]
+    inline bool has_pending(const T& msg) const noexcept {
+        if (count_ == 0) [[likely]] {
+            return false;
+        }
+        SymbolId id;
+        if (traits::key(msg, id)) [[likely]] {
+            return id < MaxSymbols && test_(id);
+        }
+        return PartitionedConflation<T>;
+    }
+
+    // Store or merge the message. Returns false if the message (or one of its
+    // partitions) cannot be keyed.
+    template<class Msg>
+    [[nodiscard]]
+    inline bool merge(Msg&& msg) noexcept {
+        SymbolId id;
+        if (!traits::key(msg, id)) [[unlikely]] {
+            if constexpr (PartitionedConflation<T>) {
+                bool all = true;
+                traits::partition(T(std::forward<Msg>(msg)), [&](T&& part) noexcept {
+                    all = merge(std::move(part)) && all;
+                });
+                return all;
+            }
+            else {
+                return false;
+            }
+        }
+        if (id >= MaxSymbols) [[unlikely]] {
+            return false;
+        }
+        if (test_(id)) {
+            if constexpr (StatefulConflation<T>) {
+                traits::merge(pending_[id], T(std::forward<Msg>(msg)), state_[id]);
+            }
+            else {
+                traits::merge(pending_[id], T(std::forward<Msg>(msg)));
+            }
+        }
+        else {
+            pending_[id] = std::forward<Msg>(msg);
+            if constexpr (StatefulConflation<T>) {
+                traits::stored(state_[id], pending_[id]);
+            }
+            dirty_[id >> 6] |= (std::uint64_t{1} << (id & 63));
+            ++count_;
+        }
+        ++merged_total_;
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Consumer side
+    // -------------------------------------------------------------------------
+
+    template<class F>
+    inline std::size_t drain(F&& fn) noexcept {
+        if (count_ == 0) [[likely]] {
+            return 0;
+        }
+        std::size_t delivered = 0;
+        for (std::size_t w = 0; w < WORDS; ++w) {
+            std::uint64_t bits = dirty_[w];
+            if (bits == 0) {
+                continue;
+            }
+            dirty_[w] = 0;
+            while (bits) {
+                const std::size_t id = (w << 6) + static_cast<std::size_t>(std::countr_zero(bits));
+                bits &= bits - 1;
+                fn(pending_[id]);
+                ++delivered;
+            }
+        }
+        count_ = 0;
+        return delivered;
+    }
+
+    [[nodiscard]]
+    inline bool pop(T& out) noexcept {
+        if (count_ == 0) [[likely]] {
+            return false;
+        }
+        for (std::size_t w = 0; w < WORDS; ++w) {
+            if (dirty_[w] != 0) {
+                const std::size_t id = (w << 6) + static_cast<std::size_t>(std::countr_zero(dirty_[w]));
+                dirty_[w] &= dirty_[w] - 1;
+                out = std::move(pending_[id]);
+                --count_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // -------------------------------------------------------------------------
+    // Observers
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline std::size_t pending() const noexcept {
+        return count_;
+    }
+
+    [[nodiscard]]
+    inline bool empty() const noexcept {
+        return count_ == 0;
+    }
+
+    // Messages absorbed by the table (stored or merged) since construction
+    [[nodiscard]]
+    inline std::uint64_t merged_total() const noexcept {
+        return merged_total_;
+    }
+
+private:
+    std::unique_ptr<T[]> pending_;
+    std::unique_ptr<state_type[]> state_;     // stateful traits only
+    std::uint64_t dirty_[WORDS]{};
+    std::size_t count_{0};
+    std::uint64_t merged_total_{0};
+
+    [[nodiscard]]
+    inline bool test_(SymbolId id) const noexcept {
+        return (dirty_[id >> 6] >> (id & 63)) & 1u;
+    }
+};
+
+} // namespace wirekrak::core::protocol::data
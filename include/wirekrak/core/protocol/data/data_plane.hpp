@@ -1,17 +1,44 @@
 #pragma once
 
+#include <cstdint>
+#include <tuple>
 #include <utility>
 #include <type_traits>
 
 #include "wirekrak/core/protocol/data/message_bus.hpp"
 #include "wirekrak/core/protocol/data/state_store.hpp"
+#include "wirekrak/core/protocol/data/conflation_table.hpp"
+#include "wirekrak/core/policy/protocol/conflation.hpp"
 #include "wirekrak/core/meta/type_list.hpp"
 
 namespace wirekrak::core::protocol::data {
 
+// ============================================================================
+// Push outcome
+// ============================================================================
+enum class PushResult : std::uint8_t {
+    Queued,     // Appended to the message ring
+    Conflated,  // Ring full (or symbol pending) → merged into the latest-state entry
+    Rejected    // Ring full and the message cannot be conflated
+};
+
+namespace detail {
+
+template<class List, std::size_t MaxSymbols>
+struct conflation_tables;
+
+template<class... Ts, std::size_t MaxSymbols>
+struct conflation_tables<meta::type_list<Ts...>, MaxSymbols> {
+    using type = std::tuple<ConflationTable<Ts, MaxSymbols>...>;
+};
+
+} // namespace detail
+
+
 template<
     class MessageList,
-    class StateList
+    class StateList,
+    policy::protocol::ConflationConcept ConflationPolicy = policy::protocol::NoConflation
 >
 struct DataPlane {
     MessageBus<MessageList> messages;
@@ -24,18 +51,56 @@ struct DataPlane {
     template<class Msg>
     [[nodiscard]]
     inline bool push(Msg&& msg) noexcept {
-        return messages.push(std::forward<Msg>(msg));
+        return offer(std::forward<Msg>(msg)) != PushResult::Rejected;
+    }
+
+    // Same as push(), reporting whether the message was queued or conflated.
+    //
+    // Per-symbol ordering: once a symbol has a pending conflated entry, all its
+    // later updates are merged into that entry until it is drained, so queued
+    // messages are always older than the pending entry of the same symbol.
+    template<class Msg>
+    [[nodiscard]]
+    inline PushResult offer(Msg&& msg) noexcept {
+        using T = std::decay_t<Msg>;
+        if constexpr (conflates_<T>()) {
+            auto& table = table_<T>();
+            if (table.has_pending(msg)) {
+                return table.merge(std::forward<Msg>(msg)) ? PushResult::Conflated : PushResult::Rejected;
+            }
+            // NOTE: a failed ring push leaves the message untouched
+            if (messages.push(std::forward<Msg>(msg))) [[likely]] {
+                return PushResult::Queued;
+            }
+            return table.merge(std::forward<Msg>(msg)) ? PushResult::Conflated : PushResult::Rejected;
+        }
+        else {
+            return messages.push(std::forward<Msg>(msg)) ? PushResult::Queued : PushResult::Rejected;
+        }
     }
 
     template<class Msg>
     [[nodiscard]]
     inline bool try_pop(Msg& msg) noexcept {
-        return messages.pop(msg);
+        if (messages.pop(msg)) {
+            return true;
+        }
+        if constexpr (conflates_<Msg>()) {
+            return table_<Msg>().pop(msg);
+        }
+        else {
+            return false;
+        }
     }
 
+    // Queued messages first, then the coalesced batch of pending entries
     template<class Msg, class F>
     inline std::size_t drain(F&& fn) noexcept {
-        return messages.template drain<Msg>(std::forward<F>(fn));
+        std::size_t count = messages.template drain<Msg>(fn);
+        if constexpr (conflates_<Msg>()) {
+            count += table_<Msg>().drain(fn);
+        }
+        return count;
     }
 
     template<class F>
@@ -46,7 +111,24 @@ struct DataPlane {
     template<class Msg>
     [[nodiscard]]
     inline bool empty() const noexcept {
-        return messages.template empty<Msg>();
+        if constexpr (conflates_<Msg>()) {
+            return messages.template empty<Msg>() && table_<Msg>().empty();
+        }
+        else {
+            return messages.template empty<Msg>();
+        }
+    }
+
+    // Number of symbols with a pending conflated entry
+    template<class Msg>
+    [[nodiscard]]
+    inline std::size_t conflated_pending() const noexcept {
+        if constexpr (conflates_<Msg>()) {
+            return table_<Msg>().pending();
+        }
+        else {
+            return 0;
+        }
     }
 
     // =========================================================================
@@ -75,10 +157,35 @@ struct DataPlane {
     // =========================================================================
     [[nodiscard]]
     inline bool empty() const noexcept {
-        return messages.empty();
+        return messages.empty() && tables_empty_(typename ConflationPolicy::messages{});
     }
 
 private:
+    using ConflationTables =
+        typename detail::conflation_tables<typename ConflationPolicy::messages, ConflationPolicy::max_symbols>::type;
+
+    ConflationTables conflation_;
+
+    template<class Msg>
+    static constexpr bool conflates_() noexcept {
+        return meta::type_list_contains_v<Msg, typename ConflationPolicy::messages>;
+    }
+
+    template<class Msg>
+    inline auto& table_() noexcept {
+        return std::get<meta::type_list_index_v<Msg, typename ConflationPolicy::messages>>(conflation_);
+    }
+
+    template<class Msg>
+    inline const auto& table_() const noexcept {
+        return std::get<meta::type_list_index_v<Msg, typename ConflationPolicy::messages>>(conflation_);
+    }
+
+    template<class... Msgs>
+    inline bool tables_empty_(meta::type_list<Msgs...>) const noexcept {
+        return (table_<Msgs>().empty() && ...);
+    }
+
     // =========================================================================
     // INTERNAL: drain_all implementation
     // =========================================================================
@@ -87,7 +194,7 @@ private:
         std::size_t total = 0;
 
         (void(
-            total += messages.template drain<Msgs>(fn)
+            total += drain<Msgs>(fn)
         ), ...);
 
         return total;
@@ -0,0 +1,487 @@
+#pragma once
+
+/*
+===============================================================================
+FanoutBus - Multi-consumer typed message routing
+===============================================================================
+
+The FanoutBus is the multi-consumer counterpart of MessageBus.
+
+It provides:
+  • Type-safe push by message type (single producer: the Session)
+  • Independent read position per registered consumer
+  • Zero-copy consumption (drain() hands out references into the ring)
+  • Per-consumer lag tracking
+  • Compile-time slow-consumer policy (Block / Drop / Evict)
+
+This implementation uses:
+  lcr::lockfree::spmc_fanout_ring<T, N, MaxConsumers>
+
+Capacity is configurable via ring_traits<T> (shared with MessageBus).
+
+------------------------------------------------------------------------------
+Threading model
+------------------------------------------------------------------------------
+
+• push() is called from the Session thread only
+• register_consumer() must be called before the Session starts publishing
+• Each consumer id must be used by exactly one thread
+• Observability accessors (lag, dropped, evictions...) are safe from any thread
+
+------------------------------------------------------------------------------
+Slow consumers
+------------------------------------------------------------------------------
+
+Under SlowConsumerMode::Evict the producer moves a stalled consumer itself,
+so one stalled consumer never costs the other consumers a message:
+
+  1) Producer finds the ring full and reclaims every consumer lagging by a
+     full ring: their tail jumps to the live edge (spmc_fanout_ring::reclaim)
+  2) The skipped backlog is counted and, for message types listed in the
+     ConflationPolicy, merged into that consumer's ConflationTable
+  3) The message being published now fits and is delivered to everyone
+  4) The evicted consumer reads its conflated backlog (latest entry per
+     symbol) before any message published after the eviction
+
+Evict-mode reads claim their slot, so the producer never reclaims a slot that
+is being read. A consumer stalled inside a drain() callback still pins its
+slot: only then is the published message dropped (counted).
+
+===============================================================================
+*/
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include "wirekrak/core/meta/type_list.hpp"
+#include "wirekrak/core/protocol/data/message_bus.hpp"
+#include "wirekrak/core/protocol/data/conflation_table.hpp"
+#include "wirekrak/core/policy/protocol/fanout.hpp"
+#include "wirekrak/core/policy/protocol/conflation.hpp"
+#include "lcr/lockfree/spmc_fanout_ring.hpp"
+
+namespace wirekrak::core::protocol::data {
+
+// Consumer identifier (index into per-consumer state)
+using consumer_id_t = std::size_t;
+
+inline constexpr consumer_id_t INVALID_CONSUMER_ID = static_cast<consumer_id_t>(-1);
+
+
+// ============================================================================
+// FanoutBus
+// ============================================================================
+template<
+    class MessageList,
+    policy::protocol::FanoutConcept FanoutPolicy,
+    policy::protocol::ConflationConcept ConflationPolicy = policy::protocol::NoConflation
+>
+class FanoutBus;
+
+// ----------------------------------------------------------------------------
+// Specialization for meta::type_list
+// ----------------------------------------------------------------------------
+template<
+    class... Messages,
+    policy::protocol::FanoutConcept FanoutPolicy,
+    policy::protocol::ConflationConcept ConflationPolicy
+>
+class FanoutBus<meta::type_list<Messages...>, FanoutPolicy, ConflationPolicy> {
+
+    // Ensure all message types are unique at compile time
+    static_assert(meta::type_list_assert_unique_v<meta::type_list<Messages...>>, "FanoutBus requires unique message types");
+
+    static_assert(!ConflationPolicy::enabled || FanoutPolicy::slow_consumer == policy::protocol::SlowConsumerMode::Evict,
+        "FanoutBus conflation serves evicted consumers (requires SlowConsumerMode::Evict)");
+
+public:
+    using message_list = meta::type_list<Messages...>;
+    static constexpr std::size_t size = sizeof...(Messages);
+    static constexpr std::size_t max_consumers = FanoutPolicy::max_consumers;
+    static constexpr policy::protocol::SlowConsumerMode slow_consumer = FanoutPolicy::slow_consumer;
+
+private:
+    static constexpr bool evicts_ = (slow_consumer == policy::protocol::SlowConsumerMode::Evict);
+
+    // Ownership of an evicted consumer's conflated backlog
+    enum : std::uint8_t {
+        BACKLOG_IDLE,       // producer-owned (empty, or being merged into)
+        BACKLOG_PUBLISHED,  // pending entries ready for the consumer
+        BACKLOG_DRAINING    // consumer-owned
+    };
+
+    // Per (message type, consumer) bookkeeping
+    struct alignas(64) ConsumerSlot {
+        std::atomic<std::uint8_t>  backlog{BACKLOG_IDLE};   // see conflate_backlog_ / drain_backlog_
+        std::atomic<std::uint64_t> evictions{0};            // producer-owned
+        std::atomic<std::uint64_t> skipped{0};              // producer-owned
+        std::atomic<std::uint64_t> conflated{0};            // producer-owned
+        std::atomic<std::size_t>   max_lag{0};              // consumer-owned
+    };
+
+    template<class T>
+    static constexpr bool conflates_() noexcept {
+        return meta::type_list_contains_v<T, typename ConflationPolicy::messages>;
+    }
+
+    // One conflated backlog per consumer (conflated message types only)
+    struct NoBacklog {};
+
+    template<class T>
+    using Backlog = std::conditional_t<
+        conflates_<T>(),
+        std::array<ConflationTable<T, ConflationPolicy::max_symbols>, max_consumers>,
+        NoBacklog
+    >;
+
+    // One fan-out ring per message type
+    template<class T>
+    struct Channel {
+        lcr::lockfree::spmc_fanout_ring<T, ring_traits<T>::capacity, max_consumers> ring;
+        std::array<ConsumerSlot, max_consumers> consumers{};
+        [[no_unique_address]] Backlog<T> backlog{};
+        alignas(64) std::atomic<std::uint64_t> dropped{0};  // producer-owned
+    };
+
+    std::tuple<Channel<Messages>...> channels_;
+
+    consumer_id_t consumer_count_{0};
+
+public:
+    FanoutBus() = default;
+
+    FanoutBus(const FanoutBus&) = delete;
+    FanoutBus& operator=(const FanoutBus&) = delete;
+
+    // =========================================================================
+    // CONSUMER REGISTRATION
+    // =========================================================================
+    // Must be called before the producer starts publishing.
+    // Returns INVALID_CONSUMER_ID when max_consumers is exhausted.
+    [[nodiscard]]
+    inline consumer_id_t register_consumer() noexcept {
+        if (consumer_count_ >= max_consumers) {
+            return INVALID_CONSUMER_ID;
+        }
+        const consumer_id_t id = consumer_count_++;
+        (void(std::get<Channel<Messages>>(channels_).ring.register_consumer()), ...);
+        return id;
+    }
+
+    [[nodiscard]]
+    inline consumer_id_t consumer_count() const noexcept {
+        return consumer_count_;
+    }
+
+    // =========================================================================
+    // PUSH (producer)
+    // =========================================================================
+    // Returns false only under SlowConsumerMode::Block when the slowest
+    // consumer lags by a full ring. Drop/Evict never refuse a message.
+    template<class Message>
+    [[nodiscard]]
+    inline bool push(Message&& msg) noexcept {
+        using T = std::decay_t<Message>;
+        static_assert(meta::type_list_contains_v<T, message_list>, "Message type not registered in FanoutBus");
+        auto& ch = channel_<T>();
+        // NOTE: a failed ring push leaves the message untouched
+        if (ch.ring.push(std::forward<Message>(msg))) [[likely]] {
+            return true;
+        }
+        if constexpr (slow_consumer == policy::protocol::SlowConsumerMode::Block) {
+            return false;
+        }
+        else {
+            if constexpr (evicts_) {
+                if (evict_lagging_(ch) && ch.ring.push(std::forward<Message>(msg))) {
+                    return true;
+                }
+            }
+            ch.dropped.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // =========================================================================
+    // POP (consumer, copies the message)
+    // =========================================================================
+    template<class Message>
+    [[nodiscard]]
+    inline bool pop(consumer_id_t consumer, Message& out) noexcept {
+        static_assert(meta::type_list_contains_v<Message, message_list>, "Message type not registered in FanoutBus");
+        auto& ch = channel_<Message>();
+        prepare_read_(ch, consumer);
+        if constexpr (evicts_) {
+            auto take = [&out](Message& m) noexcept { out = std::move(m); };
+            for (;;) {
+                const Message* msg = ch.ring.claim(consumer);
+                if (backlog_published_(ch, consumer)) [[unlikely]] {
+                    // The conflated backlog is older than anything in the ring
+                    if (msg) {
+                        ch.ring.unclaim(consumer);
+                    }
+                    if (drain_backlog_(ch, consumer, 1, take) == 1) {
+                        return true;
+                    }
+                    continue;
+                }
+                if (!msg) {
+                    return false;
+                }
+                out = *msg;
+                ch.ring.release(consumer);
+                return true;
+            }
+        }
+        else {
+            return ch.ring.pop(consumer, out);
+        }
+    }
+
+    // =========================================================================
+    // DRAIN (consumer, zero-copy)
+    // =========================================================================
+    template<class Message, class F>
+    inline std::size_t drain(consumer_id_t consumer, F&& fn) noexcept {
+        return drain_n<Message>(consumer, static_cast<std::size_t>(-1), std::forward<F>(fn));
+    }
+
+    template<class Message, class F>
+    inline std::size_t drain_n(consumer_id_t consumer, std::size_t max, F&& fn) noexcept {
+        static_assert(meta::type_list_contains_v<Message, message_list>, "Message type not registered in FanoutBus");
+        auto& ch = channel_<Message>();
+        prepare_read_(ch, consumer);
+        std::size_t count = 0;
+        while (count < max) {
+            const Message* msg;
+            if constexpr (evicts_) {
+                msg = ch.ring.claim(consumer);
+                if (backlog_published_(ch, consumer)) [[unlikely]] {
+                    // The conflated backlog is older than anything in the ring
+                    if (msg) {
+                        ch.ring.unclaim(consumer);
+                    }
+                    count += drain_backlog_(ch, consumer, max - count, fn);
+                    continue;
+                }
+            }
+            else {
+                msg = ch.ring.peek(consumer);
+            }
+            if (!msg) {
+                break;
+            }
+            fn(*msg);
+            ch.ring.release(consumer);
+            ++count;
+        }
+        return count;
+    }
+
+    // =========================================================================
+    // EMPTY
+    // =========================================================================
+    template<class Message>
+    [[nodiscard]]
+    inline bool empty(consumer_id_t consumer) const noexcept {
+        static_assert(meta::type_list_contains_v<Message, message_list>, "Message type not registered in FanoutBus");
+        const auto& ch = channel_<Message>();
+        return ch.ring.empty(consumer) && !backlog_published_(ch, consumer);
+    }
+
+    // True if every registered consumer has caught up on every message type
+    [[nodiscard]]
+    inline bool empty() const noexcept {
+        for (consumer_id_t c = 0; c < consumer_count_; ++c) {
+            if (!(empty<Messages>(c) && ...)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // =========================================================================
+    // OBSERVABILITY
+    // =========================================================================
+
+    // Messages published but not yet consumed by the given consumer
+    template<class Message>
+    [[nodiscard]]
+    inline std::size_t lag(consumer_id_t consumer) const noexcept {
+        return channel_<Message>().ring.lag(consumer);
+    }
+
+    // Highest lag observed by the given consumer when reading
+    template<class Message>
+    [[nodiscard]]
+    inline std::size_t max_lag(consumer_id_t consumer) const noexcept {
+        return slot_<Message>(consumer).max_lag.load(std::memory_order_relaxed);
+    }
+
+    // Number of times the given consumer was evicted (Evict mode only)
+    template<class Message>
+    [[nodiscard]]
+    inline std::uint64_t evictions(consumer_id_t consumer) const noexcept {
+        return slot_<Message>(consumer).evictions.load(std::memory_order_relaxed);
+    }
+
+    // Messages removed from the given consumer's backlog by eviction
+    template<class Message>
+    [[nodiscard]]
+    inline std::uint64_t skipped(consumer_id_t consumer) const noexcept {
+        return slot_<Message>(consumer).skipped.load(std::memory_order_relaxed);
+    }
+
+    // Skipped messages folded into the given consumer's conflated backlog
+    template<class Message>
+    [[nodiscard]]
+    inline std::uint64_t conflated(consumer_id_t consumer) const noexcept {
+        return slot_<Message>(consumer).conflated.load(std::memory_order_relaxed);
+    }
+
+    // Messages the producer could not publish to anyone (Drop / Evict modes)
+    template<class Message>
+    [[nodiscard]]
+    inline std::uint64_t dropped() const noexcept {
+        return channel_<Message>().dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    // =========================================================================
+    // INTERNAL: Channel access
+    // =========================================================================
+    template<class Message>
+    inline Channel<Message>& channel_() noexcept {
+        return std::get<Channel<Message>>(channels_);
+    }
+
+    template<class Message>
+    inline const Channel<Message>& channel_() const noexcept {
+        return std::get<Channel<Message>>(channels_);
+    }
+
+    template<class Message>
+    inline const ConsumerSlot& slot_(consumer_id_t consumer) const noexcept {
+        return channel_<Message>().consumers[consumer];
+    }
+
+    // =========================================================================
+    // INTERNAL: Consumer-side bookkeeping before each read
+    // =========================================================================
+    template<class T>
+    inline void prepare_read_(Channel<T>& ch, consumer_id_t consumer) noexcept {
+        if (consumer >= consumer_count_) [[unlikely]] {
+            return;
+        }
+        auto& slot = ch.consumers[consumer];
+        const std::size_t lag = ch.ring.lag(consumer);
+        if (lag > slot.max_lag.load(std::memory_order_relaxed)) {
+            slot.max_lag.store(lag, std::memory_order_relaxed);
+        }
+    }
+
+    // =========================================================================
+    // INTERNAL: Producer-side eviction of consumers lagging by a full ring
+    // =========================================================================
+    // Returns true if at least one consumer was moved to the live edge.
+    template<class T>
+    inline bool evict_lagging_(Channel<T>& ch) noexcept {
+        bool reclaimed = false;
+        for (consumer_id_t c = 0; c < consumer_count_; ++c) {
+            if (ch.ring.lag(c) < ch.ring.capacity()) {
+                continue;
+            }
+            std::size_t from = 0;
+            const std::size_t n = ch.ring.reclaim(c, from);
+            if (n == 0) {
+                continue; // consumer is reading its oldest slot
+            }
+            auto& slot = ch.consumers[c];
+            slot.evictions.fetch_add(1, std::memory_order_relaxed);
+            slot.skipped.fetch_add(n, std::memory_order_relaxed);
+            if constexpr (conflates_<T>()) {
+                slot.conflated.fetch_add(conflate_backlog_(ch, c, from, n), std::memory_order_relaxed);
+            }
+            reclaimed = true;
+        }
+        return reclaimed;
+    }
+
+    // =========================================================================
+    // INTERNAL: Conflated backlog of evicted consumers
+    // =========================================================================
+    // Producer: merges the reclaimed items [from, from + n) into the consumer's
+    // table and publishes it. Skipped items are lost for that consumer only if
+    // it is draining its previous backlog at that moment.
+    // NOTE: items are copied (other consumers may still read those slots).
+    template<class T>
+    inline std::size_t conflate_backlog_(Channel<T>& ch, consumer_id_t consumer, std::size_t from, std::size_t n) noexcept {
+        auto& state = ch.consumers[consumer].backlog;
+        std::uint8_t s = state.load(std::memory_order_acquire);
+        if (s == BACKLOG_DRAINING) {
+            return 0;
+        }
+        if (s == BACKLOG_PUBLISHED &&
+            !state.compare_exchange_strong(s, BACKLOG_IDLE, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return 0; // consumer started draining meanwhile
+        }
+        auto& table = ch.backlog[consumer];
+        std::size_t merged = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            merged += table.merge(ch.ring.at(from + i)) ? 1 : 0;
+        }
+        if (!table.empty()) {
+            state.store(BACKLOG_PUBLISHED, std::memory_order_release);
+        }
+        return merged;
+    }
+
+    template<class T>
+    [[nodiscard]]
+    inline bool backlog_published_(const Channel<T>& ch, consumer_id_t consumer) const noexcept {
+        if constexpr (conflates_<T>()) {
+            return consumer < consumer_count_ &&
+                   ch.consumers[consumer].backlog.load(std::memory_order_acquire) == BACKLOG_PUBLISHED;
+        }
+        else {
+            return false;
+        }
+    }
+
+    // Consumer: delivers up to max pending entries (0 if the producer took the
+    // backlog back to merge a newer eviction)
+    template<class T, class F>
+    inline std::size_t drain_backlog_(Channel<T>& ch, consumer_id_t consumer, std::size_t max, F& fn) noexcept {
+        if constexpr (conflates_<T>()) {
+            auto& state = ch.consumers[consumer].backlog;
+            std::uint8_t s = BACKLOG_PUBLISHED;
+            if (!state.compare_exchange_strong(s, BACKLOG_DRAINING, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return 0;
+            }
+            auto& table = ch.backlog[consumer];
+            std::size_t count = 0;
+            if (max >= table.pending()) {
+                count = table.drain(fn);
+            }
+            else {
+                T msg;
+                while (count < max && table.pop(msg)) {
+                    fn(msg);
+                    ++count;
+                }
+            }
+            state.store(table.empty() ? BACKLOG_IDLE : BACKLOG_PUBLISHED, std::memory_order_release);
+            return count;
+        }
+        else {
+            return 0;
+        }
+    }
+};
+
+} // namespace wirekrak::core::protocol::data
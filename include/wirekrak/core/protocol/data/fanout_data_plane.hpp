@@ -0,0 +1,190 @@
+#pragma once
+
+/*
+===============================================================================
+FanoutDataPlane - Multi-consumer data-plane
+===============================================================================
+
+Drop-in replacement for DataPlane selected by policy::protocol::FanoutPolicy.
+
+  • messages → FanoutBus   (parsed once, read by N consumer threads)
+  • states   → StateStore  (latest value, owned by the Session thread)
+
+Every message read is qualified by a consumer id obtained from
+register_consumer(). A Consumer handle is provided for convenience:
+
+    auto pricing = session.data_plane().consumer(
+        session.data_plane().register_consumer()
+    );
+
+    // pricing thread
+    pricing.drain<schema::book::Response>([](const auto& book) { ... });
+
+With SlowConsumerMode::Evict, message types listed in a ConflationPolicy are
+conflated per symbol for evicted consumers (see FanoutBus).
+
+NOTE:
+  States are NOT fanned out. They remain single-threaded snapshots owned by
+  the thread calling Session::poll().
+
+===============================================================================
+*/
+
+#include <utility>
+#include <type_traits>
+
+#include "wirekrak/core/protocol/data/fanout_bus.hpp"
+#include "wirekrak/core/protocol/data/state_store.hpp"
+#include "wirekrak/core/meta/type_list.hpp"
+
+namespace wirekrak::core::protocol::data {
+
+template<
+    class MessageList,
+    class StateList,
+    policy::protocol::FanoutConcept FanoutPolicy,
+    policy::protocol::ConflationConcept ConflationPolicy = policy::protocol::NoConflation
+>
+struct FanoutDataPlane {
+    FanoutBus<MessageList, FanoutPolicy, ConflationPolicy> messages;
+    StateStore<StateList>                states;
+
+    // =========================================================================
+    // CONSUMER HANDLE
+    // =========================================================================
+    class Consumer {
+    public:
+        Consumer(FanoutDataPlane& plane, consumer_id_t id) noexcept
+            : plane_(&plane), id_(id) {}
+
+        [[nodiscard]]
+        inline consumer_id_t id() const noexcept {
+            return id_;
+        }
+
+        [[nodiscard]]
+        inline bool valid() const noexcept {
+            return id_ != INVALID_CONSUMER_ID;
+        }
+
+        template<class Msg>
+        [[nodiscard]]
+        inline bool try_pop(Msg& msg) noexcept {
+            return plane_->try_pop(id_, msg);
+        }
+
+        template<class Msg, class F>
+        inline std::size_t drain(F&& fn) noexcept {
+            return plane_->template drain<Msg>(id_, std::forward<F>(fn));
+        }
+
+        template<class F>
+        inline std::size_t drain_all(F&& fn) noexcept {
+            return plane_->drain_all(id_, std::forward<F>(fn));
+        }
+
+        template<class Msg>
+        [[nodiscard]]
+        inline bool empty() const noexcept {
+            return plane_->template empty<Msg>(id_);
+        }
+
+        template<class Msg>
+        [[nodiscard]]
+        inline std::size_t lag() const noexcept {
+            return plane_->messages.template lag<Msg>(id_);
+        }
+
+    private:
+        FanoutDataPlane* plane_;
+        consumer_id_t id_;
+    };
+
+    [[nodiscard]]
+    inline consumer_id_t register_consumer() noexcept {
+        return messages.register_consumer();
+    }
+
+    [[nodiscard]]
+    inline Consumer consumer(consumer_id_t id) noexcept {
+        return Consumer{*this, id};
+    }
+
+    // =========================================================================
+    // MESSAGE API
+    // =========================================================================
+
+    template<class Msg>
+    [[nodiscard]]
+    inline bool push(Msg&& msg) noexcept {
+        return messages.push(std::forward<Msg>(msg));
+    }
+
+    template<class Msg>
+    [[nodiscard]]
+    inline bool try_pop(consumer_id_t consumer, Msg& msg) noexcept {
+        return messages.pop(consumer, msg);
+    }
+
+    template<class Msg, class F>
+    inline std::size_t drain(consumer_id_t consumer, F&& fn) noexcept {
+        return messages.template drain<Msg>(consumer, std::forward<F>(fn));
+    }
+
+    template<class F>
+    inline std::size_t drain_all(consumer_id_t consumer, F&& fn) noexcept {
+        return drain_all_impl_(consumer, std::forward<F>(fn), MessageList{});
+    }
+
+    template<class Msg>
+    [[nodiscard]]
+    inline bool empty(consumer_id_t consumer) const noexcept {
+        return messages.template empty<Msg>(consumer);
+    }
+
+    // =========================================================================
+    // STATE API
+    // =========================================================================
+
+    template<class State>
+    inline void set(State&& s) noexcept {
+        states.set(std::forward<State>(s));
+    }
+
+    template<class State>
+    [[nodiscard]]
+    inline State* get() noexcept {
+        return states.template get<State>();
+    }
+
+    template<class State>
+    [[nodiscard]]
+    inline const State* get() const noexcept {
+        return states.template get<State>();
+    }
+
+    // =========================================================================
+    // GLOBAL EMPTY (messages only, every consumer caught up)
+    // =========================================================================
+    [[nodiscard]]
+    inline bool empty() const noexcept {
+        return messages.empty();
+    }
+
+private:
+    // =========================================================================
+    // INTERNAL: drain_all implementation
+    // =========================================================================
+    template<class F, class... Msgs>
+    inline std::size_t drain_all_impl_(consumer_id_t consumer, F&& fn, meta::type_list<Msgs...>) noexcept {
+        std::size_t total = 0;
+
+        (void(
+            total += messages.template drain<Msgs>(consumer, fn)
+        ), ...);
+
+        return total;
+    }
+};
+
+} // namespace wirekrak::core::protocol::data
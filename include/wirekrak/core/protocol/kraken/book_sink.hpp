@@ -0,0 +1,107 @@
+#pragma once
+
+/*
+===============================================================================
+Kraken Book Sink
+===============================================================================
+
+Selects where the router writes book messages:
+
+  • book_sink::None         → schema::book::Response messages on the data
+                              plane (default)
+  • book_sink::Into<Store>  → book messages are parsed straight into an
+                              attached book store (e.g. feed::BookStore):
+                                - snapshots are bulk-loaded into the store and
+                                  only a schema::book::SnapshotApplied event
+                                  reaches the data plane
+                                - updates are applied to the store and only a
+                                  schema::book::UpdateApplied event reaches
+                                  the data plane
+  • book_sink::Into<Store, true>
+                            → same, but updates are also copied into
+                              Response deltas (already applied) for consumers
+                              that need the changed levels
+
+A store is attached at runtime through the message handler:
+
+    session.message_handler().attach_book_store(books);
+
+Until a store is attached, Into<Store> behaves like None.
+
+Store requirements (BookStoreConcept):
+
+    typename S::staging_type;                  // parser target, filled in place
+    staging_type& S::staging() noexcept;       // cleared staging buffer
+    bool S::commit(const staging_type&) noexcept;
+
+staging_type mirrors schema::book::Response: `type` and `book` with `symbol`,
+`asks`, `bids` (push_back(Level), reserve(n), size(), iterable), `checksum`
+and `timestamp`, plus reset().
+
+Optional epoch hooks, called by the router when all are present:
+
+    void S::expect_book(SymbolId, std::uint64_t req_id) noexcept;  // book subscribe with snapshot
+    void S::cancel_book(SymbolId, std::uint64_t req_id) noexcept;  // rejected (req_id) / unsubscribed (0)
+    void S::begin_epoch() noexcept;                                // reconnect
+
+===============================================================================
+*/
+
+#include <concepts>
+#include <cstddef>
+
+#include "wirekrak/core/protocol/kraken/schema/book/common.hpp"
+
+
+namespace wirekrak::core::protocol::kraken {
+
+// ============================================================================
+// Concepts
+// ============================================================================
+
+template<class S>
+concept BookStoreConcept =
+requires(S& store, typename S::staging_type& staging, const schema::book::Level& level) {
+    { store.staging() } noexcept -> std::same_as<typename S::staging_type&>;
+    { store.commit(staging) } noexcept -> std::same_as<bool>;
+    { staging.reset() } noexcept;
+    { staging.book.asks.push_back(level) } noexcept;
+    { staging.book.bids.push_back(level) } noexcept;
+    { staging.book.asks.size() } noexcept -> std::convertible_to<std::size_t>;
+};
+
+template<class P>
+concept BookSinkConcept =
+    requires { { P::enabled } -> std::same_as<const bool&>; } &&
+    requires { { P::copy_deltas } -> std::same_as<const bool&>; } &&
+    (!P::enabled || BookStoreConcept<typename P::store_type>);
+
+
+namespace book_sink {
+
+// ------------------------------------------------------------
+// None (book messages on the data plane)
+// ------------------------------------------------------------
+
+struct None {
+    static constexpr bool enabled = false;
+    static constexpr bool copy_deltas = false;
+    using store_type = void;
+};
+
+// ------------------------------------------------------------
+// Into<Store> (book messages streamed into a store)
+// ------------------------------------------------------------
+
+template<class Store, bool CopyDeltas = false>
+struct Into {
+    static constexpr bool enabled = true;
+    static constexpr bool copy_deltas = CopyDeltas;
+    using store_type = Store;
+};
+
+} // namespace book_sink
+
+static_assert(BookSinkConcept<book_sink::None>);
+
+} // namespace wirekrak::core::protocol::kraken
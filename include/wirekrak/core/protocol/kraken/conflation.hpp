@@ -0,0 +1,169 @@
+#pragma once
+
+/*
+===============================================================================
+Kraken conflation traits
+===============================================================================
+
+Merge rules used when conflation is enabled for Kraken data-plane messages
+(see policy::protocol::ConflationPolicy).
+
+book::Response
+  • Keyed by book symbol
+  • Incoming snapshot  → replaces the pending entry
+  • Incoming update    → levels are merged by price into the pending entry
+                         (latest qty wins; on a pending snapshot, qty = 0
+                         removes the level). Checksum and timestamp are
+                         taken from the incoming update, so the merged entry
+                         describes the book after the latest update.
+  • Both sides stay sorted best first (binary-search insert / erase) and a
+    pending snapshot is truncated to its subscription depth, so front() is
+    always the best level. The depth (smallest Kraken depth holding the
+    snapshot) is taken when the snapshot becomes pending and kept in the
+    entry state: deletions merged afterwards do not shrink it.
+
+trade::Response
+  • Keyed by the symbol of its trades; a message carrying several symbols
+    has no single key and is partitioned into per-symbol runs instead
+  • Trades are appended (oldest first). Past MAX_CONFLATED_TRADES
+    (config::protocol, 256 by default) the oldest trades are discarded: the
+    entry keeps the most recent prints.
+
+Merging grows std::vector storage, so the merge hooks are not noexcept.
+
+===============================================================================
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "wirekrak/core/config/protocol.hpp"
+#include "wirekrak/core/protocol/data/conflation_table.hpp"
+#include "wirekrak/core/protocol/kraken/symbol_traits.hpp"
+#include "wirekrak/core/protocol/kraken/schema/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/response.hpp"
+
+
+namespace wirekrak::core::protocol::kraken {
+
+inline constexpr std::size_t MAX_CONFLATED_TRADES = config::protocol::MAX_CONFLATED_TRADES;
+
+namespace detail {
+
+// Smallest Kraken subscription depth able to hold a snapshot side
+[[nodiscard]]
+inline std::size_t snapshot_depth(std::size_t levels) noexcept {
+    for (const std::size_t depth : {10u, 25u, 100u, 500u, 1000u}) {
+        if (levels <= depth) {
+            return depth;
+        }
+    }
+    return levels;
+}
+
+// Merges incoming levels into a side kept sorted best first (Better(a, b):
+// price a ranks before price b). A pending snapshot drops deletions of
+// unknown levels and is truncated to 'depth' levels.
+template<class Better>
+inline void merge_levels(std::vector<schema::book::Level>& pending,
+                         const std::vector<schema::book::Level>& incoming,
+                         bool pending_is_snapshot, std::size_t depth, Better better) {
+    auto ranks_before = [&](const schema::book::Level& l, double price) { return better(l.price, price); };
+    auto by_rank = [&](const schema::book::Level& a, const schema::book::Level& b) { return better(a.price, b.price); };
+
+    // Wire order is not guaranteed for updates: normalize once (O(n) when sorted)
+    if (!std::is_sorted(pending.begin(), pending.end(), by_rank)) [[unlikely]] {
+        std::sort(pending.begin(), pending.end(), by_rank);
+    }
+
+    for (const auto& lvl : incoming) {
+        auto it = std::lower_bound(pending.begin(), pending.end(), lvl.price, ranks_before);
+        if (it != pending.end() && it->price == lvl.price) {
+            if (pending_is_snapshot && lvl.qty == 0.0) {
+                pending.erase(it);
+            }
+            else {
+                it->qty = lvl.qty;
+            }
+        }
+        else if (!pending_is_snapshot) {
+            pending.insert(it, lvl);
+        }
+        else if (lvl.qty != 0.0 && static_cast<std::size_t>(it - pending.begin()) < depth) {
+            pending.insert(it, lvl);
+            if (pending.size() > depth) {
+                pending.pop_back();
+            }
+        }
+    }
+}
+
+} // namespace detail
+} // namespace wirekrak::core::protocol::kraken
+
+
+namespace wirekrak::core::protocol::data {
+
+template<>
+struct conflation_traits<kraken::schema::book::Response> {
+    static constexpr bool enabled = true;
+
+    // Depth of the pending snapshot (unused for a pending update)
+    struct state_type {
+        std::size_t depth = 0;
+    };
+
+    [[nodiscard]]
+    static inline bool key(const kraken::schema::book::Response& msg, SymbolId& out) noexcept {
+        return symbol_traits<kraken::schema::book::Response>::key(msg, out);
+    }
+
+    static inline void stored(state_type& state, const kraken::schema::book::Response& entry) noexcept {
+        state.depth = kraken::detail::snapshot_depth(std::max(entry.book.asks.size(), entry.book.bids.size()));
+    }
+
+    static inline void merge(kraken::schema::book::Response& pending, kraken::schema::book::Response&& incoming, state_type& state) {
+        if (incoming.type == kraken::PayloadType::Snapshot) {
+            pending = std::move(incoming);
+            stored(state, pending);
+            return;
+        }
+        const bool snapshot = (pending.type == kraken::PayloadType::Snapshot);
+        const std::size_t depth = state.depth;
+        kraken::detail::merge_levels(pending.book.asks, incoming.book.asks, snapshot, depth, std::less<double>{});
+        kraken::detail::merge_levels(pending.book.bids, incoming.book.bids, snapshot, depth, std::greater<double>{});
+        pending.book.checksum = incoming.book.checksum;
+        if (incoming.book.timestamp.has()) {
+            pending.book.timestamp = incoming.book.timestamp;
+        }
+    }
+};
+
+template<>
+struct conflation_traits<kraken::schema::trade::Response> {
+    static constexpr bool enabled = true;
+
+    // Single-symbol messages only (see symbol_traits)
+    [[nodiscard]]
+    static inline bool key(const kraken::schema::trade::Response& msg, SymbolId& out) noexcept {
+        return symbol_traits<kraken::schema::trade::Response>::key(msg, out);
+    }
+
+    // Multi-symbol messages are merged per run of one symbol
+    template<class F>
+    static inline void partition(kraken::schema::trade::Response&& msg, F&& fn) {
+        symbol_traits<kraken::schema::trade::Response>::partition(std::move(msg), std::forward<F>(fn));
+    }
+
+    static inline void merge(kraken::schema::trade::Response& pending, kraken::schema::trade::Response&& incoming) {
+        auto& trades = pending.trades;
+        trades.insert(trades.end(), incoming.trades.begin(), incoming.trades.end());
+        if (trades.size() > kraken::MAX_CONFLATED_TRADES) {
+            trades.erase(trades.begin(), trades.begin() + (trades.size() - kraken::MAX_CONFLATED_TRADES));
+        }
+    }
+};
+
+} // namespace wirekrak::core::protocol::data
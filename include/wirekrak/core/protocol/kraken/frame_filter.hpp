@@ -0,0 +1,119 @@
+#pragma once
+
+/*
+===============================================================================
+Kraken Channel Filter
+===============================================================================
+
+Drops frames of configured-uninteresting channels before any JSON parse.
+
+    using Filter = kraken::ChannelFilter<kraken::Channel::Heartbeat>;
+
+The same type plugs into two places:
+
+  • Transport (receive thread), through the WebSocket policy bundle:
+
+        policy::transport::websocket_bundle<
+            policy::transport::DefaultBackpressure,
+            policy::transport::DefaultNotification,
+            Filter
+        >
+
+    Dropped frames never reach the message ring. They still refresh the
+    connection liveness timestamp.
+
+  • Protocol (session thread), through the Kraken model:
+
+        BasicKrakenModel<policy::protocol::DefaultValidation, Filter>
+
+    Dropped frames are consumed from the ring and reported as Ignored
+    without being parsed.
+
+Classification is done by the byte-level sniffer (parser/sniffer.hpp):
+frames it does not recognize are never dropped.
+
+===============================================================================
+*/
+
+#include <concepts>
+#include <ostream>
+#include <string_view>
+
+#include "wirekrak/core/protocol/kraken/enums/channel.hpp"
+#include "wirekrak/core/protocol/kraken/parser/sniffer.hpp"
+#include "wirekrak/core/policy/transport/frame_filter.hpp"
+
+
+namespace wirekrak::core::protocol::kraken {
+
+// ============================================================================
+// Channel Filter Concept
+// ============================================================================
+
+template<typename P>
+concept ChannelFilterConcept =
+    policy::transport::FrameFilterConcept<P> &&
+    requires(Channel channel) {
+        { P::drops(channel) } noexcept -> std::same_as<bool>;
+    };
+
+
+// ============================================================================
+// Channel Filter
+// ============================================================================
+
+template<Channel... Dropped>
+struct ChannelFilter {
+
+    static constexpr bool enabled = (sizeof...(Dropped) > 0);
+
+    [[nodiscard]]
+    static constexpr bool drops(Channel channel) noexcept {
+        return ((channel == Dropped) || ...);
+    }
+
+    [[nodiscard]]
+    static bool drop(std::string_view frame) noexcept {
+        if constexpr (!enabled) {
+            return false;
+        }
+        else {
+            const parser::FrameShape shape = parser::sniff(frame);
+            return shape.kind == parser::FrameShape::Kind::Channel && drops(shape.channel);
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Introspection Helpers
+    // ------------------------------------------------------------
+
+    static constexpr const char* mode_name() noexcept {
+        return enabled ? "ChannelFilter" : "Disabled";
+    }
+
+    static void dump(std::ostream& os) {
+        os << "[Kraken Channel Filter]\n";
+        os << "- Mode        : " << mode_name() << "\n";
+        os << "- Dropped     :";
+        if constexpr (enabled) {
+            ((os << ' ' << to_string(Dropped)), ...);
+        }
+        else {
+            os << " none";
+        }
+        os << "\n\n";
+    }
+};
+
+
+// ============================================================================
+// Common filters
+// ============================================================================
+
+using NoChannelFilter = ChannelFilter<>;
+using HeartbeatFilter = ChannelFilter<Channel::Heartbeat>;
+
+static_assert(ChannelFilterConcept<NoChannelFilter>);
+static_assert(ChannelFilterConcept<HeartbeatFilter>);
+
+} // namespace wirekrak::core::protocol::kraken
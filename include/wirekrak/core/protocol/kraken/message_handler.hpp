@@ -44,11 +44,18 @@ The handler must satisfy:
 
   MessageResult  on_message(Context&, std::string_view) noexcept;
 
+Optional session hooks (used when present):
+
+  void on_subscribe(const RequestT&) noexcept;   // request emitted
+  void on_unsubscribe(const RequestT&) noexcept; // request emitted
+  void on_reconnect() noexcept;                  // new transport epoch
+
 Where Context provides:
 
   • on_subscribe_ack(...)
   • on_unsubscribe_ack(...)
   • on_rejection(...)
+  • on_request_rejected(...)
   • push(...)
 
 -------------------------------------------------------------------------------
@@ -58,6 +65,10 @@ Design Notes
   • Zero runtime polymorphism (fully inlined)
   • Branch-based routing (can evolve to table-driven dispatch)
   • Parsing strategy is pluggable (simdjson recommended)
+  • Validation level is selected at compile time (ValidationPolicy)
+  • Uninteresting channels can be dropped before parsing (FramePolicy)
+  • Book messages can be streamed into a book store (BookSink)
+  • Trade messages can be aggregated into bars (TradeSink)
   • Safe to call inside tight polling loop
 
 ===============================================================================
@@ -69,16 +80,66 @@ Design Notes
 
 #include "wirekrak/core/protocol/message_result.hpp"
 #include "wirekrak/core/protocol/kraken/enums.hpp"
+#include "wirekrak/core/protocol/kraken/frame_filter.hpp"
+#include "wirekrak/core/protocol/kraken/book_sink.hpp"
+#include "wirekrak/core/protocol/kraken/trade_sink.hpp"
 #include "wirekrak/core/protocol/kraken/parser/router.hpp"
+#include "wirekrak/core/policy/protocol/validation.hpp"
 
 
 namespace wirekrak::core::protocol::kraken {
 
+template<
+    policy::protocol::ValidationConcept ValidationPolicy = policy::protocol::DefaultValidation,
+    ChannelFilterConcept FramePolicy = NoChannelFilter,
+    BookSinkConcept BookSink = book_sink::None,
+    TradeSinkConcept TradeSink = trade_sink::None
+>
 class MessageHandler {
 public:
+    using validation_policy = ValidationPolicy;
+    using frame_policy = FramePolicy;
+    using book_sink = BookSink;
+    using trade_sink = TradeSink;
+
 
     MessageHandler() = default;
 
+    // Streams book messages into `store` (book_sink::Into). Session thread only.
+    template<class Store = typename BookSink::store_type>
+        requires (BookSink::enabled && std::same_as<Store, typename BookSink::store_type>)
+    inline void attach_book_store(Store& store) noexcept {
+        router_.attach_book_store(store);
+    }
+
+    // Folds trade messages into `aggregator` (trade_sink::Into). Session thread only.
+    template<class Aggregator = typename TradeSink::aggregator_type>
+        requires (TradeSink::enabled && std::same_as<Aggregator, typename TradeSink::aggregator_type>)
+    inline void attach_trade_aggregator(Aggregator& aggregator) noexcept {
+        router_.attach_trade_aggregator(aggregator);
+    }
+
+    // =========================================================================
+    // Session hooks (optional, called when present)
+    // =========================================================================
+
+    // A subscription request was emitted (subscribe or replay)
+    template<class RequestT>
+    inline void on_subscribe(const RequestT& req) noexcept {
+        router_.on_subscribe(req);
+    }
+
+    // An unsubscription request was emitted
+    template<class RequestT>
+    inline void on_unsubscribe(const RequestT& req) noexcept {
+        router_.on_unsubscribe(req);
+    }
+
+    // A new transport was established after a disconnect
+    inline void on_reconnect() noexcept {
+        router_.on_reconnect();
+    }
+
     // =========================================================================
     // Entry point (HandlerConcept)
     // =========================================================================
@@ -98,7 +159,7 @@ public:
     }
 
 private:
-    parser::Router router_;
+    parser::Router<ValidationPolicy, FramePolicy, BookSink, TradeSink> router_;
 };
 
 } // namespace wirekrak::core::protocol::kraken
@@ -9,6 +9,7 @@
 #include "wirekrak/core/protocol/kraken/enums/order_type.hpp"
 #include "wirekrak/core/protocol/kraken/enums/payload_type.hpp"
 #include "wirekrak/core/protocol/kraken/enums/system_state.hpp"
+#include "wirekrak/core/protocol/kraken/schema/text.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/helpers.hpp"
 #include "wirekrak/core/symbol.hpp"
 #include "wirekrak/core/timestamp.hpp"
@@ -112,7 +113,7 @@ inline MessageResult parse_symbol_required(const simdjson::dom::object& obj, con
         return MessageResult::InvalidValue;
     }
     // Valid symbol
-    out = Symbol{std::string(sv)};
+    out = Symbol{sv};
     return MessageResult::Parsed;
 }
 
@@ -136,7 +137,39 @@ inline MessageResult parse_symbol_optional(const simdjson::dom::object& obj, con
         return MessageResult::InvalidValue;
     }
     // Valid symbol
-    out = Symbol{std::string(sv)};
+    out = Symbol{sv};
+    return MessageResult::Parsed;
+}
+
+// ------------------------------------------------------------
+// Bounded text list (warnings)
+// ------------------------------------------------------------
+// Strings beyond the text capacity are truncated, entries beyond the list
+// capacity are dropped; both set `truncated`.
+template<std::size_t N, std::size_t M>
+[[nodiscard]]
+inline MessageResult parse_text_list_optional(const simdjson::dom::element& obj, const char* key,
+                                              lcr::local::vector<lcr::local::string<N>, M>& out, bool& truncated) noexcept {
+    // Always reset output (streaming safety)
+    out.clear();
+    // Parse optional array field
+    bool presence = false;
+    simdjson::dom::array arr;
+    auto r = helper::parse_array_optional(obj, key, arr, presence);
+    if (r != MessageResult::Parsed || !presence) {
+        return r;
+    }
+    for (auto v : arr) {
+        std::string_view sv;
+        if (v.get(sv)) {
+            return MessageResult::InvalidSchema;
+        }
+        if (out.full()) {
+            truncated = true;
+            continue;
+        }
+        truncated |= schema::assign_text(out.emplace_back(), sv);
+    }
     return MessageResult::Parsed;
 }
 
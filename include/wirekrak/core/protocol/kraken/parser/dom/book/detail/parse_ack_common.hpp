@@ -86,8 +86,7 @@ inline MessageResult parse_ack_common(const simdjson::dom::element& root, std::s
 
         // warnings (subscribe-only, optional)
         if constexpr (requires { out.warnings; }) {
-            bool presence;
-            r = helper::parse_string_list_optional(result, "warnings", out.warnings, presence);
+            r = adapter::parse_text_list_optional(result, "warnings", out.warnings, out.truncated);
             if (r != MessageResult::Parsed) {
                 WK_TRACE("[PARSER] Field 'warnings' invalid in " << expected_method << " ACK -> ignore message.");
                 return r;
@@ -109,7 +108,7 @@ inline MessageResult parse_ack_common(const simdjson::dom::element& root, std::s
             WK_TRACE("[PARSER] Field 'error' missing in failed " << expected_method << " ACK -> ignore message.");
             return r;
         }
-        out.error = std::string(err);
+        out.truncated |= schema::assign_text(out.error, err);
 
 /* TODO: more strict??
         // result must NOT exist on failure
@@ -6,13 +6,48 @@
 #include "wirekrak/core/protocol/kraken/parser/dom/helpers.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/adapters.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/book/detail/parse_side_levels_common.hpp"
+#include "wirekrak/core/protocol/kraken/parser/dom/single_pass.hpp"
+#include "wirekrak/core/policy/protocol/validation.hpp"
 
 
 namespace wirekrak::core::protocol::kraken::parser::dom::book {
 
+// The Response parsers are generic over their output: schema::book::Response,
+// or any type with the same members whose level containers provide
+// push_back(Level) and reserve(n) (e.g. feed::BookStore staging, filled in
+// place without intermediate vectors). Such outputs are cleared with reset().
 struct response {
     [[nodiscard]]
     static inline MessageResult parse(const simdjson::dom::element& root, schema::book::Book& out) noexcept {
+        return parse_book_(root, out);
+    }
+
+
+    template<policy::protocol::ValidationConcept Validation = policy::protocol::DefaultValidation, class ResponseT>
+    [[nodiscard]]
+    static inline MessageResult parse(const simdjson::dom::element& root, ResponseT& out) noexcept {
+        if constexpr (Validation::mode == policy::protocol::ValidationMode::Strict) {
+            return parse_strict_(root, out);
+        }
+        else {
+            return parse_single_pass_<Validation>(root, out);
+        }
+    }
+
+private:
+    template<class ResponseT>
+    static inline void reset_(ResponseT& out) noexcept {
+        if constexpr (requires { out.reset(); }) {
+            out.reset();
+        }
+        else {
+            out = ResponseT{};
+        }
+    }
+
+    template<class BookT>
+    [[nodiscard]]
+    static inline MessageResult parse_book_(const simdjson::dom::element& root, BookT& out) noexcept {
         using namespace simdjson;
 
         // data array (required, exactly one element)
@@ -80,10 +115,10 @@ struct response {
         return MessageResult::Parsed;
     }
 
-
+    template<class ResponseT>
     [[nodiscard]]
-    static inline MessageResult parse(const simdjson::dom::element& root, schema::book::Response& out) noexcept {
-        out = schema::book::Response{};
+    static inline MessageResult parse_strict_(const simdjson::dom::element& root, ResponseT& out) noexcept {
+        reset_(out);
         using namespace simdjson;
 
         // Root
@@ -102,7 +137,156 @@ struct response {
         }
         out.type = type;
 
-        return parse(root, out.book);
+        return parse_book_(root, out.book);
+    }
+
+    // Structural / Trusted: one pass over the fields of each object
+    template<policy::protocol::ValidationConcept Validation, class ResponseT>
+    [[nodiscard]]
+    static inline MessageResult parse_single_pass_(const simdjson::dom::element& root, ResponseT& out) noexcept {
+        reset_(out);
+
+        simdjson::dom::object obj;
+        if (!single_pass::get_object(root, obj)) {
+            WK_TRACE("[PARSER] Root not an object in book message -> ignore message.");
+            return MessageResult::InvalidSchema;
+        }
+
+        constexpr std::uint32_t TYPE = 1u << 0;
+        single_pass::presence<Validation> root_fields;
+        simdjson::dom::array data;
+        bool has_data = false;
+
+        for (const auto field : obj) {
+            if (field.key == "type") {
+                std::string_view sv;
+                if (!single_pass::get<Validation>(field.value, sv)) {
+                    WK_TRACE("[PARSER] Field 'type' invalid in book message -> ignore message.");
+                    return MessageResult::InvalidSchema;
+                }
+                out.type = to_payload_type_enum_fast(sv);
+                root_fields.mark(TYPE);
+            }
+            else if (field.key == "data") {
+                if (!single_pass::get_array(field.value, data)) {
+                    WK_TRACE("[PARSER] Field 'data' invalid in book message -> ignore message.");
+                    return MessageResult::InvalidSchema;
+                }
+                has_data = true;
+            }
+        }
+
+        if (!has_data || !root_fields.has_all(TYPE)) {
+            WK_TRACE("[PARSER] Field 'type' or 'data' missing in book message -> ignore message.");
+            return MessageResult::InvalidSchema;
+        }
+
+        // enforce array size (exactly one element)
+        if (data.size() != 1) {
+            WK_TRACE("[PARSER] Field 'data' does not contain exactly one element in book message -> ignore message.");
+            return MessageResult::InvalidSchema;
+        }
+
+        simdjson::dom::object book;
+        if (!single_pass::get_object(*data.begin(), book)) {
+            WK_TRACE("[PARSER] Field 'data[0]' invalid in book message -> ignore message.");
+            return MessageResult::InvalidSchema;
+        }
+
+        constexpr std::uint32_t SYMBOL   = 1u << 0;
+        constexpr std::uint32_t ASKS     = 1u << 1;
+        constexpr std::uint32_t BIDS     = 1u << 2;
+        constexpr std::uint32_t CHECKSUM = 1u << 3;
+        single_pass::presence<Validation> fields;
+        bool ok = true;
+
+        for (const auto field : book) {
+            const std::string_view key = field.key;
+            if (key == "symbol") {
+                std::string_view sv;
+                ok = single_pass::get<Validation>(field.value, sv);
+                out.book.symbol = Symbol{sv};
+                fields.mark(SYMBOL);
+            }
+            else if (key == "asks") {
+                ok = parse_levels_single_pass_<Validation>(field.value, out.book.asks);
+                fields.mark(ASKS);
+            }
+            else if (key == "bids") {
+                ok = parse_levels_single_pass_<Validation>(field.value, out.book.bids);
+                fields.mark(BIDS);
+            }
+            else if (key == "checksum") {
+                std::uint64_t checksum = 0;
+                ok = single_pass::get<Validation>(field.value, checksum);
+                out.book.checksum = static_cast<std::uint32_t>(checksum);
+                fields.mark(CHECKSUM);
+            }
+            else if (key == "timestamp") {
+                std::string_view sv;
+                ok = single_pass::get<Validation>(field.value, sv);
+                Timestamp ts;
+                if (ok && !parse_rfc3339(sv, ts)) {
+                    WK_TRACE("[PARSER] Field 'timestamp' invalid in book message -> ignore message.");
+                    return MessageResult::InvalidValue;
+                }
+                out.book.timestamp = ts;
+            }
+            if (!ok) {
+                WK_TRACE("[PARSER] Field '" << key << "' invalid in book message -> ignore message.");
+                return MessageResult::InvalidSchema;
+            }
+        }
+
+        // Kraken invariants: symbol and checksum required, at least one side present
+        if (!fields.has_all(SYMBOL | CHECKSUM) || !fields.has_any(ASKS | BIDS)) {
+            WK_TRACE("[PARSER] Required field missing in book message -> ignore message.");
+            return MessageResult::InvalidSchema;
+        }
+
+        return MessageResult::Parsed;
+    }
+
+    template<policy::protocol::ValidationConcept Validation, typename Levels>
+    [[nodiscard]]
+    static inline bool parse_levels_single_pass_(const simdjson::dom::element& value, Levels& out_levels) noexcept {
+        simdjson::dom::array arr;
+        if (!single_pass::get_array(value, arr)) {
+            return false;
+        }
+
+        constexpr std::uint32_t PRICE = 1u << 0;
+        constexpr std::uint32_t QTY   = 1u << 1;
+
+        out_levels.reserve(arr.size());
+        for (const simdjson::dom::element& lvl : arr) {
+            simdjson::dom::object obj;
+            if (!single_pass::get_object(lvl, obj)) {
+                return false;
+            }
+            double price = 0.0;
+            double qty   = 0.0;
+            single_pass::presence<Validation> fields;
+            for (const auto field : obj) {
+                if (field.key == "price") {
+                    if (!single_pass::get<Validation>(field.value, price)) {
+                        return false;
+                    }
+                    fields.mark(PRICE);
+                }
+                else if (field.key == "qty") {
+                    if (!single_pass::get<Validation>(field.value, qty)) {
+                        return false;
+                    }
+                    fields.mark(QTY);
+                }
+            }
+            if (!fields.has_all(PRICE | QTY)) {
+                return false;
+            }
+            out_levels.push_back({ price, qty });
+        }
+        return true;
     }
 };
 
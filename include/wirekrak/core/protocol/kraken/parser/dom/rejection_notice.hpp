@@ -31,7 +31,7 @@ struct rejection_notice {
             WK_TRACE("[PARSER] Field 'error' missing in failed rejection notice -> ignore message.");
             return r;
         }
-        out.error = std::string(sv);
+        out.truncated |= schema::assign_text(out.error, sv);
 
         // req_id (optional, strict)
         r = helper::parse_uint64_optional(root, "req_id", out.req_id);
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "wirekrak/core/policy/protocol/validation.hpp"
+
+#include "simdjson.h"
+
+/*
+================================================================================
+Kraken Single-Pass Field Primitives (Structural / Trusted validation)
+================================================================================
+
+Strict parsers look every field up by key (helper::parse_*_required), which
+scans the object once per field, and once more per absent optional field.
+
+Structural and Trusted parsers instead iterate the object once and dispatch
+on the key. These primitives extract the field values:
+
+  • Structural → the JSON type of every value is checked
+  • Trusted    → scalar types are assumed (unchecked access); a malformed
+                 message yields unspecified field values, never a crash
+
+Containers (objects, arrays) are always type-checked: walking a value of the
+wrong container type would not be memory-safe.
+
+Like helpers, these primitives never allocate, log or throw.
+
+================================================================================
+*/
+
+
+namespace wirekrak::core::protocol::kraken::parser::dom::single_pass {
+
+// Extracts a scalar (string_view, double, uint64_t, bool)
+template<policy::protocol::ValidationConcept Validation, class T>
+[[nodiscard]]
+inline bool get(const simdjson::dom::element& value, T& out) noexcept {
+    if constexpr (Validation::check_types) {
+        return value.get(out) == simdjson::SUCCESS;
+    }
+    else {
+        out = value.get<T>().value_unsafe();
+        return true;
+    }
+}
+
+// Extracts a container (object, array): always checked
+[[nodiscard]]
+inline bool get_object(const simdjson::dom::element& value, simdjson::dom::object& out) noexcept {
+    return value.get(out) == simdjson::SUCCESS;
+}
+
+[[nodiscard]]
+inline bool get_array(const simdjson::dom::element& value, simdjson::dom::array& out) noexcept {
+    return value.get(out) == simdjson::SUCCESS;
+}
+
+// Required-field presence tracking (compiled out when types are not checked)
+template<policy::protocol::ValidationConcept Validation>
+struct presence {
+    std::uint32_t seen = 0;
+
+    inline void mark(std::uint32_t bit) noexcept {
+        if constexpr (Validation::check_types) {
+            seen |= bit;
+        }
+    }
+
+    [[nodiscard]]
+    inline bool has_all(std::uint32_t required) const noexcept {
+        if constexpr (Validation::check_types) {
+            return (seen & required) == required;
+        }
+        else {
+            return true;
+        }
+    }
+
+    [[nodiscard]]
+    inline bool has_any(std::uint32_t fields) const noexcept {
+        if constexpr (Validation::check_types) {
+            return (seen & fields) != 0;
+        }
+        else {
+            return true;
+        }
+    }
+};
+
+} // namespace wirekrak::core::protocol::kraken::parser::dom::single_pass
@@ -17,6 +17,7 @@ struct pong {
     [[nodiscard]]
     static inline MessageResult parse(const simdjson::dom::element& root, schema::system::Pong& out) noexcept {
         using namespace simdjson;
+        out.truncated = false;
 
 /* Kraken API doc says:
         // Root must be an object
@@ -52,8 +53,7 @@ struct pong {
             }
 
             // warnings (optional, strict)
-            bool presence;
-            r = helper::parse_string_list_optional(result, "warnings", out.warnings, presence);
+            r = adapter::parse_text_list_optional(result, "warnings", out.warnings, out.truncated);
             if (r != MessageResult::Parsed) {
                 WK_TRACE("[PARSER] Field 'warnings' invalid in pong response -> ignore message.");
                 return r;
@@ -82,7 +82,7 @@ struct pong {
                 WK_TRACE("[PARSER] Field 'error' missing in failed pong response -> ignore message.");
                 return r;
             }
-            out.error = std::string(sv);
+            out.truncated |= schema::assign_text(out.error, sv);
         }
       
         return true;
@@ -138,8 +138,7 @@ struct pong {
                 }
 
                 // warnings (optional, strict)
-                bool presence;
-                r = helper::parse_string_list_optional(result, "warnings", out.warnings, presence);
+                r = adapter::parse_text_list_optional(result, "warnings", out.warnings, out.truncated);
                 if (r != MessageResult::Parsed) {
                     WK_TRACE("[PARSER] Field 'warnings' invalid in pong response -> ignore message.");
                     return r;
@@ -153,7 +152,7 @@ struct pong {
                     WK_TRACE("[PARSER] Field 'error' missing in failed pong response -> ignore message.");
                     return r;
                 }
-                out.error = std::string(sv);
+                out.truncated |= schema::assign_text(out.error, sv);
             }
         }
         
@@ -80,8 +80,7 @@ inline MessageResult parse_ack_common(const simdjson::dom::element& root, std::s
         // warnings (subscribe-only)
         if constexpr (requires { out.warnings; }) {
             // warnings (optional, strict)
-            bool presence;
-            r = helper::parse_string_list_optional(result, "warnings", out.warnings, presence);
+            r = adapter::parse_text_list_optional(result, "warnings", out.warnings, out.truncated);
             if (r != MessageResult::Parsed) {
                 WK_TRACE("[PARSER] Field 'warnings' invalid in " << expected_method << " ACK -> ignore message.");
                 return r;
@@ -106,7 +105,7 @@ inline MessageResult parse_ack_common(const simdjson::dom::element& root, std::s
             WK_TRACE("[PARSER] Field 'error' missing in failed " << expected_method << " ACK -> ignore message.");
             return r;
         }
-        out.error = std::string(sv);
+        out.truncated |= schema::assign_text(out.error, sv);
 
         // result must NOT exist
         if (!root["result"].error()) {
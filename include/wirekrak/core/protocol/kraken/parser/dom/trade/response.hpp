@@ -6,6 +6,8 @@
 #include "wirekrak/core/protocol/kraken/schema/trade/response.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/helpers.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/adapters.hpp"
+#include "wirekrak/core/protocol/kraken/parser/dom/single_pass.hpp"
+#include "wirekrak/core/policy/protocol/validation.hpp"
 #include "lcr/log/logger.hpp"
 
 #include "simdjson.h"
@@ -15,8 +17,20 @@ namespace wirekrak::core::protocol::kraken::parser::dom::trade {
 
 struct response {
 
+    template<policy::protocol::ValidationConcept Validation = policy::protocol::DefaultValidation>
     [[nodiscard]]
     static inline MessageResult parse(const simdjson::dom::element& root, schema::trade::Response& out) noexcept {
+        if constexpr (Validation::mode == policy::protocol::ValidationMode::Strict) {
+            return parse_strict_(root, out);
+        }
+        else {
+            return parse_single_pass_<Validation>(root, out);
+        }
+    }
+
+private:
+    [[nodiscard]]
+    static inline MessageResult parse_strict_(const simdjson::dom::element& root, schema::trade::Response& out) noexcept {
         out = schema::trade::Response{};
 
         // Root
@@ -118,6 +132,129 @@ struct response {
 
         return MessageResult::Parsed;
     }
+
+    // Structural / Trusted: one pass over the fields of each object
+    template<policy::protocol::ValidationConcept Validation>
+    [[nodiscard]]
+    static inline MessageResult parse_single_pass_(const simdjson::dom::element& root, schema::trade::Response& out) noexcept {
+        out = schema::trade::Response{};
+
+        simdjson::dom::object obj;
+        if (!single_pass::get_object(root, obj)) {
+            WK_TRACE("[PARSER] Root not an object in trade response -> ignore message.");
+            return MessageResult::InvalidSchema;
+        }
+
+        constexpr std::uint32_t TYPE = 1u << 0;
+        single_pass::presence<Validation> root_fields;
+        simdjson::dom::array data;
+        bool has_data = false;
+
+        for (const auto field : obj) {
+            if (field.key == "type") {
+                std::string_view sv;
+                if (!single_pass::get<Validation>(field.value, sv)) {
+                    WK_TRACE("[PARSER] Field 'type' invalid in trade response -> ignore message.");
+                    return MessageResult::InvalidSchema;
+                }
+                out.type = to_payload_type_enum_fast(sv);
+                root_fields.mark(TYPE);
+            }
+            else if (field.key == "data") {
+                if (!single_pass::get_array(field.value, data)) {
+                    WK_TRACE("[PARSER] Field 'data' invalid in trade response -> ignore message.");
+                    return MessageResult::InvalidSchema;
+                }
+                has_data = true;
+            }
+        }
+
+        if (!has_data || !root_fields.has_all(TYPE)) {
+            WK_TRACE("[PARSER] Field 'type' or 'data' missing in trade response -> ignore message.");
+            return MessageResult::InvalidSchema;
+        }
+
+        // data must contain at least one trade
+        if (data.size() == 0) {
+            WK_TRACE("[PARSER] Empty 'data' array in trade response -> ignore message.");
+            return MessageResult::Ignored;
+        }
+
+        out.trades.reserve(data.size());
+
+        constexpr std::uint32_t SYMBOL    = 1u << 0;
+        constexpr std::uint32_t SIDE      = 1u << 1;
+        constexpr std::uint32_t QTY       = 1u << 2;
+        constexpr std::uint32_t PRICE     = 1u << 3;
+        constexpr std::uint32_t TRADE_ID  = 1u << 4;
+        constexpr std::uint32_t TIMESTAMP = 1u << 5;
+        constexpr std::uint32_t REQUIRED  = SYMBOL | SIDE | QTY | PRICE | TRADE_ID | TIMESTAMP;
+
+        for (const simdjson::dom::element& elem : data) {
+
+            simdjson::dom::object trade_obj;
+            if (!single_pass::get_object(elem, trade_obj)) {
+                WK_TRACE("[PARSER] Data element not an object in trade response -> ignore message.");
+                return MessageResult::InvalidSchema;
+            }
+
+            schema::trade::Trade trade{};
+            single_pass::presence<Validation> fields;
+            bool ok = true;
+
+            for (const auto field : trade_obj) {
+                const std::string_view key = field.key;
+                std::string_view sv;
+                if (key == "symbol") {
+                    ok = single_pass::get<Validation>(field.value, sv);
+                    trade.symbol = Symbol{sv};
+                    fields.mark(SYMBOL);
+                }
+                else if (key == "side") {
+                    ok = single_pass::get<Validation>(field.value, sv);
+                    trade.side = to_side_enum_fast(sv);
+                    fields.mark(SIDE);
+                }
+                else if (key == "qty") {
+                    ok = single_pass::get<Validation>(field.value, trade.qty);
+                    fields.mark(QTY);
+                }
+                else if (key == "price") {
+                    ok = single_pass::get<Validation>(field.value, trade.price);
+                    fields.mark(PRICE);
+                }
+                else if (key == "trade_id") {
+                    ok = single_pass::get<Validation>(field.value, trade.trade_id);
+                    fields.mark(TRADE_ID);
+                }
+                else if (key == "timestamp") {
+                    ok = single_pass::get<Validation>(field.value, sv);
+                    if (ok && !parse_rfc3339(sv, trade.timestamp)) {
+                        WK_TRACE("[PARSER] Field 'timestamp' invalid in trade object -> ignore message.");
+                        return MessageResult::InvalidValue;
+                    }
+                    fields.mark(TIMESTAMP);
+                }
+                else if (key == "ord_type") {
+                    ok = single_pass::get<Validation>(field.value, sv);
+                    trade.ord_type = to_order_type_enum_fast(sv);
+                }
+                if (!ok) {
+                    WK_TRACE("[PARSER] Field '" << key << "' invalid in trade object -> ignore message.");
+                    return MessageResult::InvalidSchema;
+                }
+            }
+
+            if (!fields.has_all(REQUIRED)) {
+                WK_TRACE("[PARSER] Required field missing in trade object -> ignore message.");
+                return MessageResult::InvalidSchema;
+            }
+
+            out.trades.emplace_back(std::move(trade));
+        }
+
+        return MessageResult::Parsed;
+    }
 };
 
 } // namespace wirekrak::core::protocol::kraken::parser::dom::trade
@@ -6,7 +6,16 @@
 #include <simdjson.h>
 
 #include "wirekrak/core/protocol/message_result.hpp"
+#include "wirekrak/core/symbol/intern.hpp"
 #include "wirekrak/core/protocol/kraken/enums.hpp"
+#include "wirekrak/core/protocol/kraken/frame_filter.hpp"
+#include "wirekrak/core/protocol/kraken/book_sink.hpp"
+#include "wirekrak/core/protocol/kraken/trade_sink.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/subscribe.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/unsubscribe.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/snapshot_applied.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/update_applied.hpp"
+#include "wirekrak/core/protocol/kraken/parser/sniffer.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/adapters.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/rejection_notice.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/status/update.hpp"
@@ -17,6 +26,7 @@
 #include "wirekrak/core/protocol/kraken/parser/dom/book/subscribe_ack.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/book/response.hpp"
 #include "wirekrak/core/protocol/kraken/parser/dom/book/unsubscribe_ack.hpp"
+#include "wirekrak/core/policy/protocol/validation.hpp"
 #include "lcr/log/logger.hpp"
 
 
@@ -106,21 +116,136 @@ Design Goals
 This layered design allows each component to remain simple, focused, and
 correct, while enabling the overall system to scale as Kraken schemas evolve.
 
+-------------------------------------------------------------------------------
+Validation levels
+-------------------------------------------------------------------------------
+The Router is parameterized by a compile-time ValidationPolicy
+(policy::protocol::validation) applied to the data-plane parsers (trade and
+book responses):
+  • Strict      → the layered parsers above (default)
+  • Structural  → single pass over fields, JSON types and required fields only
+  • Trusted     → single pass over fields, schema assumed
+
+Control messages (ACKs, rejections, pong, status) are always parsed strictly.
+
+-------------------------------------------------------------------------------
+Frame prefilter
+-------------------------------------------------------------------------------
+Before parsing, the router classifies the frame with the byte-level sniffer
+(sniffer.hpp):
+  • Channels dropped by the ChannelFilter → Ignored, never parsed
+  • Heartbeats                            → Delivered, never parsed
+  • Other recognized frames               → parsed, then dispatched directly
+                                            (no method / channel key lookup)
+  • Unrecognized frames                   → full parse and key lookup
+
+-------------------------------------------------------------------------------
+Book sink
+-------------------------------------------------------------------------------
+With a book_sink::Into<Store> policy and an attached store (book_sink.hpp),
+book messages are parsed straight into the store staging buffer: snapshots
+reach the data plane as schema::book::SnapshotApplied only, updates as
+schema::book::UpdateApplied (or copied Response deltas when opted in).
+on_subscribe() / on_unsubscribe() / on_reconnect() and book rejections drive
+the awaited snapshots of the store (time to full book).
+
+With a trade_sink::Into<Aggregator> policy and an attached aggregator
+(trade_sink.hpp), trade messages are folded into the aggregator before
+delivery: completed bars reach the data plane as schema::trade::BarClose
+(and the state plane as the latest one).
+
 ================================================================================
 */
 
+template<
+    policy::protocol::ValidationConcept ValidationPolicy = policy::protocol::DefaultValidation,
+    ChannelFilterConcept FramePolicy = NoChannelFilter,
+    BookSinkConcept BookSink = book_sink::None,
+    TradeSinkConcept TradeSink = trade_sink::None
+>
 class Router {
 
     constexpr static size_t PARSER_BUFFER_INITIAL_SIZE_ = 16 * 1024; // 16 KB
 
+    using book_store_type = typename BookSink::store_type;
+    using trade_aggregator_type = typename TradeSink::aggregator_type;
+
 public:
     Router() = default;
 
+    // Book messages are streamed into `store` from now on (book_sink::Into)
+    template<class Store = book_store_type>
+        requires (BookSink::enabled && std::same_as<Store, book_store_type>)
+    inline void attach_book_store(Store& store) noexcept {
+        book_store_ = &store;
+    }
+
+    // Trade messages are folded into `aggregator` from now on (trade_sink::Into)
+    template<class Aggregator = trade_aggregator_type>
+        requires (TradeSink::enabled && std::same_as<Aggregator, trade_aggregator_type>)
+    inline void attach_trade_aggregator(Aggregator& aggregator) noexcept {
+        trade_aggregator_ = &aggregator;
+    }
+
+    // Subscription emitted by the session: each symbol of a book subscribe
+    // with snapshot is awaited by the attached store (ticket = req_id)
+    template<class RequestT>
+    inline void on_subscribe(const RequestT& req) noexcept {
+        if constexpr (has_book_epochs_ && std::same_as<RequestT, schema::book::Subscribe>) {
+            const bool snapshot = !req.snapshot.has() || req.snapshot.value();
+            if (book_store_ && snapshot) {
+                const std::uint64_t ticket = req.req_id.has() ? req.req_id.value() : 0;
+                for (const auto& symbol : req.symbols) {
+                    book_store_->expect_book(intern_symbol(symbol.view()), ticket);
+                }
+            }
+        }
+        else {
+            (void)req;
+        }
+    }
+
+    // Unsubscription emitted by the session: its books are no longer awaited
+    template<class RequestT>
+    inline void on_unsubscribe(const RequestT& req) noexcept {
+        if constexpr (has_book_epochs_ && std::same_as<RequestT, schema::book::Unsubscribe>) {
+            if (book_store_) {
+                for (const auto& symbol : req.symbols) {
+                    cancel_book_(symbol, 0);
+                }
+            }
+        }
+        else {
+            (void)req;
+        }
+    }
+
+    // New transport: books of the attached store are stale until reloaded
+    inline void on_reconnect() noexcept {
+        if constexpr (has_book_epochs_) {
+            if (book_store_) {
+                book_store_->begin_epoch();
+            }
+        }
+    }
+
     // Main entry point
     template<class Context>
     [[nodiscard]]
     inline MessageResult parse_and_route(Context& ctx, std::string_view raw_msg, Method& method, Channel& channel) noexcept {
         using namespace simdjson;
+        // Byte-level prefilter (no parse)
+        const FrameShape shape = sniff(raw_msg);
+        if (shape.kind == FrameShape::Kind::Channel) {
+            if (FramePolicy::drops(shape.channel)) {
+                return MessageResult::Ignored;
+            }
+            // Heartbeats carry no payload of interest
+            if (shape.channel == Channel::Heartbeat) {
+                channel = Channel::Heartbeat;
+                return MessageResult::Delivered;
+            }
+        }
         // Parse JSON message
         simdjson::dom::element root;
         auto error = parser_.parse(raw_msg).get(root);
@@ -128,6 +253,17 @@ public:
             WK_WARN("[PARSER] JSON parse error: " << error << " in message: " << raw_msg);
             return MessageResult::InvalidSchema;
         }
+        // SNIFFED DISPATCH (routing key already known)
+        switch (shape.kind) {
+            case FrameShape::Kind::Channel:
+                channel = shape.channel;
+                return parse_channel_message_(ctx, channel, root);
+            case FrameShape::Kind::Method:
+                method = shape.method;
+                return parse_method_message_(ctx, method, root);
+            default:
+                break;
+        }
         // METHOD DISPATCH (ACK / CONTROL)
         if (dom::adapter::parse_method_required(root, method) == MessageResult::Parsed) {
             return parse_method_message_(ctx, method, root);
@@ -144,6 +280,40 @@ private:
     // Underlying simdjson parser
     simdjson::dom::parser parser_;
 
+    // Book store target (book_sink::Into only, non-owning)
+    book_store_type* book_store_ = nullptr;
+
+    // The attached store tracks awaited snapshots (optional store hooks)
+    static constexpr bool has_book_epochs_ = [] {
+        if constexpr (BookSink::enabled) {
+            return requires(book_store_type& store, SymbolId id) {
+                store.expect_book(id, std::uint64_t{});
+                store.cancel_book(id, std::uint64_t{});
+                store.begin_epoch();
+            };
+        }
+        else {
+            return false;
+        }
+    }();
+
+    // Rejected book subscribe (ticket = req_id) or unsubscribe (ticket 0)
+    inline void cancel_book_(const Symbol& symbol, std::uint64_t ticket) noexcept {
+        if constexpr (has_book_epochs_) {
+            SymbolId id{};
+            if (book_store_ && find_symbol(symbol.view(), id)) {
+                book_store_->cancel_book(id, ticket);
+            }
+        }
+        else {
+            (void)symbol;
+            (void)ticket;
+        }
+    }
+
+    // Trade aggregator target (trade_sink::Into only, non-owning)
+    trade_aggregator_type* trade_aggregator_ = nullptr;
+
 private:
 
     // =========================================================================
@@ -223,6 +393,9 @@ private:
                 schema::book::SubscribeAck resp;
                 r = dom::book::subscribe_ack::parse(root, resp);
                 if (r == MessageResult::Parsed) {
+                    if (!resp.success) {
+                        cancel_book_(resp.symbol, resp.req_id.has() ? resp.req_id.value() : 0);
+                    }
                     ctx.template on_subscribe_ack<schema::book::Subscribe>(
                         resp.req_id.value(),
                         resp.symbol,
@@ -240,8 +413,13 @@ private:
                         << "} (req_id=" << (resp.req_id.has() ? resp.req_id.value() : ctrl::INVALID_REQ_ID) << ") - " << resp.error);
                     // 1. CONTROL PLANE (internal correctness)
                     if (resp.req_id.has() && resp.symbol.has()) {
+                        cancel_book_(resp.symbol.value(), resp.req_id.value());
                         ctx.on_rejection(resp.req_id.value(), resp.symbol.value());
                     }
+                    else if (resp.req_id.has()) {
+                        // Whole request rejected (e.g. rate limiting)
+                        ctx.on_request_rejected(resp.req_id.value());
+                    }
                     // 2. DATA PLANE (user visibility)
                     if (!ctx.push(std::move(resp))) {
                         return MessageResult::Backpressure;
@@ -296,6 +474,10 @@ private:
                     if (resp.req_id.has() && resp.symbol.has()) {
                         ctx.on_rejection(resp.req_id.value(), resp.symbol.value());
                     }
+                    else if (resp.req_id.has()) {
+                        // Whole request rejected (e.g. rate limiting)
+                        ctx.on_request_rejected(resp.req_id.value());
+                    }
                     // 2. DATA PLANE (user visibility)
                     if (!ctx.push(std::move(resp))) {
                         return MessageResult::Backpressure;
@@ -342,9 +524,18 @@ private:
     inline MessageResult parse_trade_(Context& ctx, const simdjson::dom::element& root) noexcept {
         using namespace simdjson;
         schema::trade::Response response;
-        auto r = dom::trade::response::parse(root, response);
+        auto r = dom::trade::response::template parse<ValidationPolicy>(root, response);
         if (r == MessageResult::Parsed) {
-            if (!ctx.push(std::move(response))) {
+            bool delivered = true;
+            if constexpr (TradeSink::enabled) {
+                if (trade_aggregator_) [[likely]] {
+                    trade_aggregator_->on_trades(response, [&](const schema::trade::BarClose& bar) noexcept {
+                        ctx.set(schema::trade::BarClose{bar});
+                        delivered &= ctx.push(schema::trade::BarClose{bar});
+                    });
+                }
+            }
+            if (!ctx.push(std::move(response)) || !delivered) {
                 return MessageResult::Backpressure;
             }
             return MessageResult::Delivered;
@@ -367,8 +558,13 @@ private:
     [[nodiscard]]
     inline MessageResult parse_book_(Context& ctx, const simdjson::dom::element& root) noexcept {
         using namespace simdjson;
+        if constexpr (BookSink::enabled) {
+            if (book_store_) [[likely]] {
+                return parse_book_into_store_(ctx, root);
+            }
+        }
         schema::book::Response response;
-        auto r = dom::book::response::parse(root, response);
+        auto r = dom::book::response::template parse<ValidationPolicy>(root, response);
         if (r == MessageResult::Parsed) {
             if (!ctx.push(std::move(response))) {
                 return MessageResult::Backpressure;
@@ -378,6 +574,61 @@ private:
         return r;
     }
 
+    // BOOK PARSER (streamed into the attached book store)
+    template<class Context>
+    [[nodiscard]]
+    inline MessageResult parse_book_into_store_(Context& ctx, const simdjson::dom::element& root) noexcept {
+        auto& staged = book_store_->staging();
+        auto r = dom::book::response::template parse<ValidationPolicy>(root, staged);
+        if (r != MessageResult::Parsed) {
+            return r;
+        }
+        (void)book_store_->commit(staged);
+
+        const auto& book = staged.book;
+        if (staged.type == PayloadType::Snapshot) {
+            schema::book::SnapshotApplied event{
+                .symbol     = book.symbol,
+                .checksum   = book.checksum,
+                .bid_levels = static_cast<std::uint32_t>(book.bids.size()),
+                .ask_levels = static_cast<std::uint32_t>(book.asks.size()),
+                .timestamp  = book.timestamp
+            };
+            if (!ctx.push(std::move(event))) {
+                return MessageResult::Backpressure;
+            }
+            return MessageResult::Delivered;
+        }
+
+        // Updates stay visible as deltas (already applied to the store):
+        // copied into a Response only when opted in (book_sink::Into<S, true>)
+        if constexpr (BookSink::copy_deltas) {
+            schema::book::Response response;
+            response.type = staged.type;
+            response.book.symbol = book.symbol;
+            response.book.asks.assign(book.asks.begin(), book.asks.end());
+            response.book.bids.assign(book.bids.begin(), book.bids.end());
+            response.book.checksum = book.checksum;
+            response.book.timestamp = book.timestamp;
+            if (!ctx.push(std::move(response))) {
+                return MessageResult::Backpressure;
+            }
+        }
+        else {
+            schema::book::UpdateApplied event{
+                .symbol     = book.symbol,
+                .checksum   = book.checksum,
+                .bid_levels = static_cast<std::uint32_t>(book.bids.size()),
+                .ask_levels = static_cast<std::uint32_t>(book.asks.size()),
+                .timestamp  = book.timestamp
+            };
+            if (!ctx.push(std::move(event))) {
+                return MessageResult::Backpressure;
+            }
+        }
+        return MessageResult::Delivered;
+    }
+
     // PONG PARSER
     template<class Context>
     [[nodiscard]]
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "wirekrak/core/protocol/kraken/enums/channel.hpp"
+#include "wirekrak/core/protocol/kraken/enums/method.hpp"
+#include "lcr/bit/pack.hpp"
+
+/*
+================================================================================
+Kraken Frame Sniffer (byte-level prefilter)
+================================================================================
+
+Classifies a raw WebSocket frame from its first bytes, before any JSON parse.
+
+Kraken serializes the routing key first:
+
+    {"channel":"book","type":"update","data":[...]}
+    {"channel":"heartbeat"}
+    {"method":"subscribe","req_id":1,"result":{...},"success":true,...}
+    {"method":"pong","req_id":7,"time_in":"...","time_out":"..."}
+
+The sniffer matches the key prefix with word compares (lcr::bit::pack8 /
+pack4), dispatches the value on its first four bytes (the same tags as
+to_channel_enum_fast / to_method_enum_fast) and verifies the full value and
+its closing quote.
+
+It is conservative: a frame is classified only when the prefix, the value and
+the closing quote all match. Anything else (whitespace, other key order,
+unknown values, short frames) is Unknown and takes the full-parse path.
+
+Never parses, allocates, logs or throws. Safe on the receive thread.
+
+================================================================================
+*/
+
+
+namespace wirekrak::core::protocol::kraken::parser {
+
+struct FrameShape {
+    enum class Kind : std::uint8_t {
+        Unknown,   // Not recognized by the sniffer (full parse required)
+        Channel,   // {"channel":"<channel>"...  (data plane)
+        Method     // {"method":"<method>"...    (control plane)
+    };
+
+    Kind kind = Kind::Unknown;
+    kraken::Channel channel = kraken::Channel::Unknown;
+    kraken::Method method = kraken::Method::Unknown;
+};
+
+namespace sniffer {
+
+// {"channel":"   → 8 + 4 bytes
+inline constexpr std::uint64_t TAG_CHANNEL_HEAD = lcr::bit::pack8(R"({"channe)");
+inline constexpr std::uint32_t TAG_CHANNEL_TAIL = lcr::bit::pack4(R"(l":")");
+inline constexpr std::size_t   CHANNEL_VALUE_POS = 12;
+
+// {"method":"    → 8 + 3 bytes
+inline constexpr std::uint64_t TAG_METHOD_HEAD = lcr::bit::pack8(R"({"method)");
+inline constexpr std::uint32_t TAG_METHOD_TAIL = lcr::bit::pack4(R"(":")");  // + NUL, masked on load
+inline constexpr std::size_t   METHOD_VALUE_POS = 11;
+
+// Every classification reads the first 16 bytes
+// (shortest routable frame: {"method":"pong",...)
+inline constexpr std::size_t MIN_FRAME_SIZE = 16;
+
+// Whether `frame` holds `value` followed by a closing quote at `pos`
+[[nodiscard]]
+inline bool quoted_value_at(std::string_view frame, std::size_t pos, std::string_view value) noexcept {
+    return frame.size() > pos + value.size()
+        && frame.compare(pos, value.size(), value) == 0
+        && frame[pos + value.size()] == '"';
+}
+
+} // namespace sniffer
+
+
+[[nodiscard]]
+inline FrameShape sniff(std::string_view frame) noexcept {
+    FrameShape shape;
+    if (frame.size() < sniffer::MIN_FRAME_SIZE) [[unlikely]] {
+        return shape;
+    }
+
+    const char* p = frame.data();
+    const std::uint64_t head = lcr::bit::pack8(p);
+
+    if (head == sniffer::TAG_CHANNEL_HEAD) {
+        if (lcr::bit::pack4(p + 8) != sniffer::TAG_CHANNEL_TAIL) [[unlikely]] {
+            return shape;
+        }
+        const Channel channel = to_channel_enum_fast(std::string_view{ p + sniffer::CHANNEL_VALUE_POS, 4 });
+        if (channel != Channel::Unknown && sniffer::quoted_value_at(frame, sniffer::CHANNEL_VALUE_POS, to_string(channel))) [[likely]] {
+            shape.kind = FrameShape::Kind::Channel;
+            shape.channel = channel;
+        }
+    }
+    else if (head == sniffer::TAG_METHOD_HEAD) {
+        if ((lcr::bit::pack4(p + 8) & 0x00FFFFFFu) != sniffer::TAG_METHOD_TAIL) [[unlikely]] {
+            return shape;
+        }
+        const Method method = to_method_enum_fast(std::string_view{ p + sniffer::METHOD_VALUE_POS, 4 });
+        if (method != Method::Unknown && sniffer::quoted_value_at(frame, sniffer::METHOD_VALUE_POS, to_string(method))) [[likely]] {
+            shape.kind = FrameShape::Kind::Method;
+            shape.method = method;
+        }
+    }
+    return shape;
+}
+
+} // namespace wirekrak::core::protocol::kraken::parser
@@ -1,6 +1,9 @@
 #pragma once
 
-#include <unordered_map>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include <span>
 
@@ -22,9 +25,27 @@ Key properties:
   - Generic over ResponseT via traits<ResponseT>
   - Header-only and fully inlineable
   - Zero-copy: never copies protocol messages
-  - Allocation-free after warm-up (capacity reuse)
+  - Allocation-free after warm-up (capacity reuse, no rehashing)
   - Produces non-owning ResponseView instances
 
+Algorithm (stable counting sort by symbol):
+  1. Classify: each message gets a dense group index (first-appearance
+     order). Symbols are compared as a 16-byte integer key (no memcmp, no
+     string hash). The first few symbols are found by a branch-free linear
+     scan, beyond that through a small open-addressing table cleared in
+     O(1) by bumping a generation counter.
+  2. Scatter: prefix sums over group sizes give each group a contiguous
+     range of one reusable pointer array; messages are placed in arrival
+     order (stable).
+  3. Views: one view per group, spanning its range.
+
+  Single-symbol responses (the common case) skip the scatter step.
+
+Output ordering:
+  - Views follow the first appearance of each symbol in the response
+  - Within a view, messages keep their response order
+  - Only symbols present in the current response produce a view
+
 Design intent:
   - Preserve protocol semantics (e.g. snapshot vs update)
   - Enable efficient per-symbol dispatch without modifying the dispatcher
@@ -50,6 +71,9 @@ class Partitioner {
     using message_type = typename message_traits::message_type;
     using view_type    = typename message_traits::view_type;
 
+    static constexpr std::size_t MIN_TABLE_SIZE = 16;   // power of two
+    static constexpr std::size_t LINEAR_GROUPS  = 8;    // groups found by linear scan before hashing
+
 public:
     Partitioner() = default;
     Partitioner(const Partitioner&) = delete;
@@ -66,38 +90,191 @@ public:
     }
 
 private:
+    // Symbol bytes packed into two words, bytes past size() zeroed
+    struct Key {
+        std::uint64_t lo = 0;
+        std::uint64_t hi = 0;
+
+        // Single branch-free test (no short-circuit on lo)
+        [[nodiscard]]
+        inline bool operator==(const Key& other) const noexcept {
+            return ((lo ^ other.lo) | (hi ^ other.hi)) == 0;
+        }
+    };
+
+    struct Slot {
+        Key key{};
+        std::uint32_t generation = 0;   // slot is empty unless it matches generation_
+        std::uint32_t group = 0;
+    };
+
+    struct Group {
+        Key key;
+        const Symbol* symbol;           // first message of the group (stable during reset)
+        std::uint32_t count;
+        std::uint32_t offset;
+    };
+
     const ResponseT* response_ = nullptr;
 
-    std::unordered_map<Symbol, std::vector<const message_type*>> buckets_;
+    // Key -> group index, load factor <= 0.5
+    std::vector<Slot> table_;
+    std::uint32_t generation_ = 0;
+
+    std::vector<Group> groups_;
+    std::vector<std::uint32_t> group_of_;           // per message
+    std::vector<const message_type*> ordered_;      // grouped, stable
 
     std::vector<view_type> views_;
 
 private:
     inline void classify_() noexcept {
-        for (auto& [_, vec] : buckets_) {
-            vec.clear();
-        }
+        groups_.clear();
         views_.clear();
 
-        for (const auto& msg : message_traits::messages(*response_)) {
-            buckets_[message_traits::symbol_of(msg)].push_back(&msg);
+        const auto& messages = message_traits::messages(*response_);
+        const std::size_t n = messages.size();
+        if (n == 0) [[unlikely]] {
+            return;
         }
 
-        views_.reserve(buckets_.size());
+        // Capacity only grows (warm-up), then every buffer is reused
+        group_of_.resize(n);
+        ordered_.resize(n);
+        begin_generation_(n);
 
-        for (auto& [symbol, vec] : buckets_) {
+        // ---- Pass 1: classify ----
+        for (std::size_t i = 0; i < n; ++i) {
+            const Symbol& symbol = message_traits::symbol_of(messages[i]);
+            const Key key = key_of_(symbol);
+            group_of_[i] = find_or_insert_(key, symbol);
+        }
+
+        // ---- Pass 2: scatter ----
+        if (groups_.size() == 1) [[likely]] {
+            groups_[0].count = static_cast<std::uint32_t>(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                ordered_[i] = &messages[i];
+            }
+        }
+        else {
+            for (std::size_t i = 0; i < n; ++i) {
+                ++groups_[group_of_[i]].count;
+            }
+            std::uint32_t offset = 0;
+            for (auto& g : groups_) {
+                g.offset = offset;
+                offset += g.count;
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                ordered_[groups_[group_of_[i]].offset++] = &messages[i];
+            }
+            // offsets now point at each group's end
+            for (auto& g : groups_) {
+                g.offset -= g.count;
+            }
+        }
+
+        // ---- Views ----
+        const auto type = message_traits::payload_type(*response_);
+        for (const auto& g : groups_) {
             views_.push_back(
                 message_traits::make_view(
-                    symbol,
-                    message_traits::payload_type(*response_),
+                    *g.symbol,
+                    type,
                     std::span<const message_type* const>(
-                        vec.data(),
-                        vec.size()
+                        ordered_.data() + g.offset,
+                        g.count
                     )
                 )
             );
         }
     }
+
+    [[nodiscard]]
+    static inline Key key_of_(const Symbol& symbol) noexcept {
+        static_assert(Symbol::capacity() >= 15 && Symbol::capacity() <= 16, "Key packs exactly 16 symbol bytes");
+        static_assert(std::endian::native == std::endian::little, "Key masking assumes little endian");
+        std::uint64_t w[2];
+        std::memcpy(w, symbol.data(), sizeof(w));   // data() holds capacity() + 1 bytes
+        const std::size_t size = symbol.size();
+        Key key;
+        key.lo = size >= 8  ? w[0] : w[0] & ((std::uint64_t{1} << (8 * size)) - 1);
+        key.hi = size >= 16 ? w[1] : size <= 8 ? 0 : w[1] & ((std::uint64_t{1} << (8 * (size - 8))) - 1);
+        return key;
+    }
+
+    [[nodiscard]]
+    static inline std::size_t hash_(const Key& key) noexcept {
+        const std::uint64_t h = (key.lo ^ (key.hi * 0x9E3779B97F4A7C15ull)) * 0xBF58476D1CE4E5B9ull;
+        return static_cast<std::size_t>(h ^ (h >> 29));
+    }
+
+    // Clears the table in O(1); grows it so that n distinct symbols fit at load factor <= 0.5
+    inline void begin_generation_(std::size_t n) noexcept {
+        std::size_t size = table_.empty() ? MIN_TABLE_SIZE : table_.size();
+        while (size < 2 * n) {
+            size *= 2;
+        }
+        if (size != table_.size()) [[unlikely]] {
+            table_.assign(size, Slot{});
+            generation_ = 0;
+        }
+        if (++generation_ == 0) [[unlikely]] {   // wrap-around: stale generations must not match
+            for (auto& slot : table_) {
+                slot.generation = 0;
+            }
+            generation_ = 1;
+        }
+    }
+
+    // Returns the group index of `key`, creating the group if needed
+    [[nodiscard]]
+    inline std::uint32_t find_or_insert_(const Key& key, const Symbol& symbol) noexcept {
+        if (groups_.size() <= LINEAR_GROUPS) [[likely]] {
+            // Branch-free scan: symbols interleave unpredictably, the group count does not
+            const auto count = static_cast<std::uint32_t>(groups_.size());
+            std::uint32_t found = count;
+            for (std::uint32_t g = 0; g < count; ++g) {
+                found = (groups_[g].key == key) ? g : found;
+            }
+            if (found != count) [[likely]] {
+                return found;
+            }
+            if (count < LINEAR_GROUPS) [[likely]] {
+                groups_.push_back(Group{ key, &symbol, 0, 0 });
+                return static_cast<std::uint32_t>(groups_.size() - 1);
+            }
+            // Switching to the table: index the groups found so far
+            for (std::uint32_t g = 0; g < groups_.size(); ++g) {
+                (void)probe_(groups_[g].key, *groups_[g].symbol, g);
+            }
+        }
+        return probe_(key, symbol, static_cast<std::uint32_t>(groups_.size()));
+    }
+
+    // Table lookup; inserts `key` as group `next_group` if absent (a new group unless re-indexing)
+    [[nodiscard]]
+    inline std::uint32_t probe_(const Key& key, const Symbol& symbol, std::uint32_t next_group) noexcept {
+        const std::size_t mask = table_.size() - 1;
+        std::size_t idx = hash_(key) & mask;
+        while (true) {
+            Slot& slot = table_[idx];
+            if (slot.generation != generation_) {
+                slot.key = key;
+                slot.generation = generation_;
+                slot.group = next_group;
+                if (next_group == groups_.size()) {
+                    groups_.push_back(Group{ key, &symbol, 0, 0 });
+                }
+                return slot.group;
+            }
+            if (slot.key == key) {
+                return slot.group;
+            }
+            idx = (idx + 1) & mask;
+        }
+    }
 };
 
 } // namespace wirekrak::core::protocol::kraken::response
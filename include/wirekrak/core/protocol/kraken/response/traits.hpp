@@ -62,7 +62,7 @@ struct traits<schema::trade::Response> {
     using message_type  = schema::trade::Trade;
     using view_type     = schema::trade::ResponseView;
 
-    static inline Symbol symbol_of(const message_type& msg) noexcept {
+    static inline const Symbol& symbol_of(const message_type& msg) noexcept {
         return msg.symbol;
     }
 
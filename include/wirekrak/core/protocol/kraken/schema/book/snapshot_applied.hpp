@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include "wirekrak/core/symbol.hpp"
+#include "wirekrak/core/timestamp.hpp"
+#include "lcr/optional.hpp"
+
+
+namespace wirekrak::core {
+namespace protocol {
+namespace kraken {
+namespace schema {
+namespace book {
+
+// ===============================================
+// BOOK SNAPSHOT APPLIED
+// ===============================================
+//
+// Data-plane notification emitted instead of a
+// book snapshot Response when the session streams
+// book messages into a book store (book_sink).
+//
+// The levels live in the store; this event only
+// says which book was (re)loaded.
+//
+// ===============================================
+
+struct SnapshotApplied {
+    Symbol symbol;
+    std::uint32_t checksum;
+    std::uint32_t bid_levels;
+    std::uint32_t ask_levels;
+    lcr::optional<Timestamp> timestamp;
+
+    [[nodiscard]]
+    inline Symbol get_symbol() const noexcept {
+        return symbol;
+    }
+
+    // ---------------------------------------------------------
+    // Dump
+    // ---------------------------------------------------------
+    inline void dump(std::ostream& os) const {
+        os << "[BOOK SNAPSHOT APPLIED] {"
+           << "symbol=" << symbol
+           << ", checksum=" << checksum
+           << ", bids=" << bid_levels
+           << ", asks=" << ask_levels;
+        if (timestamp.has()) {
+            os << ", timestamp=" << wirekrak::core::to_string(timestamp.value());
+        }
+        os << "}";
+    }
+
+#ifndef NDEBUG
+    // ---------------------------------------------------------
+    // String helper (debug / logging)
+    // NOTE: Allocates. Intended for debugging/logging only.
+    // ---------------------------------------------------------
+    inline std::string str() const {
+        std::ostringstream oss;
+        dump(oss);
+        return oss.str();
+    }
+#endif
+};
+
+// Stream operator<< delegates to dump(); allocation-free.
+inline std::ostream& operator<<(std::ostream& os, const SnapshotApplied& e) {
+    e.dump(os);
+    return os;
+}
+
+} // namespace book
+} // namespace schema
+} // namespace kraken
+} // namespace protocol
+} // namespace wirekrak::core
@@ -5,6 +5,7 @@
 #include <cstdint>
 
 #include "wirekrak/core/protocol/kraken/schema/validate.hpp"
+#include "wirekrak/core/protocol/kraken/schema/request_json.hpp"
 #include "wirekrak/core/protocol/kraken/schema/book/common.hpp"
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/symbol.hpp"
@@ -85,68 +86,40 @@ struct Subscribe {
         }
 #endif
 
-        std::size_t pos = 0;
+        static constexpr auto head = request_json::head("subscribe", "book");
+        static constexpr auto options = request_json::book_options();
 
-        // Prefix
-        static constexpr char prefix[] =
-            "{\"method\":\"subscribe\",\"params\":{"
-            "\"channel\":\"book\","
-            "\"symbol\":[";
-        std::memcpy(buffer + pos, prefix, sizeof(prefix) - 1);
-        pos += sizeof(prefix) - 1;
-
-        // Symbols
-        for (std::size_t i = 0; i < symbols.size(); ++i) {
-            buffer[pos++] = '"';
-            pos += lcr::json::escape(buffer + pos, symbols[i]);
-            buffer[pos++] = '"';
-
-            if (i + 1 < symbols.size())
-                buffer[pos++] = ',';
+        std::size_t pos = head.write(buffer);
+        pos += request_json::write_symbols(buffer + pos, symbols);
+        const std::size_t depth_index = request_json::book_depth_index(depth);
+        if (depth_index != request_json::BOOK_DEPTH_NONCANONICAL) [[likely]] {
+            pos += options[depth_index * 3 + request_json::snapshot_index(snapshot)].write(buffer + pos);
         }
-
-        buffer[pos++] = ']';
-
-        // depth
-        if (depth.has()) {
-            static constexpr char depth_prefix[] = ",\"depth\":";
-            std::memcpy(buffer + pos, depth_prefix, sizeof(depth_prefix) - 1);
-            pos += sizeof(depth_prefix) - 1;
-            pos += lcr::json::append(buffer + pos, depth.value());
+        else {
+            pos += write_options_(buffer + pos);
         }
+        pos += request_json::write_tail(buffer + pos, req_id);
 
-        // snapshot
-        if (snapshot.has()) {
-            static constexpr char snap_prefix[] = ",\"snapshot\":";
-            std::memcpy(buffer + pos, snap_prefix, sizeof(snap_prefix) - 1);
-            pos += sizeof(snap_prefix) - 1;
-
-            if (snapshot.value()) {
-                static constexpr char t[] = "true";
-                std::memcpy(buffer + pos, t, 4);
-                pos += 4;
-            } else {
-                static constexpr char f[] = "false";
-                std::memcpy(buffer + pos, f, 5);
-                pos += 5;
-            }
-        }
+        return pos;
+    }
 
+private:
+    // Field-by-field options (depth outside the values Kraken accepts)
+    [[nodiscard]]
+    inline std::size_t write_options_(char* buffer) const noexcept {
+        static constexpr char depth_prefix[] = "],\"depth\":";
+        std::size_t pos = 0;
+        std::memcpy(buffer + pos, depth_prefix, sizeof(depth_prefix) - 1);
+        pos += sizeof(depth_prefix) - 1;
+        pos += lcr::json::append(buffer + pos, depth.value());
+        request_json::Fragment snap;
+        request_json::append_snapshot(snap, request_json::snapshot_index(snapshot));
+        pos += snap.write(buffer + pos);
         buffer[pos++] = '}'; // close params
-
-        // req_id
-        if (req_id.has()) {
-            static constexpr char req_prefix[] = ",\"req_id\":";
-            std::memcpy(buffer + pos, req_prefix, sizeof(req_prefix) - 1);
-            pos += sizeof(req_prefix) - 1;
-            pos += lcr::json::append(buffer + pos, req_id.value());
-        }
-
-        buffer[pos++] = '}'; // close json
-
         return pos;
     }
 
+public:
 #ifndef WIREKRAK_NO_ALLOCATIONS
     // Convenience method (allocating) for tests / logging.
     std::string to_json() const {
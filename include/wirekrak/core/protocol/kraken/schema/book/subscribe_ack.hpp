@@ -1,11 +1,10 @@
 #pragma once
 
-#include <string>
-#include <vector>
 #include <cstdint>
 
 #include "wirekrak/core/symbol.hpp"
 #include "wirekrak/core/timestamp.hpp"
+#include "wirekrak/core/protocol/kraken/schema/text.hpp"
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "lcr/optional.hpp"
 
@@ -26,8 +25,9 @@ struct SubscribeAck {
 
     std::uint32_t depth;
 
-    std::vector<std::string> warnings;
-    lcr::optional<std::string> error;
+    Warnings warnings;
+    lcr::optional<ErrorText> error;
+    bool truncated = false;     // warnings / error exceeded their bounded capacity
 
     lcr::optional<Timestamp> time_in;
     lcr::optional<Timestamp> time_out;
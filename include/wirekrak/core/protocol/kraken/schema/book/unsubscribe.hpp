@@ -6,6 +6,7 @@
 #include <cassert>
 
 #include "wirekrak/core/protocol/kraken/schema/validate.hpp"
+#include "wirekrak/core/protocol/kraken/schema/request_json.hpp"
 #include "wirekrak/core/protocol/kraken/schema/book/common.hpp"
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/symbol.hpp"
@@ -82,47 +83,23 @@ struct Unsubscribe {
         }
 #endif
 
-        std::size_t pos = 0;
+        static constexpr auto head = request_json::head("unsubscribe", "book");
+        static constexpr auto options = request_json::book_options();
 
-        // Prefix
-        static constexpr char prefix[] =
-            "{\"method\":\"unsubscribe\",\"params\":{"
-            "\"channel\":\"book\","
-            "\"symbol\":[";
-        std::memcpy(buffer + pos, prefix, sizeof(prefix) - 1);
-        pos += sizeof(prefix) - 1;
-
-        // Symbols
-        for (std::size_t i = 0; i < symbols.size(); ++i) {
-            buffer[pos++] = '"';
-            pos += lcr::json::escape(buffer + pos, symbols[i]);
-            buffer[pos++] = '"';
-
-            if (i + 1 < symbols.size())
-                buffer[pos++] = ',';
+        std::size_t pos = head.write(buffer);
+        pos += request_json::write_symbols(buffer + pos, symbols);
+        const std::size_t depth_index = request_json::book_depth_index(depth);
+        if (depth_index != request_json::BOOK_DEPTH_NONCANONICAL) [[likely]] {
+            pos += options[depth_index * 3].write(buffer + pos);
         }
-
-        buffer[pos++] = ']';
-
-        // depth
-        if (depth.has()) {
-            static constexpr char depth_prefix[] = ",\"depth\":";
+        else {
+            static constexpr char depth_prefix[] = "],\"depth\":";
             std::memcpy(buffer + pos, depth_prefix, sizeof(depth_prefix) - 1);
             pos += sizeof(depth_prefix) - 1;
             pos += lcr::json::append(buffer + pos, depth.value());
+            buffer[pos++] = '}'; // close params
         }
-
-        buffer[pos++] = '}'; // close params
-
-        // req_id
-        if (req_id.has()) {
-            static constexpr char req_prefix[] = ",\"req_id\":";
-            std::memcpy(buffer + pos, req_prefix, sizeof(req_prefix) - 1);
-            pos += sizeof(req_prefix) - 1;
-            pos += lcr::json::append(buffer + pos, req_id.value());
-        }
-
-        buffer[pos++] = '}'; // close entire JSON
+        pos += request_json::write_tail(buffer + pos, req_id);
 
         return pos;
     }
@@ -1,11 +1,10 @@
 #pragma once
 
-#include <string>
-#include <vector>
 #include <cstdint>
 
 #include "wirekrak/core/symbol.hpp"
 #include "wirekrak/core/timestamp.hpp"
+#include "wirekrak/core/protocol/kraken/schema/text.hpp"
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "lcr/optional.hpp"
 
@@ -30,7 +29,8 @@ struct UnsubscribeAck {
     bool success;
 
     // Conditional error (present if success == false)
-    lcr::optional<std::string> error;
+    lcr::optional<ErrorText> error;
+    bool truncated = false;     // error exceeded its bounded capacity
 
     // Optional timestamps
     lcr::optional<Timestamp> time_in;
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <string>
-#include <vector>
 #include <cstdint>
 #include <ostream>
 #include <sstream>
@@ -9,6 +8,7 @@
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/symbol.hpp"
 #include "wirekrak/core/timestamp.hpp"
+#include "wirekrak/core/protocol/kraken/schema/text.hpp"
 #include "lcr/optional.hpp"
 
 namespace wirekrak::core {
@@ -25,7 +25,8 @@ namespace rejection {
 // rejection::Notice type for consistent error handling.
 // ===============================================
 struct Notice {
-    std::string error;
+    ErrorText error;
+    bool truncated = false;     // error exceeded its bounded capacity
     lcr::optional<ctrl::req_id_t> req_id;
     lcr::optional<Symbol> symbol;
     lcr::optional<Timestamp> time_in;
@@ -35,7 +36,7 @@ struct Notice {
     // Debug / inspection helper
     // ------------------------------------------------------------
     inline void dump(std::ostream& os) const {
-        os << "[REJECTION] { " << "error=\"" << error << "\"";
+        os << "[REJECTION] { " << "error=\"" << error << (truncated ? "...\"" : "\"");
         if (req_id.has()) {
             os << ", req_id=" << req_id.value();
         }
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "wirekrak/core/protocol/kraken/schema/book/common.hpp"
+#include "wirekrak/core/protocol/control/req_id.hpp"
+#include "wirekrak/core/symbol.hpp"
+#include "lcr/json.hpp"
+#include "lcr/optional.hpp"
+
+
+namespace wirekrak::core {
+namespace protocol {
+namespace kraken {
+namespace schema {
+namespace request_json {
+
+// ===============================================
+// PRE-RENDERED REQUEST JSON
+// ===============================================
+//
+// Subscribe / unsubscribe requests are constant
+// except for the symbol list and the req_id:
+//
+//   {"method":"subscribe","params":{"channel":"book","symbol":[
+//   "BTC/USD","ETH/USD"                       ← spliced
+//   ],"depth":10,"snapshot":false}            ← pre-rendered per option set
+//   ,"req_id":                                ← constant
+//   42                                        ← spliced
+//   }
+//
+// Every constant part is a Fragment rendered at
+// compile time (one per request type, one per
+// combination of channel options), so a request
+// is written with a few memcpy plus the splices.
+//
+// Symbols are written verbatim (no per-character
+// escaping) when they contain nothing to escape,
+// which holds for every exchange symbol; others
+// fall back to lcr::json::escape.
+//
+// Output is byte-identical to the field-by-field
+// writer it replaces.
+//
+// ===============================================
+
+struct Fragment {
+    static constexpr std::size_t CAPACITY = 64;
+
+    char data[CAPACITY]{};
+    std::size_t size = 0;
+
+    constexpr Fragment& append(std::string_view s) noexcept {
+        for (char c : s) {
+            data[size++] = c;
+        }
+        return *this;
+    }
+
+    constexpr Fragment& append(std::uint64_t value) noexcept {
+        char digits[20]{};
+        std::size_t n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        while (n > 0) {
+            data[size++] = digits[--n];
+        }
+        return *this;
+    }
+
+    [[nodiscard]]
+    inline std::size_t write(char* out) const noexcept {
+        std::memcpy(out, data, size);
+        return size;
+    }
+};
+
+// {"method":"<method>","params":{"channel":"<channel>","symbol":[
+[[nodiscard]]
+consteval Fragment head(std::string_view method, std::string_view channel) noexcept {
+    Fragment f;
+    f.append("{\"method\":\"").append(method).append("\",\"params\":{")
+     .append("\"channel\":\"").append(channel).append("\",")
+     .append("\"symbol\":[");
+    return f;
+}
+
+// ,"snapshot":true / ,"snapshot":false (none for index 0)
+[[nodiscard]]
+inline std::size_t snapshot_index(const lcr::optional<bool>& snapshot) noexcept {
+    return snapshot.has() ? (snapshot.value() ? 1 : 2) : 0;
+}
+
+constexpr Fragment& append_snapshot(Fragment& f, std::size_t index) noexcept {
+    if (index == 1) {
+        f.append(",\"snapshot\":true");
+    }
+    else if (index == 2) {
+        f.append(",\"snapshot\":false");
+    }
+    return f;
+}
+
+// -----------------------------------------------
+// Book channel options
+// -----------------------------------------------
+
+// Depth values Kraken accepts, in option table order (index 0 = no depth)
+inline constexpr std::uint32_t BOOK_DEPTHS[] = {10, 25, 100, 500, 1000};
+inline constexpr std::size_t BOOK_DEPTH_NONCANONICAL = ~std::size_t{0};
+
+[[nodiscard]]
+inline std::size_t book_depth_index(const lcr::optional<std::uint32_t>& depth) noexcept {
+    if (!depth.has()) {
+        return 0;
+    }
+    switch (depth.value()) {
+        case 10:   return 1;
+        case 25:   return 2;
+        case 100:  return 3;
+        case 500:  return 4;
+        case 1000: return 5;
+        default:   return BOOK_DEPTH_NONCANONICAL;
+    }
+}
+
+// ],"depth":N,"snapshot":...} for every depth index x snapshot index
+// (entry depth_index * 3 + snapshot_index)
+[[nodiscard]]
+consteval auto book_options() noexcept {
+    std::array<Fragment, (std::size(BOOK_DEPTHS) + 1) * 3> t{};
+    for (std::size_t d = 0; d <= std::size(BOOK_DEPTHS); ++d) {
+        for (std::size_t snap = 0; snap < 3; ++snap) {
+            Fragment& f = t[d * 3 + snap];
+            f.append("]");
+            if (d != 0) {
+                f.append(",\"depth\":").append(std::uint64_t{BOOK_DEPTHS[d - 1]});
+            }
+            append_snapshot(f, snap);
+            f.append("}"); // close params
+        }
+    }
+    return t;
+}
+
+static_assert(std::size(BOOK_DEPTHS) == 5 && book::is_valid_depth(BOOK_DEPTHS[0]) && book::is_valid_depth(BOOK_DEPTHS[4]));
+
+// -----------------------------------------------
+// Splices
+// -----------------------------------------------
+
+// "A","B","C" (without brackets)
+[[nodiscard]]
+inline std::size_t write_symbols(char* out, const RequestSymbols& symbols) noexcept {
+    std::size_t pos = 0;
+    for (const auto& symbol : symbols) {
+        out[pos++] = '"';
+        pos += lcr::json::escape(out + pos, symbol);   // memcpy when plain
+        out[pos++] = '"';
+        out[pos++] = ',';
+    }
+    return pos - (pos != 0); // drop the trailing comma
+}
+
+// ,"req_id":N} or }
+[[nodiscard]]
+inline std::size_t write_tail(char* out, const lcr::optional<ctrl::req_id_t>& req_id) noexcept {
+    static constexpr char req_prefix[] = ",\"req_id\":";
+    std::size_t pos = 0;
+    if (req_id.has()) {
+        std::memcpy(out, req_prefix, sizeof(req_prefix) - 1);
+        pos += sizeof(req_prefix) - 1;
+        pos += lcr::json::append(out + pos, req_id.value());
+    }
+    out[pos++] = '}'; // close json
+    return pos;
+}
+
+} // namespace request_json
+} // namespace schema
+} // namespace kraken
+} // namespace protocol
+} // namespace wirekrak::core
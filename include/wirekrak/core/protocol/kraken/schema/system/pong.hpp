@@ -2,12 +2,12 @@
 
 #include <cstdint>
 #include <string>
-#include <vector>
 #include <ostream>
 #include <sstream>
 
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/timestamp.hpp"
+#include "wirekrak/core/protocol/kraken/schema/text.hpp"
 #include "lcr/optional.hpp"
 
 namespace wirekrak::core {
@@ -25,12 +25,14 @@ struct Pong {
     lcr::optional<ctrl::req_id_t> req_id;
 
     // --- success-only fields ---
-    std::vector<std::string> warnings;
+    Warnings warnings;
     lcr::optional<Timestamp> time_in;
     lcr::optional<Timestamp> time_out;
 
     // --- error-only field ---
-    lcr::optional<std::string> error;
+    lcr::optional<ErrorText> error;
+
+    bool truncated = false;     // warnings / error exceeded their bounded capacity
 
     inline void to_json(std::ostream& os) const {
         bool first = true;
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include "lcr/local/string.hpp"
+#include "lcr/local/vector.hpp"
+#include "lcr/optional.hpp"
+
+
+namespace wirekrak::core {
+namespace protocol {
+namespace kraken {
+namespace schema {
+
+// ===============================================
+// BOUNDED TEXT (control-plane strings)
+// ===============================================
+//
+// Exchange-provided free text (ack / pong errors,
+// warnings, rejection reasons) is stored inline
+// with a fixed capacity, so control-plane messages
+// never allocate on the session thread.
+//
+// Longer text is truncated to capacity and extra
+// warnings are dropped; messages carrying bounded
+// text expose a `truncated` flag when that happens.
+//
+// ===============================================
+
+inline constexpr std::size_t MAX_ERROR_TEXT_LENGTH   = 128;
+inline constexpr std::size_t MAX_WARNING_TEXT_LENGTH = 128;
+inline constexpr std::size_t MAX_WARNINGS            = 4;
+
+using ErrorText   = lcr::local::string<MAX_ERROR_TEXT_LENGTH>;
+using WarningText = lcr::local::string<MAX_WARNING_TEXT_LENGTH>;
+using Warnings    = lcr::local::vector<WarningText, MAX_WARNINGS>;
+
+// Assigns `sv` truncated to capacity. Returns true if truncated.
+template<std::size_t N>
+[[nodiscard]]
+inline bool assign_text(lcr::local::string<N>& out, std::string_view sv) noexcept {
+    const bool truncated = sv.size() > N;
+    out.assign(truncated ? sv.substr(0, N) : sv);
+    return truncated;
+}
+
+template<std::size_t N>
+[[nodiscard]]
+inline bool assign_text(lcr::optional<lcr::local::string<N>>& out, std::string_view sv) noexcept {
+    out = lcr::local::string<N>{};
+    return assign_text(out.value(), sv);
+}
+
+} // namespace schema
+} // namespace kraken
+} // namespace protocol
+} // namespace wirekrak::core
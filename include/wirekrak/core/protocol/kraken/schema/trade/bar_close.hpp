@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include "wirekrak/core/symbol.hpp"
+#include "wirekrak/core/timestamp.hpp"
+
+
+namespace wirekrak::core {
+namespace protocol {
+namespace kraken {
+namespace schema {
+namespace trade {
+
+// ===============================================
+// TRADE BAR CLOSE
+// ===============================================
+//
+// Data-plane event emitted when the session
+// aggregates trades into bars (trade_sink) and a
+// time bucket of one symbol is complete.
+//
+// Also kept in the state plane as the latest
+// closed bar (any symbol, any interval).
+//
+// ===============================================
+
+struct BarClose {
+    Symbol symbol;
+    std::uint64_t interval_ns;
+    Timestamp open_time;        // bucket start
+    double open;
+    double high;
+    double low;
+    double close;
+    double volume;
+    double vwap;                // volume-weighted price of the bar
+    std::uint32_t trades;
+
+    [[nodiscard]]
+    inline Symbol get_symbol() const noexcept {
+        return symbol;
+    }
+
+    // ---------------------------------------------------------
+    // Dump
+    // ---------------------------------------------------------
+    inline void dump(std::ostream& os) const {
+        os << "[TRADE BAR CLOSE] {"
+           << "symbol=" << symbol
+           << ", interval_ns=" << interval_ns
+           << ", open_time=" << wirekrak::core::to_string(open_time)
+           << ", open=" << open
+           << ", high=" << high
+           << ", low=" << low
+           << ", close=" << close
+           << ", volume=" << volume
+           << ", vwap=" << vwap
+           << ", trades=" << trades
+           << "}";
+    }
+
+#ifndef NDEBUG
+    // ---------------------------------------------------------
+    // String helper (debug / logging)
+    // NOTE: Allocates. Intended for debugging/logging only.
+    // ---------------------------------------------------------
+    inline std::string str() const {
+        std::ostringstream oss;
+        dump(oss);
+        return oss.str();
+    }
+#endif
+};
+
+// Stream operator<< delegates to dump(); allocation-free.
+inline std::ostream& operator<<(std::ostream& os, const BarClose& e) {
+    e.dump(os);
+    return os;
+}
+
+} // namespace trade
+} // namespace schema
+} // namespace kraken
+} // namespace protocol
+} // namespace wirekrak::core
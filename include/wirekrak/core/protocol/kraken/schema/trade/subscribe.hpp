@@ -1,10 +1,12 @@
 #pragma once
 
+#include <array>
 #include <string>
 #include <vector>
 #include <cstdint>
 
 #include "wirekrak/core/protocol/kraken/schema/validate.hpp"
+#include "wirekrak/core/protocol/kraken/schema/request_json.hpp"
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/symbol.hpp"
 #include "lcr/json.hpp"
@@ -69,61 +71,22 @@ struct Subscribe {
         schema::validate_req_id(req_id);
 #endif
 
-        std::size_t pos = 0;
-
-        auto append_literal = [&](const char* s, std::size_t len) {
-            std::memcpy(buffer + pos, s, len);
-            pos += len;
-        };
-
-        // {"method":"subscribe","params":{
-        static constexpr char prefix[] =
-            "{\"method\":\"subscribe\",\"params\":{";
-        append_literal(prefix, sizeof(prefix) - 1);
-
-        // "channel":"trade",
-        static constexpr char channel[] =
-            "\"channel\":\"trade\",";
-        append_literal(channel, sizeof(channel) - 1);
-
-        // "symbol":[
-        static constexpr char symbol_prefix[] =
-            "\"symbol\":[";
-        append_literal(symbol_prefix, sizeof(symbol_prefix) - 1);
-
-        // symbols
-        for (std::size_t i = 0; i < symbols.size(); ++i) {
-            buffer[pos++] = '"';
-            pos += lcr::json::escape(buffer + pos, symbols[i]);
-            buffer[pos++] = '"';
-
-            if (i + 1 < symbols.size())
-                buffer[pos++] = ',';
-        }
-
-        buffer[pos++] = ']';
-
-        // snapshot
-        if (snapshot.has()) {
-            static constexpr char snap_prefix[] = ",\"snapshot\":";
-            append_literal(snap_prefix, sizeof(snap_prefix) - 1);
-
-            if (snapshot.value())
-                append_literal("true", 4);
-            else
-                append_literal("false", 5);
-        }
-
-        buffer[pos++] = '}'; // close params
-
-        // req_id
-        if (req_id.has()) {
-            static constexpr char req_prefix[] = ",\"req_id\":";
-            append_literal(req_prefix, sizeof(req_prefix) - 1);
-            pos += lcr::json::append(buffer + pos, req_id.value());
-        }
-
-        buffer[pos++] = '}';
+        // ],"snapshot":...} per snapshot option (none / true / false)
+        static constexpr auto options = [] {
+            std::array<request_json::Fragment, 3> t{};
+            for (std::size_t snap = 0; snap < t.size(); ++snap) {
+                t[snap].append("]");
+                request_json::append_snapshot(t[snap], snap);
+                t[snap].append("}"); // close params
+            }
+            return t;
+        }();
+        static constexpr auto head = request_json::head("subscribe", "trade");
+
+        std::size_t pos = head.write(buffer);
+        pos += request_json::write_symbols(buffer + pos, symbols);
+        pos += options[request_json::snapshot_index(snapshot)].write(buffer + pos);
+        pos += request_json::write_tail(buffer + pos, req_id);
 
         LCR_ASSERT_MSG(pos <= max_json_size(), "Serialized JSON size exceeds static buffer capacity");
 
@@ -1,12 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
 #include <cstdint>
 
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/symbol.hpp"
 #include "wirekrak/core/timestamp.hpp"
+#include "wirekrak/core/protocol/kraken/schema/text.hpp"
 #include "lcr/optional.hpp"
 
 
@@ -22,8 +21,9 @@ struct SubscribeAck {
 
     lcr::optional<bool> snapshot;
 
-    std::vector<std::string> warnings;
-    lcr::optional<std::string> error;
+    Warnings warnings;
+    lcr::optional<ErrorText> error;
+    bool truncated = false;     // warnings / error exceeded their bounded capacity
 
     lcr::optional<Timestamp> time_in;
     lcr::optional<Timestamp> time_out;
@@ -5,6 +5,7 @@
 #include <cstdint>
 
 #include "wirekrak/core/protocol/kraken/schema/validate.hpp"
+#include "wirekrak/core/protocol/kraken/schema/request_json.hpp"
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/symbol.hpp"
 #include "lcr/json.hpp"
@@ -57,38 +58,13 @@ struct Unsubscribe {
         schema::validate_req_id(req_id);
 #endif
 
-        std::size_t pos = 0;
+        static constexpr auto head = request_json::head("unsubscribe", "trade");
+        static constexpr auto close = request_json::Fragment{}.append("]}"); // close symbols + params
 
-        // Prefix
-        static constexpr char prefix[] =
-            "{\"method\":\"unsubscribe\",\"params\":{"
-            "\"channel\":\"trade\","
-            "\"symbol\":[";
-        std::memcpy(buffer + pos, prefix, sizeof(prefix) - 1);
-        pos += sizeof(prefix) - 1;
-
-        // Symbols
-        for (std::size_t i = 0; i < symbols.size(); ++i) {
-            buffer[pos++] = '"';
-            pos += lcr::json::escape(buffer + pos, symbols[i]);
-            buffer[pos++] = '"';
-
-            if (i + 1 < symbols.size())
-                buffer[pos++] = ',';
-        }
-
-        buffer[pos++] = ']';
-        buffer[pos++] = '}'; // close params
-
-        // req_id
-        if (req_id.has()) {
-            static constexpr char req_prefix[] = ",\"req_id\":";
-            std::memcpy(buffer + pos, req_prefix, sizeof(req_prefix) - 1);
-            pos += sizeof(req_prefix) - 1;
-            pos += lcr::json::append(buffer + pos, req_id.value());
-        }
-
-        buffer[pos++] = '}'; // close entire JSON
+        std::size_t pos = head.write(buffer);
+        pos += request_json::write_symbols(buffer + pos, symbols);
+        pos += close.write(buffer + pos);
+        pos += request_json::write_tail(buffer + pos, req_id);
 
         return pos;
     }
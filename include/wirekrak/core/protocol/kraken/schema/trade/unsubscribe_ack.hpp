@@ -1,10 +1,10 @@
 #pragma once
-#include <string>
 #include <cstdint>
 
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/symbol.hpp"
 #include "wirekrak/core/timestamp.hpp"
+#include "wirekrak/core/protocol/kraken/schema/text.hpp"
 #include "lcr/optional.hpp"
 
 
@@ -18,7 +18,8 @@ struct UnsubscribeAck {
     bool success = false;
     Symbol symbol;
 
-    lcr::optional<std::string> error;
+    lcr::optional<ErrorText> error;
+    bool truncated = false;     // error exceeded its bounded capacity
 
     lcr::optional<Timestamp> time_in;
     lcr::optional<Timestamp> time_out;
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "wirekrak/core/protocol/kraken/subscriptions/traits.hpp"
 #include "wirekrak/core/protocol/kraken/subscriptions/set.hpp"
 
@@ -20,6 +22,20 @@ struct SubscriptionModel {
     // ------------------------------------------------------------
     template<class T>
     using subscription_type_t = subscription_type<T>;
+
+    // ------------------------------------------------------------
+    // Canonical subscription → cancel request for some of its symbols
+    // (used by load shedding to drop symbols it will resubscribe later)
+    // ------------------------------------------------------------
+    [[nodiscard]]
+    static inline schema::trade::Unsubscribe cancel_request(const schema::trade::Subscribe&, RequestSymbols symbols) noexcept {
+        return schema::trade::Unsubscribe{.symbols = std::move(symbols)};
+    }
+
+    [[nodiscard]]
+    static inline schema::book::Unsubscribe cancel_request(const schema::book::Subscribe& sub, RequestSymbols symbols) noexcept {
+        return schema::book::Unsubscribe{.symbols = std::move(symbols), .depth = sub.depth};
+    }
 };
 
 } // namespace wirekrak::core::protocol::kraken
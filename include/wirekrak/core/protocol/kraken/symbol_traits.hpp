@@ -0,0 +1,116 @@
+#pragma once
+
+/*
+===============================================================================
+Kraken symbol traits
+===============================================================================
+
+Per-symbol keys of Kraken data-plane messages (see protocol::symbol_traits).
+
+book::Response
+  • One symbol per message (book.symbol)
+
+trade::Response
+  • A message may carry trades of several symbols: key() succeeds only when
+    every trade has the same symbol, retain() / partition() work on runs of
+    consecutive trades of one symbol (one lock-free intern lookup per run)
+
+===============================================================================
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "wirekrak/core/protocol/symbol_traits.hpp"
+#include "wirekrak/core/protocol/kraken/schema/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/response.hpp"
+#include "wirekrak/core/symbol/intern.hpp"
+
+
+namespace wirekrak::core::protocol {
+
+template<>
+struct symbol_traits<kraken::schema::book::Response> {
+    static constexpr bool enabled = true;
+
+    [[nodiscard]]
+    static inline bool key(const kraken::schema::book::Response& msg, SymbolId& out) noexcept {
+        out = intern_symbol(msg.book.symbol.view());
+        return true;
+    }
+};
+
+template<>
+struct symbol_traits<kraken::schema::trade::Response> {
+    static constexpr bool enabled = true;
+
+    // False for empty messages and for messages carrying several symbols
+    [[nodiscard]]
+    static inline bool key(const kraken::schema::trade::Response& msg, SymbolId& out) noexcept {
+        if (msg.trades.empty()) [[unlikely]] {
+            return false;
+        }
+        const auto symbol = msg.trades.front().symbol.view();
+        for (std::size_t i = 1; i < msg.trades.size(); ++i) {
+            if (msg.trades[i].symbol.view() != symbol) [[unlikely]] {
+                return false;
+            }
+        }
+        out = intern_symbol(symbol);
+        return true;
+    }
+
+    template<class Keep>
+    [[nodiscard]]
+    static inline bool retain(kraken::schema::trade::Response& msg, Keep&& keep) noexcept {
+        auto& trades = msg.trades;
+        const std::size_t n = trades.size();
+        std::size_t out = 0;
+        std::size_t i = 0;
+        while (i < n) {
+            const std::size_t j = run_end_(trades, i);
+            if (keep(intern_symbol(trades[i].symbol.view()))) {
+                if (out != i) {
+                    std::move(trades.begin() + static_cast<std::ptrdiff_t>(i),
+                              trades.begin() + static_cast<std::ptrdiff_t>(j),
+                              trades.begin() + static_cast<std::ptrdiff_t>(out));
+                }
+                out += j - i;
+            }
+            i = j;
+        }
+        trades.resize(out);
+        return out > 0 || n == 0;
+    }
+
+    template<class F>
+    static inline void partition(kraken::schema::trade::Response&& msg, F&& fn) {
+        const auto& trades = msg.trades;
+        std::size_t i = 0;
+        while (i < trades.size()) {
+            const std::size_t j = run_end_(trades, i);
+            kraken::schema::trade::Response part{};
+            part.type = msg.type;
+            part.trades.assign(trades.begin() + static_cast<std::ptrdiff_t>(i), trades.begin() + static_cast<std::ptrdiff_t>(j));
+            fn(std::move(part));
+            i = j;
+        }
+    }
+
+private:
+    // One past the last trade of the run starting at i
+    template<class Trades>
+    [[nodiscard]]
+    static inline std::size_t run_end_(const Trades& trades, std::size_t i) noexcept {
+        std::size_t j = i + 1;
+        while (j < trades.size() && trades[j].symbol.view() == trades[i].symbol.view()) {
+            ++j;
+        }
+        return j;
+    }
+};
+
+static_assert(MultiSymbolMessage<kraken::schema::trade::Response>);
+
+} // namespace wirekrak::core::protocol
@@ -0,0 +1,96 @@
+#pragma once
+
+/*
+===============================================================================
+Kraken Trade Sink
+===============================================================================
+
+Selects whether the router feeds trade messages to an aggregator:
+
+  • trade_sink::None              → trades only reach the data plane as
+                                    schema::trade::Response (default)
+  • trade_sink::Into<Aggregator>  → every parsed trade message is also folded
+                                    into an attached aggregator (e.g.
+                                    feed::TradeAggregator) before delivery:
+                                      - each completed bar is published as a
+                                        schema::trade::BarClose event on the
+                                        data plane and as the latest BarClose
+                                        in the state plane
+                                      - the Response is still delivered
+
+An aggregator is attached at runtime through the message handler:
+
+    session.message_handler().attach_trade_aggregator(bars);
+
+Until an aggregator is attached, Into<Aggregator> behaves like None.
+
+Aggregator requirements (TradeAggregatorConcept):
+
+    void A::on_trades(const schema::trade::Response&, Emit&& emit) noexcept;
+        // calls emit(const schema::trade::BarClose&) for each completed bar
+
+Aggregation runs before delivery, so bars stay complete even when the data
+plane rejects the Response (backpressure).
+
+===============================================================================
+*/
+
+#include <concepts>
+
+#include "wirekrak/core/protocol/kraken/schema/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/schema/trade/bar_close.hpp"
+
+
+namespace wirekrak::core::protocol::kraken {
+
+// ============================================================================
+// Concepts
+// ============================================================================
+
+namespace trade_sink::detail {
+
+// Emit callback archetype (concept checking only)
+struct BarCloseSink {
+    inline void operator()(const schema::trade::BarClose&) const noexcept {}
+};
+
+} // namespace trade_sink::detail
+
+template<class A>
+concept TradeAggregatorConcept =
+requires(A& aggregator, const schema::trade::Response& response) {
+    { aggregator.on_trades(response, trade_sink::detail::BarCloseSink{}) } noexcept;
+};
+
+template<class P>
+concept TradeSinkConcept =
+    requires { { P::enabled } -> std::same_as<const bool&>; } &&
+    (!P::enabled || TradeAggregatorConcept<typename P::aggregator_type>);
+
+
+namespace trade_sink {
+
+// ------------------------------------------------------------
+// None (trades on the data plane only)
+// ------------------------------------------------------------
+
+struct None {
+    static constexpr bool enabled = false;
+    using aggregator_type = void;
+};
+
+// ------------------------------------------------------------
+// Into<Aggregator> (trades also folded into an aggregator)
+// ------------------------------------------------------------
+
+template<class Aggregator>
+struct Into {
+    static constexpr bool enabled = true;
+    using aggregator_type = Aggregator;
+};
+
+} // namespace trade_sink
+
+static_assert(TradeSinkConcept<trade_sink::None>);
+
+} // namespace wirekrak::core::protocol::kraken
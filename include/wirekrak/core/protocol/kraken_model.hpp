@@ -43,6 +43,46 @@ using SessionT = Session<
     MessageRing
 >;
 
+KrakenModel parses with Strict validation. Once the schema is trusted, the
+data-plane parsers can be relaxed at compile time:
+
+using FastSessionT = Session<
+    BasicKrakenModel<policy::protocol::validation::Trusted>,
+    WS,
+    MessageRing
+>;
+
+Channels of no interest (e.g. heartbeats) can be dropped before parsing with
+a kraken::ChannelFilter. Using the same filter in the WebSocket policy bundle
+drops them on the receive thread instead (see kraken/frame_filter.hpp):
+
+using QuietModel = BasicKrakenModel<
+    policy::protocol::DefaultValidation,
+    kraken::HeartbeatFilter
+>;
+
+Deep books (e.g. depth 1000) can be streamed into a book store instead of
+travelling as Response messages; snapshots and updates then reach the data
+plane as schema::book::SnapshotApplied / UpdateApplied events (see
+kraken/book_sink.hpp):
+
+using StoreModel = BasicKrakenModel<
+    policy::protocol::DefaultValidation,
+    kraken::NoChannelFilter,
+    kraken::book_sink::Into<feed::BookStore<1000>>
+>;
+
+Trades can be aggregated into OHLCV bars once, in the session; completed bars
+reach the data plane as schema::trade::BarClose events and the state plane as
+the latest BarClose (see kraken/trade_sink.hpp, feed/trade_aggregator.hpp):
+
+using BarModel = BasicKrakenModel<
+    policy::protocol::DefaultValidation,
+    kraken::NoChannelFilter,
+    kraken::book_sink::None,
+    kraken::trade_sink::Into<feed::TradeAggregator<>>
+>;
+
 ------------------------------------------------------------------------------
 Structure
 ------------------------------------------------------------------------------
@@ -62,23 +102,40 @@ Notes
 -------------------------------------------------------------------------------
 */
 
+#include <type_traits>
+
 #include "wirekrak/core/meta/type_list.hpp"
 #include "wirekrak/core/protocol/kraken/subscriptions/model.hpp"
 #include "wirekrak/core/protocol/kraken/message_handler.hpp"
+#include "wirekrak/core/protocol/kraken/frame_filter.hpp"
+#include "wirekrak/core/protocol/kraken/book_sink.hpp"
+#include "wirekrak/core/protocol/kraken/trade_sink.hpp"
+#include "wirekrak/core/policy/protocol/validation.hpp"
 // Schema types (messages + states + factory functions)
 #include "wirekrak/core/protocol/kraken/schema/system/ping.hpp"
 #include "wirekrak/core/protocol/kraken/schema/system/pong.hpp"
 #include "wirekrak/core/protocol/kraken/schema/status/update.hpp"
 #include "wirekrak/core/protocol/kraken/schema/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/schema/trade/bar_close.hpp"
 #include "wirekrak/core/protocol/kraken/schema/book/response.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/snapshot_applied.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/update_applied.hpp"
 #include "wirekrak/core/protocol/kraken/schema/rejection_notice.hpp"
+// Conflation merge rules (book / trade)
+#include "wirekrak/core/protocol/kraken/conflation.hpp"
 
 namespace wirekrak::core::protocol {
 
 // ============================================================================
 // KrakenModel
 // ============================================================================
-struct KrakenModel {
+template<
+    policy::protocol::ValidationConcept ValidationPolicy = policy::protocol::DefaultValidation,
+    kraken::ChannelFilterConcept FramePolicy = kraken::NoChannelFilter,
+    kraken::BookSinkConcept BookSink = kraken::book_sink::None,
+    kraken::TradeSinkConcept TradeSink = kraken::trade_sink::None
+>
+struct BasicKrakenModel {
 
     // =========================================================================
     // CONTROL PLANE
@@ -90,31 +147,48 @@ struct KrakenModel {
     // DATA PLANE (message streams)
     // =========================================================================
 
-    using messages = meta::type_list<
+    using messages = meta::type_list_concat_t<
         // Trade channel
-        kraken::schema::trade::Response,
+        meta::type_list<kraken::schema::trade::Response>,
+        std::conditional_t<TradeSink::enabled,
+            meta::type_list<kraken::schema::trade::BarClose>,   // Bars completed by the aggregator
+            meta::type_list<>
+        >,
 
         // Book channel
-        kraken::schema::book::Response,
+        meta::type_list<kraken::schema::book::Response>,       // Copied deltas are already applied to the store (book_sink)
+        std::conditional_t<BookSink::enabled,
+            meta::type_list<
+                kraken::schema::book::SnapshotApplied,          // Snapshots loaded into the store
+                kraken::schema::book::UpdateApplied             // Updates applied to the store
+            >,
+            meta::type_list<>
+        >,
 
         // Rejections
-        kraken::schema::rejection::Notice
+        meta::type_list<kraken::schema::rejection::Notice>
     >;
 
     // =========================================================================
     // STATE PLANE (latest-value storage)
     // =========================================================================
 
-    using states = meta::type_list<
-        kraken::schema::system::Pong,
-        kraken::schema::status::Update
+    using states = meta::type_list_concat_t<
+        meta::type_list<
+            kraken::schema::system::Pong,
+            kraken::schema::status::Update
+        >,
+        std::conditional_t<TradeSink::enabled,
+            meta::type_list<kraken::schema::trade::BarClose>,   // Latest completed bar
+            meta::type_list<>
+        >
     >;
 
     // =========================================================================
     // PROTOCOL LOGIC
     // =========================================================================
 
-    using message_handler = kraken::MessageHandler;
+    using message_handler = kraken::MessageHandler<ValidationPolicy, FramePolicy, BookSink, TradeSink>;
 
     // =========================================================================
     // FACTORY FUNCTIONS
@@ -128,4 +202,6 @@ struct KrakenModel {
     }
 };
 
+using KrakenModel = BasicKrakenModel<>;
+
 } // namespace wirekrak::core::protocol
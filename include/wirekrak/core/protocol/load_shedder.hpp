@@ -0,0 +1,324 @@
+#pragma once
+
+/*
+===============================================================================
+LoadShedder - Per-symbol load shedding state
+===============================================================================
+
+Tracks, per SymbolId, the user-supplied priority and the observed activity
+(messages seen) and decides which symbols are shed when the session is under
+sustained transport backpressure (see policy::protocol::LoadShedding).
+
+The shedder only keeps state; the Session owns the protocol actions:
+
+  • select()  → lowest ranked symbols eligible for shedding
+  • park()    → keeps the subscribe request used to resync a shed symbol
+  • restore() → hands parked requests back once pressure has cleared
+
+Shed and resync transitions are queued as SheddingEvent so the user can tell
+exactly which symbols went stale and which were resynced.
+
+Single-threaded (session thread). Zero cost when shedding is disabled
+(empty specialization).
+
+===============================================================================
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "wirekrak/core/meta/type_list.hpp"
+#include "wirekrak/core/policy/protocol/shedding.hpp"
+#include "wirekrak/core/symbol/intern.hpp"
+
+
+namespace wirekrak::core::protocol {
+
+// ------------------------------------------------------------
+// Shedding events (user visible)
+// ------------------------------------------------------------
+
+enum class SheddingEventType : std::uint8_t {
+    Shed,       // Symbol unsubscribed under load, data is stale
+    Resynced    // Symbol resubscribed, a fresh snapshot follows
+};
+
+struct SheddingEvent {
+    SymbolId symbol;
+    SheddingEventType type;
+};
+
+inline constexpr std::uint8_t DEFAULT_SYMBOL_PRIORITY = 128;
+
+
+template<class SheddingPolicy, class DomainList>
+class LoadShedder;
+
+template<class SheddingPolicy, class... Domains>
+class LoadShedder<SheddingPolicy, meta::type_list<Domains...>> {
+    static constexpr std::size_t MAX_SYMBOLS = SheddingPolicy::max_symbols;
+
+    struct Slot {
+        std::uint32_t activity = 0;
+        std::uint8_t  priority = DEFAULT_SYMBOL_PRIORITY;
+        bool known = false;
+        bool stale = false;
+        bool resubscribing = false;     // restored, subscribe ACK pending
+    };
+
+public:
+    LoadShedder()
+        : slots_(std::make_unique<Slot[]>(MAX_SYMBOLS)) {
+    }
+
+    // ------------------------------------------------------------
+    // Ranking inputs
+    // ------------------------------------------------------------
+
+    // Higher priority symbols are shed last
+    inline void set_priority(SymbolId id, std::uint8_t priority) noexcept {
+        if (id >= MAX_SYMBOLS) [[unlikely]] {
+            return;
+        }
+        track_(id);
+        slots_[id].priority = priority;
+    }
+
+    // Records one message for the symbol. Returns false if the symbol is
+    // stale (its message must be dropped).
+    [[nodiscard]]
+    inline bool on_message(SymbolId id) noexcept {
+        if (id >= MAX_SYMBOLS) [[unlikely]] {
+            return true;
+        }
+        Slot& s = slots_[id];
+        if (s.stale) [[unlikely]] {
+            return false;
+        }
+        track_(id);
+        ++s.activity;
+        return true;
+    }
+
+    // ------------------------------------------------------------
+    // Pressure tracking
+    // ------------------------------------------------------------
+
+    inline void on_overloaded_poll() noexcept {
+        clear_polls_ = 0;
+    }
+
+    // Returns the number of consecutive clear polls
+    inline std::uint32_t on_clear_poll() noexcept {
+        return ++clear_polls_;
+    }
+
+    // ------------------------------------------------------------
+    // Shedding
+    // ------------------------------------------------------------
+
+    // Writes up to `batch_size` lowest ranked symbols accepted by
+    // `eligible` into `out`. Activity counters are halved afterwards so the
+    // ranking follows the recent rate.
+    template<class Eligible>
+    [[nodiscard]]
+    inline std::size_t select(SymbolId* out, Eligible&& eligible) {
+        candidates_.clear();
+        for (SymbolId id : known_) {
+            if (!slots_[id].stale && eligible(id)) {
+                candidates_.push_back(id);
+            }
+        }
+        const std::size_t n = std::min(SheddingPolicy::batch_size, candidates_.size());
+        std::partial_sort(candidates_.begin(), candidates_.begin() + n, candidates_.end(),
+            [&](SymbolId a, SymbolId b) { return rank_(a) < rank_(b); });
+        std::copy_n(candidates_.begin(), n, out);
+        for (SymbolId id : known_) {
+            slots_[id].activity >>= 1;
+        }
+        return n;
+    }
+
+    inline void mark_shed(SymbolId id) noexcept {
+        slots_[id].stale = true;
+        ++shed_count_;
+        events_.push_back({id, SheddingEventType::Shed});
+    }
+
+    template<class Domain>
+    inline void park(Domain req) {
+        std::get<std::vector<Domain>>(parked_).push_back(std::move(req));
+    }
+
+    // ------------------------------------------------------------
+    // Recovery
+    // ------------------------------------------------------------
+
+    // Hands each parked request to `fn(req)`. Requests for which `fn`
+    // returns false stay parked (retried on the next call). Symbols with no
+    // parked request left are marked fresh and reported as resynced.
+    template<class F>
+    inline std::size_t restore(F&& fn) {
+        std::size_t restored = 0;
+        (restore_<Domains>(fn, restored), ...);
+        for (SymbolId id : known_) {
+            Slot& s = slots_[id];
+            if (s.stale && !is_parked_(id)) {
+                s.stale = false;
+                s.resubscribing = true;
+                s.activity = 0;
+                --shed_count_;
+                events_.push_back({id, SheddingEventType::Resynced});
+            }
+        }
+        if (shed_count_ == 0) {
+            clear_polls_ = 0;
+        }
+        return restored;
+    }
+
+    // Returns true (once) if the symbol was waiting for the ACK of its
+    // resync subscribe
+    [[nodiscard]]
+    inline bool on_resubscribe_ack(SymbolId id) noexcept {
+        if (id >= MAX_SYMBOLS || !slots_[id].resubscribing) [[likely]] {
+            return false;
+        }
+        slots_[id].resubscribing = false;
+        return true;
+    }
+
+    // ------------------------------------------------------------
+    // Accessors
+    // ------------------------------------------------------------
+
+    [[nodiscard]]
+    inline bool is_stale(SymbolId id) const noexcept {
+        return id < MAX_SYMBOLS && slots_[id].stale;
+    }
+
+    [[nodiscard]]
+    inline std::size_t shed_count() const noexcept {
+        return shed_count_;
+    }
+
+    [[nodiscard]]
+    inline bool has_shed() const noexcept {
+        return shed_count_ > 0;
+    }
+
+    template<class F>
+    inline std::size_t drain_events(F&& fn) {
+        const std::size_t n = events_.size();
+        for (const auto& ev : events_) {
+            fn(ev);
+        }
+        events_.clear();
+        return n;
+    }
+
+private:
+    std::unique_ptr<Slot[]> slots_;
+    std::vector<SymbolId> known_;
+    std::vector<SymbolId> candidates_;
+    std::vector<SheddingEvent> events_;
+    std::tuple<std::vector<Domains>...> parked_;
+    std::size_t shed_count_{0};
+    std::uint32_t clear_polls_{0};
+
+    inline void track_(SymbolId id) {
+        if (!slots_[id].known) [[unlikely]] {
+            slots_[id].known = true;
+            known_.push_back(id);
+        }
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t rank_(SymbolId id) const noexcept {
+        if constexpr (SheddingPolicy::order == policy::protocol::ShedOrder::Priority) {
+            return (std::uint64_t{slots_[id].priority} << 32) | slots_[id].activity;
+        }
+        else {
+            return slots_[id].activity;
+        }
+    }
+
+    template<class Domain, class F>
+    inline void restore_(F& fn, std::size_t& restored) {
+        auto& parked = std::get<std::vector<Domain>>(parked_);
+        auto keep = std::remove_if(parked.begin(), parked.end(), [&](Domain& req) {
+            if (fn(req)) {
+                ++restored;
+                return true;
+            }
+            return false;
+        });
+        parked.erase(keep, parked.end());
+    }
+
+    [[nodiscard]]
+    inline bool is_parked_(SymbolId id) const noexcept {
+        return (is_parked_in_<Domains>(id) || ...);
+    }
+
+    template<class Domain>
+    [[nodiscard]]
+    inline bool is_parked_in_(SymbolId id) const noexcept {
+        for (const auto& req : std::get<std::vector<Domain>>(parked_)) {
+            for (const auto& symbol : req.symbols) {
+                if (intern_symbol(symbol) == id) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+};
+
+
+// ------------------------------------------------------------
+// Shedding disabled
+// ------------------------------------------------------------
+
+template<class... Domains>
+class LoadShedder<policy::protocol::NoShedding, meta::type_list<Domains...>> {
+public:
+    inline void set_priority(SymbolId, std::uint8_t) noexcept {}
+
+    [[nodiscard]]
+    constexpr bool on_message(SymbolId) const noexcept {
+        return true;
+    }
+
+    [[nodiscard]]
+    constexpr bool on_resubscribe_ack(SymbolId) const noexcept {
+        return false;
+    }
+
+    [[nodiscard]]
+    constexpr bool is_stale(SymbolId) const noexcept {
+        return false;
+    }
+
+    [[nodiscard]]
+    constexpr std::size_t shed_count() const noexcept {
+        return 0;
+    }
+
+    [[nodiscard]]
+    constexpr bool has_shed() const noexcept {
+        return false;
+    }
+
+    template<class F>
+    constexpr std::size_t drain_events(F&&) const noexcept {
+        return 0;
+    }
+};
+
+} // namespace wirekrak::core::protocol
@@ -0,0 +1,72 @@
+#pragma once
+
+/*
+===============================================================================
+PollQuota - Per-message-type delivery quotas for one poll() cycle
+===============================================================================
+
+Tracks how many messages of each quota-limited type were delivered during the
+current poll() and flags when any quota is reached. Built from the `quotas`
+list of a PollBudgetPolicy (see policy::protocol::message_quota).
+
+Zero cost when no quotas are configured (empty specialization).
+
+===============================================================================
+*/
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "wirekrak/core/meta/type_list.hpp"
+
+namespace wirekrak::core::protocol {
+
+template<class QuotaList>
+class PollQuota;
+
+template<class... Quotas>
+class PollQuota<meta::type_list<Quotas...>> {
+public:
+    inline void reset() noexcept {
+        counts_.fill(0);
+        exhausted_ = false;
+    }
+
+    template<class Msg>
+    inline void on_delivered() noexcept {
+        on_delivered_<Msg>(std::index_sequence_for<Quotas...>{});
+    }
+
+    [[nodiscard]]
+    inline bool exhausted() const noexcept {
+        return exhausted_;
+    }
+
+private:
+    std::array<std::size_t, sizeof...(Quotas)> counts_{};
+    bool exhausted_{false};
+
+    template<class Msg, std::size_t... I>
+    inline void on_delivered_(std::index_sequence<I...>) noexcept {
+        ((std::is_same_v<Msg, typename Quotas::message> && ++counts_[I] >= Quotas::limit
+            ? void(exhausted_ = true) : void()), ...);
+    }
+};
+
+template<>
+class PollQuota<meta::type_list<>> {
+public:
+    inline void reset() noexcept {}
+
+    template<class Msg>
+    inline void on_delivered() noexcept {}
+
+    [[nodiscard]]
+    constexpr bool exhausted() const noexcept {
+        return false;
+    }
+};
+
+} // namespace wirekrak::core::protocol
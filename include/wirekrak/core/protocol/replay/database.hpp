@@ -89,6 +89,12 @@
 // • take_subscriptions<RequestT>()
 //     Transfers all replayable subscriptions of a given type
 //
+// • set_resume_without_snapshot<RequestT>(symbol, enabled)
+//     Marks a symbol whose replay may skip the snapshot
+//
+// • begin_resync / complete_resync / cancel_resync
+//     Per-symbol time-to-resync bookkeeping (replay emission -> ACK)
+//
 // • clear_all()
 //     Drops all stored protocol intent (e.g. shutdown)
 //
@@ -166,6 +172,15 @@ public:
         table_<DomainT>().erase_symbol(symbol);
     }
 
+    // ------------------------------------------------------------
+    // Stored request owning a symbol (nullptr if not replayable)
+    // ------------------------------------------------------------
+    template<class DomainT>
+    [[nodiscard]]
+    inline const DomainT* find_request(Symbol symbol) const noexcept {
+        return table_<DomainT>().find_request(symbol);
+    }
+
     // ------------------------------------------------------------
     // Process rejection across all tables
     // ------------------------------------------------------------
@@ -189,10 +204,58 @@ public:
     // ------------------------------------------------------------
     template<class DomainT>
     [[nodiscard]]
-    inline std::vector<Subscription<DomainT>> take_subscriptions() noexcept {
+    inline std::vector<Subscription<DomainT>>& take_subscriptions() noexcept {
         return table_<DomainT>().take_subscriptions();
     }
 
+    // ------------------------------------------------------------
+    // Transfer buffer filled by the last take_subscriptions<DomainT>()
+    // ------------------------------------------------------------
+    template<class DomainT>
+    [[nodiscard]]
+    inline std::vector<Subscription<DomainT>>& taken_subscriptions() noexcept {
+        return table_<DomainT>().taken_subscriptions();
+    }
+
+    // ------------------------------------------------------------
+    // Snapshot-less resume
+    // ------------------------------------------------------------
+    template<class DomainT>
+    inline void set_resume_without_snapshot(Symbol symbol, bool enabled) noexcept {
+        table_<DomainT>().set_resume_without_snapshot(symbol, enabled);
+    }
+
+    template<class DomainT>
+    [[nodiscard]]
+    inline bool resumes_without_snapshot(Symbol symbol) const noexcept {
+        return table_<DomainT>().resumes_without_snapshot(symbol);
+    }
+
+    // ------------------------------------------------------------
+    // Time-to-resync
+    // ------------------------------------------------------------
+    template<class DomainT>
+    inline void begin_resync(Symbol symbol, std::uint64_t now_ns) noexcept {
+        table_<DomainT>().begin_resync(symbol, now_ns);
+    }
+
+    template<class DomainT>
+    [[nodiscard]]
+    inline std::uint64_t complete_resync(Symbol symbol, std::uint64_t now_ns) noexcept {
+        return table_<DomainT>().complete_resync(symbol, now_ns);
+    }
+
+    template<class DomainT>
+    inline void cancel_resync(Symbol symbol) noexcept {
+        table_<DomainT>().cancel_resync(symbol);
+    }
+
+    template<class DomainT>
+    [[nodiscard]]
+    inline std::size_t resyncing_symbols() const noexcept {
+        return table_<DomainT>().resyncing_symbols();
+    }
+
     // ------------------------------------------------------------
     // Clear all stored protocol intent
     // ------------------------------------------------------------
@@ -65,6 +65,13 @@ Lifecycle
 • take_subscriptions()
     Transfer all stored intent for replay after reconnect
 
+• set_resume_without_snapshot(symbol, enabled)
+    Mark a symbol whose replay may skip the snapshot (user preference,
+    kept across replays, dropped on unsubscribe / rejection)
+
+• begin_resync(symbol, now) / complete_resync(symbol, now)
+    Time-to-resync of a replayed symbol: replay emission to its ACK
+
 • clear()
     Drop all stored intent (shutdown / reset)
 
@@ -75,7 +82,9 @@ Threading & performance
 • Owned by the Session event loop
 • No blocking
 • Allocation-stable after warm-up
-• Linear scans are acceptable due to bounded subscription counts
+• Symbol ownership is dense (SymbolId-indexed): O(1) per symbol
+• take_subscriptions() reuses one transfer buffer across reconnects
+• No clock reads: resync timestamps are passed by the caller
 
 ===============================================================================
 */
@@ -83,12 +92,14 @@ Threading & performance
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 #include <cstdint>
 #include <utility>
 
 #include "wirekrak/core/protocol/replay/subscription.hpp"
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/symbol/intern.hpp"
+#include "wirekrak/core/symbol/set.hpp"
 #include "lcr/trap.hpp"
 
 
@@ -111,6 +122,9 @@ template<class RequestT>
 class Table {
 public:
     explicit Table()
+        : owner_(MAX_INTERNED_SYMBOLS, ctrl::INVALID_REQ_ID)
+        , resync_start_ns_(MAX_INTERNED_SYMBOLS, 0)
+        , last_resync_ns_(MAX_INTERNED_SYMBOLS, 0)
     {}
 
     // ------------------------------------------------------------
@@ -135,12 +149,7 @@ public:
                 symbols.begin(),
                 symbols.end(),
                 [&](const Symbol& symbol) {
-                    auto symbol_id = intern_symbol(symbol);
-                    auto it = symbol_owner_.find(symbol_id);
-                    if (it != symbol_owner_.end()) {
-                        return true; // drop from incoming request
-                    }
-                    return false;
+                    return owned_.contains(intern_symbol(symbol)); // drop from incoming request
                 }
             ),
             symbols.end()
@@ -157,7 +166,9 @@ public:
         // 4) Register ownership after successful insertion
         for (const auto& symbol : it->second.request().symbols) {
             SymbolId sid = intern_symbol(symbol);
-            symbol_owner_.emplace(sid, req_id);
+            if (owned_.insert(sid)) {
+                owner_[sid] = req_id;
+            }
         }
         return true;
     }
@@ -173,8 +184,7 @@ public:
             return false;
         }
         // 3) Remove the symbol track from the ownership map
-        SymbolId sid = intern_symbol(symbol);
-        symbol_owner_.erase(sid);
+        drop_symbol_(intern_symbol(symbol));
         // 4) If the subscription is now empty, remove it from the table
         if (it->second.empty()) {
             subscriptions_.erase(it);
@@ -191,22 +201,21 @@ public:
     inline void erase_symbol(Symbol symbol) noexcept {
         // 1) Find the req_id owning the symbol
         SymbolId sid = intern_symbol(symbol);
-        auto owner_it = symbol_owner_.find(sid);
-        if (owner_it == symbol_owner_.end()) {
+        if (!owned_.contains(sid)) {
             return;
         }
-        ctrl::req_id_t req_id = owner_it->second;
+        ctrl::req_id_t req_id = owner_[sid];
         // 2) Find the subscription by req_id
         auto sub_it = subscriptions_.find(req_id);
         if (sub_it == subscriptions_.end()) {
-            symbol_owner_.erase(owner_it);
+            drop_symbol_(sid);
             return;
         }
         // 3) Remove the symbol from the subscription
         bool removed = sub_it->second.erase_symbol(symbol);
         if (removed) {
             // 4) Remove the symbol track from the ownership map
-            symbol_owner_.erase(owner_it);
+            drop_symbol_(sid);
             // 5) If the subscription is now empty, remove it from the table
             if (sub_it->second.empty()) {
                 subscriptions_.erase(sub_it);
@@ -216,8 +225,83 @@ public:
 
     [[nodiscard]]
     inline bool contains_symbol(Symbol symbol) const noexcept {
+        return owned_.contains(intern_symbol(symbol));
+    }
+
+    // ------------------------------------------------------------
+    // Returns the stored request owning the symbol (nullptr if none)
+    // ------------------------------------------------------------
+    [[nodiscard]]
+    inline const RequestT* find_request(Symbol symbol) const noexcept {
+        SymbolId sid = intern_symbol(symbol);
+        if (!owned_.contains(sid)) {
+            return nullptr;
+        }
+        auto sub_it = subscriptions_.find(owner_[sid]);
+        return sub_it != subscriptions_.end() ? &sub_it->second.request() : nullptr;
+    }
+
+    // ------------------------------------------------------------
+    // Snapshot-less resume
+    // ------------------------------------------------------------
+    // Marked symbols are replayed with snapshot=false: the consumer accepts
+    // resuming from live updates instead of a fresh snapshot.
+    inline void set_resume_without_snapshot(Symbol symbol, bool enabled) noexcept {
+        SymbolId sid = intern_symbol(symbol);
+        if (enabled) {
+            (void)resume_without_snapshot_.insert(sid);
+        }
+        else {
+            (void)resume_without_snapshot_.erase(sid);
+        }
+    }
+
+    [[nodiscard]]
+    inline bool resumes_without_snapshot(Symbol symbol) const noexcept {
+        return !resume_without_snapshot_.empty() && resume_without_snapshot_.contains(intern_symbol(symbol));
+    }
+
+    // ------------------------------------------------------------
+    // Time-to-resync (replay emission -> ACK)
+    // ------------------------------------------------------------
+    inline void begin_resync(Symbol symbol, std::uint64_t now_ns) noexcept {
+        SymbolId sid = intern_symbol(symbol);
+        (void)resyncing_.insert(sid);
+        resync_start_ns_[sid] = now_ns;
+    }
+
+    // Returns the time-to-resync of the symbol, 0 if it was not resyncing
+    [[nodiscard]]
+    inline std::uint64_t complete_resync(Symbol symbol, std::uint64_t now_ns) noexcept {
         SymbolId sid = intern_symbol(symbol);
-        return symbol_owner_.find(sid) != symbol_owner_.end();
+        if (!resyncing_.erase(sid)) {
+            return 0;
+        }
+        const std::uint64_t start = resync_start_ns_[sid];
+        const std::uint64_t elapsed = now_ns > start ? now_ns - start : 1;
+        last_resync_ns_[sid] = elapsed;
+        return elapsed;
+    }
+
+    // Replay failed for the symbol (negative ACK): no resync to report
+    inline void cancel_resync(Symbol symbol) noexcept {
+        (void)resyncing_.erase(intern_symbol(symbol));
+    }
+
+    [[nodiscard]]
+    inline bool is_resyncing(Symbol symbol) const noexcept {
+        return !resyncing_.empty() && resyncing_.contains(intern_symbol(symbol));
+    }
+
+    [[nodiscard]]
+    inline std::size_t resyncing_symbols() const noexcept {
+        return resyncing_.size();
+    }
+
+    // Time-to-resync of the symbol after the last completed replay (0 if never)
+    [[nodiscard]]
+    inline std::uint64_t last_resync_ns(Symbol symbol) const noexcept {
+        return last_resync_ns_[intern_symbol(symbol)];
     }
 
     // ------------------------------------------------------------
@@ -231,7 +315,9 @@ public:
 
     inline void clear() noexcept {
         subscriptions_.clear();
-        symbol_owner_.clear();
+        owned_.clear();
+        resume_without_snapshot_.clear();
+        resyncing_.clear();
     }
 
     [[nodiscard]]
@@ -241,21 +327,31 @@ public:
 
     [[nodiscard]]
     inline size_t total_symbols() const noexcept {
-        return symbol_owner_.size();
+        return owned_.size();
     }
 
+    // The returned buffer is owned by the table and reused by the next call:
+    // the table itself may be refilled (replay) while the caller iterates it.
     [[nodiscard]]
-    inline std::vector<Subscription<RequestT>> take_subscriptions() noexcept {
-        // Prepare output vector
-        std::vector<Subscription<RequestT>> out;
-        out.reserve(subscriptions_.size());
+    inline std::vector<Subscription<RequestT>>& take_subscriptions() noexcept {
+        // Prepare output buffer (capacity kept across reconnects)
+        taken_.clear();
+        taken_.reserve(subscriptions_.size());
         // Move all subscriptions out of the table for replay
         for (auto& [_, sub] : subscriptions_) {
-            out.push_back(std::move(sub));
+            taken_.push_back(std::move(sub));
         }
         // Clear table state after moving out subscriptions
-        clear();
-        return out;
+        // (snapshot-less resume marks are preferences and survive replays)
+        subscriptions_.clear();
+        owned_.clear();
+        return taken_;
+    }
+
+    // Transfer buffer filled by the last take_subscriptions()
+    [[nodiscard]]
+    inline std::vector<Subscription<RequestT>>& taken_subscriptions() noexcept {
+        return taken_;
     }
 
 #ifndef NDEBUG
@@ -264,13 +360,41 @@ public:
         for (const auto& [_, sub] : subscriptions_) {
             symbol_count += sub.request().symbols.size();
         }
-        LCR_ASSERT_MSG(symbol_count == symbol_owner_.size(), "Symbol count must match symbol owner map size");
+        LCR_ASSERT_MSG(symbol_count == owned_.size(), "Symbol count must match symbol owner map size");
+        for (const auto& [req_id, sub] : subscriptions_) {
+            for (const auto& symbol : sub.request().symbols) {
+                SymbolId sid = intern_symbol(symbol);
+                LCR_ASSERT_MSG(owned_.contains(sid) && owner_[sid] == req_id, "Symbol must be owned by its subscription");
+            }
+        }
     }
 #endif
 
 private:
     std::unordered_map<ctrl::req_id_t, Subscription<RequestT>> subscriptions_;
-    std::unordered_map<SymbolId, ctrl::req_id_t> symbol_owner_;
+
+    // SymbolId -> owning req_id (valid while owned_)
+    SymbolSet owned_;
+    std::vector<ctrl::req_id_t> owner_;
+
+    // Transfer buffer for take_subscriptions()
+    std::vector<Subscription<RequestT>> taken_;
+
+    // Symbols replayed without snapshot
+    SymbolSet resume_without_snapshot_;
+
+    // Replayed symbols awaiting their ACK, SymbolId -> replay emission time
+    SymbolSet resyncing_;
+    std::vector<std::uint64_t> resync_start_ns_;
+    std::vector<std::uint64_t> last_resync_ns_;
+
+private:
+    // Symbol intent removed (unsubscribe / rejection)
+    inline void drop_symbol_(SymbolId sid) noexcept {
+        owned_.erase(sid);
+        resume_without_snapshot_.erase(sid);
+        resyncing_.erase(sid);
+    }
 };
 
 } // namespace replay
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "lcr/trap.hpp"
+
+
+namespace wirekrak::core::protocol::request {
+
+/*
+===============================================================================
+AdaptivePacer (Adaptive batching mode)
+===============================================================================
+
+Decides when the next request batch may be emitted, from time and exchange
+feedback instead of poll() counts.
+
+Two gates, both must pass:
+
+  Token bucket (rate limit)
+    - Refills Policy::rate_per_sec tokens per second, up to Policy::burst
+    - One token per batch
+    - Time-based: independent of how often poll() is called
+
+  In-flight window (ack feedback)
+    - At most `window` batches awaiting their ACKs
+    - Starts at 1 and grows by one per completed batch (doubles per RTT)
+      until the first congestion signal, then by one per window of
+      completed batches (additive increase), up to Policy::max_in_flight
+    - Growth holds while the batch RTT exceeds twice the minimum seen
+      (the exchange is queueing our requests)
+    - A failed ACK or rejection halves the window and empties the bucket
+      (batches with a failed symbol do not grow the window);
+      failures of batches sent before that reduction are not counted
+      again (one reduction per round trip)
+    - A rejection of a whole request (no symbol, e.g. rate limiting)
+      fails and completes the oldest batch at once
+    - A batch without complete feedback after the retransmission timeout
+      (RTO = srtt + 4 × rttvar, clamped to [200 ms, 60 s], 1 s before the
+      first sample, doubled per expiry) is expired as congestion, so a lost
+      ACK cannot pin the window
+
+Feedback attribution
+--------------------
+Batches complete in emission order: each symbol-level ACK or rejection is
+charged to the oldest in-flight batch, which completes after one feedback
+per symbol. Feedback with nothing in flight (requests not emitted by the
+pacer) is ignored. Late feedback of an expired batch is charged to the next
+one (completing it early at worst).
+
+Properties
+----------
+  - No allocation (fixed in-flight ring), no clock reads (caller passes now)
+  - Not thread-safe (session thread only)
+
+===============================================================================
+*/
+template<class Policy>
+class AdaptivePacer {
+    static constexpr std::uint64_t NS_PER_SEC = 1'000'000'000ULL;
+    static constexpr std::uint64_t TOKEN      = NS_PER_SEC;          // fixed-point token unit
+    static constexpr std::uint64_t BUCKET_CAP = Policy::burst * TOKEN;
+    static constexpr std::size_t   MAX_IN_FLIGHT = Policy::max_in_flight;
+
+    // Retransmission timeout bounds (RFC 6298 style)
+    static constexpr std::uint64_t INITIAL_RTO_NS = NS_PER_SEC;
+    static constexpr std::uint64_t MIN_RTO_NS     = 200'000'000ULL;
+    static constexpr std::uint64_t MAX_RTO_NS     = 60 * NS_PER_SEC;
+
+    static_assert(Policy::rate_per_sec > 0 && Policy::burst > 0 && MAX_IN_FLIGHT > 0);
+
+public:
+    AdaptivePacer() noexcept {
+        reset();
+    }
+
+    // True if a batch may be emitted at now_ns
+    [[nodiscard]]
+    inline bool can_send(std::uint64_t now_ns) noexcept {
+        expire_(now_ns);
+        if (count_ >= window_) {
+            return false;
+        }
+        refill_(now_ns);
+        return tokens_ >= TOKEN;
+    }
+
+    // A batch of `symbols` symbols was emitted at now_ns
+    inline void on_sent(std::uint64_t now_ns, std::uint32_t symbols) noexcept {
+        LCR_ASSERT_MSG(count_ < MAX_IN_FLIGHT, "AdaptivePacer::on_sent() beyond the in-flight window");
+        tokens_ = tokens_ >= TOKEN ? tokens_ - TOKEN : 0;
+        in_flight_[(head_ + count_) % MAX_IN_FLIGHT] = Batch{ now_ns, std::max<std::uint32_t>(symbols, 1), false };
+        ++count_;
+    }
+
+    // Feedback for one symbol of the oldest in-flight batch.
+    // Returns the batch round-trip time when this completes it, 0 otherwise.
+    [[nodiscard]]
+    inline std::uint64_t on_ack(std::uint64_t now_ns, bool success) noexcept {
+        if (count_ == 0) {
+            return 0;
+        }
+        Batch& batch = in_flight_[head_];
+        if (!success) [[unlikely]] {
+            batch.failed = true;
+            on_congestion_(now_ns, batch.sent_ns);
+        }
+        if (--batch.remaining > 0) {
+            return 0;
+        }
+        const std::uint64_t rtt = std::max<std::uint64_t>(now_ns - batch.sent_ns, 1);
+        const bool grow = !batch.failed;
+        head_ = (head_ + 1) % MAX_IN_FLIGHT;
+        --count_;
+        on_batch_completed_(rtt, grow);
+        return rtt;
+    }
+
+    // Rejection of a whole request (no symbol): fails and completes the
+    // oldest in-flight batch. Returns its round-trip time, 0 if none.
+    [[nodiscard]]
+    inline std::uint64_t on_batch_rejected(std::uint64_t now_ns) noexcept {
+        if (count_ == 0) {
+            return 0;
+        }
+        Batch& batch = in_flight_[head_];
+        on_congestion_(now_ns, batch.sent_ns);
+        const std::uint64_t rtt = std::max<std::uint64_t>(now_ns - batch.sent_ns, 1);
+        head_ = (head_ + 1) % MAX_IN_FLIGHT;
+        --count_;
+        on_batch_completed_(rtt, false);
+        return rtt;
+    }
+
+    // Connection lost: in-flight batches will never be acknowledged
+    inline void reset() noexcept {
+        window_ = 1;
+        ssthresh_ = MAX_IN_FLIGHT;
+        acked_in_window_ = 0;
+        head_ = 0;
+        count_ = 0;
+        tokens_ = BUCKET_CAP;
+        last_refill_ns_ = 0;
+        recovery_start_ns_ = 0;
+        srtt_ns_ = 0;
+        rttvar_ns_ = 0;
+        rto_ns_ = INITIAL_RTO_NS;
+        min_rtt_ns_ = std::numeric_limits<std::uint64_t>::max();
+    }
+
+    // -------------------------------------------------------------------------
+    // Introspection
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]]
+    inline std::size_t window() const noexcept {
+        return window_;
+    }
+
+    [[nodiscard]]
+    inline std::size_t in_flight() const noexcept {
+        return count_;
+    }
+
+    // Smoothed batch round-trip time (0 until the first batch completes)
+    [[nodiscard]]
+    inline std::uint64_t srtt_ns() const noexcept {
+        return srtt_ns_;
+    }
+
+    // Current retransmission timeout of the oldest in-flight batch
+    [[nodiscard]]
+    inline std::uint64_t rto_ns() const noexcept {
+        return rto_ns_;
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t congestion_events() const noexcept {
+        return congestion_events_;
+    }
+
+    // Batches expired without complete feedback
+    [[nodiscard]]
+    inline std::uint64_t timeouts() const noexcept {
+        return timeouts_;
+    }
+
+private:
+    struct Batch {
+        std::uint64_t sent_ns = 0;
+        std::uint32_t remaining = 0;    // symbol feedback still expected
+        bool failed = false;            // at least one symbol failed (no window growth)
+    };
+
+    // In-flight window
+    std::size_t window_;
+    std::size_t ssthresh_;
+    std::size_t acked_in_window_;
+    std::array<Batch, MAX_IN_FLIGHT> in_flight_{};
+    std::size_t head_;
+    std::size_t count_;
+
+    // Token bucket (fixed point, TOKEN units per token)
+    std::uint64_t tokens_;
+    std::uint64_t last_refill_ns_;
+
+    // Feedback
+    std::uint64_t recovery_start_ns_;
+    std::uint64_t srtt_ns_;
+    std::uint64_t rttvar_ns_;
+    std::uint64_t rto_ns_;
+    std::uint64_t min_rtt_ns_;
+    std::uint64_t congestion_events_ = 0;
+    std::uint64_t timeouts_ = 0;
+
+private:
+    inline void refill_(std::uint64_t now_ns) noexcept {
+        if (last_refill_ns_ == 0 || now_ns <= last_refill_ns_) [[unlikely]] {
+            last_refill_ns_ = std::max(last_refill_ns_, now_ns);
+            return;
+        }
+        const std::uint64_t elapsed = now_ns - last_refill_ns_;
+        last_refill_ns_ = now_ns;
+        if (elapsed >= BUCKET_CAP / Policy::rate_per_sec) {
+            tokens_ = BUCKET_CAP;
+        }
+        else {
+            tokens_ = std::min(BUCKET_CAP, tokens_ + elapsed * Policy::rate_per_sec);
+        }
+    }
+
+    inline void on_congestion_(std::uint64_t now_ns, std::uint64_t batch_sent_ns) noexcept {
+        if (batch_sent_ns < recovery_start_ns_) {
+            return; // already reacted to this round trip
+        }
+        ++congestion_events_;
+        ssthresh_ = std::max<std::size_t>(window_ / 2, 1);
+        window_ = ssthresh_;
+        acked_in_window_ = 0;
+        tokens_ = 0;
+        last_refill_ns_ = std::max(last_refill_ns_, now_ns);
+        recovery_start_ns_ = now_ns;
+    }
+
+    // Expires the batches older than the RTO as congestion
+    inline void expire_(std::uint64_t now_ns) noexcept {
+        while (count_ > 0) {
+            const Batch& batch = in_flight_[head_];
+            if (now_ns - std::min(now_ns, batch.sent_ns) < rto_ns_) {
+                return;
+            }
+            ++timeouts_;
+            on_congestion_(now_ns, batch.sent_ns);
+            head_ = (head_ + 1) % MAX_IN_FLIGHT;
+            --count_;
+            rto_ns_ = std::min(2 * rto_ns_, MAX_RTO_NS);   // back off until the next sample
+        }
+    }
+
+    inline void on_batch_completed_(std::uint64_t rtt, bool grow) noexcept {
+        if (srtt_ns_ == 0) {
+            srtt_ns_ = rtt;
+            rttvar_ns_ = rtt / 2;
+        }
+        else {
+            const std::uint64_t deviation = srtt_ns_ > rtt ? srtt_ns_ - rtt : rtt - srtt_ns_;
+            rttvar_ns_ = (3 * rttvar_ns_ + deviation) / 4;
+            srtt_ns_ = (7 * srtt_ns_ + rtt) / 8;
+        }
+        rto_ns_ = std::clamp(srtt_ns_ + 4 * rttvar_ns_, MIN_RTO_NS, MAX_RTO_NS);
+        min_rtt_ns_ = std::min(min_rtt_ns_, rtt);
+
+        if (!grow || window_ >= MAX_IN_FLIGHT || rtt > 2 * min_rtt_ns_) {
+            return;
+        }
+        if (window_ < ssthresh_) {
+            ++window_;              // slow start
+        }
+        else if (++acked_in_window_ >= window_) {
+            acked_in_window_ = 0;
+            ++window_;              // additive increase
+        }
+    }
+};
+
+} // namespace wirekrak::core::protocol::request
@@ -2,12 +2,17 @@
 
 #include <string_view>
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
 
 #include "wirekrak/core/config/protocol.hpp"
 #include "wirekrak/core/policy/protocol/batching.hpp"
 #include "wirekrak/core/protocol/concept/json_writable.hpp"
+#include "wirekrak/core/protocol/request/pacer.hpp"
 #include "lcr/local/raw_buffer.hpp"
 #include "lcr/local/ring.hpp"
+#include "lcr/system/monotonic_clock.hpp"
 
 namespace wirekrak::core::protocol::request {
 
@@ -17,6 +22,8 @@ template<
     std::size_t MaxPayload    = config::protocol::TX_BATCH_BUFFER_CAPACITY
 >
 class Scheduler {
+    static constexpr bool adaptive = Policy::mode == policy::protocol::BatchingMode::Adaptive;
+
 public:
 
     using buffer_type = lcr::local::raw_buffer<MaxPayload>;
@@ -27,8 +34,9 @@ public:
     // Poll hook
     // ---------------------------------------------------------------------
 
-    inline void poll() noexcept {
+    inline void poll(std::uint64_t now_ns) noexcept {
         ++poll_counter_;
+        now_ns_ = now_ns;
     }
 
     // ---------------------------------------------------------------------
@@ -51,9 +59,53 @@ public:
             poll_counter_ = 0;
             return true;
         }
+        else if constexpr (adaptive) {
+            return pacer_.can_send(now_ns_);
+        }
         return false;
     }
 
+    // ---------------------------------------------------------------------
+    // Exchange feedback (Adaptive mode, no-ops otherwise)
+    // ---------------------------------------------------------------------
+
+    // The batch returned by peek() was sent (call before release())
+    inline void on_emitted() noexcept {
+        if constexpr (adaptive) {
+            pacer_.on_sent(now_ns_, symbols_[queue_head_]);
+        }
+    }
+
+    // Symbol-level ACK / rejection. Returns the completed batch RTT (ns) or 0.
+    [[nodiscard]]
+    inline std::uint64_t on_ack(bool success) noexcept {
+        if constexpr (adaptive) {
+            return pacer_.on_ack(lcr::system::monotonic_clock::instance().now_ns(), success);
+        }
+        return 0;
+    }
+
+    // Rejection of a whole request (no symbol). Returns the batch RTT (ns) or 0.
+    [[nodiscard]]
+    inline std::uint64_t on_batch_rejected() noexcept {
+        if constexpr (adaptive) {
+            return pacer_.on_batch_rejected(lcr::system::monotonic_clock::instance().now_ns());
+        }
+        return 0;
+    }
+
+    // Connection lost: forget in-flight batches
+    inline void on_disconnect() noexcept {
+        if constexpr (adaptive) {
+            pacer_.reset();
+        }
+    }
+
+    [[nodiscard]]
+    inline const auto& pacer() const noexcept requires adaptive {
+        return pacer_;
+    }
+
     // ---------------------------------------------------------------------
     // Enqueue batch request
     // ---------------------------------------------------------------------
@@ -72,6 +124,10 @@ public:
             return false;
         }
         slot->set_size(size);
+        if constexpr (adaptive) {
+            symbols_[queue_tail_] = static_cast<std::uint32_t>(req.symbols.size());
+            queue_tail_ = (queue_tail_ + 1) % QueueCapacity;
+        }
         queue_.commit_producer_slot();
         return true;
     }
@@ -92,22 +148,37 @@ public:
     }
 
     void release() noexcept {
+        if constexpr (adaptive) {
+            queue_head_ = (queue_head_ + 1) % QueueCapacity;
+        }
         queue_.release_consumer_slot();
     }
 
 private:
 
     std::size_t poll_counter_{0};
+    std::uint64_t now_ns_{0};
     lcr::local::ring<buffer_type, QueueCapacity> queue_;
 
+    // Adaptive mode: symbols per queued batch (mirrors queue_ order) and the pacer
+    struct Empty {};
+    [[no_unique_address]] std::conditional_t<adaptive, std::array<std::uint32_t, QueueCapacity>, Empty> symbols_{};
+    std::size_t queue_head_{0};
+    std::size_t queue_tail_{0};
+    [[no_unique_address]] std::conditional_t<adaptive, AdaptivePacer<Policy>, Empty> pacer_{};
+
 };
 
 
 
 struct NullScheduler {
-    inline void poll() noexcept {}
+    inline void poll(std::uint64_t) noexcept {}
     [[nodiscard]] inline bool idle() const noexcept { return true; }
     [[nodiscard]] inline bool should_send() noexcept { return false; }
+    inline void on_emitted() noexcept {}
+    [[nodiscard]] inline std::uint64_t on_ack(bool) noexcept { return 0; }
+    [[nodiscard]] inline std::uint64_t on_batch_rejected() noexcept { return 0; }
+    inline void on_disconnect() noexcept {}
 
     template<typename T>
     [[nodiscard]] bool enqueue(const T&) noexcept { return true; }
@@ -54,6 +54,7 @@ Data-plane model:
 ===============================================================================
 */
 
+#include <algorithm>
 #include <string_view>
 #include <functional>
 #include <chrono>
@@ -71,11 +72,16 @@ Data-plane model:
 #include "wirekrak/core/protocol/subscription/controller.hpp"
 #include "wirekrak/core/protocol/replay/database.hpp"
 #include "wirekrak/core/protocol/model_concepts.hpp"
+#include "wirekrak/core/protocol/poll_quota.hpp"
+#include "wirekrak/core/protocol/load_shedder.hpp"
+#include "wirekrak/core/protocol/symbol_traits.hpp"
 #include "wirekrak/core/protocol/data/data_plane.hpp"
+#include "wirekrak/core/protocol/data/fanout_data_plane.hpp"
 #include "wirekrak/core/policy/protocol/session_bundle.hpp"
 #include "wirekrak/core/policy/transport/connection_bundle.hpp"
 #include "wirekrak/core/config/protocol.hpp"
 #include "wirekrak/core/config/backpressure.hpp"
+#include "wirekrak/core/perf/alloc_trace.hpp"
 #include "lcr/memory/footprint.hpp"
 #include "lcr/local/raw_buffer.hpp"
 #include "lcr/local/queue.hpp"
@@ -84,7 +90,6 @@ Data-plane model:
 #include "lcr/buffer/concepts.hpp"
 #include "lcr/sequence.hpp"
 #include "lcr/metrics/util/scope_timer.hpp"
-#include "lcr/system/thread_affinity.hpp"
 #include "lcr/log/logger.hpp"
 #include "lcr/trap.hpp"
 
@@ -104,6 +109,7 @@ public:
 
     using SubscriptionModel = typename ProtocolModel::subscription_model;
     using MessageHandler    = typename ProtocolModel::message_handler;
+    using MessageList       = typename ProtocolModel::messages;
 
     template<class T>
     using domain_t = typename SubscriptionModel::template subscription_type_t<T>;
@@ -124,12 +130,21 @@ public:
         inline void on_subscribe_ack(req_id_t req_id, const Symbol& symbol, bool success) noexcept {
             session_.subscription_controller_.template
                 process_subscribe_ack<Domain>(req_id, symbol, success);
+            session_.on_request_feedback_(success);
+            session_.template on_replay_ack_<Domain>(symbol, success);
+            if constexpr (Session::SheddingPolicy::enabled) {
+                // A shed symbol is resynced once its resubscribe is acknowledged
+                if (session_.load_shedder_.on_resubscribe_ack(intern_symbol(symbol.view())) && success) {
+                    WK_TL1( session_.telemetry_.resynced_symbols_total.inc() );
+                }
+            }
         }
 
         template<class Domain>
         inline void on_unsubscribe_ack(req_id_t req_id, const Symbol& symbol, bool success) noexcept {
             session_.subscription_controller_.template
                 process_unsubscribe_ack<Domain>(req_id, symbol, success);
+            session_.on_request_feedback_(success);
 
             if constexpr (Session::ReplayPolicy::enabled) {
                 if (success) {
@@ -143,6 +158,11 @@ public:
             session_.handle_rejection_(req_id, symbol);
         }
 
+        // Rejection without symbol: the whole request failed
+        inline void on_request_rejected(req_id_t req_id) noexcept {
+            session_.handle_request_rejection_(req_id);
+        }
+
         // ============================================================
         // DATA PLANE
         // ============================================================
@@ -150,9 +170,25 @@ public:
         template<class Message>
         [[nodiscard]]
         inline bool push(Message&& msg) noexcept {
-            return session_.data_plane_.template push<std::decay_t<Message>>(
-                std::forward<Message>(msg)
-            );
+            if constexpr (Session::SheddingPolicy::enabled) {
+                if (!session_.admit_shedding_(msg)) [[unlikely]] {
+                    WK_TL1( session_.telemetry_.shed_dropped_messages_total.inc() );
+                    return true; // Stale symbol: consumed, not delivered
+                }
+            }
+            session_.poll_quota_.template on_delivered<std::decay_t<Message>>();
+            if constexpr (Session::ConflationPolicy::enabled && !Session::FanoutPolicy::enabled) {
+                const auto r = session_.data_plane_.offer(std::forward<Message>(msg));
+                if (r == data::PushResult::Conflated) [[unlikely]] {
+                    WK_TL1( session_.telemetry_.conflated_messages_total.inc() );
+                }
+                return r != data::PushResult::Rejected;
+            }
+            else {
+                return session_.data_plane_.template push<std::decay_t<Message>>(
+                    std::forward<Message>(msg)
+                );
+            }
         }
 
         template<class State>
@@ -181,7 +217,6 @@ public:
         , connection_(ring, telemetry_.connection)
         , ctx_(*this)
     {
-        lcr::system::pin_thread(4); // Pin session thread to core 1 for deterministic performance
     }
 
     // open connection
@@ -235,6 +270,8 @@ public:
             return ctrl::INVALID_REQ_ID;
         }
         WK_TL1(telemetry_.subscriptions_requested_total.inc());
+        notify_subscribe_(req);
+        begin_ramp_();
         return req.req_id.value();
     }
 
@@ -255,6 +292,9 @@ public:
             return ctrl::INVALID_REQ_ID;
         }
         WK_TL1(telemetry_.unsubscriptions_requested_total.inc());
+        if constexpr (requires { handler_.on_unsubscribe(req); }) {
+            handler_.on_unsubscribe(req);
+        }
         // 3) Tell subscription manager we are awaiting an ACK (transfer ownership of symbols)
         RequestSymbols cancelled =
         subscription_controller_.template
@@ -269,6 +309,26 @@ public:
         return req.req_id.value();
     }
 
+    // ============================================================================
+    // Snapshot-less resume
+    // ============================================================================
+    //
+    // Marks a symbol whose subscription may resume without a snapshot after a
+    // reconnect: replay re-subscribes it with snapshot=false, ahead of the
+    // snapshot-bearing requests. Use it for consumers that tolerate a gap
+    // (e.g. trade tape) to shrink the post-reconnect snapshot flood.
+    //
+    // The mark is kept across reconnects and dropped when the symbol is
+    // unsubscribed or rejected.
+    //
+    template <request::Subscription RequestT>
+    inline void resume_without_snapshot(const Symbol& symbol, bool enabled = true) noexcept {
+        static_assert(ReplayPolicy::enabled, "Snapshot-less resume requires replay to be enabled");
+        static_assert(requires(RequestT r) { r.snapshot = false; }, "Request type has no snapshot option");
+        replay_db_.template
+            set_resume_without_snapshot<domain_t<RequestT>>(symbol, enabled);
+    }
+
     // ============================================================================
     // Control-plane send (stateless requests)
     // ============================================================================
@@ -336,7 +396,10 @@ public:
             last_poll_ns_ = now;
         );
 
+        WK_ALLOC_THREAD(Session);
+
         // === Advance transport state - Heartbeat liveness & reconnection logic ===
+        WK_ALLOC_STAGE(Transport);
         connection_.poll();
 
         // Observability: track control plane pressure (ring size) at each poll
@@ -362,7 +425,11 @@ public:
         );
 
         // === Drain transport data-plane (zero-copy) ===
-        while (messages_processed < config::protocol::MAX_MESSAGES_PER_POLL) {
+        // Bounded by the poll budget policy (message count, optional time budget and per-type quotas)
+        WK_ALLOC_STAGE(Parse);
+        [[maybe_unused]] const std::uint64_t poll_deadline_ns = poll_deadline_ns_(clock);
+        poll_quota_.reset();
+        while (messages_processed < PollBudgetPolicy::max_messages) {
             auto* slot = connection_.peek_message();
             if (!slot) [[unlikely]] { // No more messages to process
 /*
@@ -416,6 +483,18 @@ public:
                 }
             );
             ++messages_processed;
+            // Time budget: bound the control-plane latency between polls regardless of message cost
+            if constexpr (PollBudgetPolicy::mode == policy::protocol::PollBudgetMode::Deadline) {
+                if (clock.now_ns() >= poll_deadline_ns) [[unlikely]] {
+                    WK_TL1( telemetry_.poll_budget_exhausted_total.inc() );
+                    break;
+                }
+            }
+            // Per-type quotas
+            if (poll_quota_.exhausted()) [[unlikely]] {
+                WK_TL1( telemetry_.poll_quota_exhausted_total.inc() );
+                break;
+            }
         }
 
         // Observability: track data plane pressure (messages processed per poll)
@@ -428,26 +507,45 @@ public:
         // ===============================================================================
         // Batching logic for user requests
         // ===============================================================================
-        if constexpr (BatchingPolicy::mode == policy::protocol::BatchingMode::Paced) {
-            request_scheduler_.poll();
-            if (!request_scheduler_.idle() && request_scheduler_.should_send()) {
+        WK_ALLOC_STAGE(Requests);
+        if constexpr (policy::protocol::is_scheduled_batching_v<BatchingPolicy>) {
+            request_scheduler_.poll(clock.now_ns());
+            // Paced: at most one batch per poll. Adaptive: as many as the pacer admits.
+            while (!request_scheduler_.idle() && request_scheduler_.should_send()) {
                 std::string_view msg;
-                if (request_scheduler_.peek(msg)) {
-                    WK_TRACE("[SESSION] Emitting paced request: " << msg);
-                    if (connection_.send(msg)) [[likely]] {
-                        WK_TL1( telemetry_.requests_emitted_total.inc() );
-                    }
-                    else {
-                        WK_ERROR("[SESSION] Failed to send paced request - " << msg);
-                    }
-                    request_scheduler_.release();
+                if (!request_scheduler_.peek(msg)) [[unlikely]] {
+                    break;
+                }
+                WK_TRACE("[SESSION] Emitting paced request: " << msg);
+                if (connection_.send(msg)) [[likely]] {
+                    request_scheduler_.on_emitted();
+                    WK_TL1( telemetry_.requests_emitted_total.inc() );
+                }
+                else {
+                    WK_ERROR("[SESSION] Failed to send paced request - " << msg);
+                }
+                request_scheduler_.release();
+                if constexpr (BatchingPolicy::mode == policy::protocol::BatchingMode::Paced) {
+                    break;
                 }
             }
         }
-        
+
+        // Time-to-full-subscription: every requested symbol acknowledged (or rejected)
+        if (ramp_start_ns_ != 0 && request_scheduler_.idle() && subscription_controller_.is_quiescent()) {
+            WK_TL1( telemetry_.subscription_ramp_duration.record_duration(clock.now_ns() - ramp_start_ns_) );
+            ramp_start_ns_ = 0;
+        }
+
+
         // Check for backpressure violations and enforce policy if needed
         enforce_backpressure_policy_();
 
+        // Observability: poll duration distribution (bounds worst-case ping / ack handling latency)
+        WK_TL3(
+            telemetry_.poll_latency.record(now, clock.now_ns());
+        );
+
         return connection_.epoch();
     }
 
@@ -484,6 +582,15 @@ public:
         return connection_.tx_messages();
     }
 
+    // True if the transport rings (websocket control events, data, or
+    // undelivered connection signals) hold work for poll().
+    // Cheap (three ring loads): used to skip idle sessions (see SessionGroup).
+    [[nodiscard]]
+    inline bool has_pending_input() noexcept {
+        return connection_.has_pending_control() || connection_.pending_messages() != 0
+            || connection_.pending_signals() != 0;
+    }
+
     // -----------------------------------------------------------------------------
     // Protocol quiescence indicator (strict, deterministic)
     // -----------------------------------------------------------------------------
@@ -650,6 +757,72 @@ public:
         return subscription_controller_.pending_symbols();
     }
 
+    // -----------------------------------------------------------------------------
+    // Readiness notification (see policy::transport::notification::EventFd)
+    // -----------------------------------------------------------------------------
+    //
+    // With a notifying transport, event_fd() is a pollable fd that becomes
+    // readable when the receive thread publishes a message or a control event.
+    // A process can register the fds of many sessions in one epoll set:
+    //
+    //   session.poll(); drain...;
+    //   if (session.prepare_wait()) {
+    //       epoll_wait(...);          // or session.wait(timeout)
+    //   }
+    //
+    // prepare_wait() re-arms the wake-up and returns false if work is already
+    // pending (poll again instead of sleeping). Liveness pings, reconnect
+    // backoff and paced requests still need poll(): bound the sleep with a
+    // timeout. event_fd() is -1 when notifications are disabled.
+    //
+    // -----------------------------------------------------------------------------
+    [[nodiscard]]
+    inline int event_fd() const noexcept {
+        return connection_.notification_fd();
+    }
+
+    [[nodiscard]]
+    inline bool prepare_wait() noexcept {
+        return connection_.prepare_wait();
+    }
+
+    // Sleeps until the transport publishes work or the timeout expires.
+    // Returns false on timeout (or if notifications are disabled).
+    inline bool wait(std::chrono::milliseconds timeout) noexcept {
+        if (!connection_.prepare_wait()) {
+            return connection_.notification_fd() >= 0;
+        }
+        return connection_.wait_notification(timeout);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Load shedding (see policy::protocol::LoadShedding)
+    // -----------------------------------------------------------------------------
+    //
+    // Symbols with a higher priority are shed last (default: 128). Shed symbols
+    // are stale until resynced; each transition is reported once through
+    // drain_shedding_events(). No-ops when shedding is disabled.
+    //
+    // -----------------------------------------------------------------------------
+    inline void set_symbol_priority(const Symbol& symbol, std::uint8_t priority) noexcept {
+        load_shedder_.set_priority(intern_symbol(symbol.view()), priority);
+    }
+
+    [[nodiscard]]
+    inline bool is_symbol_stale(const Symbol& symbol) const noexcept {
+        return load_shedder_.is_stale(intern_symbol(symbol.view()));
+    }
+
+    [[nodiscard]]
+    inline std::size_t shed_symbols() const noexcept {
+        return load_shedder_.shed_count();
+    }
+
+    template<class F>
+    inline std::size_t drain_shedding_events(F&& fn) {
+        return load_shedder_.drain_events(std::forward<F>(fn));
+    }
+
     [[nodiscard]]
     inline const auto& subscription_controller() const noexcept {
         return subscription_controller_;
@@ -670,6 +843,12 @@ public:
         return data_plane_;
     }
 
+    // Protocol handler (e.g. to attach handler-level sinks before connecting)
+    [[nodiscard]]
+    inline MessageHandler& message_handler() noexcept {
+        return handler_;
+    }
+
     [[nodiscard]]
     inline telemetry::Session& telemetry() noexcept {
         return telemetry_;
@@ -708,9 +887,22 @@ private:
     using SymbolLimitPolicy   = typename PolicyBundle::symbol_limit;
     using ReplayPolicy        = typename PolicyBundle::replay;
     using BatchingPolicy      = typename PolicyBundle::batching;
+    using FanoutPolicy        = typename PolicyBundle::fanout;
+    using ConflationPolicy    = typename PolicyBundle::conflation;
+    using PollBudgetPolicy    = typename PolicyBundle::poll_budget;
+    using SheddingPolicy      = typename PolicyBundle::shedding;
 
     // Asserts
     static_assert(BatchingPolicy::batch_size <= MAX_REQUEST_SYMBOLS);
+    static_assert(!(FanoutPolicy::enabled && ConflationPolicy::enabled) ||
+                  FanoutPolicy::slow_consumer == policy::protocol::SlowConsumerMode::Evict,
+        "With fan-out, conflation only serves evicted consumers (requires SlowConsumerMode::Evict)");
+    static_assert(!SheddingPolicy::enabled || ReplayPolicy::enabled,
+        "Load shedding resyncs from the replay database (replay must be enabled)");
+    static_assert(!SheddingPolicy::enabled || BackpressurePolicy::mode != core::policy::BackpressureMode::ZeroTolerance,
+        "Load shedding cannot act under ZeroTolerance backpressure (the transport closes on first overload)");
+    static_assert(!SheddingPolicy::enabled || SheddingPolicy::trigger_polls < BackpressurePolicy::escalation_threshold,
+        "Load shedding must trigger before the backpressure escalation threshold");
 
 private:
     // Sequence generator for request IDs
@@ -731,12 +923,15 @@ private:
     // Request scheduler for huge subscribe requests 
     using RequestSchedulerT =
         std::conditional_t<
-            BatchingPolicy::mode == policy::protocol::BatchingMode::Paced,
+            policy::protocol::is_scheduled_batching_v<BatchingPolicy>,
             request::Scheduler<BatchingPolicy>,
             request::NullScheduler
         >;
     RequestSchedulerT request_scheduler_;
 
+    // Start of the current subscription ramp (0 = none in progress)
+    std::uint64_t ramp_start_ns_{0};
+
     using SubscriptionController = subscription::Controller<
         ProgressPolicy,
         typename SubscriptionModel::types
@@ -749,12 +944,36 @@ private:
     >;
     ReplayDB replay_db_;
 
-    using DataPlaneT = data::DataPlane<
-        typename ProtocolModel::messages,
-        typename ProtocolModel::states
-    >;
+    // Data plane (single consumer by default, N consumers with fan-out enabled,
+    // optional per-symbol conflation for slow single consumers or for evicted
+    // fan-out consumers)
+    using DataPlaneT =
+        std::conditional_t<
+            FanoutPolicy::enabled,
+            data::FanoutDataPlane<
+                typename ProtocolModel::messages,
+                typename ProtocolModel::states,
+                FanoutPolicy,
+                ConflationPolicy
+            >,
+            data::DataPlane<
+                typename ProtocolModel::messages,
+                typename ProtocolModel::states,
+                ConflationPolicy
+            >
+        >;
     DataPlaneT data_plane_;
 
+    // Per-type delivery quotas for the current poll() cycle
+    PollQuota<typename PollBudgetPolicy::quotas> poll_quota_;
+
+    // Per-symbol load shedding state (priority, activity, stale symbols)
+    using LoadShedderT = LoadShedder<
+        std::conditional_t<SheddingPolicy::enabled, SheddingPolicy, policy::protocol::NoShedding>,
+        typename SubscriptionModel::types
+    >;
+    LoadShedderT load_shedder_;
+
     // Session context to pass to the protocol handler
     Context ctx_;
 
@@ -777,52 +996,116 @@ private:
 
 private:
     
+    template<class Clock>
+    [[nodiscard]]
+    static inline std::uint64_t poll_deadline_ns_([[maybe_unused]] Clock& clock) noexcept {
+        if constexpr (PollBudgetPolicy::mode == policy::protocol::PollBudgetMode::Deadline) {
+            return clock.now_ns() + PollBudgetPolicy::budget_ns;
+        }
+        else {
+            return 0;
+        }
+    }
+
     inline void handle_connect_() {
         WK_TRACE("[SESSION] handle connect (transport_epoch = " << transport_epoch() << ")");
+        if constexpr (requires { handler_.on_reconnect(); }) {
+            if (transport_epoch() > 1) {
+                handler_.on_reconnect();
+            }
+        }
         if constexpr (ReplayPolicy::enabled) {
             WK_DEBUG("[SESSION] Subscription replay is enabled (subscriptions will be re-sent after reconnect)");
             do_replay_();
+            // A fresh connection has no backlog: resync every shed symbol
+            if constexpr (SheddingPolicy::enabled) {
+                if (transport_epoch() > 1 && load_shedder_.has_shed()) {
+                    restore_shed_symbols_();
+                }
+            }
         }
         else {
             WK_DEBUG("[SESSION] Subscription replay is disabled (no subscriptions will be re-sent after reconnect)");
         }
     }
 
+    // Replay runs in two passes so that snapshot-less resumes are emitted
+    // (or queued, with scheduled batching) before any snapshot-bearing request:
+    //   1) restore intent, emit the snapshot-less part of each request
+    //   2) emit the remaining (snapshot) part of each request
+    // Every replayed symbol starts its time-to-resync clock at emission.
     inline void do_replay_() noexcept {
         // Replay subscriptions if this is a reconnect (epoch > 1)
         if (transport_epoch() > 1) {
+            const std::uint64_t now = lcr::system::monotonic_clock::instance().now_ns();
             replay_db_.for_each([&]<class T>() {
-                auto subs = replay_db_.template
-                    take_subscriptions<T>();
-                if (!subs.empty()) {
-                    for (const auto& sub : subs) {
-                        re_subscribe_(sub.request());
+                for (auto& sub : replay_db_.template take_subscriptions<T>()) {
+                    re_subscribe_(sub.request(), now);
+                }
+            });
+            replay_db_.for_each([&]<class T>() {
+                for (const auto& sub : replay_db_.template taken_subscriptions<T>()) {
+                    if (!sub.empty()) {
+                        emit_replay_(sub.request());
                     }
                 }
             });
         }
     }
 
+    // Restores the intent of one request and emits its snapshot-less part.
+    // On return, req.symbols holds the symbols still to be replayed.
     template <request::Subscription RequestT>
-    void re_subscribe_(RequestT req) {
+    void re_subscribe_(RequestT& req, std::uint64_t now_ns) {
         // 1) Register subscription with manager (internal filtering)
         auto accepted_symbols =
         subscription_controller_.template
             register_subscription<domain_t<RequestT>>(std::move(req.symbols), req.req_id.value());
-        if (accepted_symbols.empty()) {
+        // 2) Replace request symbols with accepted set
+        req.symbols = std::move(accepted_symbols);
+        if (req.symbols.empty()) {
             WK_TRACE("[SESSION] Re-subscription fully filtered by manager");
             return;
         }
-        // 2) Replace request symbols with accepted set
-        req.symbols = std::move(accepted_symbols);
         // 3) Register in replay DB using filtered request (only if replay enabled)
         if constexpr (ReplayPolicy::enabled) {
             replay_db_.template
                 add<domain_t<RequestT>>(req);
+            for (const auto& symbol : req.symbols) {
+                replay_db_.template
+                    begin_resync<domain_t<RequestT>>(symbol, now_ns);
+            }
+        }
+        // 4) Split off the symbols marked for snapshot-less resume
+        if constexpr (requires { req.snapshot = false; }) {
+            RequestT resume = req;
+            resume.symbols.clear();
+            resume.snapshot = false;
+            for (const auto& symbol : req.symbols) {
+                if (replay_db_.template resumes_without_snapshot<domain_t<RequestT>>(symbol)) {
+                    resume.symbols.push_back(symbol);
+                }
+            }
+            if (!resume.symbols.empty()) {
+                req.symbols.erase(
+                    std::remove_if(req.symbols.begin(), req.symbols.end(), [&](const Symbol& symbol) {
+                        return replay_db_.template resumes_without_snapshot<domain_t<RequestT>>(symbol);
+                    }),
+                    req.symbols.end()
+                );
+                WK_TL1(telemetry_.replay_snapshotless_symbols_total.inc(resume.symbols.size()));
+                emit_replay_(resume);
+            }
         }
+    }
+
+    template <request::Subscription RequestT>
+    void emit_replay_(const RequestT& req) {
         WK_DEBUG("[SESSION] Emitting re-subscribe message: " << req.symbols.size() << " symbol/s");
-        // 4) Emit the request according to the configured batching policy
+        // Emit the request according to the configured batching policy
         if (emit_request_(req)) {
+            notify_subscribe_(req);
+            begin_ramp_();
             WK_TL1(telemetry_.replay_requests_total.inc());
             WK_TL1(telemetry_.replay_symbols_total.inc(req.symbols.size()) );
         }
@@ -833,6 +1116,55 @@ private:
         // Clear runtime state
         subscription_controller_.clear_all();
         overload_state_.reset();
+        request_scheduler_.on_disconnect();
+        ramp_start_ns_ = 0;
+    }
+
+    // Optional handler hook (e.g. book store epochs)
+    template <request::Subscription RequestT>
+    inline void notify_subscribe_(const RequestT& req) noexcept {
+        if constexpr (requires { handler_.on_subscribe(req); }) {
+            handler_.on_subscribe(req);
+        }
+    }
+
+    inline void begin_ramp_() noexcept {
+        if (ramp_start_ns_ == 0) {
+            ramp_start_ns_ = lcr::system::monotonic_clock::instance().now_ns();
+        }
+    }
+
+    // Subscribe ACK of a replayed symbol: time-to-resync
+    template<class Domain>
+    inline void on_replay_ack_(const Symbol& symbol, bool success) noexcept {
+        if constexpr (ReplayPolicy::enabled) {
+            if (replay_db_.template resyncing_symbols<Domain>() == 0) [[likely]] {
+                return;
+            }
+            if (!success) {
+                replay_db_.template cancel_resync<Domain>(symbol);
+                return;
+            }
+            const std::uint64_t elapsed = replay_db_.template
+                complete_resync<Domain>(symbol, lcr::system::monotonic_clock::instance().now_ns());
+            WK_TL1(
+                if (elapsed != 0) {
+                    telemetry_.replay_resync_duration.record_duration(elapsed);
+                }
+            );
+            (void)elapsed;
+        }
+    }
+
+    // Symbol-level ACK / rejection: feeds the Adaptive pacer (no-op otherwise)
+    inline void on_request_feedback_(bool success) noexcept {
+        const std::uint64_t rtt = request_scheduler_.on_ack(success);
+        WK_TL1(
+            if (rtt != 0) {
+                telemetry_.request_batch_rtt.record_duration(rtt);
+            }
+        );
+        (void)rtt;
     }
 
     inline void handle_message_result_(MessageResult result, std::string_view raw_message) noexcept {
@@ -863,6 +1195,8 @@ private:
             if (ack.req_id.has()) [[likely]] {
                 subscription_controller_.template
                     process_subscribe_ack<domain_t<AckT>>(ack.req_id.value(), ack.symbol, ack.success);
+                on_request_feedback_(ack.success);
+                on_replay_ack_<domain_t<AckT>>(ack.symbol, ack.success);
             }
             else {
                 // TODO: Increment a metric for ACKs with missing req_id to monitor potential protocol issues
@@ -877,6 +1211,7 @@ private:
             if (ack.req_id.has()) [[likely]] {
                 subscription_controller_.template
                     process_unsubscribe_ack<domain_t<AckT>>(ack.req_id.value(), ack.symbol, ack.success);
+                on_request_feedback_(ack.success);
                 // Prevent replay of the cancelled symbol after reconnect (only if replay enabled)
                 if constexpr (ReplayPolicy::enabled) {
                     if (ack.success) {
@@ -895,12 +1230,25 @@ private:
         WK_TL1( telemetry_.rejection_notices_total.inc() );
         WK_WARN("[SESSION] Handling rejection notice for symbol {" << symbol << "} (req_id=" << req_id << ")");
         (void)subscription_controller_.try_process_rejection(req_id, symbol);
+        on_request_feedback_(false);
         // Try process rejection in replay DB to prevent replay of failed subscriptions after reconnect (only if replay enabled)
         if constexpr (ReplayPolicy::enabled) {
             (void)replay_db_.try_process_rejection(req_id, symbol);
         }
     }
 
+    inline void handle_request_rejection_(ctrl::req_id_t req_id) noexcept {
+        WK_TL1( telemetry_.rejection_notices_total.inc() );
+        WK_WARN("[SESSION] Handling rejection notice for request (req_id=" << req_id << ")");
+        const std::uint64_t rtt = request_scheduler_.on_batch_rejected();
+        WK_TL1(
+            if (rtt != 0) {
+                telemetry_.request_batch_rtt.record_duration(rtt);
+            }
+        );
+        (void)rtt;
+    }
+
     inline void handle_connection_signal_(transport::connection::Signal sig) noexcept {
         switch (sig) {
         case transport::connection::Signal::Connected:
@@ -938,11 +1286,99 @@ private:
 
     inline void enforce_backpressure_policy_() noexcept {
         overload_state_.next_frame();
+        if constexpr (SheddingPolicy::enabled) {
+            enforce_load_shedding_policy_();
+        }
         if (overload_state_.transport.is_active() && enforce_transport_backpressure_policy_()) [[unlikely]] {
             return; // If transport policy enforcement resulted in connection close, skip user policy to avoid redundant actions
         }
     }
 
+    // Sheds one batch every `trigger_polls` overloaded polls and resyncs the
+    // shed symbols once backpressure has been clear for `recovery_polls`.
+    inline void enforce_load_shedding_policy_() noexcept {
+        if (overload_state_.transport.is_active()) {
+            load_shedder_.on_overloaded_poll();
+            const std::uint32_t streak = overload_state_.transport.count();
+            if (streak >= SheddingPolicy::trigger_polls && (streak % SheddingPolicy::trigger_polls) == 0) [[unlikely]] {
+                shed_symbols_();
+            }
+        }
+        else if (load_shedder_.has_shed() && load_shedder_.on_clear_poll() >= SheddingPolicy::recovery_polls) [[unlikely]] {
+            restore_shed_symbols_();
+        }
+    }
+
+    inline void shed_symbols_() noexcept {
+        SymbolId victims[SheddingPolicy::batch_size];
+        const std::size_t n = load_shedder_.select(victims, [&](SymbolId id) {
+            const Symbol symbol{symbol_name(id)};
+            bool subscribed = false;
+            replay_db_.for_each([&]<class T>() {
+                subscribed = subscribed || replay_db_.template find_request<T>(symbol) != nullptr;
+            });
+            return subscribed;
+        });
+        for (std::size_t i = 0; i < n; ++i) {
+            const Symbol symbol{symbol_name(victims[i])};
+            replay_db_.for_each([&]<class T>() {
+                const T* owner = replay_db_.template find_request<T>(symbol);
+                if (owner == nullptr) {
+                    return;
+                }
+                // Keep the subscribe intent to resync later (unsubscribe drops it from replay)
+                T resync = *owner;
+                resync.symbols = RequestSymbols{symbol};
+                resync.req_id.reset();
+                auto cancel = SubscriptionModel::cancel_request(*owner, RequestSymbols{symbol});
+                load_shedder_.park(std::move(resync));
+                (void)unsubscribe(std::move(cancel));
+            });
+            load_shedder_.mark_shed(victims[i]);
+            WK_WARN("[SESSION] Load shedding: symbol {" << symbol << "} unsubscribed under sustained backpressure ("
+                << overload_state_.transport.count() << " consecutive overloaded polls)");
+            WK_TL1( telemetry_.shed_symbols_total.inc() );
+        }
+    }
+
+    inline void restore_shed_symbols_() noexcept {
+        const std::size_t restored = load_shedder_.restore([&](auto& req) {
+            using RequestT = std::decay_t<decltype(req)>;
+            // Wait for the unsubscribe ACK, otherwise the subscribe would only
+            // cancel the pending unsubscribe and no snapshot would follow
+            for (const auto& symbol : req.symbols) {
+                if (subscription_controller_.template manager_for<domain_t<RequestT>>().is_unsubscribing(intern_symbol(symbol.view()))) {
+                    return false;
+                }
+            }
+            WK_DEBUG("[SESSION] Load shedding: resubscribing {" << req.symbols.front() << "} for a fresh snapshot");
+            (void)subscribe(std::move(req));
+            return true;
+        });
+        (void)restored;
+    }
+
+    // Returns false if the message must be dropped (every symbol it carries
+    // is stale). Multi-symbol messages lose the entries of stale symbols only.
+    template<class Message>
+    [[nodiscard]]
+    inline bool admit_shedding_(Message& msg) noexcept {
+        using T = std::remove_const_t<Message>;
+        using traits = symbol_traits<T>;
+        if constexpr (traits::enabled) {
+            SymbolId id;
+            if (traits::key(msg, id)) [[likely]] {
+                return load_shedder_.on_message(id);
+            }
+            if constexpr (MultiSymbolMessage<T> && !std::is_const_v<Message>) {
+                return traits::retain(msg, [&](SymbolId sid) noexcept {
+                    return load_shedder_.on_message(sid);
+                });
+            }
+        }
+        return true;
+    }
+
     [[nodiscard]]
     inline bool enforce_transport_backpressure_policy_() noexcept {
         using core::policy::BackpressureMode;
@@ -0,0 +1,265 @@
+#pragma once
+
+/*
+===============================================================================
+SessionGroup - Several sessions polled from one thread
+===============================================================================
+
+When symbols are sharded over several connections, each connection keeps its
+own transport (receive) thread, but the session-level work (control plane,
+parsing, routing) of all of them can be driven by a single core:
+
+    SessionGroup group{ spot_a, spot_b, futures };   // heterogeneous sessions
+    SessionGroup paced{ GroupOptions{ .cycle_budget_ns = 50'000 }, spot_a, spot_b };
+
+    while (running) {
+        (void)group.poll();
+        group.for_each([&](auto& session) {
+            session.data_plane().drain_all(on_message);
+        });
+    }
+
+or through a SessionRunner (BusySpin / Backoff idle policies):
+
+    SessionRunner<decltype(group)> runner{ group, RunnerPlacement{ .core = 4 } };
+    runner.run([&](auto& g) { ... });
+
+Each poll() cycle:
+  1) Builds a readiness bitmap: bit i is set when session i has work in its
+     transport rings (Session::has_pending_input, three ring loads)
+  2) Polls the ready sessions in round-robin order, starting one position
+     after the previous cycle's start, so no session is systematically first.
+     Each Session::poll() is bounded by the session's own PollBudget policy
+  3) Optional group time budget (GroupOptions::cycle_budget_ns): once spent,
+     the cycle stops and the next one resumes at the first session not served
+  4) Every maintenance_interval_ns, all sessions are polled regardless of
+     input, so heartbeats, liveness, reconnect backoff and paced requests keep
+     running for quiet connections
+
+Threading:
+  • Not thread-safe. All member sessions are owned by the group thread.
+  • Sessions are referenced, not owned: they must outlive the group.
+
+===============================================================================
+*/
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#include "wirekrak/core/protocol/telemetry/session_group.hpp"
+#include "lcr/system/monotonic_clock.hpp"
+
+
+namespace wirekrak::core::protocol {
+
+// ------------------------------------------------------------
+// Group options
+// ------------------------------------------------------------
+
+struct GroupOptions {
+    // Period of the sweep polling every session (liveness, reconnect, pacing).
+    // Must stay well below the heartbeat / pacing intervals of the sessions.
+    std::uint64_t maintenance_interval_ns = 1'000'000;  // 1 ms
+
+    // Time budget of one poll() cycle (0 → visit every ready session).
+    // Checked after each session poll, so a cycle may overrun it by at most
+    // one Session::poll().
+    std::uint64_t cycle_budget_ns = 0;
+};
+
+
+template<class... Sessions>
+class SessionGroup {
+    static_assert(sizeof...(Sessions) > 0, "SessionGroup requires at least one session");
+    static_assert(sizeof...(Sessions) <= 64, "SessionGroup readiness bitmap holds up to 64 sessions");
+
+    static constexpr std::size_t N = sizeof...(Sessions);
+    static constexpr std::uint64_t ALL = (N == 64) ? ~std::uint64_t{0} : ((std::uint64_t{1} << N) - 1);
+
+    using SessionRefs = std::tuple<Sessions&...>;
+
+public:
+    explicit SessionGroup(Sessions&... sessions) noexcept
+        : sessions_(sessions...) {}
+
+    SessionGroup(GroupOptions options, Sessions&... sessions) noexcept
+        : sessions_(sessions...)
+        , options_(options) {}
+
+    SessionGroup(const SessionGroup&) = delete;
+    SessionGroup& operator=(const SessionGroup&) = delete;
+
+    // ------------------------------------------------------------
+    // Scheduling
+    // ------------------------------------------------------------
+
+    // Runs one group cycle. Returns the number of sessions polled.
+    inline std::size_t poll() {
+        auto& clock = lcr::system::monotonic_clock::instance();
+        const std::uint64_t now = clock.now_ns();
+
+        telemetry_.cycles_total.inc();
+
+        // Maintenance sweep: every session is due once, whatever its input
+        if (sweep_pending_ == 0 && now >= next_sweep_ns_) {
+            sweep_pending_ = ALL;
+        }
+
+        const std::uint64_t ready = ready_mask_() | sweep_pending_;
+        if (ready == 0) [[likely]] {
+            telemetry_.idle_cycles_total.inc();
+            telemetry_.skipped_polls_total.inc(N);
+            return 0;
+        }
+
+        const std::uint64_t deadline = options_.cycle_budget_ns
+            ? now + options_.cycle_budget_ns
+            : std::numeric_limits<std::uint64_t>::max();
+
+        // Round-robin: [cursor, N) first, then [0, cursor)
+        const std::size_t start = cursor_;
+        const std::uint64_t low = (std::uint64_t{1} << start) - 1;
+        std::size_t polled = 0;
+        std::size_t resume = (start + 1) % N;
+        bool exhausted = false;
+
+        for (std::uint64_t bits : { ready & ~low, ready & low }) {
+            while (bits != 0 && !exhausted) {
+                const std::size_t i = static_cast<std::size_t>(std::countr_zero(bits));
+                bits &= bits - 1;
+
+                POLL_TABLE[i](sessions_);
+                sweep_pending_ &= ~(std::uint64_t{1} << i);
+                ++polled;
+
+                if (options_.cycle_budget_ns && clock.now_ns() >= deadline) [[unlikely]] {
+                    exhausted = true;
+                    resume = (i + 1) % N;
+                }
+            }
+        }
+
+        cursor_ = resume;
+        if (exhausted) [[unlikely]] {
+            telemetry_.budget_exhausted_total.inc();
+        }
+        // A sweep cut by the budget completes over the following cycles
+        if (sweep_pending_ == 0 && now >= next_sweep_ns_) {
+            next_sweep_ns_ = now + options_.maintenance_interval_ns;
+            telemetry_.maintenance_sweeps_total.inc();
+        }
+
+        telemetry_.session_polls_total.inc(polled);
+        telemetry_.skipped_polls_total.inc(N - polled);
+        return polled;
+    }
+
+    // ------------------------------------------------------------
+    // Access to member sessions
+    // ------------------------------------------------------------
+
+    template<std::size_t I>
+    [[nodiscard]]
+    inline auto& get() noexcept {
+        return std::get<I>(sessions_);
+    }
+
+    // Invokes fn(session) on every member, in declaration order
+    template<class F>
+    inline void for_each(F&& fn) {
+        std::apply([&](auto&... s) { (fn(s), ...); }, sessions_);
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t size() noexcept {
+        return N;
+    }
+
+    // ------------------------------------------------------------
+    // Aggregated facts (SessionRunner compatible)
+    // ------------------------------------------------------------
+
+    // True while at least one member session is active
+    [[nodiscard]]
+    inline bool is_active() const noexcept {
+        return std::apply([](const auto&... s) { return (s.is_active() || ...); }, sessions_);
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t rx_messages() const noexcept {
+        return std::apply([](const auto&... s) { return (s.rx_messages() + ...); }, sessions_);
+    }
+
+    [[nodiscard]]
+    inline std::uint64_t tx_messages() const noexcept {
+        return std::apply([](const auto&... s) { return (s.tx_messages() + ...); }, sessions_);
+    }
+
+    // ------------------------------------------------------------
+    // Telemetry
+    // ------------------------------------------------------------
+
+    // Refreshes the aggregated member facts of the group telemetry
+    inline void aggregate_telemetry() noexcept {
+        telemetry_.rx_messages_total.store(rx_messages());
+        telemetry_.tx_messages_total.store(tx_messages());
+        telemetry_.parse_success_total.store(sum_([](auto& t) { return t.parse_success_total.load(); }));
+        telemetry_.parse_failure_total.store(sum_([](auto& t) { return t.parse_failure_total.load(); }));
+        telemetry_.rejection_notices_total.store(sum_([](auto& t) { return t.rejection_notices_total.load(); }));
+        telemetry_.user_delivery_failures_total.store(sum_([](auto& t) { return t.user_delivery_failures_total.load(); }));
+    }
+
+    [[nodiscard]]
+    inline const telemetry::SessionGroup& telemetry() const noexcept {
+        return telemetry_;
+    }
+
+    [[nodiscard]]
+    inline const GroupOptions& options() const noexcept {
+        return options_;
+    }
+
+private:
+    SessionRefs sessions_;
+    GroupOptions options_;
+
+    std::size_t cursor_ = 0;           // First session of the next cycle
+    std::uint64_t next_sweep_ns_ = 0;  // First cycle is a maintenance sweep
+    std::uint64_t sweep_pending_ = 0;  // Sessions not yet polled by the current sweep
+
+    telemetry::SessionGroup telemetry_;
+
+    // Type-erased per-index poll (heterogeneous sessions, O(1) dispatch)
+    using PollFn = void (*)(SessionRefs&);
+
+    template<std::size_t I>
+    static void poll_at_(SessionRefs& sessions) {
+        (void)std::get<I>(sessions).poll();
+    }
+
+    static constexpr std::array<PollFn, N> POLL_TABLE =
+        []<std::size_t... I>(std::index_sequence<I...>) {
+            return std::array<PollFn, N>{ &poll_at_<I>... };
+        }(std::index_sequence_for<Sessions...>{});
+
+    [[nodiscard]]
+    inline std::uint64_t ready_mask_() noexcept {
+        return [&]<std::size_t... I>(std::index_sequence<I...>) {
+            return ((static_cast<std::uint64_t>(std::get<I>(sessions_).has_pending_input()) << I) | ...);
+        }(std::index_sequence_for<Sessions...>{});
+    }
+
+    template<class F>
+    [[nodiscard]]
+    inline std::uint64_t sum_(F&& metric) noexcept {
+        return std::apply([&](auto&... s) { return (metric(s.telemetry()) + ...); }, sessions_);
+    }
+};
+
+} // namespace wirekrak::core::protocol
@@ -56,7 +56,8 @@ Design goals
 • Idempotent at symbol level
 • Deterministic (no time-based behavior)
 • Safe under reconnect replay storms
-• Zero dynamic allocation beyond container growth
+• O(1) per symbol, no allocation on registration or ACK processing
+  (dense SymbolId-indexed state: bitsets + flat request tables)
 • Suitable for ultra-low-latency paths
 
 -------------------------------------------------------------------------------
@@ -83,11 +84,11 @@ Notes
 ===============================================================================
 */
 
-#include <unordered_set>
 #include <cstdint>
 #include <cassert>
 
 #include "wirekrak/core/symbol/intern.hpp"
+#include "wirekrak/core/symbol/set.hpp"
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "wirekrak/core/protocol/subscription/pending_requests.hpp"
 #include "lcr/log/logger.hpp"
@@ -297,6 +298,31 @@ public:
         return pending_unsubscriptions_.symbol_count();
     }
 
+    // Whether an unsubscribe of this symbol is awaiting its ACK
+    [[nodiscard]]
+    inline bool is_unsubscribing(SymbolId sid) const noexcept {
+        return pending_unsubscriptions_.contains(sid);
+    }
+
+    // Whether the symbol is fully subscribed (ACKed)
+    [[nodiscard]]
+    inline bool is_active(SymbolId sid) const noexcept {
+        return active_symbols_.contains(sid);
+    }
+
+    // Whether a subscribe request still has symbols awaiting their ACK
+    [[nodiscard]]
+    inline bool is_subscription_pending(ctrl::req_id_t req_id) const noexcept {
+        return pending_subscriptions_.contains_request(req_id);
+    }
+
+    // Symbols of a subscribe request still awaiting their ACK
+    // Returns false if the request is not pending
+    [[nodiscard]]
+    inline bool pending_subscription_symbols(ctrl::req_id_t req_id, RequestSymbolIds& out) const noexcept {
+        return pending_subscriptions_.symbols_of(req_id, out);
+    }
+
     // ------------------------------------------------------------
     // Reset
     // ------------------------------------------------------------
@@ -309,10 +335,10 @@ public:
 
 #ifndef NDEBUG
     void assert_consistency() const {
-        for (auto sid : active_symbols_) {
+        active_symbols_.for_each([&](SymbolId sid) {
             LCR_ASSERT(!pending_subscriptions_.contains(sid));
             LCR_ASSERT(!pending_unsubscriptions_.contains(sid));
-        }
+        });
 
         pending_subscriptions_.assert_consistency();
         pending_unsubscriptions_.assert_consistency();
@@ -358,7 +384,7 @@ private:
     PendingRequests pending_subscriptions_;
     PendingRequests pending_unsubscriptions_;
 
-    std::unordered_set<SymbolId> active_symbols_;
+    SymbolSet active_symbols_;
 };
 
 } // namespace wirekrak::core::protocol::subscription
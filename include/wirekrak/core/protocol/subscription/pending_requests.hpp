@@ -11,8 +11,8 @@ Tracks pending protocol requests at symbol granularity.
 
 This structure provides a bidirectional mapping:
 
-    req_id -> vector<SymbolId>
-    SymbolId -> (implicitly owned by exactly one req_id)
+    req_id   -> SymbolIds still pending for that request
+    SymbolId -> owning req_id (exactly one)
 
 and enforces **global uniqueness of SymbolId** across all pending requests.
 
@@ -21,9 +21,10 @@ Core Invariants
 -------------------------------------------------------------------------------
 
 • A SymbolId may appear at most once across all pending requests
-• pending_symbols_.size() equals total number of stored symbols
-• If a request vector becomes empty, it is erased
-• All operations are O(1) average (unordered containers + small vectors)
+• pending_.size() equals total number of stored symbols
+• A request with no pending symbol left is erased
+• Every operation is O(1) per symbol (symbols_of(): O(symbols of the request))
+• No allocation after construction, except request table growth
 • Not thread-safe (event-loop only)
 
 -------------------------------------------------------------------------------
@@ -38,7 +39,7 @@ Semantics
     - Removes a specific symbol from a specific request
 
 • remove(sid):
-    - Removes a symbol globally (owner lookup required)
+    - Removes a symbol globally (owner lookup, O(1))
 
 • contains():
     - Fast membership test for pending symbols
@@ -47,11 +48,15 @@ Semantics
 Design
 -------------------------------------------------------------------------------
 
-• Vector per request:
-    - Optimized for small batches (e.g. Kraken ≤ 10 symbols/request)
+• Dense per-SymbolId state (SymbolIds are bounded by the intern table):
+    - pending_ : bitset membership
+    - links_   : owning req_id + intrusive doubly linked list of the
+                 symbols of that request (insertion order)
 
-• Global uniqueness:
-    - Enforced via pending_symbols_ (O(1) lookup)
+• Request table:
+    - Small flat open-addressing map req_id -> {head, tail, count}
+    - Linear probing, backward-shift deletion (no tombstones),
+      load factor <= 0.5
 
 • No ordering guarantees:
     - Requests and symbols are treated as sets for correctness
@@ -76,19 +81,18 @@ Notes
 -------------------------------------------------------------------------------
 
 • Duplicate suppression is structural, not policy-driven
-• Consistency between requests_ and pending_symbols_ is critical
+• Consistency between links_, pending_ and the request table is critical
 • Debug builds can validate invariants via assert_consistency()
 
 ===============================================================================
 */
 
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
-#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cassert>
 
+#include "wirekrak/core/symbol/set.hpp"
 #include "wirekrak/core/protocol/control/req_id.hpp"
 #include "lcr/trap.hpp"
 
@@ -96,28 +100,32 @@ Notes
 namespace wirekrak::core::protocol::subscription {
 
 class PendingRequests {
+    static constexpr SymbolId NIL = ~SymbolId{0};
+    static constexpr std::size_t MIN_TABLE_SIZE = 64;  // power of two
+
 public:
-    PendingRequests() = default;
+    PendingRequests()
+        : links_(MAX_INTERNED_SYMBOLS)
+        , table_(MIN_TABLE_SIZE) {
+    }
 
     // ------------------------------------------------------------
     // Add a new pending request
     // ------------------------------------------------------------
     inline void add(ctrl::req_id_t req_id, const RequestSymbolIds& sids) noexcept {
-        auto& vec = requests_[req_id];
+        LCR_ASSERT_MSG(req_id != ctrl::INVALID_REQ_ID, "PendingRequests::add() requires a valid req_id");
+        Request* req = nullptr;
 
         for (const auto& sid : sids) {
             // Enforce uniqueness at pending layer
-            if (pending_symbols_.contains(sid)) {
+            if (pending_.contains(sid)) {
                 continue;
             }
-
-            vec.push_back(sid);
-            pending_symbols_.insert(sid);
-        }
-
-        if (vec.empty()) {
-            // If nothing was inserted, remove empty req_id entry
-            requests_.erase(req_id);
+            // Request entry created on first accepted symbol (no empty entries)
+            if (req == nullptr) {
+                req = &acquire_(req_id);
+            }
+            append_(*req, sid);
         }
     }
 
@@ -127,24 +135,10 @@ public:
     // ------------------------------------------------------------
     [[nodiscard]]
     inline bool remove(ctrl::req_id_t req_id, SymbolId sid) noexcept {
-
-        auto it = requests_.find(req_id);
-        if (it == requests_.end())
-            return false;
-
-        auto& vec = it->second;
-
-        auto pos = std::find(vec.begin(), vec.end(), sid);
-        if (pos == vec.end())
+        if (!pending_.contains(sid) || links_[sid].req_id != req_id) {
             return false;
-
-        vec.erase(pos);
-        pending_symbols_.erase(sid);
-
-        if (vec.empty()) {
-            requests_.erase(it);
         }
-
+        unlink_(find_(req_id), sid);
         return true;
     }
 
@@ -154,61 +148,71 @@ public:
     // ------------------------------------------------------------
     [[nodiscard]]
     inline bool remove(SymbolId sid) noexcept {
-
-        if (!pending_symbols_.contains(sid))
+        if (!pending_.contains(sid)) {
             return false;
-
-        for (auto it = requests_.begin(); it != requests_.end(); ++it) {
-            auto& vec = it->second;
-            auto pos = std::find(vec.begin(), vec.end(), sid);
-            if (pos != vec.end()) {
-                vec.erase(pos);
-                pending_symbols_.erase(sid);
-
-                if (vec.empty()) {
-                    requests_.erase(it);
-                }
-
-                return true;
-            }
         }
-
-        // Should never happen if invariants hold
-        LCR_UNREACHABLE();
-
-        return false;
+        unlink_(find_(links_[sid].req_id), sid);
+        return true;
     }
 
     // ------------------------------------------------------------
     // Queries
     // ------------------------------------------------------------
 
-   [[nodiscard]]
+    [[nodiscard]]
     inline bool contains(SymbolId sid) const noexcept {
-        return pending_symbols_.contains(sid);
+        return pending_.contains(sid);
+    }
+
+    [[nodiscard]]
+    inline bool contains_request(ctrl::req_id_t req_id) const noexcept {
+        return req_id != ctrl::INVALID_REQ_ID && find_(req_id) != NOT_FOUND;
+    }
+
+    // Copies the symbols still pending for `req_id` into `out`
+    // Returns false if the request is not pending
+    [[nodiscard]]
+    inline bool symbols_of(ctrl::req_id_t req_id, RequestSymbolIds& out) const noexcept {
+        if (req_id == ctrl::INVALID_REQ_ID) {
+            return false;
+        }
+        const std::size_t slot = find_(req_id);
+        if (slot == NOT_FOUND) {
+            return false;
+        }
+        out.clear();
+        for (SymbolId sid = table_[slot].head; sid != NIL; sid = links_[sid].next) {
+            out.push_back(sid);
+        }
+        return true;
     }
 
     [[nodiscard]]
     inline bool empty() const noexcept {
-        return requests_.empty();
+        return requests_ == 0;
     }
 
     [[nodiscard]]
     inline std::size_t count() const noexcept {
-        return requests_.size();
+        return requests_;
     }
 
     [[nodiscard]]
     inline std::size_t symbol_count() const noexcept {
-        return pending_symbols_.size();
+        return pending_.size();
     }
 
     // ------------------------------------------------------------
     // Clear
     // ------------------------------------------------------------
     inline void clear() noexcept {
-        requests_.clear();
-        pending_symbols_.clear();
+        if (requests_ != 0) {
+            for (auto& req : table_) {
+                req.req_id = ctrl::INVALID_REQ_ID;
+            }
+            requests_ = 0;
+        }
+        pending_.clear();
     }
 
 #ifndef NDEBUG
@@ -217,17 +221,156 @@ public:
     // ------------------------------------------------------------
     inline void assert_consistency() const  {
         std::size_t count = 0;
-        for (const auto& [_, vec] : requests_) {
-            count += vec.size();
+        std::size_t requests = 0;
+        for (const auto& req : table_) {
+            if (req.req_id == ctrl::INVALID_REQ_ID) {
+                continue;
+            }
+            ++requests;
+            std::size_t n = 0;
+            for (SymbolId sid = req.head; sid != NIL; sid = links_[sid].next) {
+                LCR_ASSERT_MSG(pending_.contains(sid) && links_[sid].req_id == req.req_id, "pending symbol must be owned by its request");
+                ++n;
+            }
+            LCR_ASSERT_MSG(n == req.count && n > 0, "request symbol count must match its symbol list");
+            count += n;
         }
 
-        LCR_ASSERT_MSG(count == pending_symbols_.size(), "pending_symbols_ size must match total symbols in requests_");
+        LCR_ASSERT_MSG(requests == requests_, "request count must match the request table");
+        LCR_ASSERT_MSG(count == pending_.size(), "pending_ size must match total symbols in requests");
     }
 #endif
 
 private:
-    std::unordered_map<ctrl::req_id_t, std::vector<SymbolId>> requests_;
-    std::unordered_set<SymbolId> pending_symbols_;
+    static constexpr std::size_t NOT_FOUND = ~std::size_t{0};
+
+    // Per SymbolId (valid while pending)
+    struct Link {
+        ctrl::req_id_t req_id = ctrl::INVALID_REQ_ID;
+        SymbolId prev = NIL;
+        SymbolId next = NIL;
+    };
+
+    // Request table entry (empty when req_id == INVALID_REQ_ID)
+    struct Request {
+        ctrl::req_id_t req_id = ctrl::INVALID_REQ_ID;
+        SymbolId head = NIL;
+        SymbolId tail = NIL;
+        std::uint32_t count = 0;
+    };
+
+    SymbolSet pending_;
+    std::vector<Link> links_;       // MAX_INTERNED_SYMBOLS entries
+    std::vector<Request> table_;    // power of two
+    std::size_t requests_ = 0;
+
+private:
+    [[nodiscard]]
+    inline std::size_t home_(ctrl::req_id_t req_id) const noexcept {
+        // Fibonacci hashing: req_ids are mostly sequential
+        return static_cast<std::size_t>((req_id * 0x9E3779B97F4A7C15ull) >> 32) & (table_.size() - 1);
+    }
+
+    [[nodiscard]]
+    inline std::size_t find_(ctrl::req_id_t req_id) const noexcept {
+        const std::size_t mask = table_.size() - 1;
+        for (std::size_t i = home_(req_id); ; i = (i + 1) & mask) {
+            if (table_[i].req_id == req_id) {
+                return i;
+            }
+            if (table_[i].req_id == ctrl::INVALID_REQ_ID) {
+                return NOT_FOUND;
+            }
+        }
+    }
+
+    // Existing entry for req_id, or a new empty one
+    inline Request& acquire_(ctrl::req_id_t req_id) noexcept {
+        const std::size_t slot = find_(req_id);
+        if (slot != NOT_FOUND) {
+            return table_[slot];
+        }
+        if (2 * (requests_ + 1) > table_.size()) [[unlikely]] {
+            grow_();
+        }
+        const std::size_t mask = table_.size() - 1;
+        std::size_t i = home_(req_id);
+        while (table_[i].req_id != ctrl::INVALID_REQ_ID) {
+            i = (i + 1) & mask;
+        }
+        table_[i] = Request{ req_id, NIL, NIL, 0 };
+        ++requests_;
+        return table_[i];
+    }
+
+    inline void grow_() noexcept {
+        std::vector<Request> old(table_.size() * 2);
+        old.swap(table_);
+        const std::size_t mask = table_.size() - 1;
+        for (const auto& req : old) {
+            if (req.req_id == ctrl::INVALID_REQ_ID) {
+                continue;
+            }
+            std::size_t i = home_(req.req_id);
+            while (table_[i].req_id != ctrl::INVALID_REQ_ID) {
+                i = (i + 1) & mask;
+            }
+            table_[i] = req;
+        }
+    }
+
+    inline void append_(Request& req, SymbolId sid) noexcept {
+        Link& link = links_[sid];
+        link.req_id = req.req_id;
+        link.prev = req.tail;
+        link.next = NIL;
+        if (req.tail != NIL) {
+            links_[req.tail].next = sid;
+        }
+        else {
+            req.head = sid;
+        }
+        req.tail = sid;
+        ++req.count;
+        pending_.insert(sid);
+    }
+
+    inline void unlink_(std::size_t slot, SymbolId sid) noexcept {
+        LCR_ASSERT_MSG(slot != NOT_FOUND, "pending symbol without request entry");
+        Request& req = table_[slot];
+        const Link& link = links_[sid];
+        if (link.prev != NIL) {
+            links_[link.prev].next = link.next;
+        }
+        else {
+            req.head = link.next;
+        }
+        if (link.next != NIL) {
+            links_[link.next].prev = link.prev;
+        }
+        else {
+            req.tail = link.prev;
+        }
+        pending_.erase(sid);
+        if (--req.count == 0) {
+            erase_slot_(slot);
+        }
+    }
+
+    // Backward-shift deletion keeps probe sequences intact without tombstones
+    inline void erase_slot_(std::size_t hole) noexcept {
+        const std::size_t mask = table_.size() - 1;
+        for (std::size_t j = (hole + 1) & mask; table_[j].req_id != ctrl::INVALID_REQ_ID; j = (j + 1) & mask) {
+            const std::size_t home = home_(table_[j].req_id);
+            // Entry j may fill the hole unless its home lies cyclically in (hole, j]
+            if (((j - home) & mask) >= ((j - hole) & mask)) {
+                table_[hole] = table_[j];
+                hole = j;
+            }
+        }
+        table_[hole].req_id = ctrl::INVALID_REQ_ID;
+        --requests_;
+    }
 };
 
 } // namespace wirekrak::core::protocol::subscription
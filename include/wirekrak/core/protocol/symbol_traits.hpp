@@ -0,0 +1,61 @@
+#pragma once
+
+/*
+===============================================================================
+symbol_traits - Per-symbol routing key of data-plane messages
+===============================================================================
+
+Tells the session which symbol(s) a message carries, for per-symbol logic
+that must not depend on merge rules (load shedding, symbol-addressed
+coroutine waits, conflation keys).
+
+key() and retain() run once per message: SymbolIds are resolved through the
+lock-free intern table lookup (see symbol/intern.hpp).
+
+    template<>
+    struct symbol_traits<MyMsg> {
+        static constexpr bool enabled = true;
+
+        // Single symbol of the message (false if it carries none or several)
+        static bool key(const MyMsg&, SymbolId& out) noexcept;
+
+        // Multi-symbol messages only (optional):
+
+        // Keeps the entries whose symbol satisfies keep(SymbolId) (called once
+        // per run of one symbol). Returns false if entries were removed and
+        // none is left.
+        template<class Keep>
+        static bool retain(MyMsg&, Keep&& keep) noexcept;
+
+        // fn(MyMsg&&) once per run of one symbol, in order (builds one
+        // message per run: may allocate)
+        template<class F>
+        static void partition(MyMsg&&, F&& fn);
+    };
+
+===============================================================================
+*/
+
+#include <concepts>
+#include <utility>
+
+#include "wirekrak/core/symbol.hpp"
+
+
+namespace wirekrak::core::protocol {
+
+template<class T>
+struct symbol_traits {
+    static constexpr bool enabled = false;
+};
+
+// Traits providing the optional multi-symbol hooks
+template<class T>
+concept MultiSymbolMessage =
+    symbol_traits<T>::enabled &&
+    requires(T& msg, T&& rvalue) {
+        { symbol_traits<T>::retain(msg, [](SymbolId) noexcept { return true; }) } -> std::same_as<bool>;
+        symbol_traits<T>::partition(std::move(rvalue), [](T&&) noexcept {});
+    };
+
+} // namespace wirekrak::core::protocol
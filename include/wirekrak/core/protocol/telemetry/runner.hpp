@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+
+#include "lcr/metrics/atomic/counter.hpp"
+#include "lcr/metrics/atomic/latency_histogram.hpp"
+
+
+namespace wirekrak::core::protocol::telemetry {
+
+// ============================================================================
+// Runner Telemetry
+//
+// Observes the poll loop of a SessionRunner.
+//
+// Written by the runner thread only, readable from any thread (relaxed
+// atomics, each metric on its own cache line), so a monitoring thread can
+// sample it while the session is running.
+//
+// Captures:
+//   • loop iterations (poll + handler)
+//   • idle iterations (no message received, nothing drained)
+//   • poll() latency distribution (telemetry level 3)
+//
+// ============================================================================
+
+struct alignas(64) Runner final {
+
+    // ---------------------------------------------------------------------
+    // Loop activity
+    // ---------------------------------------------------------------------
+    lcr::metrics::atomic::counter64 loop_iterations_total;   // poll() + handler iterations
+    lcr::metrics::atomic::counter64 idle_iterations_total;   // Iterations that did no work (idle strategy applied)
+    lcr::metrics::atomic::counter64 blocked_waits_total;     // Iterations that slept on the notification fd (Block idle mode)
+
+    // ---------------------------------------------------------------------
+    // Timing
+    // ---------------------------------------------------------------------
+    lcr::metrics::atomic::latency_histogram poll_latency;    // Distribution of Session::poll() durations as seen by the runner
+
+    // ---------------------------------------------------------------------
+    // Derived
+    // ---------------------------------------------------------------------
+
+    // Fraction of loop iterations that did no work [0, 1]
+    [[nodiscard]]
+    inline double idle_ratio() const noexcept {
+        const std::uint64_t loops = loop_iterations_total.load();
+        if (loops == 0) {
+            return 0.0;
+        }
+        return static_cast<double>(idle_iterations_total.load()) / static_cast<double>(loops);
+    }
+
+    // ---------------------------------------------------------------------
+    // Snapshot support
+    // ---------------------------------------------------------------------
+    inline void copy_to(Runner& other) const noexcept {
+        loop_iterations_total.copy_to(other.loop_iterations_total);
+        idle_iterations_total.copy_to(other.idle_iterations_total);
+        blocked_waits_total.copy_to(other.blocked_waits_total);
+        poll_latency.copy_to(other.poll_latency);
+    }
+};
+
+} // namespace wirekrak::core::protocol::telemetry
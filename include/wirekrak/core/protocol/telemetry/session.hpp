@@ -50,11 +50,14 @@ struct alignas(64) Session final {
     // ---------------------------------------------------------------------
     lcr::metrics::counter64 replay_requests_total;  // Number of replay operations triggered after reconnect
     lcr::metrics::counter64 replay_symbols_total;   // Total symbols replayed during reconnect recovery
+    lcr::metrics::counter64 replay_snapshotless_symbols_total;  // Replayed symbols resumed without snapshot
 
     // ---------------------------------------------------------------------
     // Message processing
     // ---------------------------------------------------------------------
     lcr::metrics::stats::size32 messages_per_poll;     // Number of messages handled per poll() cycle
+    lcr::metrics::counter64 poll_budget_exhausted_total;  // poll() cycles stopped by the time budget (Deadline poll budget)
+    lcr::metrics::counter64 poll_quota_exhausted_total;   // poll() cycles stopped by a per-type message quota
 
     // ---------------------------------------------------------------------
     // Parser outcomes
@@ -74,15 +77,23 @@ struct alignas(64) Session final {
     // --------------------------------------------------------
     lcr::metrics::counter64 request_batching_failures_total;
     lcr::metrics::counter64 user_delivery_failures_total;  // Session backpressure caused by user not draining messages fast enough
+    lcr::metrics::counter64 conflated_messages_total;      // Messages merged into a per-symbol pending entry instead of queued (conflation enabled)
+    lcr::metrics::counter64 shed_symbols_total;            // Symbols unsubscribed by load shedding under sustained backpressure
+    lcr::metrics::counter64 resynced_symbols_total;        // Shed symbols whose resync subscribe was acknowledged
+    lcr::metrics::counter64 shed_dropped_messages_total;   // Messages dropped because their symbol was stale (shed)
 
     // ---------------------------------------------------------------------
     // Timing
     // ---------------------------------------------------------------------
     lcr::metrics::stats::duration64 poll_duration;            // Measures the duration of each poll() cycle 
+    lcr::metrics::latency_histogram poll_latency;             // Distribution of poll() cycle durations (worst-case control-plane latency between polls)
     lcr::metrics::stats::duration64 message_process_duration; // Measures the process duration of every message (parsing & delivery)
     lcr::metrics::latency_histogram process_latency;          // Measures the message process efficiency (time spent inside the protocol layer to process one message)
     lcr::metrics::latency_histogram handoff_latency;          // Latency from message ingress at transport to protocol delivery (measures the handoff efficiency between transport and protocol)
     lcr::metrics::latency_histogram end_to_end_latency;       // Latency from message ingress at transport to final user delivery (includes handoff + protocol processing + user delivery)
+    lcr::metrics::stats::duration64 subscription_ramp_duration; // Time from the first subscribe (or replay) until every requested symbol is acknowledged (time-to-full-subscription)
+    lcr::metrics::stats::duration64 request_batch_rtt;        // Round-trip time of request batches, emission to last symbol ACK (Adaptive batching only)
+    lcr::metrics::stats::duration64 replay_resync_duration;   // Per-symbol time-to-resync after reconnect, replay to subscribe ACK
 
     // ---------------------------------------------------------------------
     // Lifecycle
@@ -119,9 +130,12 @@ struct alignas(64) Session final {
         // Replay activity
         replay_requests_total.copy_to(other.replay_requests_total);
         replay_symbols_total.copy_to(other.replay_symbols_total);
+        replay_snapshotless_symbols_total.copy_to(other.replay_snapshotless_symbols_total);
 
         // Message processing
         messages_per_poll.copy_to(other.messages_per_poll);
+        poll_budget_exhausted_total.copy_to(other.poll_budget_exhausted_total);
+        poll_quota_exhausted_total.copy_to(other.poll_quota_exhausted_total);
 
         // Parser outcomes
         parse_success_total.copy_to(other.parse_success_total);
@@ -135,13 +149,21 @@ struct alignas(64) Session final {
         // Delivery failures
         request_batching_failures_total.copy_to(other.request_batching_failures_total);
         user_delivery_failures_total.copy_to(other.user_delivery_failures_total);
+        conflated_messages_total.copy_to(other.conflated_messages_total);
+        shed_symbols_total.copy_to(other.shed_symbols_total);
+        resynced_symbols_total.copy_to(other.resynced_symbols_total);
+        shed_dropped_messages_total.copy_to(other.shed_dropped_messages_total);
 
         // Timing
         poll_duration.copy_to(other.poll_duration);
+        poll_latency.copy_to(other.poll_latency);
         message_process_duration.copy_to(other.message_process_duration);
         process_latency.copy_to(other.process_latency);
         handoff_latency.copy_to(other.handoff_latency);
         end_to_end_latency.copy_to(other.end_to_end_latency);
+        subscription_ramp_duration.copy_to(other.subscription_ramp_duration);
+        request_batch_rtt.copy_to(other.request_batch_rtt);
+        replay_resync_duration.copy_to(other.replay_resync_duration);
 
         // Lifecycle
         healthy_time_ns.copy_to(other.healthy_time_ns);
@@ -178,10 +200,13 @@ struct alignas(64) Session final {
         os << "\nReplay\n";
         os << "  Replay requests    : "  << lcr::format_number_exact(replay_requests_total.load()) << '\n';
         os << "  Replay symbols     : " << lcr::format_number_exact(replay_symbols_total.load()) << '\n';
+        os << "  Snapshot-less      : " << lcr::format_number_exact(replay_snapshotless_symbols_total.load()) << '\n';
 
         // Message processing
         os << "\nMessage processing\n";
         os << "  Messages per poll  : "; messages_per_poll.dump(os); os << '\n';
+        os << "  Budget exhausted   : " << lcr::format_number_exact(poll_budget_exhausted_total.load()) << '\n';
+        os << "  Quota exhausted    : " << lcr::format_number_exact(poll_quota_exhausted_total.load()) << '\n';
 
         // Parser outcomes
         os << "\nParser\n";
@@ -198,14 +223,22 @@ struct alignas(64) Session final {
         os << "\nDelivery failures\n";
         os << "  Request batching   : " << lcr::format_number_exact(request_batching_failures_total.load()) << '\n';
         os << "  User delivery      : " << lcr::format_number_exact(user_delivery_failures_total.load()) << '\n';
+        os << "  Conflated messages : " << lcr::format_number_exact(conflated_messages_total.load()) << '\n';
+        os << "  Shed symbols       : " << lcr::format_number_exact(shed_symbols_total.load()) << '\n';
+        os << "  Resynced symbols   : " << lcr::format_number_exact(resynced_symbols_total.load()) << '\n';
+        os << "  Shed dropped msgs  : " << lcr::format_number_exact(shed_dropped_messages_total.load()) << '\n';
 
         // Timing
         os << "\nTiming\n";
         os << "  Poll duration      : "; poll_duration.dump(os); os << '\n';
+        os << "  Poll latency       : "; poll_latency.dump(os); os << '\n';
         os << "  Process message    : "; message_process_duration.dump(os); os << '\n';
         os << "  Process latency    : "; process_latency.dump(os); os << '\n';
         os << "  Message handoff    : "; handoff_latency.dump(os); os << '\n';
         os << "  End-to-end latency : "; end_to_end_latency.dump(os); os << '\n';
+        os << "  Subscription ramp  : "; subscription_ramp_duration.dump(os); os << '\n';
+        os << "  Request batch RTT  : "; request_batch_rtt.dump(os); os << '\n';
+        os << "  Replay resync      : "; replay_resync_duration.dump(os); os << '\n';
 
         // Lifecycle
         os << "\nLifecycle\n";
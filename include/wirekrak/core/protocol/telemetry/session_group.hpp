@@ -0,0 +1,107 @@
+#pragma once
+
+#include <ostream>
+#include <type_traits>
+
+#include "lcr/metrics/counter.hpp"
+#include "lcr/format.hpp"
+
+
+namespace wirekrak::core::protocol::telemetry {
+
+// ============================================================================
+// SessionGroup Telemetry
+//
+// Observes the scheduling of a SessionGroup (several sessions polled from
+// one thread) and aggregates the main facts of its member sessions.
+//
+// Written by the group thread only (same threading model as Session).
+//
+// Captures:
+//   • group cycles and idle cycles (no session had pending input)
+//   • per-session polls issued and skipped (idle sessions)
+//   • maintenance sweeps (every session polled for liveness / timers)
+//   • cycles cut short by the group time budget
+//   • aggregated member facts (refreshed by SessionGroup::aggregate_telemetry)
+//
+// ============================================================================
+
+struct alignas(64) SessionGroup final {
+
+    // ---------------------------------------------------------------------
+    // Scheduling
+    // ---------------------------------------------------------------------
+    lcr::metrics::counter64 cycles_total;              // SessionGroup::poll() calls
+    lcr::metrics::counter64 idle_cycles_total;         // Cycles where no session was polled
+    lcr::metrics::counter64 session_polls_total;       // Session::poll() calls issued by the group
+    lcr::metrics::counter64 skipped_polls_total;       // Session polls skipped (empty transport rings)
+    lcr::metrics::counter64 maintenance_sweeps_total;  // Cycles polling every session regardless of input
+    lcr::metrics::counter64 budget_exhausted_total;    // Cycles stopped by the group time budget
+
+    // ---------------------------------------------------------------------
+    // Aggregated member facts
+    // ---------------------------------------------------------------------
+    lcr::metrics::counter64 rx_messages_total;             // Σ Session::rx_messages()
+    lcr::metrics::counter64 tx_messages_total;             // Σ Session::tx_messages()
+    lcr::metrics::counter64 parse_success_total;           // Σ telemetry::Session::parse_success_total
+    lcr::metrics::counter64 parse_failure_total;           // Σ telemetry::Session::parse_failure_total
+    lcr::metrics::counter64 rejection_notices_total;       // Σ telemetry::Session::rejection_notices_total
+    lcr::metrics::counter64 user_delivery_failures_total;  // Σ telemetry::Session::user_delivery_failures_total
+
+    // ---------------------------------------------------------------------
+    // Snapshot support
+    // ---------------------------------------------------------------------
+    inline void copy_to(SessionGroup& other) const noexcept {
+
+        // Scheduling
+        cycles_total.copy_to(other.cycles_total);
+        idle_cycles_total.copy_to(other.idle_cycles_total);
+        session_polls_total.copy_to(other.session_polls_total);
+        skipped_polls_total.copy_to(other.skipped_polls_total);
+        maintenance_sweeps_total.copy_to(other.maintenance_sweeps_total);
+        budget_exhausted_total.copy_to(other.budget_exhausted_total);
+
+        // Aggregated member facts
+        rx_messages_total.copy_to(other.rx_messages_total);
+        tx_messages_total.copy_to(other.tx_messages_total);
+        parse_success_total.copy_to(other.parse_success_total);
+        parse_failure_total.copy_to(other.parse_failure_total);
+        rejection_notices_total.copy_to(other.rejection_notices_total);
+        user_delivery_failures_total.copy_to(other.user_delivery_failures_total);
+    }
+
+    // ---------------------------------------------------------------------
+    // Debug dump
+    // ---------------------------------------------------------------------
+
+    inline void debug_dump(std::ostream& os) const noexcept {
+
+        os << "\n=== Session Group Telemetry ===\n";
+
+        os << "Scheduling\n";
+        os << "  Cycles             : " << lcr::format_number_exact(cycles_total.load()) << '\n';
+        os << "  Idle cycles        : " << lcr::format_number_exact(idle_cycles_total.load()) << '\n';
+        os << "  Session polls      : " << lcr::format_number_exact(session_polls_total.load()) << '\n';
+        os << "  Skipped polls      : " << lcr::format_number_exact(skipped_polls_total.load()) << '\n';
+        os << "  Maintenance sweeps : " << lcr::format_number_exact(maintenance_sweeps_total.load()) << '\n';
+        os << "  Budget exhausted   : " << lcr::format_number_exact(budget_exhausted_total.load()) << '\n';
+
+        os << "\nSessions (aggregated)\n";
+        os << "  RX messages        : " << lcr::format_number_exact(rx_messages_total.load()) << '\n';
+        os << "  TX messages        : " << lcr::format_number_exact(tx_messages_total.load()) << '\n';
+        os << "  Parse success      : " << lcr::format_number_exact(parse_success_total.load()) << '\n';
+        os << "  Parse failure      : " << lcr::format_number_exact(parse_failure_total.load()) << '\n';
+        os << "  Rejection notices  : " << lcr::format_number_exact(rejection_notices_total.load()) << '\n';
+        os << "  User delivery fail : " << lcr::format_number_exact(user_delivery_failures_total.load()) << '\n';
+    }
+};
+
+// -------------------------------------------------------------------------
+// Invariants
+// -------------------------------------------------------------------------
+
+static_assert(std::is_standard_layout_v<SessionGroup>, "telemetry::SessionGroup must be standard layout");
+static_assert(std::is_trivially_destructible_v<SessionGroup>, "telemetry::SessionGroup must be trivially destructible");
+static_assert(alignof(SessionGroup) == 64, "telemetry::SessionGroup must be cache-line aligned");
+
+} // namespace wirekrak::core::protocol::telemetry
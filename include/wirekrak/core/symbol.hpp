@@ -15,6 +15,10 @@ inline constexpr std::size_t MAX_SYMBOL_LENGTH = 16;
 using Symbol = lcr::local::string<MAX_SYMBOL_LENGTH>; // max 16 chars after escaping (worst case)
 using SymbolId = uint32_t;
 
+// Capacity of the symbol intern table: every SymbolId is < MAX_INTERNED_SYMBOLS
+// (allows dense SymbolId-indexed state)
+inline constexpr std::size_t MAX_INTERNED_SYMBOLS = 4096;
+
 inline constexpr std::size_t MAX_REQUEST_SYMBOLS = 2048; // example capacity, adjust as needed
 
 using RequestSymbols   = lcr::local::vector<Symbol, MAX_REQUEST_SYMBOLS>;
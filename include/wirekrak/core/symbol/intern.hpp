@@ -8,16 +8,16 @@
  *  storage and comparison of symbol strings. Symbols are immutable and identified  *
  *  by a unique integer ID (SymbolId). The system ensures that each unique symbol   *
  *  string is stored only once in memory, allowing for fast comparisons and reduced *
- *  memory usage.                                                                   *
+ *  memory usage. Lookups of known symbols are lock-free (hot path safe).           *
  *                                                                                  *
  ************************************************************************************/
 
-#include <string>
-#include <string_view>
-#include <vector>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
 #include <mutex>
-#include <shared_mutex>
-#include <unordered_map>
+#include <string_view>
 
 #include "wirekrak/core/symbol.hpp"
 
@@ -47,8 +47,21 @@ struct SvEqual {
 // ============================================================================
 // Symbol Interning System
 // ============================================================================
+//
+// Lookups (find, and intern of a known symbol) are lock-free: symbols live in
+// a fixed array and are indexed by an open-addressing table of atomic slots.
+// Only interning a new symbol takes the mutex, which serializes writers.
+//
+// Publication: a writer constructs symbols_[id], then release-stores id + 1
+// into its slot; a reader that acquires a non-zero slot sees the symbol.
+// Symbols are never removed, so a slot never changes once set.
+//
 template<std::size_t MaxSymbols>
 class InternTable {
+    // Load factor <= 0.5: short probe sequences for misses
+    static constexpr std::size_t SLOTS = std::bit_ceil(MaxSymbols * 2);
+    static constexpr std::size_t MASK  = SLOTS - 1;
+
 public:
     [[nodiscard]] static inline InternTable& instance() {
         static InternTable inst;
@@ -57,57 +70,75 @@ public:
 
     // Intern a symbol string → returns its stable SymbolId
     [[nodiscard]] inline SymbolId intern(std::string_view sv) {
-        // --- Fast path: lookup with shared lock ---
-        {
-            std::shared_lock read_lock(mutex_);
-            auto it = map_.find(sv);
-            if (it != map_.end())
-                return it->second;
+        // --- Fast path: lock-free lookup ---
+        SymbolId id;
+        if (find(sv, id)) [[likely]] {
+            return id;
         }
 
         // --- Slow path: exclusive lock ---
-        std::unique_lock write_lock(mutex_);
-
-        // Double-check after upgrade
-        auto it = map_.find(sv);
-        if (it != map_.end())
-            return it->second;
+        std::lock_guard write_lock(mutex_);
+
+        // Double-check under the lock (another writer may have inserted it)
+        std::size_t slot = SvHasher{}(sv) & MASK;
+        for (;; slot = (slot + 1) & MASK) {
+            const std::uint32_t v = slots_[slot].load(std::memory_order_relaxed);
+            if (v == 0) {
+                break;
+            }
+            if (symbols_[v - 1].view() == sv) {
+                return static_cast<SymbolId>(v - 1);
+            }
+        }
 
-        if (symbols_.size() >= MaxSymbols) {
+        const std::size_t n = count_.load(std::memory_order_relaxed);
+        if (n >= MaxSymbols) {
             LCR_TRAP("symbol table capacity exceeded");
         }
         // --- Insert new symbol ---
-        SymbolId id = static_cast<SymbolId>(symbols_.size());
-        symbols_.emplace_back(sv);                 // permanent storage
-        std::string_view view = symbols_.back();   // stable view
+        symbols_[n] = Symbol{sv};                  // permanent storage
+        slots_[slot].store(static_cast<std::uint32_t>(n + 1), std::memory_order_release);
+        count_.store(n + 1, std::memory_order_release);
+        return static_cast<SymbolId>(n);
+    }
 
-        map_.emplace(view, id);
-        return id;
+    // Lookup ID by name without interning (false if never interned)
+    [[nodiscard]] inline bool find(std::string_view sv, SymbolId& out) const noexcept {
+        for (std::size_t slot = SvHasher{}(sv) & MASK;; slot = (slot + 1) & MASK) {
+            const std::uint32_t v = slots_[slot].load(std::memory_order_acquire);
+            if (v == 0) {
+                return false;
+            }
+            if (symbols_[v - 1].view() == sv) {
+                out = static_cast<SymbolId>(v - 1);
+                return true;
+            }
+        }
     }
 
     // Lookup name by ID
     [[nodiscard]] inline std::string_view name(SymbolId id) const noexcept {
-        if (id >= symbols_.size())
+        if (id >= count_.load(std::memory_order_acquire))
             return {};
-        return symbols_[id];
+        return symbols_[id].view();
     }
 
     // Number of interned symbols (for debugging)
     [[nodiscard]] inline size_t count() const noexcept {
-        std::shared_lock lock(mutex_);
-        return symbols_.size();
+        return count_.load(std::memory_order_acquire);
     }
 
 private:
-    InternTable() {
-        symbols_.reserve(MaxSymbols);  // TODO: Fix bug on vector reallocation that invalidates string_view keys when symbols > initial reserve 
-        map_.reserve(MaxSymbols);
+    InternTable()
+        : symbols_(std::make_unique<Symbol[]>(MaxSymbols))
+        , slots_(std::make_unique<std::atomic<std::uint32_t>[]>(SLOTS)) {
     }
 
 private:
-    mutable std::shared_mutex mutex_;
-    std::vector<Symbol> symbols_; // permanent storage of symbol names
-    std::unordered_map<std::string_view, SymbolId, SvHasher, SvEqual> map_;
+    std::mutex mutex_;                                     // writers only
+    std::unique_ptr<Symbol[]> symbols_;                    // permanent storage of symbol names
+    std::unique_ptr<std::atomic<std::uint32_t>[]> slots_;  // SymbolId + 1, 0 = empty
+    std::atomic<std::size_t> count_{0};
 };
 
 } // namespace symbol
@@ -119,12 +150,16 @@ private:
 // ============================================================================
 namespace wirekrak::core {
 
-using SymbolTable = symbol::InternTable<4096>;
+using SymbolTable = symbol::InternTable<MAX_INTERNED_SYMBOLS>;
 
 [[nodiscard]] inline SymbolId intern_symbol(std::string_view s) {
     return SymbolTable::instance().intern(s);
 }
 
+[[nodiscard]] inline bool find_symbol(std::string_view s, SymbolId& out) noexcept {
+    return SymbolTable::instance().find(s, out);
+}
+
 [[nodiscard]] inline std::string_view symbol_name(SymbolId id) {
     return SymbolTable::instance().name(id);
 }
@@ -0,0 +1,96 @@
+#pragma once
+
+/*
+===============================================================================
+SymbolSet (Dense SymbolId Bitset)
+===============================================================================
+
+Fixed-capacity set of SymbolId, one bit per interned symbol.
+
+• insert / erase / contains are O(1), branch-light, allocation-free
+• size() is maintained incrementally (no popcount scan)
+• clear() is O(MAX_INTERNED_SYMBOLS / 64)
+• for_each() visits members in ascending SymbolId order
+
+Relies on SymbolId being dense and bounded by MAX_INTERNED_SYMBOLS (intern table).
+
+===============================================================================
+*/
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "wirekrak/core/symbol.hpp"
+#include "lcr/trap.hpp"
+
+
+namespace wirekrak::core {
+
+class SymbolSet {
+    static constexpr std::size_t WORDS = (MAX_INTERNED_SYMBOLS + 63) / 64;
+
+public:
+    // Returns true if inserted (was absent)
+    inline bool insert(SymbolId sid) noexcept {
+        LCR_ASSERT_MSG(sid < MAX_INTERNED_SYMBOLS, "SymbolSet: SymbolId out of range");
+        const std::uint64_t bit = std::uint64_t{1} << (sid & 63);
+        std::uint64_t& word = words_[sid >> 6];
+        const bool absent = (word & bit) == 0;
+        word |= bit;
+        size_ += absent;
+        return absent;
+    }
+
+    // Returns true if erased (was present)
+    inline bool erase(SymbolId sid) noexcept {
+        LCR_ASSERT_MSG(sid < MAX_INTERNED_SYMBOLS, "SymbolSet: SymbolId out of range");
+        const std::uint64_t bit = std::uint64_t{1} << (sid & 63);
+        std::uint64_t& word = words_[sid >> 6];
+        const bool present = (word & bit) != 0;
+        word &= ~bit;
+        size_ -= present;
+        return present;
+    }
+
+    [[nodiscard]]
+    inline bool contains(SymbolId sid) const noexcept {
+        LCR_ASSERT_MSG(sid < MAX_INTERNED_SYMBOLS, "SymbolSet: SymbolId out of range");
+        return (words_[sid >> 6] >> (sid & 63)) & 1;
+    }
+
+    [[nodiscard]]
+    inline std::size_t size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]]
+    inline bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    inline void clear() noexcept {
+        if (size_ != 0) {
+            words_.fill(0);
+            size_ = 0;
+        }
+    }
+
+    template<class F>
+    inline void for_each(F&& f) const noexcept(noexcept(f(SymbolId{}))) {
+        for (std::size_t w = 0; w < WORDS; ++w) {
+            std::uint64_t bits = words_[w];
+            while (bits != 0) {
+                f(static_cast<SymbolId>(w * 64 + std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+private:
+    std::array<std::uint64_t, WORDS> words_{};
+    std::size_t size_ = 0;
+};
+
+} // namespace wirekrak::core
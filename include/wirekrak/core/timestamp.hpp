@@ -1,12 +1,15 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <cstdlib>
 #include <cstdio>
 #include <cctype>
 
+#include "lcr/bit/pack.hpp"
+
 namespace wirekrak::core {
 
 // ============================================================================
@@ -34,15 +37,18 @@ inline bool parse_ll(std::string_view sv, long long& out) noexcept {
 
 
 // ============================================================================
-// RFC3339 parser (example: 2023-01-02T10:22:33.123456789Z)
+// RFC3339 generic parser (example: 2023-01-02T10:22:33.123456789Z)
 //
 // Supports:
 //   YYYY-MM-DDTHH:MM:SSZ
-//   YYYY-MM-DDTHH:MM:SS.sssssssssZ
+//   YYYY-MM-DDTHH:MM:SS.sssssssssZ   (any number of fractional digits)
+//
+// Reference implementation, used by parse_rfc3339() for every input the
+// fixed-layout fast path does not accept.
 //
 // Always returns Timestamp in UTC (sys_time).
 // ============================================================================
-[[nodiscard]] inline bool parse_rfc3339(std::string_view sv, Timestamp& out) noexcept {
+[[nodiscard]] inline bool parse_rfc3339_generic(std::string_view sv, Timestamp& out) noexcept {
     using namespace std::chrono;
 
     // Minimum length: "YYYY-MM-DDTHH:MM:SSZ" (20 chars)
@@ -120,6 +126,189 @@ inline bool parse_ll(std::string_view sv, long long& out) noexcept {
 }
 
 
+// ============================================================================
+// RFC3339 fixed-layout fast path (SWAR)
+//
+// Accepts exactly:
+//   YYYY-MM-DDTHH:MM:SSZ              (20 chars)
+//   YYYY-MM-DDTHH:MM:SS.ffffffZ       (27 chars, Kraken)
+//   YYYY-MM-DDTHH:MM:SS.fffffffffZ    (30 chars)
+//
+// The text is read as 8-byte words: separators are checked with one masked
+// compare per word, all digits are validated at once and converted pairwise
+// in parallel. The epoch base of the last date seen is cached per thread, so
+// consecutive timestamps of the same day skip the calendar conversion.
+//
+// Returns false without touching `out` for anything else (including values
+// the generic parser may still accept), so results never differ from
+// parse_rfc3339_generic().
+// ============================================================================
+namespace detail::rfc3339 {
+
+inline constexpr std::uint64_t ASCII_ZEROS = 0x3030303030303030ULL;
+
+[[nodiscard]] inline constexpr std::uint64_t byte_at(char c, unsigned i) noexcept {
+    return std::uint64_t(std::uint8_t(c)) << (8 * i);
+}
+
+[[nodiscard]] inline constexpr std::uint64_t mask_at(unsigned i) noexcept {
+    return std::uint64_t(0xFF) << (8 * i);
+}
+
+// Separator layout of each word (mask / expected bytes)
+inline constexpr std::uint64_t DATE_MASK = mask_at(4) | mask_at(7);                 // YYYY-MM-
+inline constexpr std::uint64_t DATE_SEPS = byte_at('-', 4) | byte_at('-', 7);
+inline constexpr std::uint64_t DAY_MASK  = mask_at(2) | mask_at(5);                 // DDTHH:MM
+inline constexpr std::uint64_t DAY_SEPS  = byte_at('T', 2) | byte_at(':', 5);
+inline constexpr std::uint64_t TIME_MASK = mask_at(2) | mask_at(5);                 // HH:MM:SS
+inline constexpr std::uint64_t TIME_SEPS = byte_at(':', 2) | byte_at(':', 5);
+inline constexpr std::uint64_t MICRO_MASK = mask_at(0) | mask_at(7);                // .ffffffZ
+inline constexpr std::uint64_t MICRO_SEPS = byte_at('.', 0) | byte_at('Z', 7);
+
+// Replaces the separator bytes by '0' so the whole word can be digit-checked
+[[nodiscard]] inline constexpr std::uint64_t digits_only(std::uint64_t word, std::uint64_t mask) noexcept {
+    return (word & ~mask) | (ASCII_ZEROS & mask);
+}
+
+// True if all 8 bytes are ASCII digits
+[[nodiscard]] inline constexpr bool all_digits(std::uint64_t x) noexcept {
+    return ((x & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+// Byte i of the result holds the 2-digit value of bytes i and i+1
+[[nodiscard]] inline constexpr std::uint64_t pairs(std::uint64_t digits) noexcept {
+    const std::uint64_t d = digits - ASCII_ZEROS;
+    return d * 10 + (d >> 8);
+}
+
+[[nodiscard]] inline constexpr unsigned pair_at(std::uint64_t p, unsigned i) noexcept {
+    return static_cast<unsigned>((p >> (8 * i)) & 0xFF);
+}
+
+// Value of 8 ASCII digits (first digit in the lowest byte)
+[[nodiscard]] inline constexpr std::uint32_t eight_digits(std::uint64_t digits) noexcept {
+    std::uint64_t v = pairs(digits);
+    v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+         (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return static_cast<std::uint32_t>(v);
+}
+
+[[nodiscard]] inline constexpr bool is_digit(char c) noexcept {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
+
+// Days since 1970-01-01 (proleptic Gregorian)
+[[nodiscard]] inline constexpr std::int64_t days_from_civil(int y, unsigned m, unsigned d) noexcept {
+    y -= m <= 2;
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return std::int64_t(era) * 146097 + std::int64_t(doe) - 719468;
+}
+
+[[nodiscard]] inline constexpr bool valid_date(int y, unsigned m, unsigned d) noexcept {
+    if (m - 1 >= 12 || d == 0) return false;
+    const bool leap = (y % 4 == 0) && (y % 100 != 0 || y % 400 == 0);
+    const unsigned last = (m == 2) ? 28u + leap : 30u + ((m + (m >> 3)) & 1u);
+    return d <= last;
+}
+
+// Epoch base of the last date parsed on this thread
+struct DateCache {
+    std::uint64_t date = 0;   // "YYYY-MM-" word (never 0 once validated)
+    std::uint32_t day  = 0;   // "DD" bytes
+    std::int64_t  base_ns = 0;
+};
+
+[[nodiscard]] inline DateCache& date_cache() noexcept {
+    static thread_local DateCache cache;
+    return cache;
+}
+
+[[nodiscard]] inline bool parse_fixed(std::string_view sv, Timestamp& out) noexcept {
+    const std::size_t size = sv.size();
+    if (size != 20 && size != 27 && size != 30) return false;
+    const char* p = sv.data();
+
+    const std::uint64_t date = lcr::bit::pack8(p);        // YYYY-MM-
+    const std::uint64_t day  = lcr::bit::pack8(p + 8);    // DDTHH:MM
+    const std::uint64_t time = lcr::bit::pack8(p + 11);   // HH:MM:SS
+
+    const std::uint64_t date_digits = digits_only(date, DATE_MASK);
+    const std::uint64_t day_digits  = digits_only(day,  DAY_MASK);
+    const std::uint64_t time_digits = digits_only(time, TIME_MASK);
+
+    bool ok = ((date & DATE_MASK) == DATE_SEPS) &
+              ((day  & DAY_MASK)  == DAY_SEPS)  &
+              ((time & TIME_MASK) == TIME_SEPS) &
+              all_digits(date_digits) & all_digits(day_digits) & all_digits(time_digits);
+
+    // ---- Fraction ----
+    std::int64_t frac_ns = 0;
+    if (size == 27) {
+        const std::uint64_t micro = lcr::bit::pack8(p + 19);   // .ffffffZ
+        const std::uint64_t digits = digits_only(micro, MICRO_MASK);
+        ok &= ((micro & MICRO_MASK) == MICRO_SEPS) & all_digits(digits);
+        const std::uint64_t f = pairs(digits);
+        frac_ns = std::int64_t(pair_at(f, 1) * 10000u + pair_at(f, 3) * 100u + pair_at(f, 5)) * 1000;
+    }
+    else if (size == 30) {
+        const std::uint64_t nano = lcr::bit::pack8(p + 21);   // ffffffff (last 8 of 9)
+        ok &= (p[19] == '.') & is_digit(p[20]) & (p[29] == 'Z') & all_digits(nano);
+        frac_ns = std::int64_t(p[20] - '0') * 100000000 + eight_digits(nano);
+    }
+    else {
+        ok &= (p[19] == 'Z');
+    }
+    if (!ok) return false;
+
+    const std::uint64_t dp = pairs(date_digits);
+    const std::uint64_t tp = pairs(day_digits);
+    const std::uint64_t sp = pairs(time_digits);
+
+    // ---- Date (cached epoch base) ----
+    DateCache& cache = date_cache();
+    const std::uint32_t day_key = static_cast<std::uint32_t>(day & 0xFFFF);
+    if (cache.date != date || cache.day != day_key) [[unlikely]] {
+        const int year = static_cast<int>(pair_at(dp, 0) * 100 + pair_at(dp, 2));
+        const unsigned mon = pair_at(dp, 5);
+        const unsigned dd  = pair_at(tp, 0);
+        if (!valid_date(year, mon, dd)) return false;
+        cache.date = date;
+        cache.day = day_key;
+        cache.base_ns = days_from_civil(year, mon, dd) * 86'400'000'000'000LL;
+    }
+
+    // ---- Time of day ----
+    const std::int64_t secs = std::int64_t(pair_at(tp, 3)) * 3600 +
+                              std::int64_t(pair_at(tp, 6)) * 60 +
+                              std::int64_t(pair_at(sp, 6));
+
+    out = Timestamp{std::chrono::nanoseconds{cache.base_ns + secs * 1'000'000'000LL + frac_ns}};
+    return true;
+}
+
+} // namespace detail::rfc3339
+
+
+// ============================================================================
+// RFC3339 parser (example: 2023-01-02T10:22:33.123456Z)
+//
+// Fixed-layout fast path first (Kraken timestamps), generic parser for any
+// other form. Results are identical to parse_rfc3339_generic().
+//
+// Always returns Timestamp in UTC (sys_time).
+// ============================================================================
+[[nodiscard]] inline bool parse_rfc3339(std::string_view sv, Timestamp& out) noexcept {
+    if (detail::rfc3339::parse_fixed(sv, out)) [[likely]] {
+        return true;
+    }
+    return parse_rfc3339_generic(sv, out);
+}
+
+
 // ============================================================================
 // RFC3339 Formatter (always UTC)
 //
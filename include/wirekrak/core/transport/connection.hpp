@@ -108,6 +108,7 @@ No level-based liveness or health state is exposed.
 #include "lcr/memory/footprint.hpp"
 #include "lcr/buffer/concepts.hpp"
 #include "lcr/lockfree/spsc_queue.hpp"
+#include "lcr/system/event_notifier.hpp"
 #include "lcr/optional.hpp"
 #include "lcr/log/logger.hpp"
 #include "lcr/trap.hpp"
@@ -125,7 +126,13 @@ public:
     Connection(MessageRing& ring, telemetry::Connection& telemetry) noexcept
         : message_ring_(ring)
         , telemetry_(telemetry)
-    {}
+    {
+        if constexpr (NOTIFIES) {
+            if (!notifier_.open()) {
+                WK_WARN("[CONN] Failed to create notification eventfd (consumer must busy-poll)");
+            }
+        }
+    }
 
     // Ensure transport is closed on destruction.
     // Reconnection is not attempted after object lifetime ends.
@@ -255,6 +262,18 @@ public:
                 (void)reconnect_();
             }
         }
+        // === Filtered inbound traffic ===
+        // Frames dropped on the receive thread (frame filter policy) never reach
+        // the message ring, but they still prove the connection is alive.
+        if constexpr (FILTERS) {
+            if (ws_) [[likely]] {
+                const std::uint64_t filtered = ws_->filtered_messages();
+                if (filtered != filtered_seen_) {
+                    filtered_seen_ = filtered;
+                    last_message_ts_ = std::chrono::steady_clock::now();
+                }
+            }
+        }
         // === Liveness logic ===
         if constexpr (LivenessPolicy::enabled) {
             enforce_liveness_policy_();
@@ -342,6 +361,13 @@ public:
         return signals_.used();
     }
 
+    // True if the websocket published control events (close, error,
+    // backpressure) that the next poll() will drain
+    [[nodiscard]]
+    inline bool has_pending_control() const noexcept {
+        return !control_ring_.empty();
+    }
+
     [[nodiscard]]
     inline auto* peek_message() noexcept {
         auto* slot = message_ring_.peek_consumer_slot();
@@ -360,6 +386,47 @@ public:
     inline std::size_t pending_messages() noexcept {
         return message_ring_.used();
     }
+
+    // ---------------------------------------------------------------------
+    // Readiness notification (transport notification policy)
+    // ---------------------------------------------------------------------
+    //
+    // notification_fd() becomes readable when the transport publishes a
+    // message or a control event after prepare_wait() returned true.
+    // -1 when notifications are disabled.
+    //
+    // ---------------------------------------------------------------------
+    [[nodiscard]]
+    inline int notification_fd() const noexcept {
+        return notifier_.fd();
+    }
+
+    // Clears the previous wake-up and arms the next one.
+    // Returns true if no transport work is pending (safe to sleep on the fd),
+    // false if poll() must run first.
+    [[nodiscard]]
+    inline bool prepare_wait() noexcept {
+        if constexpr (!NOTIFIES) {
+            return false;
+        }
+        else {
+            if (!notifier_.is_open()) [[unlikely]] {
+                return false;
+            }
+            notifier_.consume();
+            notifier_.arm();
+            if (!control_ring_.empty() || message_ring_.used() > 0 || signals_.used() > 0) {
+                notifier_.disarm();
+                return false;
+            }
+            return true;
+        }
+    }
+
+    // Sleeps until the transport publishes work or the timeout expires
+    inline bool wait_notification(std::chrono::milliseconds timeout) noexcept {
+        return notifier_.wait(timeout);
+    }
        
 
     [[nodiscard]]
@@ -402,8 +469,17 @@ private:
     MessageRing& message_ring_;
 
     telemetry::Connection& telemetry_;   // Telemetry reference (not owned)
+
+    // Consumer wake-up channel (outlives every WS instance; opened only when WS notifies)
+    static constexpr bool NOTIFIES = requires { requires WS::notifies; };
+    lcr::system::event_notifier notifier_;
+
     std::unique_ptr<WS> ws_;                        // WebSocket instance (owned by Connection)
 
+    // Frames dropped by the transport frame filter (last observed value, current WS instance)
+    static constexpr bool FILTERS = requires { requires WS::filters; };
+    std::uint64_t filtered_seen_{0};
+
     // Current transport epoch (incremented on each websocket connection: exposed progress signal.)
     std::uint64_t epoch_{0};
 
@@ -687,6 +763,10 @@ private:
         message_ring_.clear();
         // Initialize transport
         ws_ = std::make_unique<WS>(control_ring_, message_ring_, telemetry_.websocket);
+        filtered_seen_ = 0;
+        if constexpr (NOTIFIES) {
+            ws_->set_notifier(&notifier_);
+        }
     }
 
     inline void destroy_transport_if_needed_() {
@@ -36,6 +36,7 @@ struct alignas(64) WebSocket final {
     lcr::metrics::atomic::counter64 bytes_tx_total;
     lcr::metrics::atomic::counter64 messages_rx_total;
     lcr::metrics::atomic::counter64 messages_tx_total;
+    lcr::metrics::atomic::counter64 messages_filtered_total;  // Messages dropped by the frame filter policy (never published)
 
     // --------------------------------------------------------
     // API activity
@@ -115,6 +116,7 @@ struct alignas(64) WebSocket final {
         bytes_tx_total.copy_to(other.bytes_tx_total);
         messages_rx_total.copy_to(other.messages_rx_total);
         messages_tx_total.copy_to(other.messages_tx_total);
+        messages_filtered_total.copy_to(other.messages_filtered_total);
 
         // API activity
         receive_calls_total.copy_to(other.receive_calls_total);
@@ -172,6 +174,7 @@ struct alignas(64) WebSocket final {
         os << "  TX bytes         : " << lcr::format_bytes(bytes_tx_total.load()) << '\n';
         os << "  RX messages      : " << lcr::format_number_exact(messages_rx_total.load()) << '\n';
         os << "  TX messages      : " << lcr::format_number_exact(messages_tx_total.load()) << '\n';
+        os << "  Filtered messages: " << lcr::format_number_exact(messages_filtered_total.load()) << '\n';
 
         // API activity
         os << "\nAPI Activity\n";
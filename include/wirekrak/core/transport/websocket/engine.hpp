@@ -18,10 +18,12 @@
 #include "wirekrak/core/config/transport/websocket.hpp"
 #include "wirekrak/core/config/backpressure.hpp"
 #include "wirekrak/core/telemetry.hpp"
+#include "wirekrak/core/perf/alloc_trace.hpp"
 #include "lcr/memory/footprint.hpp"
 #include "lcr/buffer/concepts.hpp"
 #include "lcr/lockfree/spsc_ring.hpp"
 #include "lcr/system/monotonic_clock.hpp"
+#include "lcr/system/event_notifier.hpp"
 #include "lcr/system/thread_affinity.hpp"
 #include "lcr/format.hpp"
 #include "lcr/log/logger.hpp"
@@ -39,6 +41,12 @@ template<
 >
 class Engine {
 public:
+    // Whether this engine wakes a consumer through an event_notifier
+    static constexpr bool notifies = PolicyBundle::notification::enabled;
+
+    // Whether this engine drops messages on the receive thread (frame filter policy)
+    static constexpr bool filters = PolicyBundle::frame_filter::enabled;
+
     explicit Engine(ControlRing& ctrl_ring, MessageRing& msg_ring, telemetry::WebSocket& telemetry) noexcept
         : control_ring_(ctrl_ring)
         , message_ring_(msg_ring)
@@ -113,11 +121,25 @@ public:
         WK_TRACE("[WS] WebSocket closed.");
     }
 
+    // Attach the consumer wake-up channel (notification policy enabled).
+    // Must be called before connect(): the receive thread reads it unguarded.
+    void set_notifier(lcr::system::event_notifier* notifier) noexcept {
+        notifier_ = notifier;
+    }
+
     [[nodiscard]]
     bool backpressure_active() const noexcept {
         return backpressure_active_;
     }
 
+    // Number of messages dropped by the frame filter policy (never published).
+    // Written by the receive thread only; lets the consumer account dropped
+    // frames as inbound traffic (liveness).
+    [[nodiscard]]
+    std::uint64_t filtered_messages() const noexcept {
+        return filtered_messages_.load(std::memory_order_relaxed);
+    }
+
     [[nodiscard]]
     telemetry::WebSocket& telemetry() noexcept {
         return telemetry_;
@@ -152,6 +174,15 @@ private:
     // Global transport-level backpressure state (independent of the individual FSMs)
     bool backpressure_active_{false};
 
+    // Frame filter policy
+    using FrameFilter = typename PolicyBundle::frame_filter;
+
+    // Messages dropped by the frame filter (single writer: receive thread)
+    std::atomic<std::uint64_t> filtered_messages_{0};
+
+    // Consumer wake-up channel (non-owning, only used when notifications are enabled)
+    lcr::system::event_notifier* notifier_{nullptr};
+
     // Compile-time backend
     Backend backend_;
 
@@ -182,6 +213,9 @@ private:
 
         lcr::system::pin_thread(3);
 
+        WK_ALLOC_THREAD(Receive);
+        WK_ALLOC_STAGE(Ingress);
+
 #ifdef WK_UNIT_TEST
     // Signal test that receive loop has started (for better synchronization in tests)
     if (receive_started_flag_) {
@@ -303,6 +337,17 @@ private:
                     WK_TL1( telemetry_.promoted_message_bytes.set(current_slot->size()) );
                 }
 
+                if constexpr (filters) {
+                    if (FrameFilter::drop(std::string_view{ current_slot->data(), current_slot->size() })) {
+                        message_ring_.discard_producer_slot(current_slot);
+                        filtered_messages_.store(filtered_messages_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                        WK_TL1( telemetry_.messages_filtered_total.inc() );
+                        current_slot = nullptr;
+                        fragments = 0;
+                        continue;
+                    }
+                }
+
                 WK_TL3(
                     if (samples_now) [[unlikely]] {
                         const auto slot_delivery_ts_ns = clock.now_ns();
@@ -314,6 +359,7 @@ private:
                 );
 
                 message_ring_.commit_producer_slot();
+                notify_consumer_();
                 current_slot = nullptr;
                 ++message_count;
                 fragments = 0;
@@ -522,9 +568,21 @@ private:
         if (!pushed) [[unlikely]] {
             WK_TL1( telemetry_.control_ring_failures_total.inc() );
         }
+        else {
+            notify_consumer_();
+        }
         return pushed;
     }
 
+    // Edge-triggered: only writes to the eventfd if the consumer is armed
+    inline void notify_consumer_() noexcept {
+        if constexpr (notifies) {
+            if (notifier_) {
+                notifier_->notify();
+            }
+        }
+    }
+
     void emit_backpressure_detected_() noexcept {
         WK_TL1( telemetry_.backpressure_detected_total.inc() );
         if (!emit_event_(transport::websocket::Event::make_backpressure_detected())) {
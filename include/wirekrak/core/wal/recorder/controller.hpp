@@ -6,6 +6,7 @@
 #include <condition_variable>
 #include <chrono>
 
+#include "wirekrak/core/perf/alloc_trace.hpp"
 #include "lcr/log/logger.hpp"
 
 
@@ -79,6 +80,8 @@ private:
     // ---------------------------------------------------------------------
     void run_loop_() {
         using namespace std::chrono;
+        WK_ALLOC_THREAD(Wal);
+        WK_ALLOC_STAGE(Wal);
         auto last_active = steady_clock::now();
 
         while (running_) {
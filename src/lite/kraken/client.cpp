@@ -85,7 +85,7 @@ struct Client::Impl {
             }
             // 2) Emit error callback if provided
             if (error_cb) {
-                error_cb(Error{ErrorCode::Rejected, rejection_msg.error});
+                error_cb(Error{ErrorCode::Rejected, rejection_msg.error.to_string()});
             }
         });
 
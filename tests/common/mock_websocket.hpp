@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <functional>
 #include <utility>
 #include <concepts>
@@ -51,6 +52,9 @@ public:
 
     inline bool send(std::string_view msg) noexcept {
         WK_DEBUG("[MockWebSocket] send() called: " << msg);
+        if (connected_) {
+            sent_.emplace_back(msg);
+        }
         return connected_;
     }
 
@@ -89,6 +93,18 @@ public:
         message_ring_.commit_producer_slot();
     }
 
+    inline void emit_backpressure_detected() noexcept {
+        if (!control_ring_.push(websocket::Event::make_backpressure_detected())) {
+            handle_control_ring_full_();
+        }
+    }
+
+    inline void emit_backpressure_cleared() noexcept {
+        if (!control_ring_.push(websocket::Event::make_backpressure_cleared())) {
+            handle_control_ring_full_();
+        }
+    }
+
     inline void emit_error(Error error = Error::TransportFailure) noexcept {
         error_count_++;
         if (!control_ring_.push(websocket::Event::make_error(error))) {
@@ -106,6 +122,10 @@ public:
     static inline int error_count() noexcept {
         return error_count_;
     }
+    // Messages sent while connected, in order
+    static inline const std::vector<std::string>& sent_messages() noexcept {
+        return sent_;
+    }
 
     // mutators
     static inline void set_next_connect_result(Error err) noexcept {
@@ -117,6 +137,7 @@ public:
         close_count_ = 0;
         error_count_ = 0;
         next_connect_result_ = Error::None;
+        sent_.clear();
     }
 
 private:
@@ -130,6 +151,7 @@ private:
     static inline int close_count_{0};
     static inline int error_count_{0};
     static inline Error next_connect_result_{Error::None};
+    static inline std::vector<std::string> sent_{};
 
     // Control event queue (for signaling events like close and error)
     ControlRing& control_ring_;
@@ -0,0 +1,558 @@
+/*
+===============================================================================
+ feed::BookStore - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • Ladder updates (insert / replace / delete / truncation) match a reference
+    book over long random update sequences, including window recentering
+  • Snapshots are bulk-loaded best first, unsorted input is still sorted
+  • Incremental analytics (top-N quantity, depth bands) match a recompute
+    from the full ladder over long random update sequences; microprice and
+    imbalance of a book
+  • Updates without a snapshot are counted and ignored
+  • Symbols beyond the store capacity are dropped and counted; find() by
+    name does not intern unknown symbols
+  • begin_epoch() invalidates books, expect_book() awaits one book until
+    its snapshot and measures the time to the full book, cancel_book()
+    drops a wait (per ticket) and restores the previous validity
+  • The router drives the waits: book subscribes with snapshot (including
+    re-subscribes of still-valid books after an unsubscribe) await,
+    rejections of the subscribe request and unsubscribes cancel, reconnects
+    start a new epoch
+  • The router streams book messages into an attached store: snapshots reach
+    the data plane as SnapshotApplied only, updates as UpdateApplied (or as
+    applied Response deltas when opted in), and the resulting books match
+    those built from Response messages
+
+===============================================================================
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "wirekrak/core/feed/book_store.hpp"
+#include "wirekrak/core/protocol/kraken/parser/router.hpp"
+#include "common/test_check.hpp"
+#include "common/json_helpers.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol;
+using namespace wirekrak::core::protocol::kraken;
+
+using Level = schema::book::Level;
+
+
+static schema::book::Response make_book(PayloadType type, std::string_view symbol,
+                                        std::vector<Level> bids, std::vector<Level> asks) {
+    schema::book::Response r{};
+    r.type = type;
+    r.book.symbol = Symbol{symbol};
+    r.book.bids = std::move(bids);
+    r.book.asks = std::move(asks);
+    r.book.checksum = 0;
+    return r;
+}
+
+template<class Ladder>
+static std::vector<Level> best_first(const Ladder& ladder) {
+    std::vector<Level> out;
+    for (std::size_t i = 0; i < ladder.size(); ++i) {
+        out.push_back(ladder[i]);
+    }
+    return out;
+}
+
+static bool same_levels(const std::vector<Level>& a, const std::vector<Level>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].price != b[i].price || a[i].qty != b[i].qty) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// ------------------------------------------------------------
+// 1 - Ladder against a reference book
+// ------------------------------------------------------------
+
+template<class Better>
+static void check_ladder_against_reference(std::uint64_t seed) {
+    constexpr std::size_t DEPTH = 16;
+    feed::BookLadder<DEPTH, Better> ladder;
+    std::map<double, double, Better> reference;   // best first
+
+    std::uint64_t state = seed;
+    auto next = [&state] {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    };
+
+    for (int step = 0; step < 20000; ++step) {
+        // Prices drift so inserts hit the top, the middle and the tail
+        const double price = 1000.0 + static_cast<double>(next() % 48) + ((step / 2000) % 3) * 8.0;
+        const double qty = (next() % 4 == 0) ? 0.0 : 1.0 + static_cast<double>(next() % 100);
+
+        ladder.apply({ price, qty });
+        if (qty > 0.0) {
+            reference[price] = qty;
+            if (reference.size() > DEPTH) {
+                reference.erase(std::prev(reference.end()));   // drop the worst
+            }
+        }
+        else {
+            reference.erase(price);
+        }
+
+        std::vector<Level> expected;
+        for (const auto& [p, q] : reference) {
+            expected.push_back({ p, q });
+        }
+        TEST_CHECK(same_levels(best_first(ladder), expected));
+    }
+}
+
+void test_ladder_reference() {
+    std::cout << "[TEST] Book ladder matches reference book\n";
+
+    check_ladder_against_reference<std::greater<>>(1);
+    check_ladder_against_reference<std::less<>>(2);
+    check_ladder_against_reference<std::greater<>>(3);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 1b - Incremental analytics against a full recompute
+// ------------------------------------------------------------
+
+using TestAnalytics = feed::BookAnalyticsPolicy<5, 10, 50, 200>;
+
+static bool near(double a, double b) {
+    return std::fabs(a - b) <= 1e-9 * std::max(1.0, std::fabs(b));
+}
+
+template<class Ladder>
+static bool analytics_match(const Ladder& ladder) {
+    const auto levels = best_first(ladder);
+    double top = 0.0;
+    for (std::size_t i = 0; i < levels.size() && i < TestAnalytics::top_levels; ++i) {
+        top += levels[i].qty;
+    }
+    if (!near(ladder.top_qty(), top)) {
+        return false;
+    }
+    for (std::size_t b = 0; b < Ladder::bands(); ++b) {
+        double band = 0.0;
+        for (const auto& l : levels) {
+            if (std::abs(l.price - levels[0].price) <= levels[0].price * TestAnalytics::band_bps[b] * 1e-4) {
+                band += l.qty;
+            }
+        }
+        if (!near(ladder.band_qty(b), band)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class Better>
+static void check_analytics_against_recompute(std::uint64_t seed) {
+    constexpr std::size_t DEPTH = 16;
+    feed::BookLadder<DEPTH, Better, TestAnalytics> ladder;
+
+    std::uint64_t state = seed;
+    auto next = [&state] {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    };
+
+    // 0.05% ticks around 1000: levels fall inside and outside every band
+    for (int step = 0; step < 20000; ++step) {
+        const double price = 1000.0 + static_cast<double>(next() % 48) * 0.5 + ((step / 2000) % 3) * 4.0;
+        const double qty = (next() % 4 == 0) ? 0.0 : 1.0 + static_cast<double>(next() % 100);
+        ladder.apply({ price, qty });
+        TEST_CHECK(analytics_match(ladder));
+
+        if (step % 5000 == 4999) {
+            std::vector<Level> levels;
+            for (int i = 0; i < 12; ++i) {
+                levels.push_back({ 1000.0 + (Better{}(1.0, 0.0) ? -i : i) * 0.5, 1.0 + i });
+            }
+            (void)ladder.assign_best_first(levels.data(), levels.size());
+            TEST_CHECK(analytics_match(ladder));
+        }
+    }
+    ladder.clear();
+    TEST_CHECK(ladder.top_qty() == 0.0 && ladder.band_qty(0) == 0.0);
+}
+
+void test_analytics() {
+    std::cout << "[TEST] Incremental book analytics match a recompute\n";
+
+    check_analytics_against_recompute<std::greater<>>(4);
+    check_analytics_against_recompute<std::less<>>(5);
+
+    feed::BookStore<8, 64, TestAnalytics> store;
+    TEST_CHECK(store.apply(make_book(PayloadType::Snapshot, "AN/USD",
+        {{100.0, 1.0}, {99.9, 2.0}, {99.0, 4.0}},
+        {{100.1, 3.0}, {100.2, 1.0}})));
+    const auto* book = store.find("AN/USD");
+    TEST_CHECK(book != nullptr);
+    TEST_CHECK(near(book->microprice(), (100.0 * 3.0 + 100.1 * 1.0) / 4.0));
+    TEST_CHECK(near(book->imbalance(), (7.0 - 4.0) / 11.0));
+    TEST_CHECK(near(book->bid_depth(0), 3.0));      // 10 bps: 100.0, 99.9
+    TEST_CHECK(near(book->bid_depth(2), 7.0));      // 200 bps: all
+    TEST_CHECK(near(book->ask_depth(0), 4.0));
+
+    // Deeper change: incremental, new best: recomputed
+    TEST_CHECK(store.apply(make_book(PayloadType::Update, "AN/USD", {{99.9, 0.0}}, {{100.05, 2.0}})));
+    TEST_CHECK(near(book->bid_depth(0), 1.0));
+    TEST_CHECK(near(book->ask_depth(0), 5.0) && near(book->ask_depth(2), 6.0));   // 100.2 is 15 bps away
+    TEST_CHECK(near(book->imbalance(), (5.0 - 6.0) / 11.0));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 2 - Snapshots, updates, orphans
+// ------------------------------------------------------------
+
+void test_snapshot_and_updates() {
+    std::cout << "[TEST] Book store snapshots and updates\n";
+
+    feed::BookStore<4, 64> store;
+
+    // Update before any snapshot: counted, ignored
+    TEST_CHECK(!store.apply(make_book(PayloadType::Update, "BS/USD", {{99.0, 1.0}}, {})));
+    TEST_CHECK(store.orphan_updates() == 1);
+    TEST_CHECK(store.find("BS/USD") == nullptr);
+
+    // Snapshot deeper than the store: truncated to depth
+    TEST_CHECK(store.apply(make_book(PayloadType::Snapshot, "BS/USD",
+        {{99.0, 1.0}, {98.0, 2.0}, {97.0, 3.0}, {96.0, 4.0}, {95.0, 5.0}},
+        {{101.0, 1.0}, {102.0, 2.0}})));
+    const auto* book = store.find("BS/USD");
+    TEST_CHECK(book != nullptr);
+    TEST_CHECK(book->bids.size() == 4 && book->asks.size() == 2);
+    TEST_CHECK(book->bids.best().price == 99.0 && book->asks.best().price == 101.0);
+    TEST_CHECK(book->bids[3].price == 96.0);
+    TEST_CHECK(store.unsorted_snapshots() == 0);
+
+    // New best bid pushes the worst out; delete and replace on asks
+    TEST_CHECK(store.apply(make_book(PayloadType::Update, "BS/USD",
+        {{99.5, 7.0}}, {{101.0, 0.0}, {102.0, 9.0}})));
+    TEST_CHECK(same_levels(best_first(book->bids), {{99.5, 7.0}, {99.0, 1.0}, {98.0, 2.0}, {97.0, 3.0}}));
+    TEST_CHECK(same_levels(best_first(book->asks), {{102.0, 9.0}}));
+    TEST_CHECK(book->snapshots == 1 && book->updates == 1);
+
+    // Unsorted snapshot is sorted on load
+    TEST_CHECK(store.apply(make_book(PayloadType::Snapshot, "BS/USD",
+        {{97.0, 1.0}, {99.0, 2.0}, {98.0, 3.0}}, {{103.0, 1.0}, {101.0, 2.0}})));
+    TEST_CHECK(store.unsorted_snapshots() == 1);
+    TEST_CHECK(same_levels(best_first(book->bids), {{99.0, 2.0}, {98.0, 3.0}, {97.0, 1.0}}));
+    TEST_CHECK(same_levels(best_first(book->asks), {{101.0, 2.0}, {103.0, 1.0}}));
+
+    // Lookup by name does not intern
+    SymbolId unknown{};
+    const auto interned = SymbolTable::instance().count();
+    TEST_CHECK(store.find("NEVER/SEEN") == nullptr);
+    TEST_CHECK(!find_symbol("NEVER/SEEN", unknown));
+    TEST_CHECK(SymbolTable::instance().count() == interned);
+
+    // Symbols beyond the store capacity: dropped and counted
+    feed::BookStore<4, 2> small;
+    (void)intern_symbol("CA/USD");
+    (void)intern_symbol("CB/USD");
+    TEST_CHECK(intern_symbol("CC/USD") >= 2);
+    TEST_CHECK(!small.apply(make_book(PayloadType::Snapshot, "CC/USD", {{1.0, 1.0}}, {{2.0, 1.0}})));
+    TEST_CHECK(!small.apply(make_book(PayloadType::Update, "CC/USD", {{1.0, 2.0}}, {})));
+    TEST_CHECK(small.dropped_symbols() == 2);
+    TEST_CHECK(small.orphan_updates() == 0);
+    TEST_CHECK(small.find("CC/USD") == nullptr);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 3 - Epochs and time to full book
+// ------------------------------------------------------------
+
+void test_epochs() {
+    std::cout << "[TEST] Book store epochs\n";
+
+    feed::BookStore<4, 64> store;
+    const SymbolId ea = intern_symbol("EA/USD");
+    const SymbolId eb = intern_symbol("EB/USD");
+    TEST_CHECK(store.apply(make_book(PayloadType::Snapshot, "EA/USD", {{1.0, 1.0}}, {{2.0, 1.0}})));
+    TEST_CHECK(store.find("EA/USD")->is_valid());
+    TEST_CHECK(store.pending_books() == 0);   // not awaited
+
+    // Reconnect: every book stale, then both symbols awaited
+    store.begin_epoch();
+    TEST_CHECK(!store.find("EA/USD")->is_valid());
+    store.expect_book(ea);
+    store.expect_book(eb);
+    store.expect_book(eb);   // awaited once
+    TEST_CHECK(store.pending_books() == 2);
+
+    TEST_CHECK(store.apply(make_book(PayloadType::Snapshot, "EA/USD", {{1.0, 2.0}}, {{2.0, 2.0}})));
+    TEST_CHECK(store.apply(make_book(PayloadType::Snapshot, "EA/USD", {{1.0, 3.0}}, {{2.0, 3.0}})));  // counted once
+    TEST_CHECK(store.pending_books() == 1);
+    TEST_CHECK(!store.awaiting(ea) && store.awaiting(eb));
+    TEST_CHECK(store.time_to_full_book_ns() == 0);
+
+    TEST_CHECK(store.apply(make_book(PayloadType::Snapshot, "EB/USD", {{5.0, 1.0}}, {{6.0, 1.0}})));
+    TEST_CHECK(store.pending_books() == 0);
+    TEST_CHECK(store.time_to_full_book_ns() > 0);
+    TEST_CHECK(store.find("EB/USD")->is_valid());
+
+    // Cancelling a wait restores the previous validity, only for its ticket
+    store.expect_book(ea, 7);
+    TEST_CHECK(!store.find("EA/USD")->is_valid() && store.pending_books() == 1);
+    store.cancel_book(ea, 8);
+    TEST_CHECK(store.pending_books() == 1);
+    store.cancel_book(ea, 7);
+    TEST_CHECK(store.pending_books() == 0 && !store.awaiting(ea));
+    TEST_CHECK(store.find("EA/USD")->is_valid());
+    store.cancel_book(ea);   // nothing awaited
+    TEST_CHECK(store.pending_books() == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 4 - Router streams book messages into the store
+// ------------------------------------------------------------
+
+using Store = feed::BookStore<25, 64>;
+
+struct StoreContext {
+    std::vector<schema::book::SnapshotApplied> applied;
+    std::vector<schema::book::UpdateApplied> updated;
+    std::vector<schema::book::Response> responses;
+
+    bool push(schema::book::SnapshotApplied&& e) noexcept { applied.push_back(std::move(e)); return true; }
+    bool push(schema::book::UpdateApplied&& e) noexcept { updated.push_back(std::move(e)); return true; }
+    bool push(schema::book::Response&& r) noexcept { responses.push_back(std::move(r)); return true; }
+    bool push(schema::trade::Response&&) noexcept { return true; }
+    bool push(schema::rejection::Notice&&) noexcept { return true; }
+    void set(schema::system::Pong&&) noexcept {}
+    void set(schema::status::Update&&) noexcept {}
+
+    template<class Request>
+    void on_subscribe_ack(ctrl::req_id_t, Symbol, bool) noexcept {}
+    template<class Request>
+    void on_unsubscribe_ack(ctrl::req_id_t, Symbol, bool) noexcept {}
+    void on_rejection(ctrl::req_id_t, Symbol) noexcept {}
+    void on_request_rejected(ctrl::req_id_t) noexcept {}
+};
+
+static std::string book_frame(std::string_view type, std::string_view symbol,
+                              const std::vector<Level>& bids, const std::vector<Level>& asks) {
+    auto side = [](const std::vector<Level>& levels) {
+        std::string s = "[";
+        for (std::size_t i = 0; i < levels.size(); ++i) {
+            s += (i ? "," : "");
+            s += "{\"price\":" + std::to_string(levels[i].price) + ",\"qty\":" + std::to_string(levels[i].qty) + "}";
+        }
+        return s + "]";
+    };
+    return std::string(R"({"channel":"book","type":")") + std::string(type) + R"(","data":[{"symbol":")"
+        + std::string(symbol) + R"(","bids":)" + side(bids) + R"(,"asks":)" + side(asks)
+        + R"(,"checksum":42,"timestamp":"2023-10-06T17:35:55.440295Z"}]})";
+}
+
+template<class Validation, bool CopyDeltas>
+static void check_streamed_router() {
+    Store streamed;
+    Store reference;
+    parser::Router<Validation, NoChannelFilter, book_sink::Into<Store, CopyDeltas>> router;
+    parser::Router<Validation> plain;
+    router.attach_book_store(streamed);
+
+    StoreContext ctx;
+    StoreContext plain_ctx;
+    Method method{};
+    Channel channel{};
+
+    std::vector<Level> bids, asks;
+    for (int i = 0; i < 25; ++i) {
+        bids.push_back({ 100.0 - i * 0.5, 1.0 + i });
+        asks.push_back({ 100.5 + i * 0.5, 2.0 + i });
+    }
+    const std::string frames[] = {
+        book_frame("snapshot", "RS/USD", bids, asks),
+        book_frame("update", "RS/USD", {{100.25, 3.0}}, {{100.5, 0.0}}),
+        book_frame("update", "RS/USD", {{99.0, 0.0}, {98.0, 5.0}}, {{100.75, 1.5}}),
+    };
+    for (const auto& frame : frames) {
+        TEST_CHECK(router.parse_and_route(ctx, frame, method, channel) == MessageResult::Delivered);
+        TEST_CHECK(plain.parse_and_route(plain_ctx, frame, method, channel) == MessageResult::Delivered);
+    }
+
+    // Snapshot: a single lightweight event
+    TEST_CHECK(ctx.applied.size() == 1);
+    TEST_CHECK(ctx.applied[0].symbol == Symbol{"RS/USD"});
+    TEST_CHECK(ctx.applied[0].bid_levels == 25 && ctx.applied[0].ask_levels == 25);
+    TEST_CHECK(ctx.applied[0].checksum == 42 && ctx.applied[0].timestamp.has());
+
+    // Updates: lightweight events, or applied deltas when opted in
+    if constexpr (CopyDeltas) {
+        TEST_CHECK(ctx.updated.empty());
+        TEST_CHECK(ctx.responses.size() == 2);
+        TEST_CHECK(ctx.responses[0].type == PayloadType::Update);
+        TEST_CHECK(ctx.responses[1].book.bids.size() == 2);
+    }
+    else {
+        TEST_CHECK(ctx.responses.empty());
+        TEST_CHECK(ctx.updated.size() == 2);
+        TEST_CHECK(ctx.updated[1].symbol == Symbol{"RS/USD"});
+        TEST_CHECK(ctx.updated[1].bid_levels == 2 && ctx.updated[1].ask_levels == 1);
+        TEST_CHECK(ctx.updated[1].checksum == 42);
+    }
+
+    // Same books as the Response path
+    for (const auto& r : plain_ctx.responses) {
+        (void)reference.apply(r);
+    }
+    const auto* a = streamed.find("RS/USD");
+    const auto* b = reference.find("RS/USD");
+    TEST_CHECK(a != nullptr && b != nullptr);
+    TEST_CHECK(same_levels(best_first(a->bids), best_first(b->bids)));
+    TEST_CHECK(same_levels(best_first(a->asks), best_first(b->asks)));
+    TEST_CHECK(a->bids.size() == 24 && a->bids.best().price == 100.25);   // one in, one out, one deleted
+    TEST_CHECK(a->asks.best().price == 100.75);
+    TEST_CHECK(a->checksum == 42 && a->updates == 2);
+}
+
+void test_router_streams_into_store() {
+    std::cout << "[TEST] Router streams book messages into the store\n";
+
+    check_streamed_router<policy::protocol::validation::Strict, false>();
+    check_streamed_router<policy::protocol::validation::Structural, false>();
+    check_streamed_router<policy::protocol::validation::Trusted, false>();
+    check_streamed_router<policy::protocol::validation::Strict, true>();
+
+    // Without an attached store, the sink falls back to Response messages
+    parser::Router<policy::protocol::DefaultValidation, NoChannelFilter, book_sink::Into<Store>> detached;
+    StoreContext ctx;
+    Method method{};
+    Channel channel{};
+    const auto frame = book_frame("snapshot", "RS/USD", {{1.0, 1.0}}, {{2.0, 1.0}});
+    TEST_CHECK(detached.parse_and_route(ctx, frame, method, channel) == MessageResult::Delivered);
+    TEST_CHECK(ctx.applied.empty() && ctx.responses.size() == 1);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 5 - Session hooks through the router
+// ------------------------------------------------------------
+
+void test_router_epoch_hooks() {
+    std::cout << "[TEST] Router drives book epochs\n";
+
+    Store store;
+    parser::Router<policy::protocol::DefaultValidation, NoChannelFilter, book_sink::Into<Store>> router;
+    router.attach_book_store(store);
+    StoreContext ctx;
+    Method method{};
+    Channel channel{};
+    auto snapshot = [&](std::string_view symbol) {
+        return router.parse_and_route(ctx, book_frame("snapshot", symbol, {{1.0, 1.0}}, {{2.0, 1.0}}), method, channel)
+            == MessageResult::Delivered;
+    };
+    auto subscribe = [&](std::string_view symbol, std::uint64_t req_id) {
+        router.on_subscribe(schema::book::Subscribe{ .symbols = {Symbol{symbol}}, .req_id = req_id });
+    };
+    TEST_CHECK(snapshot("HA/USD") && snapshot("HB/USD"));
+    TEST_CHECK(store.pending_books() == 0);
+
+    // Subscribes with snapshot await their books, without snapshot do not
+    router.on_subscribe(schema::book::Subscribe{ .symbols = {Symbol{"HC/USD"}, Symbol{"HD/USD"}}, .req_id = 10 });
+    router.on_subscribe(schema::book::Subscribe{ .symbols = {Symbol{"HE/USD"}}, .snapshot = false, .req_id = 11 });
+    TEST_CHECK(store.pending_books() == 2);
+
+    // A rejected symbol stops being awaited; a rejection of another request does not
+    const auto reject = [&](std::uint64_t req_id, std::string_view symbol) {
+        const auto frame = json::ack::rejection_notice("subscribe", req_id, Symbol{symbol}, "Currency pair not supported");
+        (void)router.parse_and_route(ctx, frame, method, channel);
+    };
+    reject(10, "HD/USD");
+    TEST_CHECK(store.pending_books() == 1);
+    reject(12, "HC/USD");
+    TEST_CHECK(store.pending_books() == 1);
+    TEST_CHECK(snapshot("HC/USD"));
+    TEST_CHECK(store.pending_books() == 0);
+    TEST_CHECK(store.time_to_full_book_ns() > 0);
+
+    // A rejected book stays absent; subscribing it again restarts the wait
+    TEST_CHECK(store.find("HD/USD") == nullptr);
+    subscribe("HD/USD", 13);
+    TEST_CHECK(store.pending_books() == 1 && store.time_to_full_book_ns() == 0);
+    TEST_CHECK(snapshot("HD/USD"));
+    TEST_CHECK(store.pending_books() == 0 && store.time_to_full_book_ns() > 0);
+
+    // Re-subscribe after unsubscribe: the still-valid book is stale until
+    // its new snapshot
+    router.on_unsubscribe(schema::book::Unsubscribe{ .symbols = {Symbol{"HA/USD"}} });
+    TEST_CHECK(store.pending_books() == 0);
+    subscribe("HA/USD", 14);
+    TEST_CHECK(!store.find("HA/USD")->is_valid() && store.pending_books() == 1);
+    TEST_CHECK(snapshot("HA/USD"));
+    TEST_CHECK(store.find("HA/USD")->is_valid() && store.pending_books() == 0);
+
+    // Unsubscribe before the snapshot cancels the wait, a new subscribe awaits again
+    subscribe("HB/USD", 15);
+    router.on_unsubscribe(schema::book::Unsubscribe{ .symbols = {Symbol{"HB/USD"}} });
+    TEST_CHECK(store.pending_books() == 0 && store.find("HB/USD")->is_valid());
+    subscribe("HB/USD", 16);
+    TEST_CHECK(store.pending_books() == 1);
+    TEST_CHECK(snapshot("HB/USD"));
+    TEST_CHECK(store.pending_books() == 0);
+
+    // A rejection of a live book (e.g. already subscribed) keeps it valid
+    subscribe("HA/USD", 17);
+    reject(17, "HA/USD");
+    TEST_CHECK(store.pending_books() == 0 && store.find("HA/USD")->is_valid());
+
+    // Reconnect invalidates every book and forgets the waits
+    subscribe("HC/USD", 18);
+    router.on_reconnect();
+    TEST_CHECK(!store.find("HA/USD")->is_valid() && !store.find("HB/USD")->is_valid());
+    TEST_CHECK(store.pending_books() == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_ladder_reference();
+    test_analytics();
+    test_snapshot_and_updates();
+    test_epochs();
+    test_router_streams_into_store();
+    test_router_epoch_hooks();
+
+    std::cout << "\n[GROUP] Book store tests passed!\n";
+    return 0;
+}
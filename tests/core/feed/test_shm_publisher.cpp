@@ -0,0 +1,199 @@
+/*
+===============================================================================
+ feed::Publisher over shared-memory rings - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • Rings created in a memfd segment are attachable through a second,
+    independent mapping (different address → position independence)
+  • Versioned header rejects mismatching layouts
+  • Trades and book levels are normalized into MarketEvent records
+  • Consumers attach at the live edge and read independently
+  • A full ring drops events without blocking and leaves sequence gaps
+
+===============================================================================
+*/
+
+#include <iostream>
+#include <unistd.h>
+
+#include "wirekrak/core/feed/publisher.hpp"
+#include "lcr/system/shared_memory.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol::kraken;
+
+using FanoutRing = feed::SharedFanoutRing<8, 4>;
+using SpscRing   = feed::SharedSpscRing<8>;
+
+
+static schema::trade::Response make_trades(int count) {
+    schema::trade::Response r{};
+    r.type = PayloadType::Update;
+    for (int i = 0; i < count; ++i) {
+        schema::trade::Trade t{};
+        t.trade_id = 100 + i;
+        t.symbol = Symbol{"BTC/USD"};
+        t.price = 50000.0 + i;
+        t.qty = 0.5;
+        t.side = (i % 2) ? Side::Sell : Side::Buy;
+        t.timestamp = Timestamp{std::chrono::nanoseconds{1'000 + i}};
+        r.trades.push_back(t);
+    }
+    return r;
+}
+
+static schema::book::Response make_book() {
+    schema::book::Response r{};
+    r.type = PayloadType::Snapshot;
+    r.book.symbol = Symbol{"ETH/USD"};
+    r.book.asks = {{4001.0, 1.0}, {4002.0, 2.0}};
+    r.book.bids = {{3999.0, 3.0}};
+    r.book.checksum = 12345;
+    return r;
+}
+
+
+// ------------------------------------------------------------
+// 1 - Cross-mapping attach and fan-out delivery
+// ------------------------------------------------------------
+
+void test_fanout_cross_mapping() {
+    std::cout << "[TEST] Shared fan-out ring across mappings\n";
+
+    lcr::system::shared_memory producer_shm;
+    TEST_CHECK(producer_shm.create_anonymous("wk-test", FanoutRing::required_bytes()));
+
+    auto* producer_ring = FanoutRing::create(producer_shm.data(), producer_shm.size());
+    TEST_CHECK(producer_ring != nullptr);
+
+    // Second, independent mapping of the same segment
+    lcr::system::shared_memory consumer_shm;
+    TEST_CHECK(consumer_shm.open_fd(::dup(producer_shm.fd())));
+    TEST_CHECK(consumer_shm.data() != producer_shm.data());
+
+    auto* consumer_ring = FanoutRing::attach(consumer_shm.data(), consumer_shm.size());
+    TEST_CHECK(consumer_ring != nullptr);
+
+    // Layout mismatch is rejected by the versioned header
+    TEST_CHECK((feed::SharedFanoutRing<16, 4>::attach(consumer_shm.data(), consumer_shm.size()) == nullptr));
+
+    auto a = consumer_ring->attach_consumer();
+    auto b = consumer_ring->attach_consumer();
+    TEST_CHECK(a != FanoutRing::INVALID_CONSUMER && b != FanoutRing::INVALID_CONSUMER);
+
+    feed::Publisher<FanoutRing> publisher(*producer_ring);
+    TEST_CHECK(publisher.publish(make_trades(2)) == 2);
+    TEST_CHECK(publisher.publish(make_book()) == 3);
+
+    // Consumer A sees everything, in order
+    feed::MarketEvent ev;
+    TEST_CHECK(consumer_ring->pop(a, ev));
+    TEST_CHECK(ev.type == feed::EventType::Trade);
+    TEST_CHECK(ev.symbol_view() == "BTC/USD");
+    TEST_CHECK(ev.aux == 100 && ev.side == feed::EventSide::Buy);
+    TEST_CHECK(ev.ts_ns == 1'000);
+    TEST_CHECK(ev.flags == feed::event_flags::FirstInMessage);
+
+    TEST_CHECK(consumer_ring->pop(a, ev));
+    TEST_CHECK(ev.aux == 101 && ev.side == feed::EventSide::Sell);
+    TEST_CHECK(ev.flags == feed::event_flags::LastInMessage);
+
+    TEST_CHECK(consumer_ring->pop(a, ev));
+    TEST_CHECK(ev.type == feed::EventType::BookLevel);
+    TEST_CHECK(ev.symbol_view() == "ETH/USD");
+    TEST_CHECK(ev.side == feed::Ask && ev.price == 4001.0);
+    TEST_CHECK(ev.flags == (feed::event_flags::Snapshot | feed::event_flags::FirstInMessage));
+
+    TEST_CHECK(consumer_ring->pop(a, ev));
+    TEST_CHECK(consumer_ring->pop(a, ev));
+    TEST_CHECK(ev.side == feed::Bid && ev.qty == 3.0);
+    TEST_CHECK(ev.aux == 12345);
+    TEST_CHECK(ev.flags & feed::event_flags::LastInMessage);
+    TEST_CHECK(ev.seq == 4);
+    TEST_CHECK(!consumer_ring->pop(a, ev));
+
+    // Consumer B reads independently (zero-copy)
+    TEST_CHECK(consumer_ring->lag(b) == 5);
+    const feed::MarketEvent* p = consumer_ring->peek(b);
+    TEST_CHECK(p && p->seq == 0);
+    consumer_ring->release(b);
+    TEST_CHECK(consumer_ring->lag(b) == 4);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 2 - Full ring drops without blocking (sequence gaps visible)
+// ------------------------------------------------------------
+
+void test_full_ring_drops() {
+    std::cout << "[TEST] Full shared ring drops events\n";
+
+    lcr::system::shared_memory shm;
+    TEST_CHECK(shm.create_anonymous("wk-test", SpscRing::required_bytes()));
+
+    auto* ring = SpscRing::create(shm.data(), shm.size());
+    TEST_CHECK(ring != nullptr);
+
+    feed::Publisher<SpscRing> publisher(*ring);
+    TEST_CHECK(publisher.publish(make_trades(10)) == 8);
+    TEST_CHECK(publisher.dropped() == 2);
+    TEST_CHECK(publisher.next_sequence() == 10);
+
+    feed::MarketEvent ev;
+    while (ring->pop(ev)) {}
+
+    TEST_CHECK(publisher.publish(make_trades(1)) == 1);
+    TEST_CHECK(ring->pop(ev));
+    TEST_CHECK(ev.seq == 10); // gap [8, 9] visible to the consumer
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 3 - Consumers attach at the live edge and can detach
+// ------------------------------------------------------------
+
+void test_consumer_attach_detach() {
+    std::cout << "[TEST] Shared fan-out consumer attach/detach\n";
+
+    lcr::system::shared_memory shm;
+    TEST_CHECK(shm.create_anonymous("wk-test", FanoutRing::required_bytes()));
+    auto* ring = FanoutRing::create(shm.data(), shm.size());
+
+    feed::Publisher<FanoutRing> publisher(*ring);
+
+    auto slow = ring->attach_consumer();
+    TEST_CHECK(publisher.publish(make_trades(8)) == 8);
+    TEST_CHECK(publisher.publish(make_trades(1)) == 0); // slow consumer pins the ring
+
+    // Late consumer starts at the live edge
+    auto late = ring->attach_consumer();
+    TEST_CHECK(ring->lag(late) == 0);
+
+    // Detaching the slow consumer releases the producer
+    ring->detach_consumer(slow);
+    TEST_CHECK(ring->active_consumers() == 1);
+    TEST_CHECK(publisher.publish(make_trades(1)) == 1);
+    TEST_CHECK(ring->lag(late) == 1);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_fanout_cross_mapping();
+    test_full_ring_drops();
+    test_consumer_attach_detach();
+
+    std::cout << "\n[GROUP] Shared-memory publisher tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,240 @@
+/*
+===============================================================================
+ feed::TopOfBookTable - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • Book snapshots set the best bid/ask from the first level of each side
+  • Book updates move the top only when they reach it
+  • Deleting the best level promotes the next level
+  • Levels deeper than a truncated shadow ladder never become the best
+  • Trades update the last trade without touching the quote
+  • Readers on another thread never observe a torn row
+
+===============================================================================
+*/
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+#include "wirekrak/core/feed/top_of_book.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol::kraken;
+
+
+static schema::book::Response make_book(PayloadType type,
+                                        std::vector<schema::book::Level> bids,
+                                        std::vector<schema::book::Level> asks) {
+    schema::book::Response r{};
+    r.type = type;
+    r.book.symbol = Symbol{"TOB/USD"};
+    r.book.bids = std::move(bids);
+    r.book.asks = std::move(asks);
+    return r;
+}
+
+
+// ------------------------------------------------------------
+// 1 - Snapshot, updates and deletions
+// ------------------------------------------------------------
+
+void test_book_updates() {
+    std::cout << "[TEST] Top of book from book messages\n";
+
+    feed::TopOfBookTable<> tob;
+    const SymbolId id = intern_symbol("TOB/USD");
+    feed::TopOfBook q;
+
+    tob.on_book(make_book(PayloadType::Snapshot, {{99.0, 1.0}, {98.0, 2.0}}, {{101.0, 3.0}, {102.0, 4.0}}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(q.bid_price == 99.0 && q.bid_qty == 1.0);
+    TEST_CHECK(q.ask_price == 101.0 && q.ask_qty == 3.0);
+    TEST_CHECK(q.microprice() == (99.0 * 3.0 + 101.0 * 1.0) / 4.0);   // leans to the thinner ask
+    TEST_CHECK(tob.update_sequence(id) == 1);
+
+    // Deeper level changes do not move the top
+    tob.on_book(make_book(PayloadType::Update, {{97.0, 5.0}}, {{103.0, 5.0}}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(q.bid_price == 99.0 && q.ask_price == 101.0);
+
+    // Improvement and size change at the top
+    tob.on_book(make_book(PayloadType::Update, {{99.5, 2.0}}, {{101.0, 7.0}}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(q.bid_price == 99.5 && q.bid_qty == 2.0);
+    TEST_CHECK(q.ask_price == 101.0 && q.ask_qty == 7.0);
+
+    // Deleting the best promotes the next level
+    tob.on_book(make_book(PayloadType::Update, {{99.5, 0.0}}, {}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(q.bid_price == 99.0 && q.bid_qty == 1.0);
+    TEST_CHECK(q.has_ask());
+    TEST_CHECK(q.microprice() == (99.0 * 7.0 + 101.0 * 1.0) / 8.0);
+    TEST_CHECK(tob.update_sequence(id) == 4);
+
+    // A deeper update after the delete does not become the best
+    tob.on_book(make_book(PayloadType::Update, {{97.0, 9.0}}, {{101.0, 0.0}}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(q.bid_price == 99.0 && q.bid_qty == 1.0);
+    TEST_CHECK(q.ask_price == 102.0 && q.ask_qty == 4.0);
+
+    // Deleting every level empties the side
+    tob.on_book(make_book(PayloadType::Update, {{99.0, 0.0}, {98.0, 0.0}, {97.0, 0.0}}, {}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(!q.has_bid());
+    TEST_CHECK(q.microprice() == 0.0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 2 - Truncated shadow ladder
+// ------------------------------------------------------------
+
+void test_truncated_shadow() {
+    std::cout << "[TEST] Top of book with a truncated shadow ladder\n";
+
+    feed::TopOfBookTable<4096, 2> tob;
+    const SymbolId id = intern_symbol("TOB/USD");
+    feed::TopOfBook q;
+
+    // bids 100 / 99 / 98: only 100 and 99 are shadowed
+    tob.on_book(make_book(PayloadType::Snapshot, {{100.0, 1.0}, {99.0, 2.0}, {98.0, 3.0}}, {{101.0, 1.0}}));
+
+    tob.on_book(make_book(PayloadType::Update, {{100.0, 0.0}}, {}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(q.bid_price == 99.0 && q.bid_qty == 2.0);
+
+    // 98 is below the truncated ladder: its rank is unknown, 99 stays best
+    tob.on_book(make_book(PayloadType::Update, {{98.0, 5.0}}, {}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(q.bid_price == 99.0 && q.bid_qty == 2.0);
+
+    // Better levels are still tracked
+    tob.on_book(make_book(PayloadType::Update, {{99.5, 4.0}}, {}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(q.bid_price == 99.5 && q.bid_qty == 4.0);
+
+    // Exhausting the ladder empties the side until the next snapshot
+    tob.on_book(make_book(PayloadType::Update, {{99.5, 0.0}, {99.0, 0.0}}, {}));
+    tob.on_book(make_book(PayloadType::Update, {{98.0, 6.0}}, {}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(!q.has_bid());
+
+    tob.on_book(make_book(PayloadType::Snapshot, {{98.0, 6.0}}, {{101.0, 1.0}}));
+    TEST_CHECK(tob.try_load(id, q));
+    TEST_CHECK(q.bid_price == 98.0 && q.bid_qty == 6.0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 3 - Trades update last trade only
+// ------------------------------------------------------------
+
+void test_trades() {
+    std::cout << "[TEST] Top of book from trade messages\n";
+
+    feed::TopOfBookTable<> tob;
+    const SymbolId id = intern_symbol("TOB/USD");
+
+    tob.set_quote(id, 10.0, 1.0, 11.0, 1.0, 0);
+
+    schema::trade::Response r{};
+    for (int i = 0; i < 3; ++i) {
+        schema::trade::Trade t{};
+        t.symbol = Symbol{"TOB/USD"};
+        t.price = 10.5 + i;
+        t.qty = 1.0 + i;
+        t.timestamp = Timestamp{std::chrono::nanoseconds{500 + i}};
+        r.trades.push_back(t);
+    }
+    tob.on_trade(r);
+
+    feed::TopOfBook q;
+    (void)tob.load(id, q);
+    TEST_CHECK(q.last_price == 12.5 && q.last_qty == 3.0);
+    TEST_CHECK(q.ts_ns == 502);
+    TEST_CHECK(q.bid_price == 10.0 && q.ask_price == 11.0);
+    TEST_CHECK(tob.update_sequence(id) == 2); // one store per symbol run
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 4 - Concurrent readers never see torn rows
+// ------------------------------------------------------------
+
+void test_concurrent_readers() {
+    std::cout << "[TEST] Top of book concurrent readers\n";
+
+    feed::TopOfBookTable<> tob;
+    const SymbolId id = intern_symbol("TOB/USD");
+    constexpr int N = 200000;
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> torn{false};
+    std::atomic<std::uint64_t> reads{0};
+
+    auto reader = [&] {
+        feed::TopOfBook q;
+        while (!done.load(std::memory_order_acquire)) {
+            if (tob.try_load(id, q)) {
+                // Writer keeps the quote fields equal to one counter, the last
+                // trade is either that counter or the previous one
+                if (q.bid_price != q.ask_price || q.bid_qty != q.ask_qty ||
+                    q.ts_ns != static_cast<std::int64_t>(q.bid_price) ||
+                    (q.last_price != q.bid_price && q.last_price != q.bid_price - 1.0)) {
+                    torn.store(true);
+                }
+                reads.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    std::thread r1(reader);
+    std::thread r2(reader);
+
+    for (int i = 1; i <= N; ++i) {
+        const double v = static_cast<double>(i);
+        tob.set_quote(id, v, v, v, v, i);
+        schema::trade::Response r{};
+        schema::trade::Trade t{};
+        t.symbol = Symbol{"TOB/USD"};
+        t.price = v;
+        t.qty = v;
+        t.timestamp = Timestamp{std::chrono::nanoseconds{i}};
+        r.trades.push_back(t);
+        tob.on_trade(r);
+    }
+
+    done.store(true, std::memory_order_release);
+    r1.join();
+    r2.join();
+
+    TEST_CHECK(!torn.load());
+    TEST_CHECK(reads.load() > 0);
+    TEST_CHECK(tob.update_sequence(id) == 2u * N);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_book_updates();
+    test_truncated_shadow();
+    test_trades();
+    test_concurrent_readers();
+
+    std::cout << "\n[GROUP] Top of book tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,436 @@
+/*
+===============================================================================
+ feed::TradeAggregator - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • OHLCV bars of several intervals, closed by the first trade of a later
+    bucket, empty buckets produce no bar
+  • Late and duplicate trades are skipped and counted, as are trades of
+    symbols beyond the aggregator capacity
+  • EWMA VWAP halves the weight of a trade every half-life
+  • close_expired() closes bars of quiet symbols
+  • Random trade streams match a reference model
+  • A session with trade_sink::Into publishes BarClose on the data plane and
+    the latest one in the state plane, trades are still delivered
+  • No heap allocation after construction (allocation tracer)
+
+===============================================================================
+*/
+
+#define WIREKRAK_ENABLE_ALLOC_TRACE
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "wirekrak/core/feed/trade_aggregator.hpp"
+#include "wirekrak/core/perf/alloc_trace.hpp"
+#include "wirekrak/core/perf/alloc_trace_install.hpp"
+#include "common/harness/session.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core::protocol::kraken::test;
+using schema::trade::BarClose;
+
+// ------------------------------------------------------------
+// Utility
+// ------------------------------------------------------------
+
+static constexpr std::int64_t SEC = 1'000'000'000LL;
+
+// 1s and 10s bars, 10s VWAP half-life
+using TestBars = feed::BarPolicy<MAX_INTERNED_SYMBOLS, 10 * SEC, 1 * SEC, 10 * SEC>;
+using Aggregator = feed::TradeAggregator<TestBars>;
+
+static schema::trade::Trade make_trade(const char* symbol, std::uint64_t id, double price, double qty, std::int64_t ts_ns) {
+    schema::trade::Trade t{};
+    t.trade_id = id;
+    t.symbol = Symbol{symbol};
+    t.price = price;
+    t.qty = qty;
+    t.side = Side::Buy;
+    t.timestamp = Timestamp{std::chrono::nanoseconds{ts_ns}};
+    return t;
+}
+
+static schema::trade::Response make_response(std::vector<schema::trade::Trade> trades) {
+    schema::trade::Response r{};
+    r.type = PayloadType::Update;
+    r.trades = std::move(trades);
+    return r;
+}
+
+struct Collector {
+    std::vector<BarClose> bars;
+
+    inline void operator()(const BarClose& bar) noexcept {
+        bars.push_back(bar);
+    }
+};
+
+static bool near(double a, double b) {
+    return std::fabs(a - b) <= 1e-9 * std::max(1.0, std::fabs(b));
+}
+
+
+// ------------------------------------------------------------
+// Bars
+// ------------------------------------------------------------
+
+void test_bars() {
+    std::cout << "[TEST] OHLCV bars close on the next bucket\n";
+
+    Aggregator agg;
+    Collector out;
+    const SymbolId sid = intern_symbol("AGG/USD");
+    const std::int64_t t0 = 1'700'000'000LL * SEC;   // aligned on 10s
+
+    agg.on_trades(make_response({
+        make_trade("AGG/USD", 1, 100.0, 1.0, t0 + 100'000'000),
+        make_trade("AGG/USD", 2, 104.0, 2.0, t0 + 200'000'000),
+        make_trade("AGG/USD", 3,  99.0, 1.0, t0 + 900'000'000),
+    }), out);
+    TEST_CHECK(out.bars.empty());
+
+    feed::Bar bar;
+    TEST_CHECK(agg.current(sid, 0, bar));
+    TEST_CHECK(bar.start_ns == t0 && bar.trades == 3);
+    TEST_CHECK(bar.open == 100.0 && bar.high == 104.0 && bar.low == 99.0 && bar.close == 99.0);
+    TEST_CHECK(bar.volume == 4.0 && near(bar.vwap(), (100.0 + 208.0 + 99.0) / 4.0));
+
+    // Next second closes the 1s bar only
+    agg.on_trades(make_response({ make_trade("AGG/USD", 4, 101.0, 1.0, t0 + SEC + 1) }), out);
+    TEST_CHECK(out.bars.size() == 1);
+    TEST_CHECK(out.bars[0].symbol == Symbol{"AGG/USD"});
+    TEST_CHECK(out.bars[0].interval_ns == 1 * SEC);
+    TEST_CHECK(out.bars[0].open_time.time_since_epoch().count() == t0);
+    TEST_CHECK(out.bars[0].open == 100.0 && out.bars[0].close == 99.0 && out.bars[0].trades == 3);
+    TEST_CHECK(near(out.bars[0].vwap, 407.0 / 4.0));
+
+    // Gap: the empty seconds produce no bar, the 10s bar closes with all trades
+    agg.on_trades(make_response({ make_trade("AGG/USD", 5, 110.0, 1.0, t0 + 12 * SEC) }), out);
+    TEST_CHECK(out.bars.size() == 3);
+    TEST_CHECK(out.bars[1].interval_ns == 1 * SEC && out.bars[1].open_time.time_since_epoch().count() == t0 + SEC);
+    TEST_CHECK(out.bars[2].interval_ns == 10 * SEC && out.bars[2].trades == 4);
+    TEST_CHECK(out.bars[2].high == 104.0 && out.bars[2].low == 99.0 && out.bars[2].close == 101.0);
+    TEST_CHECK(out.bars[2].volume == 5.0);
+
+    TEST_CHECK(agg.current(sid, 1, bar));
+    TEST_CHECK(bar.start_ns == t0 + 10 * SEC && bar.open == 110.0 && bar.trades == 1);
+    TEST_CHECK(agg.trades_total() == 5 && agg.bars_closed_total() == 3);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// Late and duplicate trades
+// ------------------------------------------------------------
+
+void test_late_and_duplicate_trades() {
+    std::cout << "[TEST] Late and duplicate trades are skipped\n";
+
+    Aggregator agg;
+    Collector out;
+    const SymbolId sid = intern_symbol("LATE/USD");
+    const std::int64_t t0 = 1'700'000'000LL * SEC;
+
+    agg.on_trades(make_response({
+        make_trade("LATE/USD", 10, 50.0, 1.0, t0),
+        make_trade("LATE/USD", 11, 51.0, 1.0, t0 + 2 * SEC),   // closes the first 1s bar
+    }), out);
+    TEST_CHECK(out.bars.size() == 1);
+
+    // Trade snapshot replayed after a reconnect: already aggregated
+    agg.on_trades(make_response({
+        make_trade("LATE/USD", 10, 50.0, 1.0, t0),
+        make_trade("LATE/USD", 11, 51.0, 1.0, t0 + 2 * SEC),
+    }), out);
+    TEST_CHECK(agg.duplicate_trades_total() == 2);
+    TEST_CHECK(agg.trades_total() == 2);
+
+    // New trade stamped in the closed second: only the 10s bar takes it
+    agg.on_trades(make_response({ make_trade("LATE/USD", 12, 40.0, 1.0, t0 + 500'000'000) }), out);
+    TEST_CHECK(agg.late_trades_total() == 1);
+    TEST_CHECK(out.bars.size() == 1);
+
+    feed::Bar bar;
+    TEST_CHECK(agg.current(sid, 0, bar) && bar.trades == 1 && bar.open == 51.0);
+    TEST_CHECK(agg.current(sid, 1, bar) && bar.trades == 3 && bar.low == 40.0 && bar.close == 40.0);
+
+    // Symbols beyond the capacity: skipped and counted, the rest aggregated
+    feed::TradeAggregator<feed::BarPolicy<2, 10 * SEC, 1 * SEC>> small;
+    (void)intern_symbol("CAPA/USD");
+    (void)intern_symbol("CAPB/USD");
+    const SymbolId beyond = intern_symbol("CAPC/USD");
+    TEST_CHECK(beyond >= 2);
+    small.on_trades(make_response({
+        make_trade("CAPC/USD", 1, 10.0, 1.0, t0),
+        make_trade("CAPC/USD", 2, 11.0, 1.0, t0),
+    }), out);
+    TEST_CHECK(small.dropped_trades_total() == 2);
+    TEST_CHECK(small.trades_total() == 0);
+    TEST_CHECK(!small.current(beyond, 0, bar));
+    TEST_CHECK(small.vwap(beyond) == 0.0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// EWMA VWAP
+// ------------------------------------------------------------
+
+void test_ewma_vwap() {
+    std::cout << "[TEST] EWMA VWAP halves the weight every half-life\n";
+
+    Aggregator agg;
+    Collector out;
+    const SymbolId sid = intern_symbol("VWAP/USD");
+    const std::int64_t t0 = 1'700'000'000LL * SEC;
+
+    TEST_CHECK(agg.vwap(sid) == 0.0);
+
+    agg.on_trades(make_response({
+        make_trade("VWAP/USD", 1, 100.0, 2.0, t0),
+        make_trade("VWAP/USD", 2, 110.0, 2.0, t0),
+    }), out);
+    TEST_CHECK(near(agg.vwap(sid), 105.0));
+
+    // One half-life later: the first two trades weigh half
+    agg.on_trades(make_response({ make_trade("VWAP/USD", 3, 120.0, 2.0, t0 + 10 * SEC) }), out);
+    TEST_CHECK(near(agg.vwap(sid), (0.5 * 420.0 + 240.0) / (0.5 * 4.0 + 2.0)));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// close_expired
+// ------------------------------------------------------------
+
+void test_close_expired() {
+    std::cout << "[TEST] close_expired() closes bars of quiet symbols\n";
+
+    Aggregator agg;
+    Collector out;
+    const std::int64_t t0 = 1'700'000'000LL * SEC;
+
+    agg.on_trades(make_response({
+        make_trade("Q1/USD", 1, 10.0, 1.0, t0),
+        make_trade("Q2/USD", 1, 20.0, 1.0, t0 + 3 * SEC),
+    }), out);
+
+    agg.close_expired(t0 + SEC - 1, out);
+    TEST_CHECK(out.bars.empty());
+
+    agg.close_expired(t0 + 4 * SEC, out);
+    TEST_CHECK(out.bars.size() == 2);    // both 1s bars
+    TEST_CHECK(out.bars[0].symbol == Symbol{"Q1/USD"} && out.bars[1].symbol == Symbol{"Q2/USD"});
+
+    agg.close_expired(t0 + 10 * SEC, out);
+    TEST_CHECK(out.bars.size() == 4);    // both 10s bars
+    TEST_CHECK(out.bars[2].interval_ns == 10 * SEC && out.bars[3].interval_ns == 10 * SEC);
+
+    // Nothing left open
+    agg.close_expired(t0 + 100 * SEC, out);
+    TEST_CHECK(out.bars.size() == 4);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// Reference model
+// ------------------------------------------------------------
+
+void test_random_reference() {
+    std::cout << "[TEST] Random trade streams match the reference model...\n";
+
+    Aggregator agg;
+    Collector out;
+    const char* symbols[] = { "R0/USD", "R1/USD", "R2/USD", "R3/USD" };
+
+    struct RefBar {
+        double open, high, low, close, volume, notional;
+        std::uint32_t trades;
+    };
+    // (symbol, interval, bucket start) -> bar
+    std::map<std::tuple<int, std::int64_t, std::int64_t>, RefBar> model;
+
+    std::uint64_t state = 7;
+    auto next = [&]() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    };
+
+    std::int64_t ts = 1'700'000'000LL * SEC;
+    std::uint64_t trade_id = 1;
+    for (int step = 0; step < 20000; ++step) {
+        ts += static_cast<std::int64_t>(next() % 400) * 1'000'000;    // up to 0.4s apart
+        const int s = static_cast<int>(next() % 4);
+        const double price = 100.0 + static_cast<double>(next() % 1000) / 10.0;
+        const double qty = 0.1 + static_cast<double>(next() % 50) / 10.0;
+        agg.on_trades(make_response({ make_trade(symbols[s], trade_id++, price, qty, ts) }), out);
+
+        for (std::int64_t width : { 1 * SEC, 10 * SEC }) {
+            auto [it, inserted] = model.try_emplace({ s, width, ts - ts % width },
+                                                    RefBar{ price, price, price, price, 0.0, 0.0, 0 });
+            RefBar& b = it->second;
+            b.high = std::max(b.high, price);
+            b.low = std::min(b.low, price);
+            b.close = price;
+            b.volume += qty;
+            b.notional += price * qty;
+            ++b.trades;
+        }
+    }
+    agg.close_expired(ts + 10 * SEC, out);
+
+    TEST_CHECK(out.bars.size() == model.size());
+    std::size_t matched = 0;
+    for (const auto& bar : out.bars) {
+        int s = 0;
+        while (bar.symbol != Symbol{symbols[s]}) {
+            ++s;
+        }
+        auto it = model.find({ s, static_cast<std::int64_t>(bar.interval_ns), bar.open_time.time_since_epoch().count() });
+        TEST_CHECK(it != model.end());
+        const RefBar& b = it->second;
+        TEST_CHECK(bar.open == b.open && bar.high == b.high && bar.low == b.low && bar.close == b.close);
+        TEST_CHECK(bar.trades == b.trades);
+        TEST_CHECK(near(bar.volume, b.volume) && near(bar.vwap, b.notional / b.volume));
+        ++matched;
+    }
+    TEST_CHECK(matched == model.size());
+    TEST_CHECK(agg.late_trades_total() == 0 && agg.duplicate_trades_total() == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// Session integration (trade_sink::Into)
+// ------------------------------------------------------------
+
+using BarModel = BasicKrakenModel<
+    policy::protocol::DefaultValidation,
+    NoChannelFilter,
+    book_sink::None,
+    trade_sink::Into<Aggregator>
+>;
+
+static std::string trade_frame(std::uint64_t id, double price, int second) {
+    char buf[256];
+    std::snprintf(buf, sizeof(buf),
+        R"({"channel":"trade","type":"update","data":[{"symbol":"SES/USD","side":"buy","price":%.1f,"qty":1.0,)"
+        R"("ord_type":"limit","trade_id":%llu,"timestamp":"2023-09-25T07:49:%02d.000000Z"}]})",
+        price, static_cast<unsigned long long>(id), second);
+    return buf;
+}
+
+void test_session_publishes_bars() {
+    std::cout << "[TEST] Session publishes BarClose on the data and state planes\n";
+
+    protocol::Session<BarModel, WebSocketUnderTest, MessageRingUnderTest> session(message_ring);
+    WebSocketUnderTest::reset();
+    Aggregator bars;
+    session.message_handler().attach_trade_aggregator(bars);
+
+    (void)session.connect("wss://example.com/ws");
+    for (int i = 0; i < 8; ++i) {
+        (void)session.poll();
+    }
+
+    session.ws()->emit_message(trade_frame(1, 100.0, 1));
+    session.ws()->emit_message(trade_frame(2, 102.0, 1));
+    session.ws()->emit_message(trade_frame(3, 101.0, 2));   // closes second 1
+    for (int i = 0; i < 8; ++i) {
+        (void)session.poll();
+    }
+
+    std::vector<BarClose> closed;
+    session.data_plane().drain<BarClose>([&](const BarClose& bar) {
+        closed.push_back(bar);
+    });
+    std::size_t trades = 0;
+    session.data_plane().drain<schema::trade::Response>([&](const schema::trade::Response& r) {
+        trades += r.trades.size();
+    });
+
+    TEST_CHECK(trades == 3);
+    TEST_CHECK(closed.size() == 1);
+    TEST_CHECK(closed[0].symbol == Symbol{"SES/USD"} && closed[0].interval_ns == 1 * SEC);
+    TEST_CHECK(closed[0].open == 100.0 && closed[0].high == 102.0 && closed[0].trades == 2);
+
+    const BarClose* latest = session.data_plane().get<BarClose>();
+    TEST_CHECK(latest != nullptr && latest->close == 102.0);
+
+    feed::Bar bar;
+    TEST_CHECK(bars.current(intern_symbol("SES/USD"), 0, bar) && bar.open == 101.0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// Allocation
+// ------------------------------------------------------------
+
+void test_no_allocation() {
+    std::cout << "[TEST] No heap allocation after construction...\n";
+
+    using perf::alloc_trace::Thread;
+
+    Aggregator agg;
+    std::size_t closed = 0;
+    auto count = [&](const BarClose&) noexcept { ++closed; };
+
+    // Messages are built and the symbol interned up front: only the aggregation is traced
+    (void)intern_symbol("ALLOC/USD");
+    std::vector<schema::trade::Response> messages;
+    const std::int64_t t0 = 1'700'000'000LL * SEC;
+    for (std::uint64_t i = 1; i <= 1000; ++i) {
+        messages.push_back(make_response({
+            make_trade("ALLOC/USD", i, 10.0 + static_cast<double>(i % 7), 1.0, t0 + static_cast<std::int64_t>(i) * 300'000'000),
+        }));
+    }
+
+    perf::alloc_trace::tag_thread(Thread::Session);
+    const auto before = perf::alloc_trace::snapshot();
+    for (const auto& msg : messages) {
+        agg.on_trades(msg, count);
+    }
+    agg.close_expired(t0 + 1000 * SEC, count);
+    const auto delta = perf::alloc_trace::snapshot() - before;
+    perf::alloc_trace::tag_thread(Thread::Untagged);
+
+    TEST_CHECK(closed > 0);
+    TEST_CHECK(delta.allocations(Thread::Session) == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_bars();
+    test_late_and_duplicate_trades();
+    test_ewma_vwap();
+    test_close_expired();
+    test_random_reference();
+    test_session_publishes_bars();
+    test_no_allocation();
+
+    std::cout << "\n[GROUP] Trade aggregator tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,192 @@
+/*
+===============================================================================
+ perf::alloc_trace - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate (instrumentation build, operator new / delete replaced):
+
+  • Allocations are attributed to the tagged thread role and current stage,
+    nested stages unwind to the enclosing one
+  • Each thread keeps its own role
+  • Snapshots subtract into per-window deltas
+  • Only pipeline stages of the hot-path threads count as hot path;
+    allocations outside any stage are reported separately
+  • SteadyStateGate passes without hot-path allocations after the warm-up,
+    fails with them, does not fail on allocations outside any stage, and
+    ignores allocations after finish()
+
+===============================================================================
+*/
+
+#define WIREKRAK_ENABLE_ALLOC_TRACE
+
+#include <cstddef>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <thread>
+
+#include "wirekrak/core/perf/alloc_trace.hpp"
+#include "wirekrak/core/perf/alloc_trace_install.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core::perf;
+using alloc_trace::Thread;
+using alloc_trace::Stage;
+
+
+// Explicit calls: unlike new-expressions, these cannot be elided
+static void allocate_and_free(std::size_t n, std::size_t bytes) {
+    for (std::size_t i = 0; i < n; ++i) {
+        void* p = ::operator new(bytes);
+        ::operator delete(p);
+    }
+}
+
+
+void test_attribution() {
+    std::cout << "[TEST] Allocations are attributed to thread role and stage...\n";
+
+    TEST_CHECK(alloc_trace::installed());
+
+    const auto before = alloc_trace::snapshot();
+    {
+        alloc_trace::tag_thread(Thread::Session);
+        WK_ALLOC_STAGE(Parse);
+        allocate_and_free(3, 64);
+        {
+            WK_ALLOC_STAGE(Requests);
+            allocate_and_free(2, 16);
+        }
+        allocate_and_free(1, 8);                // back in Parse
+        WK_ALLOC_STAGE(Transport);              // sequential stage in the same scope
+        allocate_and_free(4, 32);
+    }
+    allocate_and_free(5, 1);                    // stage None
+    alloc_trace::tag_thread(Thread::Untagged);
+    const auto delta = alloc_trace::snapshot() - before;
+
+    TEST_CHECK(delta.at(Thread::Session, Stage::Parse).allocations == 4);
+    TEST_CHECK(delta.at(Thread::Session, Stage::Parse).deallocations == 4);
+    TEST_CHECK(delta.at(Thread::Session, Stage::Parse).bytes == 3 * 64 + 8);
+    TEST_CHECK(delta.at(Thread::Session, Stage::Requests).allocations == 2);
+    TEST_CHECK(delta.at(Thread::Session, Stage::Requests).bytes == 2 * 16);
+    TEST_CHECK(delta.at(Thread::Session, Stage::Transport).allocations == 4);
+    TEST_CHECK(delta.at(Thread::Session, Stage::None).allocations == 5);
+    TEST_CHECK(delta.allocations(Thread::Session) == 15);
+    TEST_CHECK(delta.hot_path_allocations() == 10);
+    TEST_CHECK(delta.outside_stage_allocations() == 5);
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_per_thread_roles() {
+    std::cout << "[TEST] Each thread keeps its own role...\n";
+
+    const auto before = alloc_trace::snapshot();
+    std::thread receive([] {
+        WK_ALLOC_THREAD(Receive);
+        WK_ALLOC_STAGE(Ingress);
+        allocate_and_free(7, 128);
+    });
+    std::thread wal([] {
+        WK_ALLOC_THREAD(Wal);
+        WK_ALLOC_STAGE(Wal);
+        allocate_and_free(2, 4096);
+    });
+    receive.join();
+    wal.join();
+    const auto delta = alloc_trace::snapshot() - before;
+
+    TEST_CHECK(alloc_trace::current_thread() == Thread::Untagged);
+    TEST_CHECK(delta.at(Thread::Receive, Stage::Ingress).allocations == 7);
+    TEST_CHECK(delta.at(Thread::Receive, Stage::Ingress).bytes == 7 * 128);
+    TEST_CHECK(delta.at(Thread::Wal, Stage::Wal).allocations == 2);
+    TEST_CHECK(delta.allocations(Thread::Session) == 0);
+    TEST_CHECK(delta.hot_path_allocations() == 7);
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_steady_state_gate() {
+    std::cout << "[TEST] SteadyStateGate verdicts...\n";
+
+    // Not armed yet: no steady state, passes
+    {
+        alloc_trace::SteadyStateGate gate{ ~0ULL };
+        gate.poll();
+        TEST_CHECK(!gate.armed());
+        std::ostringstream os;
+        TEST_CHECK(gate.verdict(os));
+    }
+
+    // Armed, allocations off the hot path only: passes
+    {
+        alloc_trace::SteadyStateGate gate{ 0 };
+        gate.poll();
+        TEST_CHECK(gate.armed());
+        std::thread wal([] {
+            WK_ALLOC_THREAD(Wal);
+            allocate_and_free(3, 64);
+        });
+        wal.join();
+        std::ostringstream os;
+        TEST_CHECK(gate.verdict(os));
+        TEST_CHECK(os.str().find("(PASS)") != std::string::npos);
+    }
+
+    // Armed, session allocates inside poll(): fails
+    {
+        alloc_trace::SteadyStateGate gate{ 0 };
+        gate.poll();
+        alloc_trace::tag_thread(Thread::Session);
+        {
+            WK_ALLOC_STAGE(Parse);
+            allocate_and_free(1, 32);
+        }
+        alloc_trace::tag_thread(Thread::Untagged);
+        std::ostringstream os;
+        TEST_CHECK(!gate.verdict(os));
+        TEST_CHECK(os.str().find("Session / Parse : 1 allocs") != std::string::npos);
+    }
+
+    // Armed, session thread allocates between polls (user code): reported, passes
+    {
+        alloc_trace::SteadyStateGate gate{ 0 };
+        gate.poll();
+        alloc_trace::tag_thread(Thread::Session);
+        allocate_and_free(1, 32);
+        alloc_trace::tag_thread(Thread::Untagged);
+        std::ostringstream os;
+        TEST_CHECK(gate.verdict(os));
+        TEST_CHECK(os.str().find("Session / None : 1 allocs") != std::string::npos);
+        TEST_CHECK(os.str().find("Outside stages    : 1") != std::string::npos);
+    }
+
+    // Allocations after finish() are not counted
+    {
+        alloc_trace::SteadyStateGate gate{ 0 };
+        gate.poll();
+        gate.finish();
+        alloc_trace::tag_thread(Thread::Session);
+        allocate_and_free(1, 32);
+        alloc_trace::tag_thread(Thread::Untagged);
+        std::ostringstream os;
+        TEST_CHECK(gate.verdict(os));
+    }
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_attribution();
+    test_per_thread_roles();
+    test_steady_state_gate();
+
+    std::cout << "\n[GROUP] Allocation trace tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,346 @@
+/*
+===============================================================================
+ protocol::data::DataPlane (conflation) - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • Messages are queued while the ring has room
+  • A full ring conflates updates into one pending entry per symbol
+  • A symbol with a pending entry keeps conflating (per-symbol order)
+  • Drain delivers queued messages first, then the coalesced batch
+  • Non-conflated types keep rejecting when their ring is full
+  • Kraken merge rules for book and trade responses
+      - merged book sides stay sorted best first, snapshots keep the depth
+        they arrived with (deletions do not shrink it)
+      - multi-symbol trade messages conflate per symbol
+
+===============================================================================
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "wirekrak/core/protocol/data/data_plane.hpp"
+#include "wirekrak/core/protocol/kraken/conflation.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol;
+
+// ------------------------------------------------------------
+// Test message types (small rings to force conflation)
+// ------------------------------------------------------------
+
+struct Tick {
+    SymbolId symbol = 0;
+    int value = 0;
+    int merged = 1;
+};
+
+struct Quote { int value = 0; };
+
+namespace wirekrak::core::protocol::data {
+
+template<> struct ring_traits<Tick>  { static constexpr std::size_t capacity = 4; };
+template<> struct ring_traits<Quote> { static constexpr std::size_t capacity = 4; };
+
+template<>
+struct conflation_traits<Tick> {
+    static constexpr bool enabled = true;
+
+    static bool key(const Tick& t, SymbolId& out) noexcept {
+        out = t.symbol;
+        return true;
+    }
+
+    static void merge(Tick& pending, Tick&& incoming) noexcept {
+        pending.value = incoming.value;
+        pending.merged += incoming.merged;
+    }
+};
+
+} // namespace wirekrak::core::protocol::data
+
+using Messages = meta::type_list<Tick, Quote>;
+using States   = meta::type_list<>;
+using Plane    = data::DataPlane<Messages, States, policy::protocol::ConflationPolicy<8, Tick>>;
+
+
+static std::size_t fill_ring(Plane& plane) {
+    std::size_t queued = 0;
+    while (plane.offer(Tick{7, static_cast<int>(queued)}) == data::PushResult::Queued) {
+        ++queued;
+    }
+    return queued;
+}
+
+
+// ------------------------------------------------------------
+// 1 - Full ring conflates per symbol
+// ------------------------------------------------------------
+
+void test_full_ring_conflates() {
+    std::cout << "[TEST] Full ring conflates per symbol\n";
+
+    Plane plane;
+    const std::size_t queued = fill_ring(plane);
+    TEST_CHECK(queued >= 1);
+
+    // fill_ring() stopped on the first conflated Tick of symbol 7
+    TEST_CHECK(plane.conflated_pending<Tick>() == 1);
+    TEST_CHECK(plane.offer(Tick{7, 100}) == data::PushResult::Conflated);
+    TEST_CHECK(plane.offer(Tick{3, 200}) == data::PushResult::Conflated);
+    TEST_CHECK(plane.conflated_pending<Tick>() == 2);
+
+    // Free one ring slot: symbol 7 still conflates (its entry is pending),
+    // symbol 5 goes to the ring
+    Tick t;
+    TEST_CHECK(plane.try_pop(t) && t.value == 0);
+    TEST_CHECK(plane.offer(Tick{7, 101}) == data::PushResult::Conflated);
+    TEST_CHECK(plane.offer(Tick{5, 300}) == data::PushResult::Queued);
+
+    std::vector<int> values;
+    int merged_7 = 0;
+    const std::size_t n = plane.drain<Tick>([&](const Tick& x) {
+        values.push_back(x.value);
+        if (x.symbol == 7 && x.value == 101) {
+            merged_7 = x.merged;
+        }
+    });
+
+    // Ring (queued - 1 + 1) then the two pending entries (symbol order)
+    TEST_CHECK(n == queued + 2);
+    TEST_CHECK(values[queued - 1] == 300);
+    TEST_CHECK(values[queued] == 200);       // symbol 3
+    TEST_CHECK(values[queued + 1] == 101);   // symbol 7, latest value
+    TEST_CHECK(merged_7 == 3);
+    TEST_CHECK(plane.empty<Tick>());
+    TEST_CHECK(plane.empty());
+
+    // Back to queueing once drained
+    TEST_CHECK(plane.offer(Tick{7, 1}) == data::PushResult::Queued);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 2 - Non-conflated types and out-of-range symbols reject
+// ------------------------------------------------------------
+
+void test_rejections() {
+    std::cout << "[TEST] Non-conflated messages reject when full\n";
+
+    Plane plane;
+    std::size_t queued = 0;
+    while (plane.push(Quote{static_cast<int>(queued)})) {
+        ++queued;
+    }
+    TEST_CHECK(plane.offer(Quote{}) == data::PushResult::Rejected);
+
+    (void)fill_ring(plane);
+    TEST_CHECK(plane.offer(Tick{8, 0}) == data::PushResult::Rejected); // max_symbols = 8
+    TEST_CHECK(!plane.push(Tick{42, 0}));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 3 - Kraken book merge rules
+// ------------------------------------------------------------
+
+void test_kraken_book_merge() {
+    std::cout << "[TEST] Kraken book conflation merge\n";
+
+    using kraken::schema::book::Response;
+    using traits = data::conflation_traits<Response>;
+
+    Response pending{};
+    pending.type = kraken::PayloadType::Snapshot;
+    pending.book.symbol = Symbol{"BTC/USD"};
+    pending.book.bids = {{100.0, 1.0}, {99.0, 2.0}};
+    pending.book.asks = {{101.0, 1.0}};
+    pending.book.checksum = 1;
+
+    Response update{};
+    update.type = kraken::PayloadType::Update;
+    update.book.symbol = Symbol{"BTC/USD"};
+    update.book.bids = {{100.0, 0.0}, {98.0, 4.0}};
+    update.book.asks = {{101.0, 5.0}, {102.0, 0.0}};
+    update.book.checksum = 2;
+
+    traits::state_type state;
+    traits::stored(state, pending);
+    traits::merge(pending, Response{update}, state);
+    TEST_CHECK(pending.type == kraken::PayloadType::Snapshot);
+    TEST_CHECK(pending.book.bids.size() == 2);          // 100 removed, 98 added
+    TEST_CHECK(pending.book.bids[0].price == 99.0);
+    TEST_CHECK(pending.book.bids[1].price == 98.0);
+    TEST_CHECK(pending.book.asks.size() == 1);          // 102 deletion ignored
+    TEST_CHECK(pending.book.asks[0].qty == 5.0);
+    TEST_CHECK(pending.book.checksum == 2);
+
+    // Update over update keeps deletions
+    Response upd2 = update;
+    traits::state_type upd2_state;
+    traits::stored(upd2_state, upd2);
+    traits::merge(upd2, Response{update}, upd2_state);
+    TEST_CHECK(upd2.book.bids.size() == 2 && upd2.book.bids[0].qty == 0.0);
+
+    // Snapshot replaces
+    Response snap{};
+    snap.type = kraken::PayloadType::Snapshot;
+    snap.book.symbol = Symbol{"BTC/USD"};
+    snap.book.checksum = 9;
+    traits::merge(upd2, std::move(snap), upd2_state);
+    TEST_CHECK(upd2.type == kraken::PayloadType::Snapshot && upd2.book.bids.empty() && upd2.book.checksum == 9);
+
+    SymbolId a, b;
+    TEST_CHECK(traits::key(pending, a) && traits::key(update, b) && a == b);
+
+    // A better price merged into a pending snapshot becomes front()
+    Response deep{};
+    deep.type = kraken::PayloadType::Snapshot;
+    deep.book.symbol = Symbol{"BTC/USD"};
+    for (int i = 0; i < 10; ++i) {
+        deep.book.bids.push_back({100.0 - i, 1.0});
+        deep.book.asks.push_back({101.0 + i, 1.0});
+    }
+    Response better{};
+    better.type = kraken::PayloadType::Update;
+    better.book.symbol = Symbol{"BTC/USD"};
+    better.book.bids = {{100.5, 2.0}, {90.0, 3.0}};   // 90 is beyond depth 10
+    better.book.asks = {{100.8, 2.0}, {105.5, 4.0}};
+    traits::state_type deep_state;
+    traits::stored(deep_state, deep);
+    traits::merge(deep, std::move(better), deep_state);
+    TEST_CHECK(deep.book.bids.size() == 10 && deep.book.asks.size() == 10);
+    TEST_CHECK(deep.book.bids.front().price == 100.5 && deep.book.bids.front().qty == 2.0);
+    TEST_CHECK(deep.book.bids.back().price == 92.0);  // 91 truncated, 90 ignored
+    TEST_CHECK(deep.book.asks.front().price == 100.8);
+    TEST_CHECK(deep.book.asks[5].price == 105.0 && deep.book.asks[6].price == 105.5);
+    TEST_CHECK(deep.book.asks.back().price == 108.0);  // 109 and 110 truncated
+    for (std::size_t i = 1; i < 10; ++i) {
+        TEST_CHECK(deep.book.bids[i - 1].price > deep.book.bids[i].price);
+        TEST_CHECK(deep.book.asks[i - 1].price < deep.book.asks[i].price);
+    }
+
+    // Deletions do not shrink the snapshot depth: a 25-level snapshot cut
+    // to 5 levels still takes 20 more
+    Response wide{};
+    wide.type = kraken::PayloadType::Snapshot;
+    wide.book.symbol = Symbol{"BTC/USD"};
+    for (int i = 0; i < 25; ++i) {
+        wide.book.bids.push_back({100.0 - i, 1.0});
+    }
+    data::ConflationTable<Response, MAX_INTERNED_SYMBOLS> table;
+    TEST_CHECK(table.merge(std::move(wide)));
+    Response cut{};
+    cut.type = kraken::PayloadType::Update;
+    cut.book.symbol = Symbol{"BTC/USD"};
+    for (int i = 5; i < 25; ++i) {
+        cut.book.bids.push_back({100.0 - i, 0.0});
+    }
+    TEST_CHECK(table.merge(std::move(cut)));
+    Response refill{};
+    refill.type = kraken::PayloadType::Update;
+    refill.book.symbol = Symbol{"BTC/USD"};
+    for (int i = 0; i < 20; ++i) {
+        refill.book.bids.push_back({95.5 - i, 2.0});
+    }
+    TEST_CHECK(table.merge(std::move(refill)));
+    Response merged{};
+    TEST_CHECK(table.pop(merged));
+    TEST_CHECK(merged.book.bids.size() == 25);
+    TEST_CHECK(merged.book.bids.back().price == 76.5);
+
+    // Unordered updates are normalized best first
+    Response upd3{};
+    upd3.type = kraken::PayloadType::Update;
+    upd3.book.bids = {{97.0, 1.0}, {99.0, 1.0}};
+    Response upd4{};
+    upd4.type = kraken::PayloadType::Update;
+    upd4.book.bids = {{98.0, 0.0}};
+    traits::state_type upd3_state;
+    traits::stored(upd3_state, upd3);
+    traits::merge(upd3, std::move(upd4), upd3_state);
+    TEST_CHECK(upd3.book.bids.size() == 3);
+    TEST_CHECK(upd3.book.bids[0].price == 99.0 && upd3.book.bids[1].price == 98.0 && upd3.book.bids[2].price == 97.0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 4 - Kraken trade merge rules
+// ------------------------------------------------------------
+
+void test_kraken_trade_merge() {
+    std::cout << "[TEST] Kraken trade conflation merge\n";
+
+    using kraken::schema::trade::Response;
+    using traits = data::conflation_traits<Response>;
+
+    Response empty{};
+    SymbolId id;
+    TEST_CHECK(!traits::key(empty, id));
+
+    auto make = [](std::uint64_t first, std::size_t n) {
+        Response r{};
+        for (std::size_t i = 0; i < n; ++i) {
+            kraken::schema::trade::Trade t{};
+            t.trade_id = first + i;
+            t.symbol = Symbol{"ETH/USD"};
+            r.trades.push_back(t);
+        }
+        return r;
+    };
+
+    Response pending = make(0, 200);
+    traits::merge(pending, make(200, 100));
+    TEST_CHECK(pending.trades.size() == kraken::MAX_CONFLATED_TRADES);
+    TEST_CHECK(pending.trades.front().trade_id == 300 - kraken::MAX_CONFLATED_TRADES);
+    TEST_CHECK(pending.trades.back().trade_id == 299);
+
+    // Multi-symbol messages have no single key: the table merges them per symbol
+    Response mixed = make(1000, 2);                       // ETH 1000, 1001
+    mixed.trades[1].symbol = Symbol{"SOL/USD"};          // ETH 1000, SOL 1001
+    mixed.trades.push_back(mixed.trades[0]);
+    mixed.trades[2].trade_id = 1002;                      // ETH 1000, SOL 1001, ETH 1002
+    TEST_CHECK(!traits::key(mixed, id));
+
+    data::ConflationTable<Response, MAX_INTERNED_SYMBOLS> table;
+    TEST_CHECK(!table.has_pending(mixed));
+    TEST_CHECK(table.merge(make(999, 1)));                // ETH 999 pending
+    TEST_CHECK(table.has_pending(mixed));
+    TEST_CHECK(table.merge(std::move(mixed)));
+    TEST_CHECK(table.pending() == 2);
+
+    std::vector<std::uint64_t> eth, sol;
+    (void)table.drain([&](const Response& r) {
+        for (const auto& t : r.trades) {
+            (t.symbol.view() == "ETH/USD" ? eth : sol).push_back(t.trade_id);
+            TEST_CHECK(t.symbol.view() == r.trades.front().symbol.view());
+        }
+    });
+    TEST_CHECK((eth == std::vector<std::uint64_t>{999, 1000, 1002}));
+    TEST_CHECK((sol == std::vector<std::uint64_t>{1001}));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_full_ring_conflates();
+    test_rejections();
+    test_kraken_book_merge();
+    test_kraken_trade_merge();
+
+    std::cout << "\n[GROUP] Conflation tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,318 @@
+/*
+===============================================================================
+ protocol::data::FanoutBus - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • Every registered consumer observes the full stream, in order
+  • Consumers progress independently (per-consumer lag)
+  • Slow-consumer policies:
+      - Block → producer refuses to publish
+      - Drop  → message dropped, backlog kept
+      - Evict → producer moves the lagging consumer to the live edge,
+                a stalled consumer costs the others nothing and reads a
+                conflated backlog (latest entry per symbol) first
+  • Consumer registration bound
+
+===============================================================================
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "wirekrak/core/protocol/data/fanout_data_plane.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol;
+
+// ------------------------------------------------------------
+// Test message types (small rings to exercise slow consumers)
+// ------------------------------------------------------------
+
+struct Tick { int value = 0; };
+struct Quote { int value = 0; };
+struct Price { SymbolId symbol = 0; int value = 0; };
+
+namespace wirekrak::core::protocol::data {
+template<> struct ring_traits<Tick>  { static constexpr std::size_t capacity = 4; };
+template<> struct ring_traits<Quote> { static constexpr std::size_t capacity = 4; };
+template<> struct ring_traits<Price> { static constexpr std::size_t capacity = 4; };
+
+template<>
+struct conflation_traits<Price> {
+    static constexpr bool enabled = true;
+    static bool key(const Price& p, SymbolId& out) noexcept { out = p.symbol; return true; }
+    static void merge(Price& pending, Price&& incoming) noexcept { pending = incoming; }
+};
+} // namespace wirekrak::core::protocol::data
+
+using Messages = meta::type_list<Tick, Quote>;
+using States   = meta::type_list<>;
+
+template<policy::protocol::SlowConsumerMode Mode>
+using Plane = data::FanoutDataPlane<Messages, States, policy::protocol::FanoutPolicy<Mode, 2>>;
+
+
+// ------------------------------------------------------------
+// 1 - Every consumer observes the full stream
+// ------------------------------------------------------------
+
+void test_fanout_delivers_to_all_consumers() {
+    std::cout << "[TEST] Fan-out delivers to all consumers\n";
+
+    Plane<policy::protocol::SlowConsumerMode::Block> plane;
+    auto a = plane.consumer(plane.register_consumer());
+    auto b = plane.consumer(plane.register_consumer());
+    TEST_CHECK(a.valid() && b.valid());
+
+    TEST_CHECK(plane.push(Tick{1}));
+    TEST_CHECK(plane.push(Tick{2}));
+    TEST_CHECK(plane.push(Quote{7}));
+
+    std::vector<int> seen_a;
+    TEST_CHECK(a.drain<Tick>([&](const Tick& t) { seen_a.push_back(t.value); }) == 2);
+    TEST_CHECK((seen_a == std::vector<int>{1, 2}));
+
+    // Consumer B is independent and still lagging
+    TEST_CHECK(b.lag<Tick>() == 2);
+    TEST_CHECK(!plane.empty());
+
+    Tick t;
+    TEST_CHECK(b.try_pop(t) && t.value == 1);
+    TEST_CHECK(b.try_pop(t) && t.value == 2);
+    TEST_CHECK(!b.try_pop(t));
+
+    TEST_CHECK(a.drain_all([](const auto&) {}) == 1);
+    TEST_CHECK(b.drain_all([](const auto&) {}) == 1);
+    TEST_CHECK(plane.empty());
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 2 - Block: producer refuses to publish while a consumer lags
+// ------------------------------------------------------------
+
+void test_block_slow_consumer() {
+    std::cout << "[TEST] Slow consumer (Block)\n";
+
+    Plane<policy::protocol::SlowConsumerMode::Block> plane;
+    auto fast = plane.consumer(plane.register_consumer());
+    auto slow = plane.consumer(plane.register_consumer());
+
+    for (int i = 0; i < 4; ++i) {
+        TEST_CHECK(plane.push(Tick{i}));
+        (void)fast.drain<Tick>([](const Tick&) {});
+    }
+
+    TEST_CHECK(!plane.push(Tick{4}));
+    TEST_CHECK(slow.lag<Tick>() == 4);
+    TEST_CHECK(plane.messages.dropped<Tick>() == 0);
+
+    // Once the slow consumer reads, publishing resumes
+    Tick t;
+    TEST_CHECK(slow.try_pop(t) && t.value == 0);
+    TEST_CHECK(plane.push(Tick{4}));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 3 - Drop: message dropped, slow consumer keeps its backlog
+// ------------------------------------------------------------
+
+void test_drop_slow_consumer() {
+    std::cout << "[TEST] Slow consumer (Drop)\n";
+
+    Plane<policy::protocol::SlowConsumerMode::Drop> plane;
+    auto fast = plane.consumer(plane.register_consumer());
+    auto slow = plane.consumer(plane.register_consumer());
+
+    for (int i = 0; i < 6; ++i) {
+        TEST_CHECK(plane.push(Tick{i}));
+        (void)fast.drain<Tick>([](const Tick&) {});
+    }
+
+    TEST_CHECK(plane.messages.dropped<Tick>() == 2);
+
+    std::vector<int> seen;
+    (void)slow.drain<Tick>([&](const Tick& t) { seen.push_back(t.value); });
+    TEST_CHECK((seen == std::vector<int>{0, 1, 2, 3}));
+    TEST_CHECK(plane.messages.max_lag<Tick>(slow.id()) == 4);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 4 - Evict: slow consumer is moved to the live edge
+// ------------------------------------------------------------
+
+void test_evict_slow_consumer() {
+    std::cout << "[TEST] Slow consumer (Evict)\n";
+
+    Plane<policy::protocol::SlowConsumerMode::Evict> plane;
+    auto fast = plane.consumer(plane.register_consumer());
+    auto slow = plane.consumer(plane.register_consumer());
+
+    for (int i = 0; i < 5; ++i) {
+        TEST_CHECK(plane.push(Tick{i}));
+        (void)fast.drain<Tick>([](const Tick&) {});
+    }
+
+    // The producer skipped the slow backlog and published Tick{4}
+    TEST_CHECK(plane.messages.dropped<Tick>() == 0);
+    TEST_CHECK(plane.messages.evictions<Tick>(slow.id()) == 1);
+    TEST_CHECK(plane.messages.evictions<Tick>(fast.id()) == 0);
+    TEST_CHECK(plane.messages.skipped<Tick>(slow.id()) == 4);
+    TEST_CHECK(slow.lag<Tick>() == 1);
+
+    Tick t;
+    TEST_CHECK(slow.try_pop(t) && t.value == 4);
+    TEST_CHECK(!slow.try_pop(t));
+
+    // Live data flows again to both consumers
+    TEST_CHECK(plane.push(Tick{10}));
+    TEST_CHECK(slow.try_pop(t) && t.value == 10);
+    TEST_CHECK(fast.try_pop(t) && t.value == 10);
+
+    // Other message types are unaffected
+    TEST_CHECK(plane.messages.evictions<Quote>(slow.id()) == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 5 - Evict: a stalled consumer costs the others nothing
+// ------------------------------------------------------------
+
+void test_evict_stalled_consumer_isolated() {
+    std::cout << "[TEST] Stalled consumer does not cost other consumers messages (Evict)\n";
+
+    Plane<policy::protocol::SlowConsumerMode::Evict> plane;
+    auto fast = plane.consumer(plane.register_consumer());
+    auto stalled = plane.consumer(plane.register_consumer());
+    (void)stalled;
+
+    std::vector<int> seen;
+    for (int i = 0; i < 50; ++i) {
+        TEST_CHECK(plane.push(Tick{i}));
+        (void)fast.drain<Tick>([&](const Tick& t) { seen.push_back(t.value); });
+    }
+
+    TEST_CHECK(seen.size() == 50);
+    for (int i = 0; i < 50; ++i) {
+        TEST_CHECK(seen[static_cast<std::size_t>(i)] == i);
+    }
+    TEST_CHECK(plane.messages.dropped<Tick>() == 0);
+    TEST_CHECK(plane.messages.evictions<Tick>(stalled.id()) > 1);
+    TEST_CHECK(plane.messages.skipped<Tick>(stalled.id()) + stalled.lag<Tick>() == 50);
+
+    // A consumer stalled INSIDE a read pins its slot: only then is a message
+    // dropped (its slot cannot be reclaimed while it is being read)
+    int pushed = 0;
+    (void)stalled.drain<Tick>([&](const Tick&) {
+        if (pushed++ == 0) {
+            for (int i = 0; i < 4; ++i) {
+                (void)plane.push(Tick{100 + i});
+            }
+        }
+    });
+    TEST_CHECK(plane.messages.dropped<Tick>() > 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 6 - Evict: evicted consumer reads a conflated backlog first
+// ------------------------------------------------------------
+
+void test_evict_conflated_backlog() {
+    std::cout << "[TEST] Evicted consumer reads a conflated backlog (Evict + conflation)\n";
+
+    using ConflatedPlane = data::FanoutDataPlane<
+        meta::type_list<Tick, Price>, States,
+        policy::protocol::FanoutPolicy<policy::protocol::SlowConsumerMode::Evict, 2>,
+        policy::protocol::ConflationPolicy<8, Price>
+    >;
+    ConflatedPlane plane;
+    auto fast = plane.consumer(plane.register_consumer());
+    auto slow = plane.consumer(plane.register_consumer());
+
+    // Symbols 1 and 2 alternate: 1:0, 2:1, 1:2, 2:3 fill the ring, 1:4 evicts
+    for (int i = 0; i < 5; ++i) {
+        TEST_CHECK(plane.push(Price{static_cast<SymbolId>(1 + i % 2), i}));
+        (void)fast.drain<Price>([](const Price&) {});
+    }
+    TEST_CHECK(plane.messages.evictions<Price>(slow.id()) == 1);
+    TEST_CHECK(plane.messages.skipped<Price>(slow.id()) == 4);
+    TEST_CHECK(plane.messages.conflated<Price>(slow.id()) == 4);
+    TEST_CHECK(!slow.empty<Price>());
+
+    // Latest entry per symbol first (2:3 is older than the live 1:4)
+    std::vector<int> seen;
+    TEST_CHECK(slow.drain<Price>([&](const Price& p) { seen.push_back(static_cast<int>(p.symbol) * 100 + p.value); }) == 3);
+    TEST_CHECK((seen == std::vector<int>{102, 203, 104}));
+    TEST_CHECK(slow.empty<Price>());
+    TEST_CHECK(plane.empty());
+
+    // Second eviction, read one message at a time
+    for (int i = 5; i < 10; ++i) {
+        TEST_CHECK(plane.push(Price{1, i}));
+        (void)fast.drain<Price>([](const Price&) {});
+    }
+    Price p;
+    TEST_CHECK(slow.try_pop(p) && p.symbol == 1 && p.value == 8);
+    TEST_CHECK(slow.try_pop(p) && p.symbol == 1 && p.value == 9);
+    TEST_CHECK(!slow.try_pop(p));
+
+    // Unlisted types are skipped without a backlog
+    for (int i = 0; i < 5; ++i) {
+        TEST_CHECK(plane.push(Tick{i}));
+        (void)fast.drain<Tick>([](const Tick&) {});
+    }
+    TEST_CHECK(plane.messages.conflated<Tick>(slow.id()) == 0);
+    TEST_CHECK(slow.drain<Tick>([](const Tick&) {}) == 1);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// 7 - Consumer registration is bounded
+// ------------------------------------------------------------
+
+void test_consumer_registration_bound() {
+    std::cout << "[TEST] Consumer registration bound\n";
+
+    Plane<policy::protocol::SlowConsumerMode::Block> plane;
+    TEST_CHECK(plane.register_consumer() == 0);
+    TEST_CHECK(plane.register_consumer() == 1);
+    TEST_CHECK(plane.register_consumer() == data::INVALID_CONSUMER_ID);
+    TEST_CHECK(plane.messages.consumer_count() == 2);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_fanout_delivers_to_all_consumers();
+    test_block_slow_consumer();
+    test_drop_slow_consumer();
+    test_evict_slow_consumer();
+    test_evict_stalled_consumer_isolated();
+    test_evict_conflated_backlog();
+    test_consumer_registration_bound();
+
+    std::cout << "\n[GROUP] FanoutBus tests passed!\n";
+    return 0;
+}
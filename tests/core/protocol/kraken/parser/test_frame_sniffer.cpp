@@ -0,0 +1,226 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+
+#include "wirekrak/core/protocol/kraken/parser/sniffer.hpp"
+#include "wirekrak/core/protocol/kraken/parser/router.hpp"
+#include "wirekrak/core/protocol/kraken/frame_filter.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol;
+using namespace wirekrak::core::protocol::kraken;
+
+/*
+================================================================================
+Kraken Frame Sniffer / Channel Filter — Unit Tests
+================================================================================
+
+These tests validate the byte-level prefilter in front of the JSON parser:
+
+  • Frames with the routing key first are classified (channel / method)
+  • Anything the sniffer cannot prove is Unknown (never misclassified)
+  • ChannelFilter drops only the configured channels
+  • Router drops filtered channels and answers heartbeats without parsing,
+    and still routes unrecognized frames through the full-parse path
+================================================================================
+*/
+
+using Kind = parser::FrameShape::Kind;
+
+// ============================================================================
+// Minimal router context (records deliveries)
+// ============================================================================
+
+struct RecordingContext {
+    int trades = 0;
+    int books = 0;
+    int pongs = 0;
+    int statuses = 0;
+    int acks = 0;
+
+    bool push(schema::trade::Response&&) noexcept { ++trades; return true; }
+    bool push(schema::book::Response&&) noexcept { ++books; return true; }
+    bool push(schema::rejection::Notice&&) noexcept { return true; }
+    void set(schema::system::Pong&&) noexcept { ++pongs; }
+    void set(schema::status::Update&&) noexcept { ++statuses; }
+
+    template<class Request>
+    void on_subscribe_ack(ctrl::req_id_t, Symbol, bool) noexcept { ++acks; }
+    template<class Request>
+    void on_unsubscribe_ack(ctrl::req_id_t, Symbol, bool) noexcept { ++acks; }
+    void on_rejection(ctrl::req_id_t, Symbol) noexcept {}
+    void on_request_rejected(ctrl::req_id_t) noexcept {}
+};
+
+static constexpr std::string_view TRADE_UPDATE =
+    R"({"channel":"trade","type":"update","data":[{"symbol":"BTC/USD","side":"buy","price":50000.0,"qty":0.5,"ord_type":"limit","trade_id":42,"timestamp":"2023-09-25T07:49:37.708706Z"}]})";
+
+static constexpr std::string_view HEARTBEAT = R"({"channel":"heartbeat"})";
+
+static constexpr std::string_view PONG =
+    R"({"method":"pong","req_id":7,"time_in":"2023-09-25T07:49:37.708706Z","time_out":"2023-09-25T07:49:37.708726Z"})";
+
+// ============================================================================
+// Sniffer
+// ============================================================================
+
+void test_sniff_channels() {
+    std::cout << "[TEST] Sniffer classifies channel frames..." << std::endl;
+
+    struct Case { std::string_view frame; Channel channel; };
+    constexpr Case cases[] = {
+        { TRADE_UPDATE,                                     Channel::Trade },
+        { R"({"channel":"book","type":"snapshot"})",         Channel::Book },
+        { R"({"channel":"ticker","type":"update"})",         Channel::Ticker },
+        { R"({"channel":"status","type":"update"})",         Channel::Status },
+        { HEARTBEAT,                                        Channel::Heartbeat },
+    };
+    for (const auto& c : cases) {
+        const auto shape = parser::sniff(c.frame);
+        assert(shape.kind == Kind::Channel);
+        assert(shape.channel == c.channel);
+    }
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+void test_sniff_methods() {
+    std::cout << "[TEST] Sniffer classifies method frames..." << std::endl;
+
+    struct Case { std::string_view frame; Method method; };
+    constexpr Case cases[] = {
+        { R"({"method":"subscribe","req_id":1,"success":true})",   Method::Subscribe },
+        { R"({"method":"unsubscribe","req_id":2,"success":true})", Method::Unsubscribe },
+        { PONG,                                                   Method::Pong },
+    };
+    for (const auto& c : cases) {
+        const auto shape = parser::sniff(c.frame);
+        assert(shape.kind == Kind::Method);
+        assert(shape.method == c.method);
+    }
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+void test_sniff_unknown_is_conservative() {
+    std::cout << "[TEST] Sniffer leaves unproven frames Unknown..." << std::endl;
+
+    constexpr std::string_view frames[] = {
+        "",
+        "{}",
+        R"({"channel":"boo)",                         // shorter than any classification read
+        R"({"channel":"books","type":"update"})",     // value longer than a known channel
+        R"({"channel":"trad","type":"update"})",      // value shorter than a known channel
+        R"({"channel":"bookkeeping","type":"x"})",    // known 4-byte tag, other value
+        R"({"channel":"heartbea)",                    // truncated value
+        R"({"channel":"level3","type":"update"})",    // unknown channel
+        R"({ "channel":"trade","type":"update"})",    // whitespace
+        R"({"type":"update","channel":"trade"})",     // other key order
+        R"({"channels":"trade","type":"update"})",    // other key
+        R"({"method":"pingpong","req_id":1})",        // unknown method
+        R"({"method":"subscribed","req_id":1})",      // longer method
+        R"({"method" :"subscribe","req_id":1})",      // whitespace
+        R"(["channel","trade","type","update"])",     // not an object
+    };
+    for (const auto frame : frames) {
+        assert(parser::sniff(frame).kind == Kind::Unknown);
+    }
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+// ============================================================================
+// Channel filter
+// ============================================================================
+
+void test_channel_filter() {
+    std::cout << "[TEST] ChannelFilter drops only configured channels..." << std::endl;
+
+    static_assert(!NoChannelFilter::enabled);
+    static_assert(HeartbeatFilter::enabled);
+    static_assert(HeartbeatFilter::drops(Channel::Heartbeat));
+    static_assert(!HeartbeatFilter::drops(Channel::Trade));
+    static_assert(ChannelFilter<Channel::Ticker, Channel::Status>::drops(Channel::Status));
+
+    assert(HeartbeatFilter::drop(HEARTBEAT));
+    assert(!HeartbeatFilter::drop(TRADE_UPDATE));
+    assert(!HeartbeatFilter::drop(PONG));
+    assert(!HeartbeatFilter::drop(R"({ "channel":"heartbeat"})"));   // unrecognized → kept
+    assert(!NoChannelFilter::drop(HEARTBEAT));
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+// ============================================================================
+// Router
+// ============================================================================
+
+void test_router_prefilter() {
+    std::cout << "[TEST] Router drops filtered channels before parsing..." << std::endl;
+
+    parser::Router<policy::protocol::DefaultValidation, HeartbeatFilter> filtered;
+    parser::Router<> plain;
+    RecordingContext ctx;
+    Method method{};
+    Channel channel{};
+
+    assert(filtered.parse_and_route(ctx, HEARTBEAT, method, channel) == MessageResult::Ignored);
+    assert(plain.parse_and_route(ctx, HEARTBEAT, method, channel) == MessageResult::Delivered);
+    assert(channel == Channel::Heartbeat);
+
+    // Heartbeats are answered from the prefix: a broken tail is never parsed
+    assert(plain.parse_and_route(ctx, R"({"channel":"heartbeat",)", method, channel) == MessageResult::Delivered);
+
+    // Data frames still go through the parser
+    assert(filtered.parse_and_route(ctx, TRADE_UPDATE, method, channel) == MessageResult::Delivered);
+    assert(channel == Channel::Trade);
+    assert(ctx.trades == 1);
+    assert(filtered.parse_and_route(ctx, R"({"channel":"trade","type":"update","data":[)", method, channel) == MessageResult::InvalidSchema);
+
+    // Control frames are dispatched by the sniffed method
+    assert(filtered.parse_and_route(ctx, PONG, method, channel) == MessageResult::Delivered);
+    assert(method == Method::Pong);
+    assert(ctx.pongs == 1);
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+void test_router_unrecognized_fallback() {
+    std::cout << "[TEST] Router routes unrecognized frames through the full parse..." << std::endl;
+
+    parser::Router<policy::protocol::DefaultValidation, HeartbeatFilter> router;
+    RecordingContext ctx;
+    Method method{};
+    Channel channel{};
+
+    constexpr std::string_view reordered =
+        R"({"type":"update","channel":"trade","data":[{"symbol":"BTC/USD","side":"sell","price":50001.0,"qty":0.25,"ord_type":"market","trade_id":43,"timestamp":"2023-09-25T07:49:38.000000Z"}]})";
+    assert(parser::sniff(reordered).kind == Kind::Unknown);
+    assert(router.parse_and_route(ctx, reordered, method, channel) == MessageResult::Delivered);
+    assert(channel == Channel::Trade);
+    assert(ctx.trades == 1);
+
+    // Reordered heartbeat: not recognized, so not dropped (full path, Delivered)
+    constexpr std::string_view spaced_heartbeat = R"({ "channel": "heartbeat" })";
+    assert(router.parse_and_route(ctx, spaced_heartbeat, method, channel) == MessageResult::Delivered);
+    assert(channel == Channel::Heartbeat);
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main() {
+    test_sniff_channels();
+    test_sniff_methods();
+    test_sniff_unknown_is_conservative();
+    test_channel_filter();
+    test_router_prefilter();
+    test_router_unrecognized_fallback();
+
+    std::cout << "[TEST] ALL FRAME SNIFFER TESTS PASSED!\n";
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include <cassert>
 #include <iostream>
+#include <string>
 #include <string_view>
 
 #include "simdjson.h"
@@ -166,6 +167,30 @@ void test_pong_success_full() {
     std::cout << "[TEST] OK\n";
 }
 
+void test_pong_warnings_bounded() {
+    std::cout << "[TEST] Pong response (warnings bounded)..." << std::endl;
+
+    const std::string long_warning(schema::MAX_WARNING_TEXT_LENGTH + 1, 'w');
+    std::string json = R"({"method":"pong","success":true,"req_id":1,"result":{"warnings":[")" + long_warning + R"(")";
+    for (std::size_t i = 1; i < schema::MAX_WARNINGS + 2; ++i) {
+        json += R"(,"warning")";
+    }
+    json += "]}}";
+
+    simdjson::dom::parser parser;
+    auto doc = parser.parse(json);
+    assert(!doc.error());
+
+    schema::system::Pong pong{};
+    assert(parser::dom::system::pong::parse(doc.value(), pong) == MessageResult::Parsed);
+    assert(pong.truncated);
+    assert(pong.warnings.size() == schema::MAX_WARNINGS);
+    assert(pong.warnings[0].size() == schema::MAX_WARNING_TEXT_LENGTH);
+    assert(pong.warnings[1] == "warning");
+
+    std::cout << "[TEST] OK\n";
+}
+
 // ============================================================================
 // ERROR CASES — success = false
 // ============================================================================
@@ -296,6 +321,7 @@ int main() {
     // Request-style success
     test_pong_success_minimal();
     test_pong_success_full();
+    test_pong_warnings_bounded();
 
     // Error
     test_pong_error_minimal();
@@ -1,5 +1,6 @@
 #include <cassert>
 #include <iostream>
+#include <string>
 #include <string_view>
 
 #include "simdjson.h"
@@ -61,6 +62,27 @@ void test_rejection_notice_minimal() {
     std::cout << "[TEST] OK\n";
 }
 
+void test_rejection_notice_long_error_truncated() {
+    std::cout << "[TEST] Rejection notice (long error truncated)..." << std::endl;
+
+    const std::string reason(schema::MAX_ERROR_TEXT_LENGTH + 40, 'x');
+    const std::string json = R"({"error":")" + reason + R"(","req_id":7})";
+
+    schema::rejection::Notice notice{};
+    assert(parse(json, notice));
+
+    assert(notice.truncated);
+    assert(notice.error.size() == schema::MAX_ERROR_TEXT_LENGTH);
+    assert(notice.error == std::string_view(reason).substr(0, schema::MAX_ERROR_TEXT_LENGTH));
+    assert(notice.req_id.has() && notice.req_id.value() == 7);
+
+    // Short error: not truncated
+    assert(parse(R"({"error":"Already subscribed"})", notice));
+    assert(!notice.truncated);
+
+    std::cout << "[TEST] OK\n";
+}
+
 void test_rejection_notice_full_payload() {
     std::cout << "[TEST] Rejection notice (full payload)..." << std::endl;
 
@@ -232,6 +254,7 @@ int main() {
     test_rejection_notice_minimal();
     test_rejection_notice_full_payload();
     test_rejection_notice_without_symbol();
+    test_rejection_notice_long_error_truncated();
 
     // negative cases
     test_rejection_notice_missing_error();
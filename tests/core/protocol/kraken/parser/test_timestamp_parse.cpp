@@ -0,0 +1,179 @@
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "wirekrak/core/timestamp.hpp"
+
+using namespace wirekrak::core;
+
+/*
+================================================================================
+RFC3339 Timestamp Parser — Unit Tests
+================================================================================
+
+These tests validate the fixed-layout (SWAR) timestamp parser:
+
+  • Known Kraken timestamps decode to the expected epoch values
+  • parse_rfc3339() and parse_rfc3339_generic() agree on every input:
+    random valid timestamps of every supported layout, and random byte-level
+    mutations / truncations of them (accept/reject and value)
+  • The per-thread date cache never leaks a previous date
+================================================================================
+*/
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+struct Rng {
+    std::uint64_t state;
+    std::uint32_t next() noexcept {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    }
+    std::uint32_t below(std::uint32_t n) noexcept { return next() % n; }
+};
+
+static std::int64_t ns_of(const Timestamp& ts) {
+    return ts.time_since_epoch().count();
+}
+
+static void check_same(std::string_view sv) {
+    Timestamp fast{std::chrono::nanoseconds{-1}};
+    Timestamp generic{std::chrono::nanoseconds{-1}};
+    const bool ok_fast = parse_rfc3339(sv, fast);
+    const bool ok_generic = parse_rfc3339_generic(sv, generic);
+    if (ok_fast != ok_generic || (ok_fast && fast != generic)) {
+        std::cerr << "[TEST FAILED] parsers disagree on \"" << sv << "\"\n";
+        assert(false);
+    }
+}
+
+static std::string random_timestamp(Rng& rng) {
+    static constexpr int FRACTION_DIGITS[] = { 0, 6, 6, 6, 9, 3 };
+    const int digits = FRACTION_DIGITS[rng.below(6)];
+
+    char buf[64];
+    int n = std::snprintf(buf, sizeof(buf), "%04u-%02u-%02uT%02u:%02u:%02u",
+        rng.below(10000), 1 + rng.below(12), 1 + rng.below(31),
+        rng.below(24), rng.below(60), rng.below(60));
+    if (digits > 0) {
+        buf[n++] = '.';
+        for (int i = 0; i < digits; ++i) {
+            buf[n++] = static_cast<char>('0' + rng.below(10));
+        }
+    }
+    buf[n++] = 'Z';
+    return std::string(buf, static_cast<std::size_t>(n));
+}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+void test_known_values() {
+    std::cout << "[TEST] Known timestamps decode to epoch values..." << std::endl;
+
+    struct Case { std::string_view text; std::int64_t ns; };
+    constexpr Case cases[] = {
+        { "1970-01-01T00:00:00Z",            0 },
+        { "1970-01-01T00:00:00.000001Z",     1'000 },
+        { "2023-09-25T07:49:37.708706Z",     1'695'628'177'708'706'000 },
+        { "2000-02-29T23:59:59.999999999Z",  951'868'799'999'999'999 },
+        { "2024-12-31T12:00:00.500000Z",     1'735'646'400'500'000'000 },
+    };
+    for (const auto& c : cases) {
+        Timestamp ts{};
+        assert(detail::rfc3339::parse_fixed(c.text, ts));   // fixed layouts take the fast path
+        assert(ns_of(ts) == c.ns);
+        assert(parse_rfc3339(c.text, ts));
+        assert(ns_of(ts) == c.ns);
+    }
+
+    // Calendar validation
+    Timestamp ts{};
+    assert(!parse_rfc3339("2023-02-29T00:00:00.000000Z", ts));
+    assert(!parse_rfc3339("2023-13-01T00:00:00.000000Z", ts));
+    assert(!parse_rfc3339("2023-04-31T00:00:00.000000Z", ts));
+    assert(!parse_rfc3339("2023-00-10T00:00:00.000000Z", ts));
+    assert(parse_rfc3339("2024-02-29T00:00:00.000000Z", ts));
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+void test_equivalence_valid() {
+    std::cout << "[TEST] Fast and generic parsers agree on valid timestamps..." << std::endl;
+
+    Rng rng{ 0x5eed };
+    for (int i = 0; i < 200000; ++i) {
+        const std::string ts = random_timestamp(rng);
+        check_same(ts);
+    }
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+void test_equivalence_mutated() {
+    std::cout << "[TEST] Fast and generic parsers agree on mutated input..." << std::endl;
+
+    static constexpr char ALPHABET[] = "0123456789-:.TtZz +/\x7f\xff";
+    Rng rng{ 0xf00d };
+    for (int i = 0; i < 200000; ++i) {
+        std::string ts = random_timestamp(rng);
+        switch (rng.below(3)) {
+        case 0: {   // overwrite 1..3 bytes
+            const std::uint32_t edits = 1 + rng.below(3);
+            for (std::uint32_t e = 0; e < edits; ++e) {
+                ts[rng.below(static_cast<std::uint32_t>(ts.size()))] =
+                    ALPHABET[rng.below(sizeof(ALPHABET) - 1)];
+            }
+            break;
+        }
+        case 1:     // truncate
+            ts.resize(rng.below(static_cast<std::uint32_t>(ts.size())));
+            break;
+        default:    // insert one byte
+            ts.insert(ts.begin() + rng.below(static_cast<std::uint32_t>(ts.size() + 1)),
+                      ALPHABET[rng.below(sizeof(ALPHABET) - 1)]);
+            break;
+        }
+        check_same(ts);
+    }
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+void test_date_cache() {
+    std::cout << "[TEST] Date cache follows date changes..." << std::endl;
+
+    Timestamp a{}, b{}, c{};
+    assert(parse_rfc3339("2023-09-25T23:59:59.999999Z", a));
+    assert(parse_rfc3339("2023-09-26T00:00:00.000000Z", b));
+    assert(parse_rfc3339("2023-09-25T23:59:59.999999Z", c));
+    assert(ns_of(b) - ns_of(a) == 1'000);
+    assert(a == c);
+
+    // An invalid date must not replace the cached one
+    assert(!parse_rfc3339("2023-09-31T00:00:00.000000Z", a));
+    assert(parse_rfc3339("2023-09-25T23:59:59.999999Z", a));
+    assert(a == c);
+
+    std::cout << "[TEST] OK" << std::endl;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main() {
+    test_known_values();
+    test_equivalence_valid();
+    test_equivalence_mutated();
+    test_date_cache();
+
+    std::cout << "[TEST] ALL TIMESTAMP PARSER TESTS PASSED!\n";
+    return 0;
+}
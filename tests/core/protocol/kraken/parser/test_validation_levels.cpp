@@ -0,0 +1,273 @@
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "simdjson.h"
+
+#include "wirekrak/core/protocol/kraken/parser/dom/trade/response.hpp"
+#include "wirekrak/core/protocol/kraken/parser/dom/book/response.hpp"
+#include "wirekrak/core/policy/protocol/validation.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol;
+using namespace wirekrak::core::protocol::kraken;
+
+namespace validation = wirekrak::core::policy::protocol::validation;
+
+/*
+================================================================================
+Kraken Data-Plane Parsers — Validation Levels
+================================================================================
+
+These tests validate the compile-time validation levels of the trade and book
+response parsers (Strict, Structural, Trusted):
+
+  • On a corpus of valid messages (hand-written edge cases plus generated
+    traffic), the three levels produce identical messages
+  • Structural still rejects schema violations (missing fields, wrong types)
+  • Only Strict rejects invalid domain values (unknown enums)
+================================================================================
+*/
+
+// ============================================================================
+// Equality helpers
+// ============================================================================
+
+template<class T>
+static bool same_optional(const lcr::optional<T>& a, const lcr::optional<T>& b) {
+    return a.has() == b.has() && (!a.has() || a.value() == b.value());
+}
+
+static bool same(const schema::trade::Response& a, const schema::trade::Response& b) {
+    if (a.type != b.type || a.trades.size() != b.trades.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.trades.size(); ++i) {
+        const auto& x = a.trades[i];
+        const auto& y = b.trades[i];
+        if (x.trade_id != y.trade_id || !(x.symbol == y.symbol) || x.price != y.price || x.qty != y.qty ||
+            x.side != y.side || x.timestamp != y.timestamp || !same_optional(x.ord_type, y.ord_type)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class Levels>
+static bool same_levels(const Levels& a, const Levels& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].price != b[i].price || a[i].qty != b[i].qty) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool same(const schema::book::Response& a, const schema::book::Response& b) {
+    return a.type == b.type
+        && a.book.symbol == b.book.symbol
+        && a.book.checksum == b.book.checksum
+        && same_optional(a.book.timestamp, b.book.timestamp)
+        && same_levels(a.book.asks, b.book.asks)
+        && same_levels(a.book.bids, b.book.bids);
+}
+
+// ============================================================================
+// Parse helpers
+// ============================================================================
+
+template<class Validation, class Parser, class Out>
+static MessageResult parse_as(std::string_view json, Out& out) {
+    simdjson::dom::parser parser;
+    auto doc = parser.parse(json);
+    assert(!doc.error());
+    return Parser::template parse<Validation>(doc.value(), out);
+}
+
+template<class Parser, class Out>
+static void check_identical(std::string_view json) {
+    Out strict{}, structural{}, trusted{};
+    const auto r1 = parse_as<validation::Strict, Parser>(json, strict);
+    const auto r2 = parse_as<validation::Structural, Parser>(json, structural);
+    const auto r3 = parse_as<validation::Trusted, Parser>(json, trusted);
+    if (r1 != MessageResult::Parsed || r2 != MessageResult::Parsed || r3 != MessageResult::Parsed ||
+        !same(strict, structural) || !same(strict, trusted)) {
+        std::cerr << "[TEST] Validation levels diverge on: " << json << std::endl;
+        assert(false);
+    }
+}
+
+// ============================================================================
+// Corpus
+// ============================================================================
+
+static const char* const TRADE_CORPUS[] = {
+    // Snapshot, several trades, optional field present and absent
+    R"({"channel":"trade","type":"snapshot","data":[
+        {"symbol":"BTC/USD","side":"buy","qty":0.5,"price":50000.0,"ord_type":"limit","trade_id":1001,"timestamp":"2022-12-25T09:30:59.123456Z"},
+        {"symbol":"ETH/USD","side":"sell","qty":2,"price":3000,"trade_id":1002,"timestamp":"2022-12-25T09:31:00.000000Z"}]})",
+    // Update, fields in a different order, market order
+    R"({"data":[{"timestamp":"2023-01-01T00:00:00Z","trade_id":7,"price":1e-5,"qty":123456789.123,"ord_type":"market","side":"sell","symbol":"SHIB/USD"}],"type":"update","channel":"trade"})",
+    // Unknown extra fields are ignored
+    R"({"channel":"trade","type":"update","extra":{"a":[1,2]},"data":[{"symbol":"XBT/EUR","side":"buy","qty":0.00000001,"price":42000.5,"trade_id":18446744073709551615,"timestamp":"2024-02-29T23:59:59.999999Z","venue":"x"}]})",
+};
+
+static const char* const BOOK_CORPUS[] = {
+    // Snapshot, both sides, no timestamp
+    R"({"channel":"book","type":"snapshot","data":[{"symbol":"BTC/USD","bids":[{"price":49999.9,"qty":1.5},{"price":49999.8,"qty":0.25}],"asks":[{"price":50000.1,"qty":2}],"checksum":3310070434}]})",
+    // Update, bids only, timestamp
+    R"({"channel":"book","type":"update","data":[{"symbol":"ETH/USD","bids":[{"price":3000.0,"qty":0}],"checksum":123,"timestamp":"2022-12-25T09:30:59.123456Z"}]})",
+    // Update, asks only, reordered fields and level keys
+    R"({"data":[{"timestamp":"2023-06-01T12:00:00.5Z","checksum":0,"asks":[{"qty":3.25,"price":1.0001}],"symbol":"XRP/USD"}],"type":"update","channel":"book"})",
+    // Empty side array next to a populated one
+    R"({"channel":"book","type":"update","data":[{"symbol":"SOL/USD","asks":[],"bids":[{"price":20.5,"qty":10}],"checksum":42,"timestamp":"2022-12-25T09:30:59Z"}]})",
+};
+
+// Deterministic generated traffic (LCG)
+struct Lcg {
+    std::uint64_t s = 0x9E3779B97F4A7C15ull;
+    std::uint64_t next() noexcept { s = s * 6364136223846793005ull + 1442695040888963407ull; return s >> 33; }
+};
+
+static std::string generated_trade(Lcg& rng) {
+    static const char* const symbols[] = { "BTC/USD", "ETH/USD", "SOL/EUR", "DOGE/USDT" };
+    static const char* const ord_types[] = { "limit", "market" };
+    char buf[512];
+    const bool with_ord_type = rng.next() & 1;
+    std::snprintf(buf, sizeof(buf),
+        R"({"channel":"trade","type":"%s","data":[{"symbol":"%s","side":"%s","qty":%.8f,"price":%.2f,%s"trade_id":%llu,"timestamp":"2025-%02llu-%02lluT%02llu:%02llu:%02llu.%06lluZ"}]})",
+        (rng.next() & 1) ? "update" : "snapshot",
+        symbols[rng.next() % 4],
+        (rng.next() & 1) ? "buy" : "sell",
+        static_cast<double>(rng.next() % 100000000) / 1e6,
+        static_cast<double>(rng.next() % 10000000) / 100.0,
+        with_ord_type ? (std::string(R"("ord_type":")") + ord_types[rng.next() % 2] + "\",").c_str() : "",
+        static_cast<unsigned long long>(rng.next()),
+        static_cast<unsigned long long>(1 + rng.next() % 12), static_cast<unsigned long long>(1 + rng.next() % 28),
+        static_cast<unsigned long long>(rng.next() % 24), static_cast<unsigned long long>(rng.next() % 60),
+        static_cast<unsigned long long>(rng.next() % 60), static_cast<unsigned long long>(rng.next() % 1000000));
+    return buf;
+}
+
+static std::string generated_book(Lcg& rng) {
+    std::string levels[2];
+    for (auto& side : levels) {
+        const std::uint64_t n = rng.next() % 6;
+        side = "[";
+        for (std::uint64_t i = 0; i < n; ++i) {
+            char lvl[96];
+            std::snprintf(lvl, sizeof(lvl), R"(%s{"price":%.1f,"qty":%.8f})", i ? "," : "",
+                static_cast<double>(rng.next() % 1000000) / 10.0, static_cast<double>(rng.next() % 100000) / 1e4);
+            side += lvl;
+        }
+        side += "]";
+    }
+    std::string json = R"({"channel":"book","type":"update","data":[{"symbol":"BTC/USD","bids":)" + levels[0] +
+                       R"(,"asks":)" + levels[1] + R"(,"checksum":)" + std::to_string(rng.next() % 4294967296ull) +
+                       R"(,"timestamp":"2025-03-04T05:06:07.)" + std::to_string(100000 + rng.next() % 900000) + R"(Z"}]})";
+    return json;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_trade_corpus_identical() {
+    std::cout << "[TEST] Trade corpus identical across validation levels..." << std::endl;
+
+    for (const char* json : TRADE_CORPUS) {
+        check_identical<parser::dom::trade::response, schema::trade::Response>(json);
+    }
+    Lcg rng;
+    for (int i = 0; i < 500; ++i) {
+        check_identical<parser::dom::trade::response, schema::trade::Response>(generated_trade(rng));
+    }
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_book_corpus_identical() {
+    std::cout << "[TEST] Book corpus identical across validation levels..." << std::endl;
+
+    for (const char* json : BOOK_CORPUS) {
+        check_identical<parser::dom::book::response, schema::book::Response>(json);
+    }
+    Lcg rng;
+    for (int i = 0; i < 500; ++i) {
+        std::string json = generated_book(rng);
+        // Kraken invariant: at least one side populated
+        if (json.find(R"("bids":[],"asks":[])") != std::string::npos) {
+            continue;
+        }
+        check_identical<parser::dom::book::response, schema::book::Response>(json);
+    }
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_structural_rejects_schema_violations() {
+    std::cout << "[TEST] Structural rejects schema violations..." << std::endl;
+
+    constexpr std::string_view missing_price =
+        R"({"type":"update","data":[{"symbol":"BTC/USD","side":"buy","qty":1.0,"trade_id":1,"timestamp":"2022-12-25T09:30:59Z"}]})";
+    constexpr std::string_view qty_as_string =
+        R"({"type":"update","data":[{"symbol":"BTC/USD","side":"buy","qty":"1.0","price":1.0,"trade_id":1,"timestamp":"2022-12-25T09:30:59Z"}]})";
+    constexpr std::string_view book_no_sides =
+        R"({"type":"update","data":[{"symbol":"BTC/USD","checksum":1}]})";
+    constexpr std::string_view book_level_missing_qty =
+        R"({"type":"update","data":[{"symbol":"BTC/USD","bids":[{"price":1.0}],"checksum":1}]})";
+
+    schema::trade::Response trade{};
+    assert((parse_as<validation::Strict, parser::dom::trade::response>(missing_price, trade) == MessageResult::InvalidSchema));
+    assert((parse_as<validation::Structural, parser::dom::trade::response>(missing_price, trade) == MessageResult::InvalidSchema));
+    assert((parse_as<validation::Strict, parser::dom::trade::response>(qty_as_string, trade) == MessageResult::InvalidSchema));
+    assert((parse_as<validation::Structural, parser::dom::trade::response>(qty_as_string, trade) == MessageResult::InvalidSchema));
+
+    schema::book::Response book{};
+    assert((parse_as<validation::Strict, parser::dom::book::response>(book_no_sides, book) == MessageResult::InvalidSchema));
+    assert((parse_as<validation::Structural, parser::dom::book::response>(book_no_sides, book) == MessageResult::InvalidSchema));
+    assert((parse_as<validation::Strict, parser::dom::book::response>(book_level_missing_qty, book) == MessageResult::InvalidSchema));
+    assert((parse_as<validation::Structural, parser::dom::book::response>(book_level_missing_qty, book) == MessageResult::InvalidSchema));
+
+    // Containers are checked at every level
+    constexpr std::string_view data_not_array = R"({"type":"update","data":{"symbol":"BTC/USD"}})";
+    assert((parse_as<validation::Trusted, parser::dom::trade::response>(data_not_array, trade) == MessageResult::InvalidSchema));
+    assert((parse_as<validation::Trusted, parser::dom::book::response>(data_not_array, book) == MessageResult::InvalidSchema));
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_only_strict_checks_values() {
+    std::cout << "[TEST] Only Strict checks domain values..." << std::endl;
+
+    constexpr std::string_view unknown_side =
+        R"({"type":"update","data":[{"symbol":"BTC/USD","side":"hold","qty":1.0,"price":1.0,"trade_id":1,"timestamp":"2022-12-25T09:30:59Z"}]})";
+
+    schema::trade::Response trade{};
+    assert((parse_as<validation::Strict, parser::dom::trade::response>(unknown_side, trade) == MessageResult::InvalidValue));
+    assert((parse_as<validation::Structural, parser::dom::trade::response>(unknown_side, trade) == MessageResult::Parsed));
+    assert(trade.trades.front().side == Side::Unknown);
+
+    std::cout << "[TEST] OK\n";
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main() {
+    test_trade_corpus_identical();
+    test_book_corpus_identical();
+    test_structural_rejects_schema_violations();
+    test_only_strict_checks_values();
+
+    std::cout << "[TEST] ALL VALIDATION LEVEL TESTS PASSED!\n";
+    return 0;
+}
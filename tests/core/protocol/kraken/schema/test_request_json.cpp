@@ -0,0 +1,176 @@
+/*
+===============================================================================
+ protocol::kraken::schema - Pre-rendered request JSON - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate that the fragment-based request writers produce exactly
+the JSON of a field-by-field reference writer:
+
+  • Every book depth x snapshot option combination (subscribe / unsubscribe),
+    including depths outside the accepted set (fallback path)
+  • Trade snapshot options, with and without req_id
+  • Symbols that need escaping, single and many symbols, req_id extremes
+  • Written size never exceeds max_json_size()
+
+===============================================================================
+*/
+
+#include <cstdint>
+#include <iterator>
+#include <iostream>
+#include <string>
+
+#include "wirekrak/core/protocol/kraken/schema/trade/subscribe.hpp"
+#include "wirekrak/core/protocol/kraken/schema/trade/unsubscribe.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/subscribe.hpp"
+#include "wirekrak/core/protocol/kraken/schema/book/unsubscribe.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol::kraken;
+
+// ------------------------------------------------------------
+// Reference writer (field by field)
+// ------------------------------------------------------------
+template<class RequestT>
+static std::string reference(std::string_view method, std::string_view channel, const RequestT& req) {
+    std::string out = "{\"method\":\"" + std::string(method) + "\",\"params\":{\"channel\":\"" + std::string(channel) + "\",\"symbol\":[";
+    for (std::size_t i = 0; i < req.symbols.size(); ++i) {
+        out += '"';
+        for (char c : std::string_view(req.symbols[i])) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+            }
+            out += c;
+        }
+        out += '"';
+        if (i + 1 < req.symbols.size()) {
+            out += ',';
+        }
+    }
+    out += ']';
+    if constexpr (requires { req.depth; }) {
+        if (req.depth.has()) {
+            out += ",\"depth\":" + std::to_string(req.depth.value());
+        }
+    }
+    if constexpr (requires { req.snapshot; }) {
+        if (req.snapshot.has()) {
+            out += req.snapshot.value() ? ",\"snapshot\":true" : ",\"snapshot\":false";
+        }
+    }
+    out += '}';
+    if (req.req_id.has()) {
+        out += ",\"req_id\":" + std::to_string(req.req_id.value());
+    }
+    out += '}';
+    return out;
+}
+
+template<class RequestT>
+static bool matches(std::string_view method, std::string_view channel, const RequestT& req) {
+    char buffer[1 << 16];
+    const std::size_t size = req.write_json(buffer);
+    const std::string expected = reference(method, channel, req);
+    if (std::string_view(buffer, size) != expected) {
+        std::cout << "  expected: " << expected << "\n  actual  : " << std::string_view(buffer, size) << '\n';
+        return false;
+    }
+    return size <= req.max_json_size();
+}
+
+static RequestSymbols many_symbols(std::size_t n) {
+    RequestSymbols symbols;
+    for (std::size_t i = 0; i < n; ++i) {
+        symbols.emplace_back(("S" + std::to_string(i) + "/USD").c_str());
+    }
+    return symbols;
+}
+
+
+void test_book_option_combinations() {
+    std::cout << "[TEST] Book depth x snapshot combinations...\n";
+
+    // Depths outside the accepted set trap in debug builds (fallback path in release)
+#ifdef NDEBUG
+    const std::uint32_t depths[] = {10, 25, 100, 500, 1000, 7};
+#else
+    const std::uint32_t depths[] = {10, 25, 100, 500, 1000};
+#endif
+    for (int d = -1; d < static_cast<int>(std::size(depths)); ++d) {
+        for (int snap = -1; snap < 2; ++snap) {
+            schema::book::Subscribe sub{.symbols = {Symbol{"BTC/USD"}, Symbol{"ETH/EUR"}}};
+            schema::book::Unsubscribe unsub{.symbols = {Symbol{"BTC/USD"}}};
+            if (d >= 0) {
+                sub.depth = depths[d];
+                unsub.depth = depths[d];
+            }
+            if (snap >= 0) {
+                sub.snapshot = snap == 1;
+            }
+            sub.req_id = 42;
+            TEST_CHECK(matches("subscribe", "book", sub));
+            TEST_CHECK(matches("unsubscribe", "book", unsub));
+        }
+    }
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_trade_options() {
+    std::cout << "[TEST] Trade snapshot options and req_id...\n";
+
+    for (int snap = -1; snap < 2; ++snap) {
+        for (bool with_req_id : {false, true}) {
+            schema::trade::Subscribe sub{.symbols = {Symbol{"BTC/USD"}}};
+            schema::trade::Unsubscribe unsub{.symbols = {Symbol{"BTC/USD"}}};
+            if (snap >= 0) {
+                sub.snapshot = snap == 1;
+            }
+            if (with_req_id) {
+                sub.req_id = 10;
+                unsub.req_id = 11;
+            }
+            TEST_CHECK(matches("subscribe", "trade", sub));
+            TEST_CHECK(matches("unsubscribe", "trade", unsub));
+        }
+    }
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_symbols_and_req_ids() {
+    std::cout << "[TEST] Escaped symbols, many symbols, req_id extremes...\n";
+
+    schema::trade::Subscribe escaped{.symbols = {Symbol{"A\"B"}, Symbol{"C\\D"}, Symbol{"E/F"}}};
+    escaped.req_id = 1;
+    TEST_CHECK(matches("subscribe", "trade", escaped));
+
+    schema::book::Subscribe many{.symbols = many_symbols(MAX_REQUEST_SYMBOLS)};
+    many.depth = 100;
+    many.snapshot = false;
+    many.req_id = UINT64_MAX;
+    TEST_CHECK(matches("subscribe", "book", many));
+
+    const std::uint64_t ids[] = {1, 9, 10, 99, 100, 101, 999, 1000, 123456789, 10000000000000000000ULL};
+    for (std::uint64_t id : ids) {
+        schema::trade::Unsubscribe unsub{.symbols = {Symbol{"X/Y"}}};
+        unsub.req_id = id;
+        TEST_CHECK(matches("unsubscribe", "trade", unsub));
+    }
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_book_option_combinations();
+    test_trade_options();
+    test_symbols_and_req_ids();
+
+    std::cout << "\n[GROUP] Pre-rendered request JSON tests passed!\n";
+    return 0;
+}
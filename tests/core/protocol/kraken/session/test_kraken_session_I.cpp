@@ -0,0 +1,141 @@
+/*
+===============================================================================
+ protocol::kraken::Session - Group I - Poll budget
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • Count budget bounds the messages processed per poll()
+  • Deadline budget stops a poll() once its time budget is spent
+  • Per-type quotas stop a poll() once a quota is reached
+  • Remaining messages are processed by the following polls
+
+===============================================================================
+*/
+
+#include <iostream>
+#include <string>
+
+#include "common/harness/session.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core::protocol::kraken::test;
+
+// ------------------------------------------------------------
+// Utility
+// ------------------------------------------------------------
+
+static std::string trade_update(std::uint64_t trade_id) {
+    return R"({"channel":"trade","type":"update","data":[{"symbol":"BTC/USD","side":"buy","qty":0.5,"price":50000.0,"trade_id":)" +
+           std::to_string(trade_id) +
+           R"(,"timestamp":"2022-12-25T09:30:59.123456Z"}]})";
+}
+
+template<class Harness>
+static std::size_t poll_and_count_trades(Harness& h) {
+    (void)h.session.poll();
+    return h.session.data_plane().template drain<schema::trade::Response>([](const auto&) {});
+}
+
+template<class PollBudget>
+using BudgetHarness = harness::Session<
+    WebSocketUnderTest,
+    MessageRingUnderTest,
+    policy::protocol::session_bundle<
+        policy::protocol::DefaultBackpressure,
+        policy::protocol::DefaultLiveness,
+        policy::protocol::DefaultProgress,
+        policy::protocol::DefaultSymbolLimit,
+        policy::protocol::DefaultReplay,
+        policy::protocol::DefaultBatching,
+        policy::protocol::DefaultFanout,
+        policy::protocol::DefaultConflation,
+        PollBudget
+    >
+>;
+
+
+// ------------------------------------------------------------
+// I1 - Count budget
+// ------------------------------------------------------------
+
+void test_count_budget() {
+    std::cout << "[TEST] I1 Count budget\n";
+
+    BudgetHarness<policy::protocol::CountBudget<3>> h;
+    h.connect();
+
+    for (int i = 0; i < 5; ++i) {
+        h.session.ws()->emit_message(trade_update(100 + i));
+    }
+
+    TEST_CHECK(poll_and_count_trades(h) == 3);
+    TEST_CHECK(poll_and_count_trades(h) == 2);
+    TEST_CHECK(poll_and_count_trades(h) == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// I2 - Deadline budget
+// ------------------------------------------------------------
+
+void test_deadline_budget() {
+    std::cout << "[TEST] I2 Deadline budget\n";
+
+    // 1 ns budget: every poll() stops after its first message
+    BudgetHarness<policy::protocol::DeadlineBudget<1>> h;
+    h.connect();
+
+    for (int i = 0; i < 3; ++i) {
+        h.session.ws()->emit_message(trade_update(200 + i));
+    }
+
+    TEST_CHECK(poll_and_count_trades(h) == 1);
+    TEST_CHECK(poll_and_count_trades(h) == 1);
+    TEST_CHECK(poll_and_count_trades(h) == 1);
+    TEST_CHECK(poll_and_count_trades(h) == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// I3 - Per-type quota
+// ------------------------------------------------------------
+
+void test_message_quota() {
+    std::cout << "[TEST] I3 Per-type message quota\n";
+
+    BudgetHarness<
+        policy::protocol::CountBudget<
+            128,
+            policy::protocol::message_quota<schema::trade::Response, 2>
+        >
+    > h;
+    h.connect();
+
+    for (int i = 0; i < 5; ++i) {
+        h.session.ws()->emit_message(trade_update(300 + i));
+    }
+
+    TEST_CHECK(poll_and_count_trades(h) == 2);
+    TEST_CHECK(poll_and_count_trades(h) == 2);
+    TEST_CHECK(poll_and_count_trades(h) == 1);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_count_budget();
+    test_deadline_budget();
+    test_message_quota();
+
+    std::cout << "\n[GROUP] Session poll budget tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,249 @@
+/*
+===============================================================================
+ protocol::kraken::Session - Group J - Load shedding
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • Sustained backpressure sheds the lowest priority symbol first
+  • Further overloaded polls shed the next batch
+  • Messages of shed (stale) symbols are dropped, hot symbols keep flowing
+  • Shed symbols are resubscribed once backpressure has cleared, after
+    their unsubscribe ACK
+  • Activity ordering sheds the least active symbol first
+  • Shed / Resynced transitions are reported per symbol
+  • Multi-symbol trade messages only lose the trades of stale symbols
+
+===============================================================================
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "common/harness/session.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core::protocol::kraken::test;
+
+// ------------------------------------------------------------
+// Utility
+// ------------------------------------------------------------
+
+static std::string trade_update(const char* symbol, std::uint64_t trade_id) {
+    return std::string(R"({"channel":"trade","type":"update","data":[{"symbol":")") + symbol +
+           R"(","side":"buy","qty":0.5,"price":50000.0,"trade_id":)" +
+           std::to_string(trade_id) +
+           R"(,"timestamp":"2022-12-25T09:30:59.123456Z"}]})";
+}
+
+// Drains all trade responses, returns the symbol of each one
+template<class Harness>
+static std::vector<std::string> drain_trades(Harness& h) {
+    std::vector<std::string> symbols;
+    (void)h.session.data_plane().template drain<schema::trade::Response>([&](const auto& msg) {
+        symbols.push_back(msg.trades.front().symbol.to_string());
+    });
+    return symbols;
+}
+
+template<class Harness>
+static std::vector<SheddingEvent> take_events(Harness& h) {
+    std::vector<SheddingEvent> out;
+    (void)h.session.drain_shedding_events([&](const SheddingEvent& ev) { out.push_back(ev); });
+    return out;
+}
+
+template<class Shedding>
+using SheddingHarness = harness::Session<
+    WebSocketUnderTest,
+    MessageRingUnderTest,
+    policy::protocol::session_bundle<
+        policy::protocol::DefaultBackpressure,
+        policy::protocol::DefaultLiveness,
+        policy::protocol::DefaultProgress,
+        policy::protocol::DefaultSymbolLimit,
+        policy::protocol::DefaultReplay,
+        policy::protocol::DefaultBatching,
+        policy::protocol::DefaultFanout,
+        policy::protocol::DefaultConflation,
+        policy::protocol::DefaultPollBudget,
+        Shedding
+    >
+>;
+
+// Shed 1 symbol every 2 overloaded polls, resync after 3 clear polls
+template<policy::protocol::ShedOrder Order>
+using ShedEvery2 = policy::protocol::LoadShedding<Order, 2, 1, 3>;
+
+template<class Harness>
+static void subscribe_confirmed(Harness& h, const Symbol& symbol) {
+    const auto id = h.subscribe_trade(symbol);
+    TEST_CHECK(id != ctrl::INVALID_REQ_ID);
+    h.confirm_trade_subscription(id, symbol);
+}
+
+
+// ------------------------------------------------------------
+// J1 - Priority shedding and resync
+// ------------------------------------------------------------
+
+void test_priority_shedding_and_resync() {
+    std::cout << "[TEST] J1 Priority shedding and resync\n";
+
+    SheddingHarness<ShedEvery2<policy::protocol::ShedOrder::Priority>> h;
+    h.connect();
+
+    const Symbol btc{"BTC/USD"}, eth{"ETH/USD"}, sol{"SOL/USD"};
+    subscribe_confirmed(h, btc);
+    subscribe_confirmed(h, eth);
+    subscribe_confirmed(h, sol);
+    h.session.set_symbol_priority(btc, 200);
+    h.session.set_symbol_priority(eth, 50);
+    h.session.set_symbol_priority(sol, 100);
+
+    const ctrl::req_id_t next_req_id = h.subscribe_trade(Symbol{"XRP/USD"}) + 1;
+
+    // Sustained backpressure: 2 polls → lowest priority symbol is shed
+    h.session.ws()->emit_backpressure_detected();
+    (void)h.session.poll();
+    TEST_CHECK(h.session.shed_symbols() == 0);
+    (void)h.session.poll();
+    TEST_CHECK(h.session.shed_symbols() == 1);
+    TEST_CHECK(h.session.is_symbol_stale(eth));
+    TEST_CHECK(!h.session.is_symbol_stale(btc));
+    TEST_CHECK(h.trade_subscriptions().pending_unsubscribe_symbols() == 1);
+
+    auto events = take_events(h);
+    TEST_CHECK(events.size() == 1);
+    TEST_CHECK(events[0].symbol == intern_symbol(eth.view()) && events[0].type == SheddingEventType::Shed);
+
+    // Stale symbol data is dropped, hot symbols keep their feed
+    h.session.ws()->emit_message(trade_update("ETH/USD", 1));
+    h.session.ws()->emit_message(trade_update("BTC/USD", 2));
+    (void)h.session.poll();     // 3rd overloaded poll
+    const auto delivered = drain_trades(h);
+    TEST_CHECK(delivered.size() == 1 && delivered[0] == "BTC/USD");
+
+    // 4th overloaded poll → next batch
+    (void)h.session.poll();
+    TEST_CHECK(h.session.shed_symbols() == 2);
+    TEST_CHECK(h.session.is_symbol_stale(sol));
+
+    // Pressure clears: resync waits for the unsubscribe ACK
+    h.session.ws()->emit_backpressure_cleared();
+    h.drain(4);
+    TEST_CHECK(h.session.shed_symbols() == 2);
+
+    h.confirm_trade_unsubscription(next_req_id, eth);
+    TEST_CHECK(!h.session.is_symbol_stale(eth));
+    TEST_CHECK(h.session.is_symbol_stale(sol));
+    TEST_CHECK(h.replay_db_trade().contains_symbol(eth));
+
+    h.confirm_trade_unsubscription(next_req_id + 1, sol);
+    TEST_CHECK(h.session.shed_symbols() == 0);
+    TEST_CHECK(h.replay_db_trade().contains_symbol(sol));
+    TEST_CHECK(h.trade_subscriptions().pending_subscribe_symbols() == 3); // XRP + 2 resyncs
+
+    events = take_events(h);
+    TEST_CHECK(events.size() == 3);
+    TEST_CHECK(events[0].type == SheddingEventType::Shed);      // SOL
+    TEST_CHECK(events[1].type == SheddingEventType::Resynced);  // ETH
+    TEST_CHECK(events[1].symbol == intern_symbol(eth.view()));
+    TEST_CHECK(events[2].type == SheddingEventType::Resynced);  // SOL
+    TEST_CHECK(events[2].symbol == intern_symbol(sol.view()));
+
+    // Resynced symbol flows again
+    h.session.ws()->emit_message(trade_update("ETH/USD", 3));
+    (void)h.session.poll();
+    TEST_CHECK(drain_trades(h) == std::vector<std::string>{"ETH/USD"});
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// J2 - Activity shedding
+// ------------------------------------------------------------
+
+void test_activity_shedding() {
+    std::cout << "[TEST] J2 Activity shedding\n";
+
+    SheddingHarness<ShedEvery2<policy::protocol::ShedOrder::Activity>> h;
+    h.connect();
+
+    const Symbol btc{"BTC/USD"}, eth{"ETH/USD"};
+    subscribe_confirmed(h, btc);
+    subscribe_confirmed(h, eth);
+
+    for (int i = 0; i < 6; ++i) {
+        h.session.ws()->emit_message(trade_update("BTC/USD", 100 + i));
+    }
+    h.session.ws()->emit_message(trade_update("ETH/USD", 200));
+    (void)h.session.poll();
+    TEST_CHECK(drain_trades(h).size() == 7);
+
+    h.session.ws()->emit_backpressure_detected();
+    h.drain(2);
+    TEST_CHECK(h.session.shed_symbols() == 1);
+    TEST_CHECK(h.session.is_symbol_stale(eth));
+    TEST_CHECK(!h.session.is_symbol_stale(btc));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// J3 - Multi-symbol messages are filtered per symbol
+// ------------------------------------------------------------
+
+void test_multi_symbol_message_shedding() {
+    std::cout << "[TEST] J3 Multi-symbol trade message under shedding\n";
+
+    SheddingHarness<ShedEvery2<policy::protocol::ShedOrder::Priority>> h;
+    h.connect();
+
+    const Symbol btc{"BTC/USD"}, eth{"ETH/USD"};
+    subscribe_confirmed(h, btc);
+    subscribe_confirmed(h, eth);
+    h.session.set_symbol_priority(btc, 200);
+    h.session.set_symbol_priority(eth, 50);
+
+    h.session.ws()->emit_backpressure_detected();
+    (void)h.session.poll();
+    (void)h.session.poll();
+    TEST_CHECK(h.session.is_symbol_stale(eth));
+
+    auto trade = [](const char* symbol, std::uint64_t trade_id) {
+        return std::string(R"({"symbol":")") + symbol +
+               R"(","side":"buy","qty":0.5,"price":50000.0,"trade_id":)" + std::to_string(trade_id) +
+               R"(,"timestamp":"2022-12-25T09:30:59.123456Z"})";
+    };
+    h.session.ws()->emit_message(std::string(R"({"channel":"trade","type":"update","data":[)") +
+        trade("ETH/USD", 1) + "," + trade("BTC/USD", 2) + "," + trade("ETH/USD", 3) + "," + trade("BTC/USD", 4) + "]}");
+    (void)h.session.poll();
+
+    std::vector<std::uint64_t> ids;
+    (void)h.session.data_plane().template drain<schema::trade::Response>([&](const auto& msg) {
+        for (const auto& t : msg.trades) {
+            TEST_CHECK(t.symbol.view() == "BTC/USD");
+            ids.push_back(t.trade_id);
+        }
+    });
+    TEST_CHECK((ids == std::vector<std::uint64_t>{2, 4}));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_priority_shedding_and_resync();
+    test_activity_shedding();
+    test_multi_symbol_message_shedding();
+
+    std::cout << "\n[GROUP] Session load shedding tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,263 @@
+/*
+===============================================================================
+ protocol::kraken::Session - Group K - Coroutine façade
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • subscribed(req_id) resumes once the request is ACKed (true) or
+    rejected (false)
+  • next<T>(symbol) resumes each task with messages of its own symbol only,
+    in order, without missing messages of a task re-awaiting in a loop
+  • Finished tasks release their slot and frame
+  • Types nobody awaits stay in the DataPlane for plain drain<T>()
+  • Messages of an awaited type with no waiting symbol are parked (counted
+    unclaimed) for a later next<T>() or Scheduler::drain<T>(); a full
+    parking buffer drops its oldest message (counted dropped)
+  • Multi-symbol messages are split per symbol before delivery
+
+===============================================================================
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "wirekrak/core/protocol/coro/scheduler.hpp"
+#include "common/harness/session.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core::protocol::kraken::test;
+
+// ------------------------------------------------------------
+// Utility
+// ------------------------------------------------------------
+
+static std::string trade_update(const char* symbol, std::uint64_t trade_id) {
+    return std::string(R"({"channel":"trade","type":"update","data":[{"symbol":")") + symbol +
+           R"(","side":"buy","qty":0.5,"price":50000.0,"trade_id":)" +
+           std::to_string(trade_id) +
+           R"(,"timestamp":"2022-12-25T09:30:59.123456Z"}]})";
+}
+
+using Harness   = harness::Session<WebSocketUnderTest, MessageRingUnderTest>;
+using Scheduler = coro::Scheduler<Harness::SessionUnderTest, 4>;
+
+struct Outcome {
+    bool subscribed = false;
+    std::vector<std::uint64_t> trade_ids;
+};
+
+// Subscribes, waits for the ACK, then collects `count` trades of the symbol
+WK_CORO_TASKS_BEGIN
+static coro::Task collect_trades(Scheduler& sched, Symbol symbol, int count, Outcome& out) {
+    const auto req_id = sched.session().subscribe(schema::trade::Subscribe{ .symbols = {symbol} });
+    out.subscribed = co_await sched.subscribed(req_id);
+    if (!out.subscribed) {
+        co_return;
+    }
+    for (int i = 0; i < count; ++i) {
+        const auto msg = co_await sched.next<schema::trade::Response>(symbol);
+        out.trade_ids.push_back(msg.trades.front().trade_id);
+    }
+}
+WK_CORO_TASKS_END
+
+
+// ------------------------------------------------------------
+// K1 - Subscribe, then per-symbol updates
+// ------------------------------------------------------------
+
+void test_subscribed_then_per_symbol_updates() {
+    std::cout << "[TEST] K1 Subscribed then per-symbol updates\n";
+
+    Harness h;
+    h.connect();
+    Scheduler sched{h.session};
+
+    Outcome btc, eth;
+    TEST_CHECK(sched.spawn(collect_trades(sched, Symbol{"BTC/USD"}, 3, btc)));
+    TEST_CHECK(sched.spawn(collect_trades(sched, Symbol{"ETH/USD"}, 2, eth)));
+    TEST_CHECK(sched.live_tasks() == 2);
+    TEST_CHECK(sched.frame_pool().used() == 2);
+
+    // Both tasks wait for their ACK
+    (void)sched.poll();
+    TEST_CHECK(!btc.subscribed && !eth.subscribed);
+
+    h.session.ws()->emit_message(json::ack::trade_sub(10, Symbol{"BTC/USD"}));
+    h.session.ws()->emit_message(json::ack::trade_sub(11, Symbol{"ETH/USD"}));
+    (void)sched.poll();
+    TEST_CHECK(btc.subscribed && eth.subscribed);
+
+    // Interleaved burst: each task only sees its own symbol, in order
+    h.session.ws()->emit_message(trade_update("BTC/USD", 1));
+    h.session.ws()->emit_message(trade_update("BTC/USD", 2));
+    h.session.ws()->emit_message(trade_update("ETH/USD", 3));
+    h.session.ws()->emit_message(trade_update("BTC/USD", 4));
+    h.session.ws()->emit_message(trade_update("ETH/USD", 5));
+    (void)sched.poll();
+
+    TEST_CHECK((btc.trade_ids == std::vector<std::uint64_t>{1, 2, 4}));
+    TEST_CHECK((eth.trade_ids == std::vector<std::uint64_t>{3, 5}));
+    TEST_CHECK(sched.unclaimed_messages() == 0);
+
+    // Finished tasks release their slot and frame
+    TEST_CHECK(sched.live_tasks() == 0);
+    TEST_CHECK(sched.frame_pool().used() == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// K2 - Rejected subscription
+// ------------------------------------------------------------
+
+void test_rejected_subscription() {
+    std::cout << "[TEST] K2 Rejected subscription\n";
+
+    Harness h;
+    h.connect();
+    Scheduler sched{h.session};
+
+    Outcome out;
+    TEST_CHECK(sched.spawn(collect_trades(sched, Symbol{"BTC/USD"}, 1, out)));
+
+    h.session.ws()->emit_message(json::ack::rejection_notice("subscribe", 10, Symbol{"BTC/USD"}, "Subscription rejected"));
+    (void)sched.poll();
+
+    TEST_CHECK(!out.subscribed);
+    TEST_CHECK(sched.live_tasks() == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// K3 - Unclaimed and unawaited messages
+// ------------------------------------------------------------
+
+WK_CORO_TASKS_BEGIN
+void test_unclaimed_messages() {
+    std::cout << "[TEST] K3 Unclaimed messages\n";
+
+    Harness h;
+    h.connect();
+    Scheduler sched{h.session};
+
+    const Symbol btc{"BTC/USD"}, eth{"ETH/USD"};
+    h.confirm_trade_subscription(h.subscribe_trade(btc), btc);
+    h.confirm_trade_subscription(h.subscribe_trade(eth), eth);
+
+    // No task awaits trades: messages stay in the data plane
+    h.session.ws()->emit_message(trade_update("ETH/USD", 1));
+    (void)sched.poll();
+    TEST_CHECK(!h.session.data_plane().template empty<schema::trade::Response>());
+    std::vector<std::uint64_t> drained;
+    (void)h.session.data_plane().template drain<schema::trade::Response>([&](const auto& msg) {
+        drained.push_back(msg.trades.front().trade_id);
+    });
+    TEST_CHECK(drained == std::vector<std::uint64_t>{1});
+
+    // Awaited type: other symbols are parked and counted
+    Outcome out;
+    TEST_CHECK(sched.spawn([](Scheduler& sched, Symbol symbol, Outcome& out) -> coro::Task {
+        const auto msg = co_await sched.next<schema::trade::Response>(symbol);
+        out.trade_ids.push_back(msg.trades.front().trade_id);
+    }(sched, btc, out)));
+
+    h.session.ws()->emit_message(trade_update("ETH/USD", 2));
+    h.session.ws()->emit_message(trade_update("BTC/USD", 3));
+    h.session.ws()->emit_message(trade_update("ETH/USD", 4));
+    (void)sched.poll();
+
+    TEST_CHECK(out.trade_ids == std::vector<std::uint64_t>{3});
+    TEST_CHECK(sched.unclaimed_messages() == 1);
+    TEST_CHECK(sched.dropped_messages() == 0);
+    TEST_CHECK(sched.live_tasks() == 0);
+
+    // The waiter is gone: parked messages come first, then the data plane
+    drained.clear();
+    (void)sched.drain<schema::trade::Response>([&](const auto& msg) {
+        drained.push_back(msg.trades.front().trade_id);
+    });
+    TEST_CHECK((drained == std::vector<std::uint64_t>{2, 4}));
+
+    std::cout << "[TEST] OK\n";
+}
+WK_CORO_TASKS_END
+
+
+// ------------------------------------------------------------
+// K4 - Parked messages reach later tasks
+// ------------------------------------------------------------
+
+WK_CORO_TASKS_BEGIN
+void test_parked_messages() {
+    std::cout << "[TEST] K4 Parked messages\n";
+
+    using SmallScheduler = coro::Scheduler<Harness::SessionUnderTest, 4, 64 * 1024, 2>;
+
+    Harness h;
+    h.connect();
+    SmallScheduler sched{h.session};
+
+    const Symbol btc{"BTC/USD"}, eth{"ETH/USD"};
+    h.confirm_trade_subscription(h.subscribe_trade(btc), btc);
+    h.confirm_trade_subscription(h.subscribe_trade(eth), eth);
+
+    auto collect = [](SmallScheduler& sched, Symbol symbol, int count, Outcome& out) -> coro::Task {
+        for (int i = 0; i < count; ++i) {
+            const auto msg = co_await sched.next<schema::trade::Response>(symbol);
+            for (const auto& t : msg.trades) {
+                out.trade_ids.push_back(t.trade_id);
+            }
+        }
+    };
+
+    // One message mixing both symbols is split: BTC reaches the task,
+    // ETH is parked. Three more ETH messages overflow the 2-slot buffer.
+    Outcome btc_out;
+    TEST_CHECK(sched.spawn(collect(sched, btc, 1, btc_out)));
+
+    h.session.ws()->emit_message(R"({"channel":"trade","type":"update","data":[)"
+        R"({"symbol":"ETH/USD","side":"buy","qty":0.5,"price":3000.0,"trade_id":1,"timestamp":"2022-12-25T09:30:59.123456Z"},)"
+        R"({"symbol":"BTC/USD","side":"buy","qty":0.5,"price":50000.0,"trade_id":2,"timestamp":"2022-12-25T09:30:59.123456Z"}]})");
+    (void)sched.poll();
+    TEST_CHECK(btc_out.trade_ids == std::vector<std::uint64_t>{2});
+    TEST_CHECK(sched.unclaimed_messages() == 1);
+
+    TEST_CHECK(sched.spawn(collect(sched, btc, 1, btc_out)));
+    h.session.ws()->emit_message(trade_update("ETH/USD", 3));
+    h.session.ws()->emit_message(trade_update("ETH/USD", 4));
+    h.session.ws()->emit_message(trade_update("BTC/USD", 5));
+    (void)sched.poll();
+    TEST_CHECK((btc_out.trade_ids == std::vector<std::uint64_t>{2, 5}));
+    TEST_CHECK(sched.unclaimed_messages() == 3);
+    TEST_CHECK(sched.dropped_messages() == 1);
+
+    // A later ETH task resumes at once with the parked messages, in order
+    Outcome eth_out;
+    TEST_CHECK(sched.spawn(collect(sched, eth, 2, eth_out)));
+    (void)sched.poll();
+    TEST_CHECK((eth_out.trade_ids == std::vector<std::uint64_t>{3, 4}));
+    TEST_CHECK(sched.live_tasks() == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+WK_CORO_TASKS_END
+
+
+int main() {
+    test_subscribed_then_per_symbol_updates();
+    test_rejected_subscription();
+    test_unclaimed_messages();
+    test_parked_messages();
+
+    std::cout << "\n[GROUP] Session coroutine façade tests passed!\n";
+    return 0;
+}
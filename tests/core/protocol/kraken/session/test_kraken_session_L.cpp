@@ -0,0 +1,157 @@
+/*
+===============================================================================
+ protocol::kraken::Session - Group L - SessionRunner
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • run() drives poll() + handler on the calling thread until stop()
+  • Messages received by poll() are handed to the handler in the same iteration
+  • Idle iterations are counted (no message received, nothing drained)
+  • start() / stop() / join() on a dedicated runner thread
+  • The loop exits on its own once the session is no longer active
+
+===============================================================================
+*/
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "wirekrak/core/protocol/runner.hpp"
+#include "common/harness/session.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core::protocol::kraken::test;
+
+// ------------------------------------------------------------
+// Utility
+// ------------------------------------------------------------
+
+static std::string trade_update(const char* symbol, std::uint64_t trade_id) {
+    return std::string(R"({"channel":"trade","type":"update","data":[{"symbol":")") + symbol +
+           R"(","side":"buy","qty":0.5,"price":50000.0,"trade_id":)" +
+           std::to_string(trade_id) +
+           R"(,"timestamp":"2022-12-25T09:30:59.123456Z"}]})";
+}
+
+using Harness = harness::Session<WebSocketUnderTest, MessageRingUnderTest>;
+using SessionT = Harness::SessionUnderTest;
+
+
+// ------------------------------------------------------------
+// L1 - run() on the calling thread
+// ------------------------------------------------------------
+
+void test_run_on_calling_thread() {
+    std::cout << "[TEST] L1 run() on the calling thread\n";
+
+    Harness h;
+    h.connect();
+
+    const Symbol btc{"BTC/USD"};
+    h.confirm_trade_subscription(h.subscribe_trade(btc), btc);
+
+    SessionRunner<SessionT, policy::protocol::idle::BusySpin> runner{h.session};
+
+    std::vector<std::uint64_t> trade_ids;
+    int iteration = 0;
+    runner.run([&](SessionT& s) {
+        // Two updates arrive on the first iteration, then the loop idles
+        if (iteration == 0) {
+            s.ws()->emit_message(trade_update("BTC/USD", 1));
+            s.ws()->emit_message(trade_update("BTC/USD", 2));
+        }
+        if (++iteration == 8) {
+            runner.stop();
+        }
+        return s.data_plane().template drain<schema::trade::Response>([&](const schema::trade::Response& msg) {
+            trade_ids.push_back(msg.trades.front().trade_id);
+        });
+    });
+
+    TEST_CHECK((trade_ids == std::vector<std::uint64_t>{1, 2}));
+    TEST_CHECK(!runner.is_running());
+    TEST_CHECK(runner.telemetry().loop_iterations_total.load() == 8);
+    // Iteration 1 drained nothing (messages were emitted after poll()), iteration 2 drained both
+    TEST_CHECK(runner.telemetry().idle_iterations_total.load() == 7);
+    TEST_CHECK(runner.telemetry().idle_ratio() > 0.8);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// L2 - start() / stop() / join()
+// ------------------------------------------------------------
+
+void test_start_stop_join() {
+    std::cout << "[TEST] L2 start() / stop() / join()\n";
+
+    Harness h;
+    h.connect();
+
+    SessionRunner<SessionT, policy::protocol::idle::Backoff<16, 64, 10'000>> runner{h.session};
+
+    std::atomic<std::uint64_t> calls{0};
+    TEST_CHECK(runner.start([&](SessionT&) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+    }));
+    TEST_CHECK(!runner.start([](SessionT&) {}));   // Already running
+
+    while (calls.load(std::memory_order_relaxed) < 128) {
+        std::this_thread::yield();
+    }
+    runner.stop();
+    runner.join();
+
+    TEST_CHECK(!runner.is_running());
+    TEST_CHECK(runner.telemetry().loop_iterations_total.load() == calls.load());
+    TEST_CHECK(runner.telemetry().idle_iterations_total.load() == calls.load());
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// L3 - Loop exits when the session closes
+// ------------------------------------------------------------
+
+void test_exits_when_session_closes() {
+    std::cout << "[TEST] L3 Loop exits when the session closes\n";
+
+    Harness h;
+    h.connect();
+
+    SessionRunner<SessionT, policy::protocol::idle::BusySpin> runner{h.session};
+
+    std::uint64_t calls = 0;
+    runner.run([&](SessionT& s) {
+        if (++calls == 4) {
+            s.close();
+        }
+    });
+
+    // The iteration whose poll() completes the close still runs the handler
+    // (last chance to drain), then the loop exits
+    TEST_CHECK(calls == 5);
+    TEST_CHECK(!h.session.is_active());
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_run_on_calling_thread();
+    test_start_stop_join();
+    test_exits_when_session_closes();
+
+    std::cout << "\n[GROUP] Session runner tests passed!\n";
+    return 0;
+}
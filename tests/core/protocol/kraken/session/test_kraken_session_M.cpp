@@ -0,0 +1,231 @@
+/*
+===============================================================================
+ protocol::kraken::Session - Group M - SessionGroup
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • Heterogeneous sessions are polled from one thread
+  • Sessions with empty transport rings are skipped (readiness bitmap)
+  • A websocket control event (close) on an idle session makes it ready:
+    the close is handled in the very next cycle
+  • Maintenance sweeps poll every session regardless of input
+  • The group time budget stops a cycle and the next cycle resumes at the
+    first session not served (round-robin fairness)
+  • A SessionGroup can be driven by a SessionRunner
+
+===============================================================================
+*/
+
+#include <iostream>
+#include <string>
+
+#include "wirekrak/core/protocol/session_group.hpp"
+#include "wirekrak/core/protocol/runner.hpp"
+#include "common/harness/session.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core::protocol::kraken::test;
+
+// ------------------------------------------------------------
+// Utility
+// ------------------------------------------------------------
+
+static std::string trade_update(std::uint64_t trade_id) {
+    return R"({"channel":"trade","type":"update","data":[{"symbol":"BTC/USD","side":"buy","qty":0.5,"price":50000.0,"trade_id":)" +
+           std::to_string(trade_id) +
+           R"(,"timestamp":"2022-12-25T09:30:59.123456Z"}]})";
+}
+
+// Two different session types over independent message rings
+using SessionA = protocol::Session<KrakenModel, WebSocketUnderTest, MessageRingUnderTest>;
+using SessionB = protocol::Session<
+    KrakenModel, WebSocketUnderTest, MessageRingUnderTest,
+    policy::protocol::session_bundle<
+        policy::protocol::DefaultBackpressure,
+        policy::protocol::DefaultLiveness,
+        policy::protocol::DefaultProgress,
+        policy::protocol::DefaultSymbolLimit,
+        policy::protocol::DefaultReplay,
+        policy::protocol::DefaultBatching,
+        policy::protocol::DefaultFanout,
+        policy::protocol::DefaultConflation,
+        policy::protocol::CountBudget<2>
+    >
+>;
+
+struct Fixture {
+    MessageRingUnderTest ring_a{memory_pool};
+    MessageRingUnderTest ring_b{memory_pool};
+    SessionA a{ring_a};
+    SessionB b{ring_b};
+
+    Fixture() {
+        WebSocketUnderTest::reset();
+        (void)a.connect("wss://example.com/ws");
+        (void)b.connect("wss://example.com/ws");
+        for (int i = 0; i < 8; ++i) {
+            (void)a.poll();
+            (void)b.poll();
+        }
+    }
+};
+
+// No maintenance sweep during the test, except the first cycle
+constexpr std::uint64_t NO_SWEEP = 1'000'000'000'000ull;
+
+
+// ------------------------------------------------------------
+// M1 - Idle sessions are skipped
+// ------------------------------------------------------------
+
+void test_idle_sessions_skipped() {
+    std::cout << "[TEST] M1 Idle sessions are skipped\n";
+
+    Fixture f;
+    SessionGroup group{ GroupOptions{ .maintenance_interval_ns = NO_SWEEP }, f.a, f.b };
+    static_assert(decltype(group)::size() == 2);
+
+    // First cycle is a maintenance sweep
+    TEST_CHECK(group.poll() == 2);
+    TEST_CHECK(group.telemetry().maintenance_sweeps_total.load() == 1);
+
+    // Nothing pending: idle cycle
+    TEST_CHECK(group.poll() == 0);
+    TEST_CHECK(group.telemetry().idle_cycles_total.load() == 1);
+
+    // Only B has input
+    f.b.ws()->emit_message(trade_update(1));
+    TEST_CHECK(group.poll() == 1);
+    TEST_CHECK(f.b.rx_messages() == 1);
+    TEST_CHECK(f.a.rx_messages() == 0);
+
+    TEST_CHECK(group.telemetry().cycles_total.load() == 3);
+    TEST_CHECK(group.telemetry().session_polls_total.load() == 3);
+    TEST_CHECK(group.telemetry().skipped_polls_total.load() == 3);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// M1b - Control events wake an idle session
+// ------------------------------------------------------------
+
+void test_close_on_idle_session() {
+    std::cout << "[TEST] M1b Close on an idle session is handled next cycle\n";
+
+    Fixture f;
+    SessionGroup group{ GroupOptions{ .maintenance_interval_ns = NO_SWEEP }, f.a, f.b };
+    TEST_CHECK(group.poll() == 2);   // maintenance sweep
+    TEST_CHECK(group.poll() == 0);
+
+    // Remote close: only the websocket control ring holds work
+    const std::uint64_t epoch = f.a.transport_epoch();
+    f.a.ws()->emit_error(transport::Error::RemoteClosed);
+    f.a.ws()->close();
+    TEST_CHECK(f.a.has_pending_input());
+    TEST_CHECK(!f.b.has_pending_input());
+
+    // Handled in the very next cycle, without waiting for a maintenance sweep
+    TEST_CHECK(group.poll() == 1);
+    TEST_CHECK(f.a.transport_epoch() == epoch + 1);
+    TEST_CHECK(f.a.is_connected());
+    TEST_CHECK(group.telemetry().maintenance_sweeps_total.load() == 1);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// M2 - Group time budget and round-robin resume
+// ------------------------------------------------------------
+
+void test_budget_round_robin() {
+    std::cout << "[TEST] M2 Group time budget and round-robin resume\n";
+
+    Fixture f;
+    // 1 ns budget: every cycle is cut after the first session polled
+    SessionGroup group{ GroupOptions{ .maintenance_interval_ns = NO_SWEEP, .cycle_budget_ns = 1 }, f.a, f.b };
+
+    // A sweep cut by the budget completes over the following cycles
+    TEST_CHECK(group.poll() == 1);   // A
+    TEST_CHECK(group.telemetry().maintenance_sweeps_total.load() == 0);
+    TEST_CHECK(group.poll() == 1);   // B
+    TEST_CHECK(group.telemetry().maintenance_sweeps_total.load() == 1);
+
+    for (std::uint64_t i = 0; i < 4; ++i) {
+        f.a.ws()->emit_message(trade_update(10 + i));
+        f.b.ws()->emit_message(trade_update(20 + i));
+    }
+
+    // Both ready: sessions alternate, one per cycle
+    TEST_CHECK(group.poll() == 1);
+    const std::uint64_t a1 = f.a.rx_messages(), b1 = f.b.rx_messages();
+    TEST_CHECK(group.poll() == 1);
+    const std::uint64_t a2 = f.a.rx_messages(), b2 = f.b.rx_messages();
+    TEST_CHECK((a1 == 4 && b1 == 0 && a2 == 4 && b2 == 2) || (a1 == 0 && b1 == 2 && a2 == 4 && b2 == 2));
+
+    // B is bounded by its own poll budget (2 per poll): A is done, B keeps being served
+    while (f.b.rx_messages() < 4) {
+        TEST_CHECK(group.poll() == 1);
+    }
+    TEST_CHECK(f.a.rx_messages() == 4);
+    TEST_CHECK(group.poll() == 0);
+    TEST_CHECK(group.telemetry().budget_exhausted_total.load() >= 4);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// M3 - SessionRunner drives a group
+// ------------------------------------------------------------
+
+void test_runner_drives_group() {
+    std::cout << "[TEST] M3 SessionRunner drives a group\n";
+
+    Fixture f;
+    SessionGroup group{ f.a, f.b };
+    SessionRunner<decltype(group), policy::protocol::idle::BusySpin> runner{group};
+
+    for (std::uint64_t i = 0; i < 3; ++i) {
+        f.a.ws()->emit_message(trade_update(30 + i));
+        f.b.ws()->emit_message(trade_update(40 + i));
+    }
+
+    std::size_t drained = 0;
+    int iteration = 0;
+    runner.run([&](auto& g) {
+        if (++iteration == 16) {
+            runner.stop();
+        }
+        std::size_t n = 0;
+        g.for_each([&](auto& s) {
+            n += s.data_plane().template drain<schema::trade::Response>([](const auto&) {});
+        });
+        drained += n;
+        return n;
+    });
+
+    TEST_CHECK(drained == 6);
+    group.aggregate_telemetry();
+    TEST_CHECK(group.telemetry().rx_messages_total.load() == 6);
+    TEST_CHECK(runner.telemetry().loop_iterations_total.load() == 16);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_idle_sessions_skipped();
+    test_close_on_idle_session();
+    test_budget_round_robin();
+    test_runner_drives_group();
+
+    std::cout << "\n[GROUP] Session group tests passed!\n";
+    return 0;
+}
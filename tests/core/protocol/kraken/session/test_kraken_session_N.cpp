@@ -0,0 +1,215 @@
+/*
+===============================================================================
+ protocol::kraken::Session - Group N - Adaptive request batching
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • A large subscription is split into batches that are queued, not sent
+  • Emission is driven by ACK feedback: one batch in flight at first, the
+    window grows as batches are fully acknowledged (not by poll() count)
+  • A rejection shrinks the window; the subscription still converges
+  • A disconnect forgets in-flight batches
+  • A rejection of the whole request (req_id, no symbol) completes its
+    batch as failed: the next batch is not blocked
+
+===============================================================================
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "common/harness/session.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core::protocol::kraken::test;
+
+// ------------------------------------------------------------
+// Utility
+// ------------------------------------------------------------
+
+// 2 symbols per batch, rate never limits, at most 4 batches in flight
+using AdaptiveBatching = policy::protocol::AdaptiveBatchingPolicy<2, 1'000'000'000, 64, 4>;
+
+using AdaptiveBundle = policy::protocol::session_bundle<
+    policy::protocol::DefaultBackpressure,
+    policy::protocol::DefaultLiveness,
+    policy::protocol::DefaultProgress,
+    policy::protocol::DefaultSymbolLimit,
+    policy::protocol::DefaultReplay,
+    AdaptiveBatching
+>;
+
+using Harness = harness::Session<WebSocketUnderTest, MessageRingUnderTest, AdaptiveBundle>;
+
+static std::vector<Symbol> make_symbols(std::size_t n) {
+    std::vector<Symbol> symbols;
+    for (std::size_t i = 0; i < n; ++i) {
+        symbols.emplace_back(("S" + std::to_string(i) + "/USD").c_str());
+    }
+    return symbols;
+}
+
+static RequestSymbols to_request(const std::vector<Symbol>& symbols) {
+    RequestSymbols request;
+    for (const auto& s : symbols) {
+        request.push_back(s);
+    }
+    return request;
+}
+
+
+// ------------------------------------------------------------
+// N1 - Emission follows ACK feedback
+// ------------------------------------------------------------
+
+void test_ack_driven_emission() {
+    std::cout << "[TEST] N1 Emission follows ACK feedback\n";
+
+    Harness h;
+    h.connect();
+    const std::uint64_t tx0 = h.session.tx_messages();
+
+    const auto symbols = make_symbols(10);   // 5 batches
+    const auto req_id = h.subscribe_trade(to_request(symbols));
+    TEST_CHECK(req_id != ctrl::INVALID_REQ_ID);
+    TEST_CHECK(h.session.tx_messages() == tx0);
+
+    // Window 1: polling faster does not emit more
+    h.drain(16);
+    TEST_CHECK(h.session.tx_messages() == tx0 + 1);
+
+    // First batch completes on its last symbol ACK: window 2
+    h.confirm_trade_subscription(req_id, symbols[0]);
+    TEST_CHECK(h.session.tx_messages() == tx0 + 1);
+    h.confirm_trade_subscription(req_id, symbols[1]);
+    TEST_CHECK(h.session.tx_messages() == tx0 + 3);
+
+    // Two more batches complete: window 4, the last two batches go out
+    for (std::size_t i = 2; i < 6; ++i) {
+        h.confirm_trade_subscription(req_id, symbols[i]);
+    }
+    TEST_CHECK(h.session.tx_messages() == tx0 + 5);
+
+    for (std::size_t i = 6; i < 10; ++i) {
+        h.confirm_trade_subscription(req_id, symbols[i]);
+    }
+    h.drain();
+    TEST_CHECK(h.session.tx_messages() == tx0 + 5);
+    TEST_CHECK(h.session.pending_protocol_symbols() == 0);
+    TEST_CHECK(h.trade_subscriptions().active_symbols() == 10);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// N2 - Rejections shrink the window, the subscription converges
+// ------------------------------------------------------------
+
+void test_rejection_converges() {
+    std::cout << "[TEST] N2 Rejections shrink the window, the subscription converges\n";
+
+    Harness h;
+    h.connect();
+    const std::uint64_t tx0 = h.session.tx_messages();
+
+    const auto symbols = make_symbols(8);    // 4 batches
+    const auto req_id = h.subscribe_trade(to_request(symbols));
+    h.drain();
+    TEST_CHECK(h.session.tx_messages() == tx0 + 1);
+
+    // Rejected batch: no window growth, still one batch at a time
+    h.reject_trade_subscription(req_id, symbols[0]);
+    h.confirm_trade_subscription(req_id, symbols[1]);
+    h.drain();
+    TEST_CHECK(h.session.tx_messages() == tx0 + 2);
+
+    // Remaining batches complete one after the other
+    for (std::size_t i = 2; i < 8; ++i) {
+        h.confirm_trade_subscription(req_id, symbols[i]);
+        h.drain(2);
+    }
+    TEST_CHECK(h.session.tx_messages() == tx0 + 4);
+    TEST_CHECK(h.session.pending_protocol_symbols() == 0);
+    TEST_CHECK(h.trade_subscriptions().active_symbols() == 7);
+    h.drain_rejections();
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// N3 - A disconnect forgets in-flight batches
+// ------------------------------------------------------------
+
+void test_disconnect_resets_window() {
+    std::cout << "[TEST] N3 A disconnect forgets in-flight batches\n";
+
+    Harness h;
+    h.connect();
+
+    const auto symbols = make_symbols(2);    // 1 batch, never acknowledged
+    const auto req_id = h.subscribe_trade(to_request(symbols));
+    h.drain();
+    const std::uint64_t tx0 = h.session.tx_messages();
+
+    h.force_reconnect();
+    h.wait_for_epoch(2);
+
+    // The replayed batch is not blocked by the batch lost with the connection
+    h.drain();
+    TEST_CHECK(h.session.tx_messages() == tx0 + 1);
+
+    // Its ACKs complete it: the next subscription goes out
+    h.confirm_trade_subscription(req_id, symbols[0]);
+    h.confirm_trade_subscription(req_id, symbols[1]);
+    const auto more = make_symbols(4);
+    (void)h.subscribe_trade({more[2], more[3]});
+    h.drain();
+    TEST_CHECK(h.session.tx_messages() == tx0 + 2);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// N4 - A whole-request rejection completes the batch
+// ------------------------------------------------------------
+
+void test_request_rejection_releases_batch() {
+    std::cout << "[TEST] N4 A whole-request rejection completes the batch\n";
+
+    Harness h;
+    h.connect();
+    const std::uint64_t tx0 = h.session.tx_messages();
+
+    const auto symbols = make_symbols(4);    // 2 batches
+    const auto req_id = h.subscribe_trade(to_request(symbols));
+    h.drain();
+    TEST_CHECK(h.session.tx_messages() == tx0 + 1);
+
+    // Rate limited: no symbol, no per-symbol feedback will follow
+    h.session.ws()->emit_message(R"({"method":"subscribe","success":false,"req_id":)" + std::to_string(req_id) +
+                                 R"(,"error":"Exceeded msg rate"})");
+    h.drain();
+    TEST_CHECK(h.session.tx_messages() == tx0 + 2);
+    h.drain_rejections();
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_ack_driven_emission();
+    test_rejection_converges();
+    test_disconnect_resets_window();
+    test_request_rejection_releases_batch();
+
+    std::cout << "\n[GROUP] Adaptive request batching tests passed!\n";
+    return 0;
+}
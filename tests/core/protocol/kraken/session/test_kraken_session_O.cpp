@@ -0,0 +1,225 @@
+/*
+===============================================================================
+ protocol::kraken::Session - Group O - Snapshot-less replay & time-to-resync
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • Symbols marked for snapshot-less resume are replayed with snapshot=false,
+    before the snapshot-bearing part of their request (same req_id)
+  • Every replayed symbol is tracked until its subscribe ACK, which reports
+    its time-to-resync; a rejection cancels it
+  • Marks survive reconnects and are dropped by unsubscribe / rejection
+  • With scheduled batching, snapshot-less resumes are queued first
+
+===============================================================================
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "common/harness/session.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core::protocol::kraken::test;
+
+// ------------------------------------------------------------
+// Utility
+// ------------------------------------------------------------
+
+// Messages sent since `from`
+static std::vector<std::string> sent_since(std::size_t from) {
+    const auto& sent = WebSocketUnderTest::sent_messages();
+    return std::vector<std::string>(sent.begin() + static_cast<std::ptrdiff_t>(from), sent.end());
+}
+
+static bool contains(const std::string& msg, std::string_view what) {
+    return msg.find(what) != std::string::npos;
+}
+
+
+// ------------------------------------------------------------
+// O1 - Marked symbols resume first, without snapshot
+// ------------------------------------------------------------
+
+void test_snapshotless_resume() {
+    std::cout << "[TEST] O1 Marked symbols resume first, without snapshot\n";
+
+    SessionHarness h;
+    h.connect();
+
+    const auto req_id = h.subscribe_trade({"BTC/USD", "ETH/USD", "SOL/USD"});
+    h.confirm_trade_subscription(req_id, "BTC/USD");
+    h.confirm_trade_subscription(req_id, "ETH/USD");
+    h.confirm_trade_subscription(req_id, "SOL/USD");
+
+    h.session.resume_without_snapshot<schema::trade::Subscribe>("ETH/USD");
+    TEST_CHECK(h.replay_db_trade().resumes_without_snapshot("ETH/USD"));
+    TEST_CHECK(!h.replay_db_trade().resumes_without_snapshot("BTC/USD"));
+
+    const std::size_t before = WebSocketUnderTest::sent_messages().size();
+    h.force_reconnect();
+    h.wait_for_epoch(2);
+
+    const auto replay = sent_since(before);
+    TEST_CHECK(replay.size() == 2);
+    TEST_CHECK(contains(replay[0], "\"snapshot\":false"));
+    TEST_CHECK(contains(replay[0], "ETH/USD"));
+    TEST_CHECK(!contains(replay[0], "BTC/USD"));
+    TEST_CHECK(!contains(replay[1], "\"snapshot\":false"));
+    TEST_CHECK(contains(replay[1], "BTC/USD") && contains(replay[1], "SOL/USD"));
+    TEST_CHECK(!contains(replay[1], "ETH/USD"));
+    TEST_CHECK(contains(replay[0], std::to_string(req_id)) && contains(replay[1], std::to_string(req_id)));
+
+    // Stored intent is unchanged (snapshot default), mark survives the replay
+    TEST_CHECK(h.replay_db_trade().total_symbols() == 3);
+    TEST_CHECK(h.replay_db_trade().resumes_without_snapshot("ETH/USD"));
+
+    // Time-to-resync per symbol, completed by the subscribe ACK
+    TEST_CHECK(h.replay_db_trade().resyncing_symbols() == 3);
+    h.confirm_trade_subscription(req_id, "ETH/USD");
+    TEST_CHECK(h.replay_db_trade().resyncing_symbols() == 2);
+    TEST_CHECK(!h.replay_db_trade().is_resyncing("ETH/USD"));
+    TEST_CHECK(h.replay_db_trade().last_resync_ns("ETH/USD") > 0);
+    TEST_CHECK(h.replay_db_trade().last_resync_ns("BTC/USD") == 0);
+    h.confirm_trade_subscription(req_id, "BTC/USD");
+    h.confirm_trade_subscription(req_id, "SOL/USD");
+    TEST_CHECK(h.replay_db_trade().resyncing_symbols() == 0);
+    TEST_CHECK(h.trade_subscriptions().active_symbols() == 3);
+
+    // Second reconnect: same split
+    const std::size_t before2 = WebSocketUnderTest::sent_messages().size();
+    h.force_reconnect();
+    h.wait_for_epoch(3);
+    const auto replay2 = sent_since(before2);
+    TEST_CHECK(replay2.size() == 2);
+    TEST_CHECK(contains(replay2[0], "\"snapshot\":false") && contains(replay2[0], "ETH/USD"));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// O2 - Rejection cancels the resync, unsubscribe drops the mark
+// ------------------------------------------------------------
+
+void test_resync_cancel_and_marks() {
+    std::cout << "[TEST] O2 Rejection cancels the resync, unsubscribe drops the mark\n";
+
+    SessionHarness h;
+    h.connect();
+
+    const auto req_id = h.subscribe_trade({"BTC/USD", "ETH/USD"});
+    h.confirm_trade_subscription(req_id, "BTC/USD");
+    h.confirm_trade_subscription(req_id, "ETH/USD");
+    h.session.resume_without_snapshot<schema::trade::Subscribe>("BTC/USD");
+    h.session.resume_without_snapshot<schema::trade::Subscribe>("ETH/USD");
+
+    h.force_reconnect();
+    h.wait_for_epoch(2);
+    TEST_CHECK(h.replay_db_trade().resyncing_symbols() == 2);
+
+    // Rejected on replay: no resync reported, intent and mark dropped
+    h.reject_trade_subscription(req_id, "BTC/USD");
+    TEST_CHECK(!h.replay_db_trade().is_resyncing("BTC/USD"));
+    TEST_CHECK(h.replay_db_trade().last_resync_ns("BTC/USD") == 0);
+    TEST_CHECK(!h.replay_db_trade().resumes_without_snapshot("BTC/USD"));
+    TEST_CHECK(!h.replay_db_trade().contains_symbol("BTC/USD"));
+    h.drain_rejections();
+
+    h.confirm_trade_subscription(req_id, "ETH/USD");
+    TEST_CHECK(h.replay_db_trade().resyncing_symbols() == 0);
+
+    // Unsubscribe drops the mark
+    const auto unsub_id = h.unsubscribe_trade("ETH/USD");
+    h.confirm_trade_unsubscription(unsub_id, "ETH/USD");
+    TEST_CHECK(!h.replay_db_trade().resumes_without_snapshot("ETH/USD"));
+
+    // Clearing the mark restores snapshot replay
+    const auto req2 = h.subscribe_trade({"SOL/USD"});
+    h.confirm_trade_subscription(req2, "SOL/USD");
+    h.session.resume_without_snapshot<schema::trade::Subscribe>("SOL/USD");
+    h.session.resume_without_snapshot<schema::trade::Subscribe>("SOL/USD", false);
+    const std::size_t before = WebSocketUnderTest::sent_messages().size();
+    h.force_reconnect();
+    h.wait_for_epoch(3);
+    const auto replay = sent_since(before);
+    TEST_CHECK(replay.size() == 1);
+    TEST_CHECK(contains(replay[0], "SOL/USD") && !contains(replay[0], "\"snapshot\":false"));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+// ------------------------------------------------------------
+// O3 - Scheduled batching: snapshot-less resumes are queued first
+// ------------------------------------------------------------
+
+// 2 symbols per batch, rate never limits, one batch in flight at first
+using AdaptiveBatching = policy::protocol::AdaptiveBatchingPolicy<2, 1'000'000'000, 64, 4>;
+
+using AdaptiveBundle = policy::protocol::session_bundle<
+    policy::protocol::DefaultBackpressure,
+    policy::protocol::DefaultLiveness,
+    policy::protocol::DefaultProgress,
+    policy::protocol::DefaultSymbolLimit,
+    policy::protocol::DefaultReplay,
+    AdaptiveBatching
+>;
+
+void test_paced_replay_order() {
+    std::cout << "[TEST] O3 Scheduled batching: snapshot-less resumes are queued first\n";
+
+    harness::Session<WebSocketUnderTest, MessageRingUnderTest, AdaptiveBundle> h;
+    h.connect();
+
+    const RequestSymbols symbols{"A/USD", "B/USD", "C/USD", "D/USD"};
+    const auto req_id = h.subscribe_trade(symbols);
+    h.drain();
+    for (const auto& s : symbols) {
+        h.confirm_trade_subscription(req_id, s);
+    }
+    h.drain();
+    h.session.resume_without_snapshot<schema::trade::Subscribe>("D/USD");
+
+    const std::size_t before = WebSocketUnderTest::sent_messages().size();
+    h.force_reconnect();
+    h.wait_for_epoch(2);
+    h.drain();
+
+    // Window of one batch: only the snapshot-less resume is out
+    auto replay = sent_since(before);
+    TEST_CHECK(replay.size() == 1);
+    TEST_CHECK(contains(replay[0], "\"snapshot\":false") && contains(replay[0], "D/USD"));
+
+    // Its ACK releases the snapshot batches
+    h.confirm_trade_subscription(req_id, "D/USD");
+    h.drain();
+    replay = sent_since(before);
+    TEST_CHECK(replay.size() == 3);
+    TEST_CHECK(contains(replay[1], "A/USD") && contains(replay[1], "B/USD"));
+    TEST_CHECK(contains(replay[2], "C/USD"));
+    TEST_CHECK(!contains(replay[1], "\"snapshot\":false") && !contains(replay[2], "\"snapshot\":false"));
+
+    for (const char* s : {"A/USD", "B/USD", "C/USD"}) {
+        h.confirm_trade_subscription(req_id, s);
+    }
+    TEST_CHECK(h.replay_db_trade().resyncing_symbols() == 0);
+    TEST_CHECK(h.replay_db_trade().last_resync_ns("C/USD") >= h.replay_db_trade().last_resync_ns("D/USD"));
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_snapshotless_resume();
+    test_resync_cancel_and_marks();
+    test_paced_replay_order();
+
+    std::cout << "\n[GROUP] Snapshot-less replay tests passed!\n";
+    return 0;
+}
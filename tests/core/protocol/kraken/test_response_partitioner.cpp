@@ -0,0 +1,206 @@
+/*
+===============================================================================
+ response::Partitioner - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate:
+
+  • One view per symbol present in the response, in first-appearance order
+  • Trades within a view keep their response order (stable grouping)
+  • Symbols compare by value regardless of stale bytes past their size
+  • Views reflect only the current response (no stale symbols from earlier
+    resets), payload type is preserved
+  • Random responses match a reference grouping, including many distinct
+    symbols (table growth) and generation reuse across resets
+  • No heap allocation after warm-up (allocation tracer)
+
+===============================================================================
+*/
+
+#define WIREKRAK_ENABLE_ALLOC_TRACE
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "wirekrak/core/protocol/kraken/response/partitioner.hpp"
+#include "wirekrak/core/perf/alloc_trace.hpp"
+#include "wirekrak/core/perf/alloc_trace_install.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol::kraken;
+
+using Partitioner = response::Partitioner<schema::trade::Response>;
+
+
+// -----------------------------------------------------------------------------
+// Helpers
+// -----------------------------------------------------------------------------
+
+static schema::trade::Trade make_trade(std::uint64_t id, const char* symbol) {
+    schema::trade::Trade t{};
+    t.trade_id = id;
+    t.symbol = Symbol{symbol};
+    return t;
+}
+
+static schema::trade::Response make_response(PayloadType type, std::initializer_list<std::pair<std::uint64_t, const char*>> trades) {
+    schema::trade::Response r{ .type = type, .trades = {} };
+    for (const auto& [id, symbol] : trades) {
+        r.trades.push_back(make_trade(id, symbol));
+    }
+    return r;
+}
+
+// Every trade appears exactly once, grouped by symbol, in response order
+static void check_against_reference(const schema::trade::Response& r, const Partitioner& p) {
+    std::vector<std::string> order;
+    std::map<std::string, std::vector<std::uint64_t>> expected;
+    for (const auto& t : r.trades) {
+        auto& ids = expected[t.symbol.to_string()];
+        if (ids.empty()) {
+            order.push_back(t.symbol.to_string());
+        }
+        ids.push_back(t.trade_id);
+    }
+
+    TEST_CHECK(p.views().size() == order.size());
+    for (std::size_t v = 0; v < order.size(); ++v) {
+        const auto& view = p.views()[v];
+        TEST_CHECK(view.symbol == order[v]);
+        TEST_CHECK(view.type == r.type);
+        const auto& ids = expected[order[v]];
+        TEST_CHECK(view.trades.size() == ids.size());
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            TEST_CHECK(view.trades[i]->trade_id == ids[i]);
+            TEST_CHECK(view.trades[i]->symbol == view.symbol);
+        }
+    }
+}
+
+
+// -----------------------------------------------------------------------------
+// Tests
+// -----------------------------------------------------------------------------
+
+void test_grouping_and_order() {
+    std::cout << "[TEST] Views group by symbol, stable, first-appearance order...\n";
+
+    Partitioner p;
+
+    const auto r1 = make_response(PayloadType::Update,
+        {{1, "ETH/USD"}, {2, "BTC/USD"}, {3, "ETH/USD"}, {4, "SOL/USD"}, {5, "BTC/USD"}, {6, "ETH/USD"}});
+    p.reset(r1);
+    TEST_CHECK(p.views().size() == 3);
+    TEST_CHECK(p.views()[0].symbol == "ETH/USD");
+    TEST_CHECK(p.views()[1].symbol == "BTC/USD");
+    TEST_CHECK(p.views()[2].symbol == "SOL/USD");
+    TEST_CHECK(p.views()[0].trades.size() == 3);
+    TEST_CHECK(p.views()[0].trades[0]->trade_id == 1);
+    TEST_CHECK(p.views()[0].trades[1]->trade_id == 3);
+    TEST_CHECK(p.views()[0].trades[2]->trade_id == 6);
+    TEST_CHECK(p.views()[1].trades[1]->trade_id == 5);
+    TEST_CHECK(p.views()[0].is_update());
+    check_against_reference(r1, p);
+
+    // Next response: only its own symbols
+    const auto r2 = make_response(PayloadType::Snapshot, {{7, "XRP/USD"}, {8, "XRP/USD"}});
+    p.reset(r2);
+    TEST_CHECK(p.views().size() == 1);
+    TEST_CHECK(p.views()[0].symbol == "XRP/USD");
+    TEST_CHECK(p.views()[0].is_snapshot());
+    TEST_CHECK(p.views()[0].trades.size() == 2);
+
+    // Equal symbols with different bytes past size() (reused storage) are one group;
+    // symbols of capacity length compare on all 16 bytes
+    auto r3 = make_response(PayloadType::Update,
+        {{9, "BTC/USD"}, {10, "ABCDEFGHIJKLMNOP"}, {11, "ABCDEFGHIJKLMNOQ"}, {12, "BTC/USD"}});
+    r3.trades[0].symbol.assign("LONGER/SYMBOL");
+    r3.trades[0].symbol.assign("BTC/USD");
+    p.reset(r3);
+    TEST_CHECK(p.views().size() == 3);
+    TEST_CHECK(p.views()[0].symbol == "BTC/USD");
+    TEST_CHECK(p.views()[0].trades.size() == 2);
+    check_against_reference(r3, p);
+
+    const auto empty = make_response(PayloadType::Update, {});
+    p.reset(empty);
+    TEST_CHECK(p.views().empty());
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_random_reference() {
+    std::cout << "[TEST] Random responses match the reference grouping...\n";
+
+    Partitioner p;
+    std::uint64_t state = 7;
+    auto next = [&]() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    };
+
+    std::vector<std::string> symbols;
+    for (int i = 0; i < 300; ++i) {
+        symbols.push_back("S" + std::to_string(i) + "/USD");
+    }
+
+    std::uint64_t id = 0;
+    for (int round = 0; round < 2000; ++round) {
+        schema::trade::Response r{ .type = (round & 1) ? PayloadType::Update : PayloadType::Snapshot, .trades = {} };
+        const std::uint32_t distinct = 1 + next() % ((round % 10 == 0) ? 300 : 5);
+        const std::uint32_t n = 1 + next() % 400;
+        for (std::uint32_t i = 0; i < n; ++i) {
+            r.trades.push_back(make_trade(++id, symbols[next() % distinct].c_str()));
+        }
+        p.reset(r);
+        check_against_reference(r, p);
+    }
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_no_allocation_after_warmup() {
+    std::cout << "[TEST] No heap allocation after warm-up...\n";
+
+    using perf::alloc_trace::Thread;
+
+    Partitioner p;
+    const auto multi = make_response(PayloadType::Update,
+        {{1, "ETH/USD"}, {2, "BTC/USD"}, {3, "ETH/USD"}, {4, "SOL/USD"}, {5, "ADA/USD"}, {6, "ETH/USD"}});
+    const auto single = make_response(PayloadType::Update, {{7, "BTC/USD"}, {8, "BTC/USD"}});
+
+    p.reset(multi);     // warm-up: buffers reach their working capacity
+    p.reset(single);
+
+    perf::alloc_trace::tag_thread(Thread::Session);
+    const auto before = perf::alloc_trace::snapshot();
+    std::size_t views = 0;
+    for (int i = 0; i < 10000; ++i) {
+        p.reset((i & 1) ? single : multi);
+        views += p.views().size();
+    }
+    const auto delta = perf::alloc_trace::snapshot() - before;
+    perf::alloc_trace::tag_thread(Thread::Untagged);
+
+    TEST_CHECK(views == 5000 * 4 + 5000 * 1);
+    TEST_CHECK(delta.allocations(Thread::Session) == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_grouping_and_order();
+    test_random_reference();
+    test_no_allocation_after_warmup();
+
+    std::cout << "\n[GROUP] Response partitioner tests passed!\n";
+    return 0;
+}
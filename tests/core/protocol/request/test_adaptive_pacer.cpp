@@ -0,0 +1,260 @@
+/*
+===============================================================================
+ protocol::request::AdaptivePacer - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate (synthetic clock, no session):
+
+  • Token bucket: burst admits back-to-back batches, then emission follows
+    the configured rate regardless of how often can_send() is called
+  • In-flight window: starts at one batch, doubles per round trip (slow
+    start) up to max_in_flight
+  • Failures halve the window once per round trip and empty the bucket
+  • A batch completes after one ACK per symbol; RTT is measured from its
+    emission; growth holds while the RTT is inflated
+  • Feedback with nothing in flight is ignored; reset() restores the
+    initial state
+  • Batches without feedback expire after the RTO as congestion (backed
+    off per expiry, restored by the next RTT sample); a whole-request
+    rejection fails and completes the oldest batch
+
+===============================================================================
+*/
+
+#include <cstdint>
+#include <iostream>
+
+#include "wirekrak/core/policy/protocol/batching.hpp"
+#include "wirekrak/core/protocol/request/pacer.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core;
+
+constexpr std::uint64_t MS = 1'000'000ULL;
+
+// 100 batches/s (one token every 10 ms), burst 2
+using RatePolicy = policy::protocol::AdaptiveBatchingPolicy<10, 100, 2, 8>;
+// Rate never limits
+using WindowPolicy = policy::protocol::AdaptiveBatchingPolicy<10, 1'000'000'000, 64, 8>;
+
+static_assert(policy::protocol::BatchingConcept<RatePolicy>);
+static_assert(policy::protocol::is_scheduled_batching_v<RatePolicy>);
+static_assert(!policy::protocol::is_scheduled_batching_v<policy::protocol::ImmediateBatching>);
+
+
+// Sends one single-symbol batch and acknowledges it at `now`
+template<class Pacer>
+static void send_and_ack(Pacer& p, std::uint64_t now) {
+    p.on_sent(now, 1);
+    (void)p.on_ack(now + 1, true);
+}
+
+
+void test_token_bucket() {
+    std::cout << "[TEST] Token bucket: burst, then rate-limited...\n";
+
+    protocol::request::AdaptivePacer<RatePolicy> p;
+    std::uint64_t now = 1'000 * MS;
+
+    // Bucket starts full: two batches back to back
+    TEST_CHECK(p.can_send(now));
+    send_and_ack(p, now);
+    TEST_CHECK(p.can_send(now));
+    send_and_ack(p, now);
+    TEST_CHECK(p.window() == 3);
+
+    // Empty bucket: polling faster does not help
+    for (int i = 0; i < 1000; ++i) {
+        TEST_CHECK(!p.can_send(now + 5 * MS));
+    }
+
+    // One token after 10 ms
+    now += 10 * MS;
+    TEST_CHECK(p.can_send(now));
+    send_and_ack(p, now);
+    TEST_CHECK(!p.can_send(now + 1));
+
+    // A long pause refills up to the burst only
+    now += 10'000 * MS;
+    TEST_CHECK(p.can_send(now));
+    send_and_ack(p, now);
+    TEST_CHECK(p.can_send(now));
+    send_and_ack(p, now);
+    TEST_CHECK(!p.can_send(now));
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_window_slow_start() {
+    std::cout << "[TEST] Window doubles per round trip up to max_in_flight...\n";
+
+    protocol::request::AdaptivePacer<WindowPolicy> p;
+    std::uint64_t now = 1'000 * MS;
+
+    TEST_CHECK(p.window() == 1);
+    const std::size_t expected[] = {1, 2, 4, 8, 8};
+    for (std::size_t round : expected) {
+        // Fill the window
+        std::size_t sent = 0;
+        while (p.can_send(now)) {
+            p.on_sent(now, 1);
+            ++sent;
+        }
+        TEST_CHECK(sent == round);
+        TEST_CHECK(p.in_flight() == round);
+
+        // One round trip later, every batch is acknowledged
+        now += 5 * MS;
+        for (std::size_t i = 0; i < sent; ++i) {
+            TEST_CHECK(p.on_ack(now, true) == 5 * MS);
+        }
+        TEST_CHECK(p.in_flight() == 0);
+    }
+    TEST_CHECK(p.window() == 8);
+    TEST_CHECK(p.srtt_ns() == 5 * MS);
+    TEST_CHECK(p.congestion_events() == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_congestion() {
+    std::cout << "[TEST] Failures halve the window once per round trip...\n";
+
+    protocol::request::AdaptivePacer<WindowPolicy> p;
+    std::uint64_t now = 1'000 * MS;
+
+    // Grow to the maximum window
+    for (std::size_t i = 0; i < 16; ++i) {
+        send_and_ack(p, now);
+    }
+    TEST_CHECK(p.window() == 8);
+
+    // Full window in flight, every batch rejected
+    for (std::size_t i = 0; i < 8; ++i) {
+        TEST_CHECK(p.can_send(now));
+        p.on_sent(now, 1);
+    }
+    now += 1 * MS;
+    for (std::size_t i = 0; i < 8; ++i) {
+        (void)p.on_ack(now, false);
+    }
+    TEST_CHECK(p.congestion_events() == 1);
+    TEST_CHECK(p.window() == 4);    // failed batches do not grow it back
+
+    // Bucket was emptied: nothing until it refills
+    TEST_CHECK(!p.can_send(now));
+    now += 1 * MS;
+    TEST_CHECK(p.can_send(now));
+
+    // A batch sent after the reduction is a new signal
+    p.on_sent(now, 1);
+    (void)p.on_ack(now + 1, false);
+    TEST_CHECK(p.congestion_events() == 2);
+    TEST_CHECK(p.window() == 2);
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_batch_completion_and_reset() {
+    std::cout << "[TEST] Batches complete after one ACK per symbol, reset...\n";
+
+    protocol::request::AdaptivePacer<WindowPolicy> p;
+    std::uint64_t now = 1'000 * MS;
+
+    // Nothing in flight: ignored
+    TEST_CHECK(p.on_ack(now, true) == 0);
+    TEST_CHECK(p.on_ack(now, false) == 0);
+    TEST_CHECK(p.congestion_events() == 0);
+
+    p.on_sent(now, 3);
+    TEST_CHECK(p.on_ack(now + 1 * MS, true) == 0);
+    TEST_CHECK(p.on_ack(now + 2 * MS, true) == 0);
+    TEST_CHECK(p.on_ack(now + 3 * MS, true) == 3 * MS);
+    TEST_CHECK(p.in_flight() == 0);
+    TEST_CHECK(p.window() == 2);
+
+    // Inflated RTT (exchange queueing): the window holds
+    now += 10 * MS;
+    p.on_sent(now, 1);
+    TEST_CHECK(p.on_ack(now + 20 * MS, true) == 20 * MS);
+    TEST_CHECK(p.window() == 2);
+
+    // Connection lost
+    p.on_sent(now, 1);
+    p.on_sent(now, 1);
+    TEST_CHECK(p.in_flight() == 2);
+    p.reset();
+    TEST_CHECK(p.in_flight() == 0);
+    TEST_CHECK(p.window() == 1);
+    TEST_CHECK(p.srtt_ns() == 0);
+    TEST_CHECK(p.can_send(now));
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_timeout_and_batch_rejection() {
+    std::cout << "[TEST] Lost ACKs expire after the RTO, whole-batch rejections...\n";
+
+    protocol::request::AdaptivePacer<WindowPolicy> p;
+    std::uint64_t now = 1'000 * MS;
+    TEST_CHECK(p.rto_ns() == 1'000 * MS);     // before the first sample
+
+    // Tiny RTT samples: RTO clamped to its 200 ms floor, window 3
+    send_and_ack(p, now);
+    send_and_ack(p, now);
+    TEST_CHECK(p.rto_ns() == 200 * MS);
+    TEST_CHECK(p.window() == 3);
+
+    // Full window in flight, every ACK lost
+    for (std::size_t i = 0; i < 3; ++i) {
+        TEST_CHECK(p.can_send(now));
+        p.on_sent(now, 2);
+    }
+    TEST_CHECK(!p.can_send(now + 199 * MS));
+    TEST_CHECK(p.in_flight() == 3);
+
+    // Oldest batch expires as congestion, the RTO backs off
+    TEST_CHECK(!p.can_send(now + 200 * MS));
+    TEST_CHECK(p.timeouts() == 1 && p.in_flight() == 2);
+    TEST_CHECK(p.congestion_events() == 1 && p.window() == 1);
+    TEST_CHECK(p.rto_ns() == 400 * MS);
+
+    // Same round trip: expired without a second reduction
+    TEST_CHECK(!p.can_send(now + 400 * MS));
+    TEST_CHECK(p.can_send(now + 800 * MS));
+    TEST_CHECK(p.timeouts() == 3 && p.in_flight() == 0);
+    TEST_CHECK(p.congestion_events() == 1);
+
+    // The next sample restores the RTO
+    now += 800 * MS;
+    p.on_sent(now, 1);
+    TEST_CHECK(p.on_ack(now + 5 * MS, true) == 5 * MS);
+    TEST_CHECK(p.rto_ns() == 200 * MS);
+
+    // Whole request rejected (no symbol): the batch fails and completes
+    TEST_CHECK(p.on_batch_rejected(now) == 0);      // nothing in flight
+    now += 10 * MS;
+    TEST_CHECK(p.can_send(now));
+    p.on_sent(now, 5);
+    TEST_CHECK(p.on_batch_rejected(now + 2 * MS) == 2 * MS);
+    TEST_CHECK(p.in_flight() == 0);
+    TEST_CHECK(p.congestion_events() == 2);
+    TEST_CHECK(p.timeouts() == 3);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_token_bucket();
+    test_window_slow_start();
+    test_congestion();
+    test_batch_completion_and_reset();
+    test_timeout_and_batch_rejection();
+
+    std::cout << "\n[GROUP] Adaptive pacer tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,221 @@
+/*
+===============================================================================
+ protocol::subscription::PendingRequests - Unit Tests
+===============================================================================
+
+Scope:
+------
+
+These tests validate the flat, SymbolId-indexed pending index:
+
+  • Global symbol uniqueness across requests, per-request symbol lists in
+    insertion order, empty requests are erased
+  • remove(req_id, sid) only matches the owning request, remove(sid)
+    finds the owner in O(1)
+  • Random operation sequences match a reference model (many concurrent
+    requests: request table growth and backward-shift deletion)
+  • No heap allocation after construction (allocation tracer)
+
+===============================================================================
+*/
+
+#define WIREKRAK_ENABLE_ALLOC_TRACE
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "wirekrak/core/protocol/subscription/pending_requests.hpp"
+#include "wirekrak/core/perf/alloc_trace.hpp"
+#include "wirekrak/core/perf/alloc_trace_install.hpp"
+#include "common/test_check.hpp"
+
+using namespace wirekrak::core;
+using namespace wirekrak::core::protocol;
+using subscription::PendingRequests;
+
+
+static RequestSymbolIds ids(std::initializer_list<SymbolId> list) {
+    RequestSymbolIds out;
+    for (auto sid : list) {
+        out.push_back(sid);
+    }
+    return out;
+}
+
+
+void test_basic_semantics() {
+    std::cout << "[TEST] Uniqueness, ownership and request lifetime...\n";
+
+    PendingRequests p;
+    p.add(10, ids({1, 2, 3}));
+    p.add(11, ids({3, 4}));      // 3 already pending under 10
+    p.add(12, ids({1, 2}));      // fully duplicated: no request entry
+
+    TEST_CHECK(p.count() == 2);
+    TEST_CHECK(p.symbol_count() == 4);
+    TEST_CHECK(!p.contains_request(12));
+
+    RequestSymbolIds out;
+    TEST_CHECK(p.symbols_of(10, out));
+    TEST_CHECK(out.size() == 3 && out[0] == 1 && out[1] == 2 && out[2] == 3);
+    TEST_CHECK(p.symbols_of(11, out));
+    TEST_CHECK(out.size() == 1 && out[0] == 4);
+    TEST_CHECK(!p.symbols_of(12, out));
+
+    // Wrong owner
+    TEST_CHECK(!p.remove(11, 2));
+    TEST_CHECK(p.contains(2));
+
+    // Middle removal keeps the order of the rest
+    TEST_CHECK(p.remove(10, 2));
+    TEST_CHECK(!p.remove(10, 2));
+    TEST_CHECK(p.symbols_of(10, out));
+    TEST_CHECK(out.size() == 2 && out[0] == 1 && out[1] == 3);
+
+    // Global removal, request erased when empty
+    TEST_CHECK(p.remove(4));
+    TEST_CHECK(!p.contains_request(11));
+    TEST_CHECK(p.count() == 1);
+
+    // Existing request accepts more symbols
+    p.add(10, ids({5}));
+    TEST_CHECK(p.symbols_of(10, out));
+    TEST_CHECK(out.size() == 3 && out[2] == 5);
+
+    p.clear();
+    TEST_CHECK(p.empty());
+    TEST_CHECK(p.symbol_count() == 0);
+    TEST_CHECK(!p.contains(1));
+    TEST_CHECK(!p.contains_request(10));
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_random_reference() {
+    std::cout << "[TEST] Random operations match the reference model...\n";
+
+    PendingRequests p;
+    std::map<ctrl::req_id_t, std::vector<SymbolId>> model;
+    std::map<SymbolId, ctrl::req_id_t> owner;
+
+    std::uint64_t state = 11;
+    auto next = [&]() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    };
+
+    ctrl::req_id_t next_req = 10;
+    for (int step = 0; step < 200000; ++step) {
+        const std::uint32_t op = next() % 10;
+        if (op < 3) {
+            // New request with a few symbols
+            const ctrl::req_id_t req_id = next_req++;
+            RequestSymbolIds sids;
+            const std::uint32_t n = 1 + next() % 6;
+            for (std::uint32_t i = 0; i < n; ++i) {
+                sids.push_back(next() % 512);
+            }
+            p.add(req_id, sids);
+            for (auto sid : sids) {
+                if (!owner.contains(sid)) {
+                    owner[sid] = req_id;
+                    model[req_id].push_back(sid);
+                }
+            }
+        }
+        else if (op < 7) {
+            // ACK: remove(req_id, sid), sometimes with a wrong req_id
+            const SymbolId sid = next() % 512;
+            auto it = owner.find(sid);
+            const ctrl::req_id_t req_id = (it != owner.end() && next() % 4 != 0) ? it->second : next_req + 1;
+            const bool expected = it != owner.end() && it->second == req_id;
+            TEST_CHECK(p.remove(req_id, sid) == expected);
+            if (expected) {
+                auto& v = model[req_id];
+                v.erase(std::find(v.begin(), v.end(), sid));
+                if (v.empty()) {
+                    model.erase(req_id);
+                }
+                owner.erase(it);
+            }
+        }
+        else if (op < 9) {
+            // Global removal
+            const SymbolId sid = next() % 512;
+            auto it = owner.find(sid);
+            TEST_CHECK(p.remove(sid) == (it != owner.end()));
+            if (it != owner.end()) {
+                auto& v = model[it->second];
+                v.erase(std::find(v.begin(), v.end(), sid));
+                if (v.empty()) {
+                    model.erase(it->second);
+                }
+                owner.erase(it);
+            }
+        }
+        else if (next() % 500 == 0) {
+            p.clear();
+            model.clear();
+            owner.clear();
+        }
+
+        TEST_CHECK(p.count() == model.size());
+        TEST_CHECK(p.symbol_count() == owner.size());
+        if (step % 1000 == 0) {
+            RequestSymbolIds out;
+            for (const auto& [req_id, v] : model) {
+                TEST_CHECK(p.symbols_of(req_id, out));
+                TEST_CHECK(out.size() == v.size());
+                for (std::size_t i = 0; i < v.size(); ++i) {
+                    TEST_CHECK(out[i] == v[i]);
+                }
+            }
+#ifndef NDEBUG
+            p.assert_consistency();
+#endif
+        }
+    }
+
+    std::cout << "[TEST] OK\n";
+}
+
+void test_no_allocation() {
+    std::cout << "[TEST] No heap allocation after construction...\n";
+
+    using perf::alloc_trace::Thread;
+
+    PendingRequests p;
+    RequestSymbolIds sids;
+    for (SymbolId sid = 0; sid < MAX_REQUEST_SYMBOLS; ++sid) {
+        sids.push_back(sid);
+    }
+
+    perf::alloc_trace::tag_thread(Thread::Session);
+    const auto before = perf::alloc_trace::snapshot();
+    for (ctrl::req_id_t round = 1; round <= 100; ++round) {
+        p.add(round, sids);
+        for (SymbolId sid = 0; sid < MAX_REQUEST_SYMBOLS; ++sid) {
+            (void)p.remove(round, sid);
+        }
+    }
+    const auto delta = perf::alloc_trace::snapshot() - before;
+    perf::alloc_trace::tag_thread(Thread::Untagged);
+
+    TEST_CHECK(p.empty());
+    TEST_CHECK(delta.allocations(Thread::Session) == 0);
+
+    std::cout << "[TEST] OK\n";
+}
+
+
+int main() {
+    test_basic_semantics();
+    test_random_reference();
+    test_no_allocation();
+
+    std::cout << "\n[GROUP] Pending requests tests passed!\n";
+    return 0;
+}
@@ -33,10 +33,12 @@ avoiding timing assumptions and relying only on observable transport invariants.
 #include <iostream>
 #include <cstring>
 #include <algorithm>
+#include <chrono>
 
 #include "wirekrak/core/transport/websocket_concept.hpp"
 #include "wirekrak/core/transport/websocket/engine.hpp"
 #include "wirekrak/core/policy/transport/websocket_bundle.hpp"
+#include "lcr/system/event_notifier.hpp"
 #include "wirekrak/core/preset/control_ring_default.hpp"
 #include "wirekrak/core/preset/message_ring_default.hpp"
 #include "lcr/memory/block_pool.hpp"
@@ -149,6 +151,46 @@ using WebSocketUnderTest =
 // Assert that WebSocketUnderTest conforms to transport::WebSocketConcept concept
 static_assert(WebSocketConcept<WebSocketUnderTest>);
 
+using NotifyingWebSocketUnderTest =
+    websocket::Engine<
+        ControlRingUnderTest,
+        MessageRingUnderTest,
+        policy::transport::websocket_bundle<
+            policy::transport::DefaultBackpressure,
+            policy::transport::notification::EventFd
+        >,
+        test::TestBackend
+    >;
+
+static_assert(WebSocketConcept<NotifyingWebSocketUnderTest>);
+static_assert(NotifyingWebSocketUnderTest::notifies && !WebSocketUnderTest::notifies);
+
+// Frame filter dropping "noise" messages on the receive thread
+struct NoiseFilter {
+    static constexpr bool enabled = true;
+    static bool drop(std::string_view frame) noexcept {
+        return frame == "noise";
+    }
+    static void dump(std::ostream& os) {
+        os << "[Transport Frame Filter Policy]\n- Mode        : NoiseFilter\n\n";
+    }
+};
+
+using FilteringWebSocketUnderTest =
+    websocket::Engine<
+        ControlRingUnderTest,
+        MessageRingUnderTest,
+        policy::transport::websocket_bundle<
+            policy::transport::DefaultBackpressure,
+            policy::transport::DefaultNotification,
+            NoiseFilter
+        >,
+        test::TestBackend
+    >;
+
+static_assert(WebSocketConcept<FilteringWebSocketUnderTest>);
+static_assert(FilteringWebSocketUnderTest::filters && !WebSocketUnderTest::filters);
+
 // -------------------------------------------------------------------------
 // Golbal control SPSC ring buffer (transport → session)
 // -----------------------------------------------------------------------------
@@ -645,6 +687,133 @@ void test_invalid_fragment_zero_bytes() {
 // Entry point
 // -----------------------------------------------------------------------------
 
+void test_eventfd_notification_edge() {
+    std::cout << "[TEST] Running eventfd notification edge test..." << std::endl;
+
+    // Reset global rings before test
+    control_ring.clear();
+    message_ring.clear();
+
+    lcr::system::event_notifier notifier;
+    assert(notifier.open());
+    assert(notifier.fd() >= 0);
+
+    telemetry::WebSocket telemetry;
+    NotifyingWebSocketUnderTest ws(control_ring, message_ring, telemetry);
+    ws.set_notifier(&notifier);
+
+    // --- Simulate a burst of three messages + close ---
+    auto& backend = ws.test_backend();
+    for (const char* payload : {"msg1", "msg2", "msg3"}) {
+        backend.payloads.push(payload);
+        backend.results.push({
+            .status = websocket::ReceiveStatus::Ok,
+            .bytes  = 4,
+            .frame  = websocket::FrameType::Message
+        });
+    }
+    backend.results.push({
+        .status = websocket::ReceiveStatus::Ok,
+        .bytes  = 0,
+        .frame  = websocket::FrameType::Close
+    });
+
+    // Consumer is idle: arm before sleeping
+    notifier.arm();
+    ws.test_start_receive_loop();
+
+    // The first commit wakes the consumer
+    assert(notifier.wait(std::chrono::milliseconds{2000}));
+
+    // Wait until the whole burst (and close) has been read
+    while (backend.read_count < 4) {
+        std::this_thread::yield();
+    }
+    ws.close();
+
+    // Edge-triggered: the rest of the burst did not signal again
+    assert(!notifier.wait(std::chrono::milliseconds{0}));
+
+    int count = 0;
+    while (auto* slot = ws.peek_message()) {
+        ws.release_message(slot);
+        ++count;
+    }
+    assert(count == 3);
+
+    std::cout << "[TEST] Done." << std::endl;
+}
+
+
+void test_frame_filter_drops_before_ring() {
+    std::cout << "[TEST] Running frame filter test..." << std::endl;
+
+    // Reset global rings before test
+    control_ring.clear();
+    message_ring.clear();
+
+    telemetry::WebSocket telemetry;
+    FilteringWebSocketUnderTest ws(control_ring, message_ring, telemetry);
+
+    // --- Simulate noise / data / fragmented noise / data + close ---
+    auto& backend = ws.test_backend();
+    for (const char* payload : {"noise", "msg1"}) {
+        backend.payloads.push(payload);
+        backend.results.push({
+            .status = websocket::ReceiveStatus::Ok,
+            .bytes  = std::strlen(payload),
+            .frame  = websocket::FrameType::Message
+        });
+    }
+    backend.payloads.push("noi");
+    backend.results.push({
+        .status = websocket::ReceiveStatus::Ok,
+        .bytes  = 3,
+        .frame  = websocket::FrameType::Fragment
+    });
+    backend.payloads.push("se");
+    backend.results.push({
+        .status = websocket::ReceiveStatus::Ok,
+        .bytes  = 2,
+        .frame  = websocket::FrameType::Message
+    });
+    backend.payloads.push("msg2");
+    backend.results.push({
+        .status = websocket::ReceiveStatus::Ok,
+        .bytes  = 4,
+        .frame  = websocket::FrameType::Message
+    });
+    backend.results.push({
+        .status = websocket::ReceiveStatus::Ok,
+        .bytes  = 0,
+        .frame  = websocket::FrameType::Close
+    });
+
+    ws.test_start_receive_loop();
+
+    // Wait until every frame (and close) has been read
+    while (backend.read_count < 6) {
+        std::this_thread::yield();
+    }
+    ws.close();
+
+    // Only data messages reached the ring, in order
+    const char* expected[] = {"msg1", "msg2"};
+    int count = 0;
+    while (auto* slot = ws.peek_message()) {
+        assert(count < 2);
+        assert(slot->size() == 4);
+        assert(std::memcmp(slot->data(), expected[count], 4) == 0);
+        ws.release_message(slot);
+        ++count;
+    }
+    assert(count == 2);
+    assert(ws.filtered_messages() == 2);
+
+    std::cout << "[TEST] Done." << std::endl;
+}
+
+
 int main() {   
     // The WebSocket transport is fully unit-tested for message delivery,
     // error handling, close semantics, callback ordering, idempotent shutdown
@@ -660,6 +829,8 @@ int main() {
     test_multiple_messages();
     test_fragment_assembly();
     test_invalid_fragment_zero_bytes();
+    test_eventfd_notification_edge();
+    test_frame_filter_drops_before_ring();
 
     std::cout << "[TEST] ALL TRANSPORT TESTS PASSED!" << std::endl;
     return 0;